@@ -1,7 +1,14 @@
+#define _POSIX_C_SOURCE 200112L  /* clock_gettime, pthreads */
+
 #include "pbg.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+#include <time.h>
+#ifdef PBG_THREADS
+#include <pthread.h>
+#endif
 
 /*****************************
  *                           *
@@ -10,34 +17,107 @@
  *****************************/
 
 /* LITERAL REPRESENTATIONS */
+/* See pbg.h. */
+
+/* ERROR REPRESENTATIONS */
+#define PBG_ERR_CONTEXT 32  /* Characters of input shown with a syntax error. */
+
 typedef struct {
-	double _val;
-} pbg_lt_number;  /* PBG_LT_NUMBER */
+	int             _children[2];  /* Children, as for any binary operator. */
+	pbg_field_type  _op;           /* Comparison operator which was fused. */
+	pbg_field_type  _cmp;          /* Same comparison, variable first. */
+	int             _var;          /* Index of the variable. */
+	int             _strict;       /* Whether the variable's type is declared. */
+	pbg_field       _const;        /* Constant, sharing its data. */
+	pbg_lt_number   _number;       /* Inline copy of a NUMBER constant. */
+	pbg_lt_date     _date;         /* Inline copy of a DATE constant. */
+} pbg_fused;  /* Data of PBG_FU_NUMBER, PBG_FU_DATE, and PBG_FU_STRING. */
 
+/* EVALUATION STATE */
 typedef struct {
-	unsigned int  _YYYY;  /* year */
-	unsigned int  _MM;    /* month */
-	unsigned int  _DD;    /* day */
-} pbg_lt_date;  /* PBG_LT_DATE */
+	pbg_field  (*_resolve)(void*, int);  /* Resolves a variable by index. */
+	void*        _ctx;                   /* Context given to _resolve. */
+} pbg_resolver;  /* Data of unresolved variables, see pbg_evaluate_lazy. */
+#define PBG_LAZY  -1  /* _int of unresolved variables, unlike any name length. */
 
-typedef char pbg_lt_string; /* PBG_LT_STRING */
+typedef struct {
+	pbg_field*  _field;  /* Field being evaluated. */
+	pbg_field*  _child;  /* Child to evaluate before resuming the field. */
+	int         _next;   /* Position of _child among the children. */
+	int         _first;  /* Result of the first child, for comparisons. */
+#ifdef PBG_PROFILE
+	double      _start;  /* Time at which the evaluation began. */
+#endif
+} pbg_frame;  /* Field under evaluation, see pbg_evaluate_r. */
+
+typedef struct {
+	long    _visits;    /* Fields left to begin, or -1 if unbounded. */
+	double  _deadline;  /* Time by which to finish, or 0 if unbounded. */
+	int     _check;     /* Fields to begin before reading the clock. */
+} pbg_budget;  /* Budget of an evaluation, see pbg_evaluate_budget. */
+
+#ifdef PBG_THREADS
+/* PARALLEL EVALUATION STATE */
+struct pbg_parallel;
+
+/* Number of records a worker takes from its range at once. Ranges are split 
+ * at multiples of 8 so that no two workers write the same byte of the bitmap
+ * of matches. */
+#define PBG_MORSEL 1024
 
-/* ERROR REPRESENTATIONS */
 typedef struct {
-	int              _arity;  /* Number of arguments given to operator. */
-	pbg_field_type  _type;    /* Type of operator involved in error. */
-} pbg_op_arity_err;  /* PBG_ERR_OP_ARITY. */
+	int    _count;                      /* Number of selected rows. */
+	int    _dense;                      /* Whether rows are held in _bits. */
+	unsigned char  _bits[PBG_MORSEL/8]; /* Bit i is set if row i is selected. */
+	short          _rows[PBG_MORSEL];   /* Selected rows, in increasing order. */
+} pbg_selection;  /* Rows of a morsel left to evaluate, see pbg_worker_select. */
 
 typedef struct {
-	char*  _msg;  /* Description of syntax error. */
-	char*  _str;  /* String in which error occurred. */
-	int    _i;    /* Index of error in string. */
-} pbg_syntax_err;  /* PBG_ERR_SYNTAX */
+	struct pbg_parallel*  _par;     /* Evaluation this worker is part of. */
+	int                   _id;      /* Index of the worker. */
+	pthread_t             _thread;  /* Thread running the worker. */
+	pthread_mutex_t       _lock;    /* Guards _begin and _end. */
+	long                  _begin;   /* Next record of the worker's range. */
+	long                  _end;     /* End of the worker's range. */
+	long                  _morsel;  /* First record of the morsel. */
+	long                  _record;  /* Record being evaluated. */
+	long                  _numtrue; /* Number of TRUE records. */
+	pbg_expr              _bound;   /* Expression bound to _vars. */
+	pbg_field*            _vars;    /* Variables of the record. */
+	pbg_resolver          _resolver;   /* Resolves _vars from the batch. */
+	int*                  _touched;    /* Variables resolved for the record. */
+	int                   _numtouched; /* Number of variables in _touched. */
+	pbg_selection*        _sels;    /* Selections, one per level of AND/OR. */
+	signed char*          _results; /* Result of each row of the morsel. */
+	int*                  _matched; /* Rule matched by each row, or -1. */
+	pbg_error             _err;     /* First error encountered, if any. */
+} pbg_worker;
+
+typedef struct pbg_parallel {
+	pbg_expr*    _expr;        /* Expression being evaluated, or NULL. */
+	pbg_ruleset* _ruleset;     /* Rule set being evaluated, or NULL. */
+	pbg_batch*   _batch;       /* Batch being evaluated. */
+	pbg_worker*  _workers;     /* Workers, one per thread. */
+	int          _numworkers;  /* Number of workers. */
+} pbg_parallel;
+
+/* HOT RELOAD STATE */
+typedef struct pbg_version {
+	pbg_ruleset          _rs;       /* Rule set of the version. */
+	long                 _number;   /* Number of the version. */
+	unsigned long        _retired;  /* Epoch at which it was replaced. */
+	struct pbg_version*  _next;     /* Next older retired version. */
+} pbg_version;  /* Version published by pbg_reload_publish. */
+#endif
 
+/* COMPILATION STATE */
 typedef struct {
-	char*  _field;  /* String representing the unknown type. */
-	int    _n;      /* Length of field. */
-} pbg_unknown_type_err;  /* PBG_ERR_UNKNOWN_TYPE */
+	char*   _buf;   /* Buffer the source is written to. */
+	size_t  _size;  /* Size of _buf. */
+	size_t  _len;   /* Length of the source, even if truncated. */
+	char*   _name;  /* Name of the compiled function. */
+	int     _uses;  /* Helpers used by the source, see PBG_USE_FAIL. */
+} pbg_compiler;  /* Source being generated, see pbg_compile. */
 
 
 /****************************
@@ -47,21 +127,26 @@ typedef struct {
  ****************************/
 
 /* ERROR MANAGEMENT */
-void pbg_err_init(pbg_error* err, pbg_error_type type, int line, char* file, int size, void* data);
+void pbg_err_init(pbg_error* err, pbg_error_type type, int line, char* file);
 void pbg_err_alloc(pbg_error* err, int line, char* file);
 void pbg_err_unknown_type(pbg_error* err, int line, char* file, char* field, int n);
-void pbg_err_syntax(pbg_error* err, int line, char* file, char* str, int i, char* msg);
+void pbg_err_syntax(pbg_error* err, int line, char* file, char* str, size_t i, char* msg);
 void pbg_err_op_arity(pbg_error* err, int line, char* file, pbg_field_type type, int arity);
 void pbg_err_state(pbg_error* err, int line, char* file, char* msg);
+void pbg_err_budget(pbg_error* err, int line, char* file);
 void pbg_err_op_arg_type(pbg_error* err, int line, char* file, char* msg);
 char* pbg_error_str(pbg_error_type type);
 char* pbg_field_type_str(pbg_field_type type);
+size_t pbg_format_str(char* buf, size_t size, size_t len, char* str, size_t n);
+size_t pbg_format_int(char* buf, size_t size, size_t len, long value);
  
 /* FIELD MANAGEMENT */
 pbg_field* pbg_field_get(pbg_expr* e, int index);
 void pbg_field_free(pbg_field* field);
 int pbg_store_constant(pbg_expr* e, pbg_field field);
-int pbg_store_variable(pbg_expr* e, pbg_field field);
+int pbg_store_variable(pbg_expr* e, pbg_field field, int** slots, int* numslots);
+int pbg_index_variables(pbg_expr* e, int** slots, int* numslots);
+unsigned long pbg_hash_name(char* str, int n);
 
 /* FIELD CREATION TOOLKIT */
 pbg_field pbg_field_init(pbg_field_type type, int size, void* data);
@@ -72,23 +157,280 @@ pbg_field pbg_parse_number(pbg_error* err, char* str, int n);
 pbg_field pbg_parse_string(pbg_error* err, char* str, int n);
 
 /* FIELD PARSING TOOLKIT */
+#define PBG_MAX_FIELDS  (INT_MAX/2)  /* Fields are indexed by signed ints. */
+int pbg_parse_literal(pbg_expr* e, pbg_error* err, pbg_field_type type, 
+		char* str, int n, int** slots, int* numslots);
 int pbg_check_op_arity(pbg_field_type type, int numargs);
+void pbg_fuse(pbg_expr* e);
+pbg_field_type pbg_flip_op(pbg_field_type type);
+
+/* STREAMING PARSER */
+#define PBG_TOK_NONE    0  /* Between tokens. */
+#define PBG_TOK_STRING  1  /* Within a STRING. */
+#define PBG_TOK_VAR     2  /* Within a VAR. */
+#define PBG_TOK_BARE    3  /* Within any other token. */
+int pbg_parser_char(pbg_parser* p, char c);
+void pbg_parser_field(pbg_parser* p);
+void pbg_parser_close(pbg_parser* p);
+void pbg_parser_child(pbg_parser* p, int id);
+int pbg_parser_grow(void** buf, int* cap, int need, int size);
+void pbg_parser_fail(pbg_parser* p, int line, char* msg);
 
 /* FIELD EVALUATION TOOLKIT */
-int pbg_evaluate_r(pbg_expr* e, pbg_error* err, pbg_field* field);
-int pbg_evaluate_op_not(pbg_expr* e, pbg_error* err, pbg_field* field);
-int pbg_evaluate_op_and(pbg_expr* e, pbg_error* err, pbg_field* field);
-int pbg_evaluate_op_or(pbg_expr* e, pbg_error* err, pbg_field* field);
+#define PBG_FRAMES      64  /* Frames kept on the C stack by pbg_evaluate_r. */
+#define PBG_EVAL_CHILD  -3  /* Distinct from PBG_TRUE, PBG_FALSE, and PBG_ERROR. */
+int pbg_evaluate_r(pbg_expr* e, pbg_error* err, pbg_field* root);
+int pbg_evaluate_run(pbg_expr* e, pbg_error* err, pbg_eval* ev, 
+		pbg_frame* local, pbg_budget* budget);
+#define PBG_BUDGET_CHECK  256  /* Fields begun between reads of the clock. */
+int pbg_budget_spend(pbg_budget* budget);
+double pbg_budget_clock(void);
+int pbg_cost_children(pbg_expr* e, pbg_field* field);
+int pbg_evaluate_begin(pbg_expr* e, pbg_error* err, pbg_frame* f);
+int pbg_evaluate_resume(pbg_expr* e, pbg_error* err, pbg_frame* f, int result);
+int pbg_evaluate_field(pbg_expr* e, pbg_error* err, pbg_field* field);
+int pbg_evaluate_order(pbg_error* err, pbg_field* field, int result);
 int pbg_evaluate_op_exst(pbg_expr* e, pbg_error* err, pbg_field* field);
 int pbg_evaluate_op_eq(pbg_expr* e, pbg_error* err, pbg_field* field);
 int pbg_evaluate_op_neq(pbg_expr* e, pbg_error* err, pbg_field* field);
 int pbg_evaluate_op_order(pbg_expr* e, pbg_error* err, pbg_field* field);
 int pbg_evaluate_op_type(pbg_expr* e, pbg_error* err, pbg_field* field);
+int pbg_evaluate_op_match(pbg_expr* e, pbg_error* err, pbg_field* field);
+int pbg_evaluate_sp(pbg_expr* e, pbg_error* err, pbg_field* field);
+int pbg_evaluate_fused(pbg_expr* e, pbg_error* err, pbg_field* field);
+int pbg_evaluate_unfused(pbg_expr* e, pbg_error* err, pbg_field* field, 
+		pbg_field* var);
+int pbg_check_schema(pbg_expr* e, pbg_error* err, pbg_field* vars);
 
 /* JANITORIAL FUNCTIONS */
 /* No local functions. */
 
+/* SCHEMA SPECIALIZATION */
+#define PBG_SP_BOOL  PBG_LT_TRUE  /* Static type of any BOOL field. */
+pbg_field_type pbg_static_type(pbg_expr* e, pbg_field_type* schema, int index);
+int pbg_specialize_field(pbg_expr* e, pbg_error* err, pbg_field_type* schema,
+		pbg_field* field, int apply);
+void pbg_fold(pbg_field* field, int truth);
+
+/* CANONICAL FORM */
+#define PBG_HASH_LANES  4  /* 32-bit lanes of a structural hash. */
+int pbg_hash_r(pbg_expr* e, int sort, unsigned char* hash);
+unsigned long* pbg_hash_fields(pbg_expr* e, int sort);
+void pbg_hash_field(pbg_expr* e, unsigned long* hashes, int index, 
+		unsigned long* h);
+unsigned long* pbg_hash_slot(pbg_expr* e, unsigned long* hashes, int index);
+void pbg_hash_word(unsigned long* h, unsigned long word);
+void pbg_hash_bytes(unsigned long* h, unsigned char* bytes, int n);
+void pbg_sort_children(pbg_expr* e, unsigned long* hashes, int* children, 
+		int n, int* tmp);
+int pbg_hash_cmp(unsigned long* a, unsigned long* b);
+int pbg_iscommutative(pbg_field* field);
+pbg_field_type pbg_canonical_type(pbg_field* field);
+int pbg_equal_field(pbg_expr* a, int ia, pbg_expr* b, int ib);
+
+/* ZONE MAPS */
+#define PBG_ZONE_T     0x1  /* Some record may evaluate to PBG_TRUE. */
+#define PBG_ZONE_F     0x2  /* Some record may evaluate to PBG_FALSE. */
+#define PBG_ZONE_E     0x4  /* Some record may evaluate to PBG_ERROR. */
+#define PBG_ZONE_ALL   0x7
+#define PBG_SIGN_NEG   0x1  /* Some comparison may be negative. */
+#define PBG_SIGN_ZERO  0x2  /* Some comparison may be zero. */
+#define PBG_SIGN_POS   0x4  /* Some comparison may be positive. */
+typedef struct {
+	int             _null;   /* Whether the field may be NULL. */
+	int             _value;  /* Whether the field may be other than NULL. */
+	pbg_field_type  _type;   /* Type of values other than NULL, or PBG_NULL. */
+	pbg_field*      _lo;     /* Least value other than NULL. */
+	pbg_field*      _hi;     /* Greatest value other than NULL. */
+} pbg_range;
+int pbg_zone_bool(pbg_expr* e, pbg_zone* zones, char* outcomes, int index);
+int pbg_zone_op(pbg_expr* e, pbg_zone* zones, char* outcomes,
+		pbg_field* field);
+int pbg_zone_compare(pbg_field_type op, pbg_range* a, pbg_range* b,
+		pbg_field_type strict);
+int pbg_zone_signs(pbg_range* a, pbg_range* b);
+void pbg_zone_range(pbg_expr* e, pbg_zone* zones, int index, pbg_range* r);
+int pbg_zone_maybool(pbg_range* r);
+int pbg_zone_point(pbg_range* r);
+int pbg_zone_cmp(pbg_field* a, pbg_field* b);
+
+/* PARTIAL EVALUATION */
+int pbg_partial_eval(pbg_expr* e, pbg_error* err, pbg_field* vals, 
+		int index);
+int pbg_partial_op(pbg_expr* e, pbg_field* vals, int* status, 
+		pbg_field* field);
+int pbg_partial_bool(pbg_expr* e, pbg_field* vals, int* status, int index);
+pbg_field* pbg_partial_field(pbg_expr* e, pbg_field* vals, int index);
+int pbg_partial_children(pbg_expr* e, pbg_field* vals, int* status,
+		pbg_field* field, int* kept);
+int pbg_partial_build(pbg_expr* e, pbg_field* vals, int* status, 
+		char* unbound, pbg_expr* r);
+int pbg_partial_fused(pbg_expr* e, pbg_field* vals, pbg_expr* r, int* varmap,
+		pbg_field* field);
+int pbg_partial_ref(pbg_expr* e, pbg_field* vals, pbg_expr* r, int* varmap,
+		int index);
+int pbg_partial_store(pbg_expr* r, pbg_field* field);
+void pbg_partial_fail(pbg_expr* r, pbg_error* err);
+
+/* RESUMABLE EVALUATION */
+#define PBG_EVAL_FRAMES  16  /* Frames first allocated by pbg_eval_begin. */
+int pbg_eval_unbound(pbg_expr* e, pbg_field* field);
+
+/* RULE SETS */
+#define PBG_RULESET_VARS  16  /* Variables of a rule kept on the C stack. */
+int pbg_ruleset_cmp(const void* a, const void* b);
+int pbg_ruleset_names(pbg_ruleset* rs);
+int pbg_ruleset_index(pbg_ruleset* rs);
+int pbg_ruleset_key(pbg_expr* e, pbg_field** key);
+int pbg_ruleset_iskey(pbg_field* field);
+int pbg_ruleset_iskeyed(pbg_field* value, pbg_field* key);
+unsigned long pbg_ruleset_hash(pbg_field* key);
+
+/* DECISION DIAGRAMS */
+#define PBG_BDD_F         0  /* Sink of diagrams which yield PBG_FALSE. */
+#define PBG_BDD_T         1  /* Sink of diagrams which yield PBG_TRUE. */
+#define PBG_BDD_E         2  /* Sink of diagrams which fail. */
+#define PBG_BDD_SINKS     3
+#define PBG_BDD_NOT       0  /* Operations of pbg_bdd_apply. */
+#define PBG_BDD_AND       1
+#define PBG_BDD_OR        2
+#define PBG_BDD_MAXNODES  (INT_MAX/16)  /* Most nodes the tables can index. */
+typedef struct {
+	pbg_bdd*  _bdd;       /* Diagram being compiled. */
+	int       _maxnodes;  /* Most nodes the diagram may have, sinks included. */
+	int*      _unique;    /* Node of each slot, or -1, open-addressed. */
+	int*      _cache;     /* Operation, operands, and result of each slot. */
+	int       _mask;      /* Number of slots of each table, less one. */
+	int       _full;      /* Whether the diagram has too many nodes. */
+} pbg_bdd_tables;
+int pbg_bdd_isgate(pbg_field* field);
+int pbg_bdd_leaves(pbg_bdd* bdd, int* leafof, int* counts);
+int pbg_bdd_build(pbg_bdd_tables* t, int* leafof, int* levels);
+int pbg_bdd_child(pbg_bdd_tables* t, int* dd, int* leafof, int* levels, 
+		int index);
+int pbg_bdd_apply(pbg_bdd_tables* t, int op, int a, int b);
+int pbg_bdd_node(pbg_bdd_tables* t, int level, int f, int tr, int er);
+void pbg_bdd_compact(pbg_bdd* bdd);
+int pbg_bdd_slot(pbg_expr* e, int index);
+unsigned long pbg_bdd_hash(int a, int b, int c, int d);
+
+/* STRING MATCHING */
+#define PBG_MATCH_MINPATTERNS  4  /* Fewest patterns given an automaton. */
+#define PBG_MATCH_END          1  /* A pattern ends at the state. */
+#define PBG_MATCH_ANY          2  /* A pattern ends the text of the state. */
+#define PBG_MATCH_MAXLEN  (INT_MAX/1024)  /* Most bytes of patterns. */
+typedef struct {
+	int            _numstates;   /* Number of states, the root first. */
+	int            _numclasses;  /* Number of classes of bytes. */
+	int            _first;       /* Only byte leaving the root, or -1. */
+	unsigned char  _class[256];  /* Class of each byte, 0 if in no pattern. */
+	unsigned char  _stay[256];   /* Whether each byte leaves the root as is. */
+} pbg_matcher;  /* Followed by the transitions and the info of each state. */
+void pbg_match_compile(pbg_expr* e);
+void* pbg_match_build(pbg_expr* e, pbg_field* field);
+int pbg_match_scan(pbg_matcher* m, pbg_field_type type, unsigned char* str, 
+		int n);
+int pbg_match_one(pbg_field_type type, pbg_field* str, pbg_field* pattern);
+
+/* CSV RECORDS */
+size_t pbg_csv_scan(char* str, size_t n, size_t i, char delim);
+size_t pbg_csv_unquote(char** str, size_t n, char* scratch);
+pbg_field pbg_csv_resolve(void* ctx, int var);
+
+/* ARROW RECORDS */
+char pbg_arrow_format(const char* format);
+int pbg_arrow_check(pbg_arrow* a, struct ArrowArray* batch);
+pbg_field pbg_arrow_resolve(void* ctx, int var);
+pbg_field pbg_arrow_date(pbg_lt_date* data, long days);
+void pbg_arrow_release(struct ArrowArray* array);
+void pbg_arrow_release_schema(struct ArrowSchema* schema);
+
+/* INCREMENTAL EVALUATION */
+#define PBG_INCR_STALE -2  /* Distinct from PBG_TRUE, PBG_FALSE, and PBG_ERROR. */
+int pbg_incr_cached(pbg_expr* e, pbg_error* err, pbg_field* field, int* result);
+void pbg_incr_store(pbg_expr* e, pbg_error* err, pbg_field* field, int result);
+
+/* PARALLEL EVALUATION */
+#ifdef PBG_THREADS
+long pbg_parallel_run(pbg_parallel* par, pbg_error* err, int numthreads);
+void* pbg_worker_run(void* arg);
+int pbg_worker_steal(pbg_worker* w);
+void pbg_worker_evaluate(pbg_worker* w, long begin, long end);
+void pbg_worker_rules(pbg_worker* w, long begin, long end, 
+		unsigned char* filter);
+pbg_field pbg_worker_resolve(void* ctx, int var);
+#define PBG_SELECT_DEPTH  8  /* Levels of AND, OR, and NOT run on selections. */
+#define PBG_SPARSE        8  /* Selections of under 1 in 8 rows are listed. */
+void pbg_worker_select(pbg_worker* w, int index, pbg_selection* sel, int depth);
+int pbg_worker_row(pbg_worker* w, int row, int index);
+void pbg_select_all(pbg_selection* sel, int numrows, unsigned char* filter);
+int pbg_select_next(pbg_selection* sel, int* pos);
+void pbg_select_keep(pbg_selection* sel, signed char* results, int keep);
+void pbg_select_list(pbg_selection* sel);
+#endif
+
+/* HOT RELOAD */
+#ifdef PBG_THREADS
+/* Epochs of readers are spaced a cache line apart, so that readers do not 
+ * contend for the line when announcing them. */
+#define PBG_RELOAD_STRIDE  (64 / sizeof(unsigned long))
+int pbg_reload_collect(pbg_reload* r);
+void pbg_version_free(pbg_version* v);
+#endif
+
+/* BITSETS */
+#define PBG_AND     0  /* Operations of pbg_bits_op. */
+#define PBG_OR      1
+#define PBG_ANDNOT  2
+void pbg_bits_op(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits, int op);
+unsigned long pbg_bits_word(unsigned char* bits);
+int pbg_bits_popcount(unsigned long word);
+
+/* AHEAD-OF-TIME COMPILATION */
+/* Helpers used by the generated source, see pbg_compile_helpers. Each 
+ * includes the helpers it calls. */
+#define PBG_USE_FAIL     0x0001
+#define PBG_USE_ISBOOL   0x0002
+#define PBG_USE_BOOL    (0x0004 | PBG_USE_FAIL)
+#define PBG_USE_CMP      0x0008
+#define PBG_USE_ORDER   (0x0010 | PBG_USE_FAIL)
+#define PBG_USE_COMPARE (0x0020 | PBG_USE_CMP | PBG_USE_ORDER)
+#define PBG_USE_EQ      (0x0040 | PBG_USE_FAIL)
+#define PBG_USE_NEQ     (0x0080 | PBG_USE_FAIL)
+#define PBG_USE_EXST     0x0100
+#define PBG_USE_TYPE    (0x0200 | PBG_USE_FAIL | PBG_USE_ISBOOL)
+#define PBG_USE_SP      (0x0400 | PBG_USE_FAIL | PBG_USE_CMP)
+#define PBG_USE_FUSED   (0x0800 | PBG_USE_CMP)
+#define PBG_USE_MATCH   (0x1000 | PBG_USE_FAIL)
+#define PBG_USE_CONST    0x2000  /* Constants are referred to. */
+char* pbg_compile_reach(pbg_expr* e);
+int pbg_compile_isbool(pbg_expr* e, pbg_field_type type, int* children);
+void pbg_compile_body(pbg_compiler* c, pbg_expr* e, char* reach);
+void pbg_compile_node(pbg_compiler* c, pbg_expr* e, int k);
+void pbg_compile_op(pbg_compiler* c, pbg_expr* e, pbg_field_type type, 
+		int* children, int n, int stmts);
+void pbg_compile_children(pbg_compiler* c, int* children, int n);
+void pbg_compile_constants(pbg_compiler* c, pbg_expr* e);
+void pbg_emit_bool(pbg_compiler* c, pbg_expr* e, int index);
+void pbg_emit_isbool(pbg_compiler* c, pbg_expr* e, int index);
+void pbg_emit_field(pbg_compiler* c, int index);
+void pbg_emit(pbg_compiler* c, char* str);
+void pbg_emit_int(pbg_compiler* c, long value);
+void pbg_emit_string(pbg_compiler* c, char* str, int n);
+
+/* PROFILING */
+#ifdef PBG_PROFILE
+int pbg_profile_init(pbg_expr* e, char* str, size_t n);
+double pbg_profile_clock(void);
+void pbg_profile_record(pbg_expr* e, pbg_field* field, int result, double start);
+#endif
+
 /* CONVERSION & CHECKING TOOLKIT */
+/* Significant digits read exactly into a double, and greatest power of ten
+ * which is exactly a double, see pbg_read_number. */
+#define PBG_NUMBER_DIGITS 15
+#define PBG_NUMBER_MAXPOW 22
 pbg_field_type pbg_gettype(char* str, int n);
 int pbg_istypedate(char* str, int n);
 int pbg_istypenumber(char* str, int n);
@@ -98,6 +440,7 @@ int pbg_istrue(char* str, int n);
 int pbg_isfalse(char* str, int n);
 int pbg_isvar(char* str, int n);
 int pbg_isnumber(char* str, int n);
+double pbg_scale_number(double w, int exp);
 int pbg_isstring(char* str, int n);
 int pbg_isdate(char* str, int n);
 
@@ -106,7 +449,7 @@ void pbg_todate(pbg_lt_date* ptr, char* str, int n);
 
 int pbg_cmpnumber(pbg_lt_number* n1, pbg_lt_number* n2);
 int pbg_cmpdate(pbg_lt_date* d1, pbg_lt_date* d2);
-int pbg_cmpstring(pbg_lt_string* s1, pbg_lt_string* s2, int n);
+int pbg_cmpstring(pbg_lt_string* s1, int n1, pbg_lt_string* s2, int n2);
 
 int pbg_type_isbool(pbg_field_type type);
 int pbg_type_isop(pbg_field_type type);
@@ -124,106 +467,161 @@ int pbg_iswhitespace(char c);
 
 void pbg_error_print(pbg_error* err)
 {
-	pbg_op_arity_err* arity;
-	pbg_syntax_err* syntax;
-	pbg_unknown_type_err* utype;
+	char buf[256];
 	if(err->_type == PBG_ERR_NONE)
 		return;
-	printf("error %s at %s:%d", 
-			pbg_error_str(err->_type), err->_file, err->_line);
+	pbg_error_format(err, buf, sizeof(buf));
+	printf("%s\n", buf);
+}
+
+size_t pbg_error_format(pbg_error* err, char* buf, size_t size)
+{
+	size_t len, n;
+	if(size > 0)
+		buf[0] = '\0';
+	if(err->_type == PBG_ERR_NONE)
+		return 0;
+	len = pbg_format_str(buf, size, 0, "error ", 6);
+	len = pbg_format_str(buf, size, len, pbg_error_str(err->_type), 
+			strlen(pbg_error_str(err->_type)));
+	len = pbg_format_str(buf, size, len, " at ", 4);
+	len = pbg_format_str(buf, size, len, err->_file, strlen(err->_file));
+	len = pbg_format_str(buf, size, len, ":", 1);
+	len = pbg_format_int(buf, size, len, err->_line);
 	switch(err->_type) {
 		case PBG_ERR_OP_ARG_TYPE:
 		case PBG_ERR_STATE:
-			printf(": %s", (char*) err->_data);
+		case PBG_ERR_BUDGET:
+			len = pbg_format_str(buf, size, len, ": ", 2);
+			len = pbg_format_str(buf, size, len, err->_msg, strlen(err->_msg));
 			break;
 		case PBG_ERR_OP_ARITY:
-			arity = (pbg_op_arity_err*) err->_data;
-			printf(": operator %s cannot take %d arguments!", 
-					pbg_field_type_str(arity->_type), arity->_arity);
+			len = pbg_format_str(buf, size, len, ": operator ", 11);
+			len = pbg_format_str(buf, size, len, err->_msg, strlen(err->_msg));
+			len = pbg_format_str(buf, size, len, " cannot take ", 13);
+			len = pbg_format_int(buf, size, len, err->_int);
+			len = pbg_format_str(buf, size, len, " arguments!", 11);
 			break;
 		case PBG_ERR_SYNTAX:
-			syntax = (pbg_syntax_err*) err->_data;
-			printf(": %s -> %s", (char*) syntax->_msg, syntax->_str+syntax->_i);
+			len = pbg_format_str(buf, size, len, ": ", 2);
+			len = pbg_format_str(buf, size, len, err->_msg, strlen(err->_msg));
+			len = pbg_format_str(buf, size, len, " -> ", 4);
+			/* Only show the start of the remaining input. */
+			for(n = 0; n < PBG_ERR_CONTEXT && err->_str[err->_i+n] != '\0'; n++);
+			len = pbg_format_str(buf, size, len, err->_str+err->_i, n);
 			break;
 		case PBG_ERR_UNKNOWN_TYPE:
-			utype = (pbg_unknown_type_err*) err->_data;
-			printf(": failed to recognize %s (%d bytes)\n", (char*)utype->_field, utype->_n);
+			len = pbg_format_str(buf, size, len, ": failed to recognize ", 22);
+			len = pbg_format_str(buf, size, len, err->_str, err->_i);
+			len = pbg_format_str(buf, size, len, " (", 2);
+			len = pbg_format_int(buf, size, len, (long) err->_i);
+			len = pbg_format_str(buf, size, len, " bytes)", 7);
 			break;
 		default:
 			break;
 	}
-	printf("\n");
+	return len;
 }
 
-void pbg_err_init(pbg_error* err, pbg_error_type type, int line, char* file, 
-		int size, void* data)
+void pbg_err_init(pbg_error* err, pbg_error_type type, int line, char* file)
 {
 	err->_type = type;
 	err->_line = line;
 	err->_file = file;
-	err->_int = size;
-	err->_data = data;
+	err->_msg = NULL;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
 }
 
 void pbg_err_alloc(pbg_error* err, int line, char* file) {
-	pbg_err_init(err, PBG_ERR_ALLOC, line, file, 0, NULL);
+	pbg_err_init(err, PBG_ERR_ALLOC, line, file);
+}
+
+void pbg_err_budget(pbg_error* err, int line, char* file)
+{
+	pbg_err_init(err, PBG_ERR_BUDGET, line, file);
+	err->_msg = "Evaluation ran out of budget.";
 }
 
 void pbg_err_unknown_type(pbg_error* err, int line, char* file, 
 		char* field, int n)
 {
-	pbg_unknown_type_err* data;
-	data = malloc(n * sizeof(char));
-	if(data == NULL) {
-		pbg_err_alloc(err, __LINE__, __FILE__);  /* gah. */
-		return;
-	}
-	data->_field = field;
-	data->_n = n;
-	pbg_err_init(err, PBG_ERR_UNKNOWN_TYPE, line, file, n, data);
+	pbg_err_init(err, PBG_ERR_UNKNOWN_TYPE, line, file);
+	err->_str = field;
+	err->_i = n;
 }
 
 void pbg_err_syntax(pbg_error* err, int line, char* file, 
-		char* str, int i, char* msg)
+		char* str, size_t i, char* msg)
 {
-	pbg_syntax_err* data;
-	int size;
-	data = malloc(size = sizeof(pbg_syntax_err));
-	if(data == NULL) {
-		pbg_err_alloc(err, __LINE__, __FILE__); /* unfortunate. */
-		return;
-	}
-	data->_msg = msg;
-	data->_str = str;
-	data->_i = i;
-	pbg_err_init(err, PBG_ERR_SYNTAX, line, file, size, data);
+	pbg_err_init(err, PBG_ERR_SYNTAX, line, file);
+	err->_msg = msg;
+	err->_str = str;
+	err->_i = i;
 }
 
 void pbg_err_op_arity(pbg_error* err, int line, char* file, 
 		pbg_field_type type, int arity)
 {
-	pbg_op_arity_err* data;
-	int size;
-	data = malloc(size = sizeof(pbg_op_arity_err));
-	if(data == NULL) {
-		pbg_err_alloc(err, __LINE__, __FILE__); /* unfortunate. */
-		return;
-	}
-	data->_arity = arity;
-	data->_type = type;
-	pbg_err_init(err, PBG_ERR_OP_ARITY, line, file, size, data);
+	pbg_err_init(err, PBG_ERR_OP_ARITY, line, file);
+	err->_msg = pbg_field_type_str(type);
+	err->_int = arity;
 }
 
 void pbg_err_state(pbg_error* err, int line, char* file, char* msg) {
-	pbg_err_init(err, PBG_ERR_STATE, line, file, 0, msg);
+	pbg_err_init(err, PBG_ERR_STATE, line, file);
+	err->_msg = msg;
 }
 
 void pbg_err_op_arg_type(pbg_error* err, int line, char* file, char* msg) {
-	pbg_err_init(err, PBG_ERR_OP_ARG_TYPE, line, file, 0, msg);
+	pbg_err_init(err, PBG_ERR_OP_ARG_TYPE, line, file);
+	err->_msg = msg;
 }
 
 void pbg_error_free(pbg_error* err) {
-	if(err->_int != 0) free(err->_data);
+	PBG_UNUSED(err);  /* Errors hold no resources. */
+}
+
+/**
+ * Appends characters to a formatted error, truncating them to the size of 
+ * the buffer. The buffer remains terminated with '\0'.
+ * @param buf   Buffer to append to.
+ * @param size  Size of the buffer.
+ * @param len   Length of the untruncated text so far.
+ * @param str   Characters to append.
+ * @param n     Number of characters to append.
+ * @return the length of the untruncated text.
+ */
+size_t pbg_format_str(char* buf, size_t size, size_t len, char* str, size_t n)
+{
+	size_t fits;
+	if(len+1 < size) {
+		fits = (n < size-len-1) ? n : size-len-1;
+		memcpy(buf+len, str, fits);
+		buf[len+fits] = '\0';
+	}
+	return len + n;
+}
+
+/**
+ * Appends an integer to a formatted error, see pbg_format_str.
+ * @param buf    Buffer to append to.
+ * @param size   Size of the buffer.
+ * @param len    Length of the untruncated text so far.
+ * @param value  Integer to append.
+ * @return the length of the untruncated text.
+ */
+size_t pbg_format_int(char* buf, size_t size, size_t len, long value)
+{
+	char digits[24];
+	unsigned long u;
+	int i;
+	u = (value < 0) ? -(unsigned long) value : (unsigned long) value;
+	i = sizeof(digits);
+	do digits[--i] = '0' + u % 10; while((u /= 10) != 0);
+	if(value < 0) digits[--i] = '-';
+	return pbg_format_str(buf, size, len, digits+i, sizeof(digits)-i);
 }
 
 
@@ -236,7 +634,8 @@ void pbg_error_free(pbg_error* err) {
 /**
  * This function returns the field identified by the given index. Constant fields
  * are identified by positive indices starting at 1. Variable fields are
- * identified by negative indices starting at -1.
+ * identified by negative indices starting at -1. Variables which have yet to be
+ * resolved by pbg_evaluate_lazy are resolved first.
  * @param e      PBG expression to get field from.
  * @param index  Index of the field to get.
  * @return Pointer to the pbg_field in e specified by the index,
@@ -244,7 +643,19 @@ void pbg_error_free(pbg_error* err) {
  */
 pbg_field* pbg_field_get(pbg_expr* e, int index)
 {
-	if(index < 0) return e->_variables - (index+1);
+	pbg_field* field;
+	pbg_resolver* resolver;
+	if(index < 0) {
+		field = e->_variables - (index+1);
+		/* Resolve the variable on first access, see pbg_evaluate_lazy. 
+		 * Variables of a parsed expression hold their names instead, and 
+		 * those of a resumable evaluation are left until supplied. */
+		if(field->_type == PBG_LT_VAR && field->_int == PBG_LAZY) {
+			resolver = (pbg_resolver*) field->_data;
+			*field = resolver->_resolve(resolver->_ctx, -(index+1));
+		}
+		return field;
+	}
 	if(index > 0) return e->_constants + (index-1);
 	return NULL;
 }
@@ -277,20 +688,97 @@ int pbg_store_constant(pbg_expr* e, pbg_field field)
 
 /**
  * This function stores the given variable field in the AST. Variable fields are
- * indexed using negative values starting at -1.
- * @param e     Abstract expression tree to store field in.
- * @param field  Field to store.
+ * indexed using negative values starting at -1. Each distinct variable is only
+ * stored once; a repeated variable yields the index of the stored field. 
+ * Variables are found through a hash index of their names, so storing V 
+ * variables takes O(V) time.
+ * @param e         Abstract expression tree to store field in.
+ * @param field     Field to store.
+ * @param slots     Hash index of the stored variables, possibly NULL.
+ * @param numslots  Number of slots in the hash index.
  * @return a negative index if successful,
  *         0 otherwise.
  */
-int pbg_store_variable(pbg_expr* e, pbg_field field)
+int pbg_store_variable(pbg_expr* e, pbg_field field, int** slots, int* numslots)
 {
+	pbg_field* var;
+	unsigned long h, mask;
 	int fieldi;
-	fieldi = -(1 + e->_numvars++);
-	*pbg_field_get(e, fieldi) = field;
+	if(field._data == NULL)
+		return 0;
+	/* Keep the index at most half full. */
+	if(2*(e->_numvars+1) > *numslots && !pbg_index_variables(e, slots, numslots)) {
+		pbg_field_free(&field);
+		return 0;
+	}
+	/* Reuse the existing field if the variable was already referenced. */
+	mask = *numslots - 1;
+	h = pbg_hash_name(field._data, field._int) & mask;
+	for(; (*slots)[h] != 0; h = (h+1) & mask) {
+		var = e->_variables + (*slots)[h] - 1;
+		if(var->_int == field._int && 
+				memcmp(var->_data, field._data, field._int) == 0) {
+			pbg_field_free(&field);
+			return -(*slots)[h];
+		}
+	}
+	fieldi = -(1 + e->_numvars);
+	e->_variables[e->_numvars++] = field;
+	(*slots)[h] = -fieldi;
 	return fieldi;
 }
 
+/**
+ * Doubles the size of the hash index of the variables of an expression, then
+ * adds every stored variable to it. Slots hold the position of a variable plus
+ * one, or 0 if empty.
+ * @param e         Expression whose variables are indexed.
+ * @param slots     Hash index to grow, possibly NULL.
+ * @param numslots  Number of slots in the hash index, a power of two.
+ * @return 1 if successful, 0 if out of memory or too large.
+ */
+int pbg_index_variables(pbg_expr* e, int** slots, int* numslots)
+{
+	pbg_field* var;
+	unsigned long h, mask;
+	int* grown;
+	int i, n;
+	n = (*numslots < 16) ? 16 : *numslots;
+	while(n < 2*(e->_numvars+1)) n *= 2;
+	if(n > PBG_MAX_FIELDS)
+		return 0;
+	grown = calloc(n, sizeof(int));
+	if(grown == NULL)
+		return 0;
+	mask = n - 1;
+	for(i = 0; i < e->_numvars; i++) {
+		var = e->_variables + i;
+		h = pbg_hash_name(var->_data, var->_int) & mask;
+		while(grown[h] != 0) h = (h+1) & mask;
+		grown[h] = i + 1;
+	}
+	free(*slots);
+	*slots = grown;
+	*numslots = n;
+	return 1;
+}
+
+/**
+ * Hashes a name using 32-bit FNV-1a.
+ * @param str  Name to hash.
+ * @param n    Length of str.
+ * @return the hash of the name.
+ */
+unsigned long pbg_hash_name(char* str, int n)
+{
+	unsigned long h;
+	int i;
+	h = 2166136261UL;
+	for(i = 0; i < n; i++)
+		h = ((h ^ (unsigned char) str[i]) * 16777619UL) & 0xFFFFFFFFUL;
+	return h;
+}
+
 
 /**************************
  *                        *
@@ -336,6 +824,28 @@ pbg_field pbg_make_null(void) {
 	return pbg_field_init(PBG_NULL, 0, NULL);
 }
 
+pbg_field pbg_make_unbound(void) {
+	return pbg_field_init(PBG_LT_VAR, 0, NULL);
+}
+
+pbg_field pbg_init_number(pbg_lt_number* data, double value)
+{
+	data->_val = value;
+	return pbg_field_init(PBG_LT_NUMBER, sizeof(pbg_lt_number), data);
+}
+
+pbg_field pbg_init_date(pbg_lt_date* data, int year, int month, int day)
+{
+	data->_YYYY = year;
+	data->_MM = month;
+	data->_DD = day;
+	return pbg_field_init(PBG_LT_DATE, sizeof(pbg_lt_date), data);
+}
+
+pbg_field pbg_init_string(char* str, int n) {
+	return pbg_field_init(PBG_LT_STRING, n * sizeof(pbg_lt_string), str);
+}
+
 /**
  * Create a new pbg_field with the given arguments.
  * @param type  Type of the field.
@@ -381,12 +891,15 @@ pbg_field pbg_parse_op(pbg_error* err, pbg_field_type type, int argc)
 pbg_field pbg_parse_var(pbg_error* err, char* str, int n)
 {
 	int size;
-	void* data;
-	data = malloc(size = (n-2) * sizeof(char));
+	char* data;
+	/* The name is terminated for the convenience of dictionaries. */
+	data = malloc(((size = (n-2) * sizeof(char))) + 1);
 	if(data == NULL) 
 		pbg_err_alloc(err, __LINE__, __FILE__);
-	else
+	else {
 		memcpy(data, str+1, n-2);
+		data[n-2] = '\0';
+	}
 	return pbg_field_init(PBG_LT_VAR, size, data);
 }
 
@@ -460,6 +973,53 @@ pbg_field pbg_parse_string(pbg_error* err, char* str, int n)
  *                       *
  *************************/
 
+/**
+ * Makes a field representing the given literal and stores it in the 
+ * expression, which must have room for it.
+ * @param e     Expression to store the literal in.
+ * @param err   Used to store error, if any.
+ * @param type  Type of the literal, as given by pbg_gettype.
+ * @param str   String to parse as the literal.
+ * @param n     Length of str.
+ * @param slots     Hash index of the variables of e, see pbg_store_variable.
+ * @param numslots  Number of slots in the hash index.
+ * @return the index of the stored field if successful,
+ *         0 if type is not a literal type or if an error occurred.
+ */
+int pbg_parse_literal(pbg_expr* e, pbg_error* err, pbg_field_type type, 
+		char* str, int n, int** slots, int* numslots)
+{
+	pbg_field var;
+	/* It's a variable. */
+	if(type == PBG_LT_VAR) {
+		var = pbg_parse_var(err, str, n);
+		if(var._data == NULL)
+			return 0;
+		n = pbg_store_variable(e, var, slots, numslots);
+		if(n == 0)
+			pbg_err_alloc(err, __LINE__, __FILE__);
+		return n;
+	}
+	/* It's a date. */
+	if(type == PBG_LT_DATE)
+		return pbg_store_constant(e, pbg_parse_date(err, str, n));
+	/* It's a number. */
+	if(type == PBG_LT_NUMBER)
+		return pbg_store_constant(e, pbg_parse_number(err, str, n));
+	/* It's a string. */
+	if(type == PBG_LT_STRING)
+		return pbg_store_constant(e, pbg_parse_string(err, str, n));
+	/* It's a simple field. */
+	if(type == PBG_LT_TRUE || 
+			type == PBG_LT_FALSE || 
+			type == PBG_LT_TP_DATE || 
+			type == PBG_LT_TP_BOOL || 
+			type == PBG_LT_TP_NUMBER || 
+			type == PBG_LT_TP_STRING)
+		return pbg_store_constant(e, pbg_field_init(type, 0, NULL));
+	return 0;
+}
+
 /**
  * Checks if the operator can legally take the specified number of arguments.
  * This function encodes the rules for operator arity and should be modified if
@@ -487,6 +1047,9 @@ int pbg_check_op_arity(pbg_field_type type, int numargs)
 		case PBG_OP_LTE:   arity =  2; break;
 		case PBG_OP_GTE:   arity =  2; break;
 		case PBG_OP_TYPE:  arity = -2; break;
+		case PBG_OP_PFX:   arity = -2; break;
+		case PBG_OP_SFX:   arity = -2; break;
+		case PBG_OP_CONT:  arity = -2; break;
 		default:
 			return 0;
 	}
@@ -496,33 +1059,98 @@ int pbg_check_op_arity(pbg_field_type type, int numargs)
 	return 1;
 }
 
+/**
+ * Fuses every binary comparison of a variable to a NUMBER, DATE, or STRING 
+ * constant into a single operator holding the constant inline, see 
+ * pbg_evaluate_fused. The children of fused operators are kept, so the tree
+ * can still be walked as before. Comparisons are left as they are if out of 
+ * memory.
+ * @param e  Expression to fuse.
+ */
+void pbg_fuse(pbg_expr* e)
+{
+	pbg_field* field, *k;
+	pbg_fused* fu;
+	int i, *children, varfirst;
+	for(i = 0; i < e->_numconst; i++) {
+		field = e->_constants + i;
+		if(field->_int != 2 || (field->_type != PBG_OP_EQ && 
+				field->_type != PBG_OP_NEQ && field->_type != PBG_OP_LT && 
+				field->_type != PBG_OP_GT && field->_type != PBG_OP_LTE && 
+				field->_type != PBG_OP_GTE))
+			continue;
+		children = (int*) field->_data;
+		if((children[0] < 0) == (children[1] < 0))
+			continue;
+		varfirst = children[0] < 0;
+		k = pbg_field_get(e, children[varfirst]);
+		if(k->_type != PBG_LT_NUMBER && k->_type != PBG_LT_DATE && 
+				k->_type != PBG_LT_STRING)
+			continue;
+		if((fu = malloc(sizeof(pbg_fused))) == NULL)
+			return;
+		fu->_children[0] = children[0];
+		fu->_children[1] = children[1];
+		fu->_op = field->_type;
+		fu->_cmp = varfirst ? field->_type : pbg_flip_op(field->_type);
+		fu->_var = children[!varfirst];
+		fu->_strict = 0;
+		fu->_const = *k;
+		if(k->_type == PBG_LT_NUMBER) fu->_number = *(pbg_lt_number*) k->_data;
+		if(k->_type == PBG_LT_DATE) fu->_date = *(pbg_lt_date*) k->_data;
+		free(field->_data);
+		field->_data = fu;
+		field->_type = (k->_type == PBG_LT_NUMBER) ? PBG_FU_NUMBER : 
+				(k->_type == PBG_LT_DATE) ? PBG_FU_DATE : PBG_FU_STRING;
+	}
+}
+
+/**
+ * Flips a comparison operator, so that it holds with its arguments swapped.
+ * @param type  Comparison operator to flip.
+ * @return the flipped comparison operator.
+ */
+pbg_field_type pbg_flip_op(pbg_field_type type)
+{
+	switch(type) {
+		case PBG_OP_LT:  return PBG_OP_GT;
+		case PBG_OP_GT:  return PBG_OP_LT;
+		case PBG_OP_LTE: return PBG_OP_GTE;
+		case PBG_OP_GTE: return PBG_OP_LTE;
+		default:         return type;
+	}
+}
+
 void pbg_parse(pbg_expr* e, pbg_error* err, char* str) {
 	pbg_parse_n(e, err, str, strlen(str));
 }
 
-void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
+void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, size_t n)
 {
-	int i;
+	size_t i;
 	
-	int numfields, numvars, numclosings;
-	int depth, maxdepth, reachedend;
+	size_t numfields, numvars, numclosings;
+	size_t maxdepth, reachedend;
+	long depth;
 	int instring, invar;
 	
 	int* stack, stacksz;
 	int* groupsz, groupi;
 	int opened;
 	
-	int* fields, *lengths, fieldi;
-	int* closings, closingi;
+	size_t* fields, *lengths;
+	size_t* closings;
+	int fieldi, closingi;
 	
 	int numconstant, numvariable;
 	
 	pbg_field_type type;
 	int* children, id;
-	int start, len;
+	int* slots, numslots;
+	size_t start, len;
 	
 	/* Always start with a clean error! */
-	pbg_err_init(err, PBG_ERR_NONE, 0, NULL, 0, NULL);
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
 	
 	/* Set to NULL to allow for pbg_free to check if needing free. */
 	e->_constants = NULL;
@@ -533,6 +1161,13 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 	 * associated local variables here. */
 	e->_numconst = 0;
 	e->_numvars = 0;
+	e->_incr = NULL;
+	e->_schema = NULL;
+#ifdef PBG_PROFILE
+	e->_stats = NULL;
+	e->_source = NULL;
+	e->_srclen = 0;
+#endif
 	
 	/*******************************************************************
 	 * FIRST PASS                                                      *
@@ -557,6 +1192,7 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 			if(depth == 0 && !reachedend) reachedend = i;
 		/* Process a new field. */
 		}else{
+			if(depth == 0 && reachedend) break;
 			/* It's a string! */
 			if(str[i] == '\'') {
 				instring = 1;
@@ -574,6 +1210,12 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 			numfields++;
 		}
 	}
+	/* Check if fields and groups can be numbered. */
+	if(numfields > PBG_MAX_FIELDS || numclosings > PBG_MAX_FIELDS) {
+		pbg_err_syntax(err, __LINE__, __FILE__, str, 0,
+				"Too many fields in expression.");
+		return;
+	}
 	/* Check if there aren't any fields. */
 	if(numfields == 0) {
 		pbg_err_syntax(err, __LINE__, __FILE__, str, 0,
@@ -592,6 +1234,12 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 				"Too few closing parentheses.");
 		return;
 	}
+	/* Check if fields follow the expression. */
+	if(depth == 0 && reachedend && i != n && str[i] != ')') {
+		pbg_err_syntax(err, __LINE__, __FILE__, str, i,
+				"Too many fields yield multiple expressions.");
+		return;
+	}
 	/* Check if there are multiple (possible) expressions. */
 	if(depth == 0 && reachedend && i != n) {
 		pbg_err_syntax(err, __LINE__, __FILE__, str, reachedend,
@@ -629,9 +1277,9 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 	
 	/* Allocate space to record field starting positions & lengths as well as 
 	 * the positions of group closings. */
-	fields = (int*) malloc(numfields * sizeof(int));
-	lengths = (int*) malloc(numfields * sizeof(int));
-	closings = (int*) malloc((numclosings+1) * sizeof(int));
+	fields = (size_t*) malloc(numfields * sizeof(size_t));
+	lengths = (size_t*) malloc(numfields * sizeof(size_t));
+	closings = (size_t*) malloc((numclosings+1) * sizeof(size_t));
 	
 	/* Compute sizes of constant and variable arrays. */
 	numconstant = numfields - numvars;
@@ -690,10 +1338,10 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 			type = pbg_gettype(str+fields[fieldi], lengths[fieldi]);
 			/* Ensure opener is operator, and no other field is an operator. */
 			if(opened != pbg_type_isop(type) || (opened = 0)) {
-				free(stack); free(groupsz);
-				free(fields); free(lengths); free(closings);
 				pbg_err_syntax(err, __LINE__, __FILE__, str, fields[fieldi], 
 						"Field ordering not respected.");
+				free(stack); free(groupsz);
+				free(fields); free(lengths); free(closings);
 				pbg_free(e);
 				return;
 			}
@@ -713,13 +1361,14 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 	#define pbg_stack_fieldid stack[2*(stacksz-1)]
 	
 	children = NULL;
+	slots = NULL, numslots = 0;
 	stacksz = groupi = closingi = 0;
-	for(fieldi = 0; fieldi < numfields; fieldi++) {
+	for(fieldi = 0; fieldi < (int) numfields; fieldi++) {
 		/* Alias field start and field length for easier use. */
 		start = fields[fieldi];
 		len = lengths[fieldi];
-		/* Parsed all inputs to current operator. Pop it from the stack. */
-		if(start > closings[closingi]) {
+		/* Parsed all inputs to current operator(s). Pop them from the stack. */
+		while(start > closings[closingi]) {
 			closingi++;
 			/* Pop from the stack. */
 			stacksz--;
@@ -753,36 +1402,11 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 			children = pbg_field_get(e, id)->_data;
 		/* It's a literal! */
 		}else{
-			/* It's a variable. */
-			if(type == PBG_LT_VAR)
-				id = pbg_store_variable(e, 
-						pbg_parse_var(err, str+start, len));
-			/* It's a date. */
-			else if(type == PBG_LT_DATE)
-				id = pbg_store_constant(e, 
-						pbg_parse_date(err, str+start, len));
-			/* It's a number. */
-			else if(type == PBG_LT_NUMBER)
-				id = pbg_store_constant(e, 
-						pbg_parse_number(err, str+start, len));
-			/* It's a string. */
-			else if(type == PBG_LT_STRING)
-				id = pbg_store_constant(e, 
-						pbg_parse_string(err, str+start, len));
-			/* It's a simple field. */
-			else if(type == PBG_LT_TRUE || 
-					type == PBG_LT_FALSE || 
-					type == PBG_LT_TP_DATE || 
-					type == PBG_LT_TP_BOOL || 
-					type == PBG_LT_TP_NUMBER || 
-					type == PBG_LT_TP_STRING)
-				id = pbg_store_constant(e, 
-							pbg_field_init(type, 0, NULL));
+			id = pbg_parse_literal(e, err, type, str+start, len, 
+					&slots, &numslots);
 			/* It's an error... */
-			else {
-				pbg_err_unknown_type(err, __LINE__, __FILE__, str+start, n);
-				id = 0;
-			}
+			if(id == 0 && !pbg_iserror(err))
+				pbg_err_unknown_type(err, __LINE__, __FILE__, str+start, len);
 			/* Check for errors when adding literal to tree. */
 			if(id == 0) break;
 			/* Add this literal as a child of the parent operator, if any. */
@@ -794,7 +1418,7 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 	if(id == 0) pbg_free(e);
 	
 	/* Clean up! */
-	free(stack), free(groupsz);
+	free(stack), free(groupsz), free(slots);
 	free(fields), free(lengths), free(closings);
 	
 	/* Do not perform sanity checks if an error occurred. */
@@ -802,54 +1426,320 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n)
 		return;
 	
 	/* Sanity check: verify we parsed everything we expected. */
-	if(e->_numconst != numconstant || e->_numvars != numvariable) {
+	if(e->_numconst != numconstant || e->_numvars > numvariable) {
 		pbg_err_state(err, __LINE__, __FILE__,
 				"Not all fields were parsed?");
 		return;
 	}
+	
+	/* Fuse comparisons of variables to constants, and compile patterns. */
+	pbg_fuse(e);
+	pbg_match_compile(e);
+	
+#ifdef PBG_PROFILE
+	/* Attach empty statistics and source spans to the new expression. */
+	if(!pbg_profile_init(e, str, n)) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		pbg_free(e);
+	}
+#endif
 }
 
 
-/****************************
- *                          *
- * FIELD EVALUATION TOOLKIT *
- *                          *
- ****************************/
+/********************
+ *                  *
+ * STREAMING PARSER *
+ *                  *
+ ********************/
 
-int pbg_evaluate_op_not(pbg_expr* e, pbg_error* err, pbg_field* field)
+pbg_parser* pbg_parser_new(void)
 {
-	int child0, result;
-	child0 = ((int*)field->_data)[0];
-	result = pbg_evaluate_r(e, err, pbg_field_get(e, child0));
-	if(result == PBG_ERROR) return PBG_ERROR;  /* Pass error through. */
-	return result == PBG_TRUE ? PBG_FALSE : PBG_TRUE;
+	pbg_parser* p;
+	p = calloc(1, sizeof(pbg_parser));
+	if(p == NULL)
+		return NULL;
+	/* Pointers are NULL and counters 0 thanks to calloc. */
+	p->_state = PBG_TOK_NONE;
+	pbg_err_init(&p->_err, PBG_ERR_NONE, 0, NULL);
+	return p;
 }
 
-int pbg_evaluate_op_and(pbg_expr* e, pbg_error* err, pbg_field* field)
+int pbg_parser_feed(pbg_parser* p, char* chunk, size_t n)
 {
-	int i, size, childi, result;
-	size = field->_int;
-	for(i = 0; i < size; i++) {
-		childi = ((int*)field->_data)[i];
-		result = pbg_evaluate_r(e, err, pbg_field_get(e, childi));
-		if(result == PBG_ERROR) return PBG_ERROR;  /* Pass error through. */
-		if(result == PBG_FALSE) return PBG_FALSE;
+	size_t i;
+	if(pbg_iserror(&p->_err))
+		return 0;
+#ifdef PBG_PROFILE
+	/* Keep a copy of the input so pbg_profile_init can map source spans. */
+	if(n > (size_t) (PBG_MAX_FIELDS - p->_srclen) || !pbg_parser_grow(
+			(void**) &p->_source, &p->_srccap, p->_srclen + (int) n, 1)) {
+		pbg_err_alloc(&p->_err, __LINE__, __FILE__);
+		return 0;
 	}
-	return PBG_TRUE;
+	memcpy(p->_source+p->_srclen, chunk, n);
+	p->_srclen += n;
+#endif
+	for(i = 0; i < n; i++)
+		if(!pbg_parser_char(p, chunk[i]))
+			return 0;
+	return 1;
 }
 
-int pbg_evaluate_op_or(pbg_expr* e, pbg_error* err, pbg_field* field)
+void pbg_parser_finish(pbg_parser* p, pbg_expr* e, pbg_error* err)
 {
-	int i, childi, result;
-	for(i = 0; i < field->_int; i++) {
-		childi = ((int*)field->_data)[i];
-		result = pbg_evaluate_r(e, err, pbg_field_get(e, childi));
-		if(result == PBG_ERROR) return PBG_ERROR;  /* Pass error through. */
-		if(result == PBG_TRUE)  return PBG_TRUE;
+	/* The last token may end with the input. */
+	if(!pbg_iserror(&p->_err)) {
+		if(p->_state == PBG_TOK_BARE)
+			pbg_parser_field(p);
+		else if(p->_state == PBG_TOK_STRING)
+			pbg_parser_fail(p, __LINE__, "Unclosed string.");
+		else if(p->_state == PBG_TOK_VAR)
+			pbg_parser_fail(p, __LINE__, "Unclosed variable.");
 	}
-	return PBG_FALSE;
+	if(!pbg_iserror(&p->_err)) {
+		if(p->_depth != 0)
+			pbg_parser_fail(p, __LINE__, "Too few closing parentheses.");
+		else if(!p->_done)
+			pbg_parser_fail(p, __LINE__, "No fields in expression.");
+	}
+	
+	/* Hand the expression over, or free it if an error occurred. */
+	*err = p->_err;
+	*e = p->_expr;
+	if(pbg_iserror(err))
+		pbg_free(e);
+#ifdef PBG_PROFILE
+	/* Attach empty statistics and source spans to the new expression. */
+	else if(!pbg_profile_init(e, p->_source, p->_srclen)) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		pbg_free(e);
+	}
+	free(p->_source);
+#endif
+	
+	/* Fuse comparisons of variables to constants, and compile patterns. */
+	if(!pbg_iserror(err)) {
+		pbg_fuse(e);
+		pbg_match_compile(e);
+	}
+	
+	/* Clean up! */
+	free(p->_tok);
+	free(p->_varslots);
+	free(p->_groups);
+	free(p->_children);
+	free(p);
+}
+
+/**
+ * Consumes a single character of input.
+ * @param p  Parser to consume the character.
+ * @param c  Character to consume.
+ * @return 1 if successful, 0 if an error occurred.
+ */
+int pbg_parser_char(pbg_parser* p, char c)
+{
+	/* Delimiters end bare tokens, then are processed on their own. */
+	if(p->_state == PBG_TOK_BARE && (pbg_iswhitespace(c) || 
+			c == '[' || c == '(' || c == ')')) {
+		pbg_parser_field(p);
+		if(pbg_iserror(&p->_err)) return 0;
+	}
+	/* Ignore whitespaces between tokens. */
+	if(p->_state == PBG_TOK_NONE && pbg_iswhitespace(c))
+		return 1;
+	/* Open a new group, whose first field must be an operator. */
+	if(p->_state == PBG_TOK_NONE && c == '(') {
+		if(p->_done || p->_opened) {
+			pbg_parser_fail(p, __LINE__, p->_done ? 
+					"Too many opening parentheses yield multiple expressions." :
+					"Field ordering not respected.");
+			return 0;
+		}
+		if(!pbg_parser_grow((void**) &p->_groups, &p->_groupcap, 
+				2*(p->_depth+1), sizeof(int))) {
+			pbg_err_alloc(&p->_err, __LINE__, __FILE__);
+			return 0;
+		}
+		p->_depth++;
+		p->_opened = 1;
+		return 1;
+	}
+	/* Close the current group. */
+	if(p->_state == PBG_TOK_NONE && c == ')') {
+		pbg_parser_close(p);
+		return !pbg_iserror(&p->_err);
+	}
+	/* Add the character to the current token. */
+	if(!pbg_parser_grow((void**) &p->_tok, &p->_tokcap, p->_toklen+1, 1)) {
+		pbg_err_alloc(&p->_err, __LINE__, __FILE__);
+		return 0;
+	}
+	p->_tok[p->_toklen++] = c;
+	if(p->_state == PBG_TOK_NONE) {
+		p->_state = (c == '\'') ? PBG_TOK_STRING : 
+				(c == '[') ? PBG_TOK_VAR : PBG_TOK_BARE;
+	/* Strings and variables end with an unescaped quote or bracket. */
+	}else if(p->_toklen > 1 && p->_tok[p->_toklen-2] != '\\' && 
+			((p->_state == PBG_TOK_STRING && c == '\'') || 
+			(p->_state == PBG_TOK_VAR && c == ']'))) {
+		pbg_parser_field(p);
+	}
+	return !pbg_iserror(&p->_err);
+}
+
+/**
+ * Adds the token which was just read to the tree.
+ * @param p  Parser whose token is complete.
+ */
+void pbg_parser_field(pbg_parser* p)
+{
+	pbg_field_type type;
+	int id, isop, len;
+	len = p->_toklen;
+	type = pbg_gettype(p->_tok, len);
+	isop = pbg_type_isop(type);
+	p->_state = PBG_TOK_NONE;
+	p->_toklen = 0;
+	if(p->_done) {
+		pbg_parser_fail(p, __LINE__, "Too many fields yield multiple expressions.");
+		return;
+	}
+	/* Ensure opener is operator, and no other field is an operator. */
+	if(p->_opened != isop) {
+		pbg_parser_fail(p, __LINE__, "Field ordering not respected.");
+		return;
+	}
+	/* Ensure there is room for the field. */
+	if(!pbg_parser_grow((void**) &p->_expr._constants, &p->_constcap, 
+			p->_expr._numconst+1, sizeof(pbg_field)) || 
+			!pbg_parser_grow((void**) &p->_expr._variables, &p->_varcap, 
+			p->_expr._numvars+1, sizeof(pbg_field))) {
+		pbg_err_alloc(&p->_err, __LINE__, __FILE__);
+		return;
+	}
+	/* It's an operator! Its children are known once its group closes. */
+	if(isop) {
+		id = pbg_store_constant(&p->_expr, pbg_field_init(type, 0, NULL));
+		if(p->_depth > 1)
+			pbg_parser_child(p, id);
+		p->_groups[2*(p->_depth-1)] = id;
+		p->_groups[2*(p->_depth-1)+1] = p->_numchildren;
+		p->_opened = 0;
+		return;
+	}
+	/* It's a literal! */
+	id = pbg_parse_literal(&p->_expr, &p->_err, type, p->_tok, len, 
+			&p->_varslots, &p->_varslotcap);
+	if(id == 0) {
+		if(!pbg_iserror(&p->_err))
+			pbg_parser_fail(p, __LINE__, "Unknown field type.");
+		return;
+	}
+	if(p->_depth > 0)
+		pbg_parser_child(p, id);
+	else
+		p->_done = 1;
+}
+
+/**
+ * Closes the current group, handing its children over to its operator.
+ * @param p  Parser whose group is closed.
+ */
+void pbg_parser_close(pbg_parser* p)
+{
+	pbg_field* op;
+	int* children, first, numchildren;
+	if(p->_depth == 0 || p->_done) {
+		pbg_parser_fail(p, __LINE__, "Too many closing parentheses.");
+		return;
+	}
+	if(p->_opened) {
+		pbg_parser_fail(p, __LINE__, "Field ordering not respected.");
+		return;
+	}
+	op = pbg_field_get(&p->_expr, p->_groups[2*(p->_depth-1)]);
+	first = p->_groups[2*(p->_depth-1)+1];
+	numchildren = p->_numchildren - first;
+	/* Enforce operator arity. */
+	if(pbg_check_op_arity(op->_type, numchildren) == 0) {
+		pbg_err_op_arity(&p->_err, __LINE__, __FILE__, op->_type, numchildren);
+		return;
+	}
+	children = malloc(numchildren * sizeof(int));
+	if(children == NULL) {
+		pbg_err_alloc(&p->_err, __LINE__, __FILE__);
+		return;
+	}
+	memcpy(children, p->_children+first, numchildren * sizeof(int));
+	op->_int = numchildren;
+	op->_data = children;
+	/* Pop the group. */
+	p->_numchildren = first;
+	if(--p->_depth == 0)
+		p->_done = 1;
+}
+
+/**
+ * Adds a child to the current group.
+ * @param p   Parser to add the child to.
+ * @param id  Index of the child field.
+ */
+void pbg_parser_child(pbg_parser* p, int id)
+{
+	if(!pbg_parser_grow((void**) &p->_children, &p->_childcap, 
+			p->_numchildren+1, sizeof(int))) {
+		pbg_err_alloc(&p->_err, __LINE__, __FILE__);
+		return;
+	}
+	p->_children[p->_numchildren++] = id;
+}
+
+/**
+ * Ensures a buffer has room for the given number of elements, doubling its 
+ * capacity as needed. Buffers hold at most PBG_MAX_FIELDS elements.
+ * @param buf   Buffer to grow, possibly NULL.
+ * @param cap   Capacity of the buffer, in elements.
+ * @param need  Number of elements needed.
+ * @param size  Size of each element.
+ * @return 1 if successful, 0 if out of memory or too large.
+ */
+int pbg_parser_grow(void** buf, int* cap, int need, int size)
+{
+	void* grown;
+	int newcap;
+	if(need <= *cap)
+		return 1;
+	if(need < 0 || need > PBG_MAX_FIELDS)
+		return 0;
+	newcap = (*cap < 8) ? 8 : *cap;
+	while(newcap < need) newcap *= 2;
+	grown = realloc(*buf, (size_t) newcap * size);
+	if(grown == NULL)
+		return 0;
+	*buf = grown;
+	*cap = newcap;
+	return 1;
+}
+
+/**
+ * Records a syntax error. The input is not kept, so the error does not point
+ * into it.
+ * @param p     Parser which failed.
+ * @param line  Line at which the error occurred.
+ * @param msg   Description of the error.
+ */
+void pbg_parser_fail(pbg_parser* p, int line, char* msg) {
+	pbg_err_syntax(&p->_err, line, __FILE__, "", 0, msg);
 }
 
+
+/****************************
+ *                          *
+ * FIELD EVALUATION TOOLKIT *
+ *                          *
+ ****************************/
+
 int pbg_evaluate_op_exst(pbg_expr* e, pbg_error* err, pbg_field* field)
 {
 	int i, childi;
@@ -864,10 +1754,10 @@ int pbg_evaluate_op_exst(pbg_expr* e, pbg_error* err, pbg_field* field)
 
 int pbg_evaluate_op_eq(pbg_expr* e, pbg_error* err, pbg_field* field)
 {
-	int i, child0, childi, result;
+	int i, child0, childi;
 	pbg_field* c0, *ci;
-	PBG_UNUSED(err);
-	/* Ensure type and size of all children are identical. */
+	/* Ensure type and size of all children are identical. BOOLs are 
+	 * evaluated and compared by pbg_evaluate_resume instead. */
 	child0 = ((int*)field->_data)[0];
 	c0 = pbg_field_get(e, child0);
 	if(c0->_type == PBG_NULL) {
@@ -875,226 +1765,5838 @@ int pbg_evaluate_op_eq(pbg_expr* e, pbg_error* err, pbg_field* field)
 				"NULL input given to EQ operator.");
 		return PBG_ERROR;
 	}
-	/* We have a bunch of BOOLs! Evaluate them. */
-	if(pbg_type_isbool(c0->_type)) {
-		result = pbg_evaluate_r(e, err, c0);
-		for(i = 1; i < field->_int; i++) {
-			childi = ((int*)field->_data)[i];
-			ci = pbg_field_get(e, childi);
-			if(ci->_type == PBG_NULL) {
-				pbg_err_op_arg_type(err, __LINE__, __FILE__, 
-						"NULL input given to EQ operator.");
-				return PBG_ERROR;
-			}
-			if(result != pbg_evaluate_r(e, err, ci))
-				return PBG_FALSE;
+	for(i = 1; i < field->_int; i++) {
+		childi = ((int*)field->_data)[i];
+		ci = pbg_field_get(e, childi);
+		if(ci->_type == PBG_NULL) {
+			pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+					"NULL input given to EQ operator.");
+			return PBG_ERROR;
 		}
-		return PBG_TRUE;
-	/* We don't have a bunch of BOOLs! Do standard equality test. */
+		if(ci->_int != c0->_int || 
+				ci->_type != c0->_type)
+			return PBG_FALSE;
+		/* Ensure each data byte is identical. */
+		if(memcmp(ci->_data, c0->_data, c0->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+int pbg_evaluate_op_neq(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	int child0, child1;
+	pbg_field* c0, *c1;
+	PBG_UNUSED(err);
+	child0 = ((int*)field->_data)[0], child1 = ((int*)field->_data)[1];
+	c0 = pbg_field_get(e, child0), c1 = pbg_field_get(e, child1);
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL) {
+		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+				"NULL input given to NEQ operator.");
+		return PBG_ERROR;
+	}
+	/* Do standard difference check. Two BOOLs are evaluated and compared by
+	 * pbg_evaluate_resume instead. */
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+int pbg_evaluate_op_order(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	int result;
+	int child0, child1;
+	pbg_field* c0, *c1;
+	child0 = ((int*)field->_data)[0], child1 = ((int*)field->_data)[1];
+	c0 = pbg_field_get(e, child0), c1 = pbg_field_get(e, child1);
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL) {
+		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+				"NULL input given to comparison operator.");
+		return PBG_ERROR;
+	}
+	result = -2;
+	/* Both are NUMBERs. */
+	if(c0->_type == PBG_LT_NUMBER &&
+			c1->_type == PBG_LT_NUMBER)
+		result = pbg_cmpnumber(c0->_data, c1->_data);
+	/* Both are DATEs. */
+	if(c0->_type == PBG_LT_DATE &&
+			c1->_type == PBG_LT_DATE)
+		result = pbg_cmpdate(c0->_data, c1->_data);
+	/* Both are STRINGs. */
+	if(c0->_type == PBG_LT_STRING &&
+			c1->_type == PBG_LT_STRING)
+		result = pbg_cmpstring(c0->_data, c0->_int, c1->_data, c1->_int);
+	/* Two BOOLs are evaluated and compared by pbg_evaluate_resume. */
+	return pbg_evaluate_order(err, field, result);
+}
+
+/**
+ * Concludes a comparison operator given the comparison of its arguments.
+ * @param err     Used to store error, if any.
+ * @param field   Comparison operator.
+ * @param result  Negative, zero, or positive if the first argument is less
+ *                than, equal to, or greater than the second; -2 if the 
+ *                arguments cannot be compared.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_order(pbg_error* err, pbg_field* field, int result)
+{
+	/* Check if mismatched or invalid types. */
+	if(result == -2) {
+		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+				"Unknown input type to comparison operator");
+		return PBG_ERROR;
+	/* Compare results according to type of comparison operator. */
 	}else{
-		for(i = 1; i < field->_int; i++) {
-			childi = ((int*)field->_data)[i];
-			ci = pbg_field_get(e, childi);
-			if(ci->_type == PBG_NULL) {
+		if(field->_type == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+		if(field->_type == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+		if(field->_type == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		if(field->_type == PBG_OP_GTE) return result >= 0 ? PBG_TRUE : PBG_FALSE;
+		pbg_err_state(err, __LINE__, __FILE__, 
+				"Unknown result from select comparison function.");
+		return PBG_ERROR;
+	}
+}
+
+int pbg_evaluate_op_type(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	int i, child0, childi;
+	pbg_field* c0, *ci;
+	pbg_field_type type;
+	child0 = ((int*)field->_data)[0];
+	c0 = pbg_field_get(e, child0);
+	type = c0->_type;
+	/* Ensure the first argument is a type literal. */
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP) {
+		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+				"First input to TYPE operator must be a type literal.");
+		return PBG_ERROR;
+	}
+	/* Verify types of all trailing arguments. */
+	for(i = 1; i < field->_int; i++) {
+		childi = ((int*)field->_data)[i];
+		ci = pbg_field_get(e, childi);
+		if(type == PBG_LT_TP_BOOL && !pbg_type_isbool(ci->_type))
+			return PBG_FALSE;
+		if(type == PBG_LT_TP_DATE && ci->_type != PBG_LT_DATE)
+			return PBG_FALSE;
+		if(type == PBG_LT_TP_NUMBER && ci->_type != PBG_LT_NUMBER)
+			return PBG_FALSE;
+		if(type == PBG_LT_TP_STRING && ci->_type != PBG_LT_STRING)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+/**
+ * Evaluates a string operator. Every argument must be a STRING; the patterns
+ * of an operator compiled by pbg_match_compile are known to be.
+ * @param e      PBG expression the field belongs to.
+ * @param err    Used to store error, if any.
+ * @param field  String operator to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_op_match(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	int i, n, *children;
+	pbg_field* c0, *ci;
+	children = (int*) field->_data;
+	c0 = pbg_field_get(e, children[0]);
+	n = (field->_type >= PBG_AC_PFX) ? 1 : field->_int;
+	for(i = 0; i < n; i++) {
+		ci = pbg_field_get(e, children[i]);
+		if(ci->_type == PBG_NULL) {
+			pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+					"NULL input given to string operator.");
+			return PBG_ERROR;
+		}
+		if(ci->_type != PBG_LT_STRING) {
+			pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+					"Non-STRING input given to string operator.");
+			return PBG_ERROR;
+		}
+	}
+	if(field->_type >= PBG_AC_PFX)
+		return pbg_match_scan((pbg_matcher*) (children + field->_int), 
+				field->_type, (unsigned char*) c0->_data, c0->_int);
+	for(i = 1; i < field->_int; i++)
+		if(pbg_match_one(field->_type, c0, pbg_field_get(e, children[i])))
+			return PBG_TRUE;
+	return PBG_FALSE;
+}
+
+/**
+ * Evaluates a monomorphic comparison made by pbg_specialize. Its arguments are
+ * only checked against the type it was specialized to.
+ * @param e      PBG expression the field belongs to.
+ * @param err    Used to store error, if any.
+ * @param field  Monomorphic comparison to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_sp(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	pbg_field* c0, *c1;
+	pbg_field_type type;
+	int sp, result;
+	sp = field->_type - PBG_SP_NUMBER_EQ;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	c0 = pbg_field_get(e, ((int*)field->_data)[0]);
+	c1 = pbg_field_get(e, ((int*)field->_data)[1]);
+	if(c0->_type != type || c1->_type != type) {
+		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+				"Input does not match its declared type.");
+		return PBG_ERROR;
+	}
+	/* EQ and NEQ compare bytes, as pbg_evaluate_op_eq does. */
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && 
+				memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	if(type == PBG_LT_NUMBER)
+		result = pbg_cmpnumber(c0->_data, c1->_data);
+	else if(type == PBG_LT_DATE)
+		result = pbg_cmpdate(c0->_data, c1->_data);
+	else
+		result = pbg_cmpstring(c0->_data, c0->_int, c1->_data, c1->_int);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+/**
+ * Evaluates a comparison of a variable to a constant fused by pbg_fuse. When
+ * the variable is of the type of the constant, it is compared to the inline 
+ * constant at once. Otherwise the comparison is evaluated as it was parsed.
+ * @param e      PBG expression the field belongs to.
+ * @param err    Used to store error, if any.
+ * @param field  Fused comparison to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_fused(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	pbg_fused* fu;
+	pbg_field* var;
+	int result;
+	fu = (pbg_fused*) field->_data;
+	var = pbg_field_get(e, fu->_var);
+	if(var->_type != fu->_const._type)
+		return pbg_evaluate_unfused(e, err, field, var);
+	/* EQ and NEQ compare bytes, as pbg_evaluate_op_eq does. */
+	if(fu->_cmp == PBG_OP_EQ || fu->_cmp == PBG_OP_NEQ) {
+		result = (var->_int == fu->_const._int && 
+				memcmp(var->_data, fu->_const._data, var->_int) == 0);
+		return (result == (fu->_cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	/* Compare the variable to the constant. */
+	if(field->_type == PBG_FU_NUMBER)
+		result = pbg_cmpnumber(var->_data, &fu->_number);
+	else if(field->_type == PBG_FU_DATE)
+		result = pbg_cmpdate(var->_data, &fu->_date);
+	else
+		result = pbg_cmpstring(var->_data, var->_int, fu->_const._data, 
+				fu->_const._int);
+	switch(fu->_cmp) {
+		case PBG_OP_LT:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case PBG_OP_GT:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case PBG_OP_LTE: return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default:         return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+/**
+ * Evaluates a fused comparison whose variable is not of the type of its
+ * constant, yielding what the comparison would as parsed.
+ * @param e      PBG expression the field belongs to.
+ * @param err    Used to store error, if any.
+ * @param field  Fused comparison to evaluate.
+ * @param var    Variable of the comparison.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_unfused(pbg_expr* e, pbg_error* err, pbg_field* field, 
+		pbg_field* var)
+{
+	pbg_fused* fu;
+	pbg_field parsed;
+	fu = (pbg_fused*) field->_data;
+	if(fu->_strict) {
+		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+				"Input does not match its declared type.");
+		return PBG_ERROR;
+	}
+	/* A leading BOOL makes EQ evaluate every argument as a BOOL. The constant
+	 * is not one, so it fails to evaluate and differs from the variable. */
+	if(fu->_op == PBG_OP_EQ && fu->_children[0] == fu->_var && 
+			pbg_type_isbool(var->_type)) {
+		pbg_err_state(err, __LINE__, __FILE__, 
+				"Cannot evaluate a non-BOOL value.");
+		return PBG_FALSE;
+	}
+	parsed = *field;
+	parsed._type = fu->_op;
+	return pbg_evaluate_field(e, err, &parsed);
+}
+
+/**
+ * Evaluates the given BOOL field. Operators whose children are BOOLs are 
+ * evaluated with an explicit stack of frames rather than by recursion, so the
+ * depth of the expression is only bounded by memory. When compiled with 
+ * PBG_PROFILE, the outcome and duration of the evaluation of every field are
+ * recorded in its statistics. When evaluated through a pbg_incr, results are
+ * cached with their fields.
+ * @param e     PBG expression the field belongs to.
+ * @param err   Used to store error, if any.
+ * @param root  Field to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_r(pbg_expr* e, pbg_error* err, pbg_field* root)
+{
+	pbg_frame local[PBG_FRAMES];
+	pbg_eval ev;
+	int result;
+	
+	/* Shallow expressions never leave the frames on the C stack. */
+	ev._frames = local;
+	ev._cap = PBG_FRAMES;
+	ev._depth = 0;
+	local[0]._field = root;
+	result = pbg_evaluate_run(e, err, &ev, local, NULL);
+	if(ev._frames != local) free(ev._frames);
+	return result;
+}
+
+/**
+ * Evaluates the stack of frames of an evaluation, beginning with the field of
+ * its deepest frame. A resumable evaluation stops before beginning a field 
+ * which needs a variable that has not been supplied, see pbg_eval_unbound, so
+ * that it begins it again once resumed.
+ * @param e       PBG expression the fields belong to.
+ * @param err     Used to store error, if any.
+ * @param ev      Frames of the evaluation, which are grown as needed.
+ * @param local   Frames which must not be freed when grown, or NULL if the 
+ *                evaluation is resumable.
+ * @param budget  Budget spent by each field begun, or NULL if unbounded.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR,
+ *         PBG_NEED if the variable set in the evaluation's result must be 
+ *         supplied first.
+ */
+int pbg_evaluate_run(pbg_expr* e, pbg_error* err, pbg_eval* ev, 
+		pbg_frame* local, pbg_budget* budget)
+{
+	pbg_frame* frames, *f, *grown;
+	int depth, result, cached;
+	frames = (pbg_frame*) ev->_frames;
+	depth = ev->_depth;
+	for(;;) {
+		/* Suspend until the variables the field needs are supplied. */
+		f = frames + depth;
+		if(local == NULL && (result = pbg_eval_unbound(e, f->_field)) >= 0) {
+			ev->_depth = depth;
+			ev->_result = result;
+			return PBG_NEED;
+		}
+		/* Give up once the budget is spent, whatever the fields left. */
+		if(budget != NULL && !pbg_budget_spend(budget)) {
+			pbg_err_budget(err, __LINE__, __FILE__);
+			return PBG_ERROR;
+		}
+		/* Reuse the last result of the field if its variables are unchanged.
+		 * Otherwise begin evaluating it. */
+		cached = e->_incr != NULL && pbg_incr_cached(e, err, f->_field, &result);
+		if(!cached) {
+#ifdef PBG_PROFILE
+			f->_start = pbg_profile_clock();
+#endif
+			result = pbg_evaluate_begin(e, err, f);
+		}
+		/* Hand results to parent frames until one needs another child. */
+		while(result != PBG_EVAL_CHILD) {
+			if(!cached) {
+#ifdef PBG_PROFILE
+				pbg_profile_record(e, f->_field, result, f->_start);
+#endif
+				if(e->_incr != NULL)
+					pbg_incr_store(e, err, f->_field, result);
+			}
+			cached = 0;
+			if(depth == 0)
+				return result;
+			f = frames + --depth;
+			result = pbg_evaluate_resume(e, err, f, result);
+		}
+		/* Push a frame for the child, growing the stack as needed. */
+		if(depth+1 == ev->_cap) {
+			grown = malloc(2*ev->_cap * sizeof(pbg_frame));
+			if(grown == NULL) {
+				pbg_err_alloc(err, __LINE__, __FILE__);
+				return PBG_ERROR;
+			}
+			memcpy(grown, frames, ev->_cap * sizeof(pbg_frame));
+			if(frames != local) free(frames);
+			ev->_frames = frames = grown;
+			ev->_cap *= 2;
+		}
+		frames[depth+1]._field = frames[depth]._child;
+		depth++;
+	}
+}
+
+/**
+ * Begins the evaluation of the field of a frame. Leaves and operators whose
+ * children are not BOOLs are evaluated at once.
+ * @param e    PBG expression the field belongs to.
+ * @param err  Used to store error, if any.
+ * @param f    Frame of the field to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR,
+ *         PBG_EVAL_CHILD if the child set in the frame must be evaluated 
+ *         first, see pbg_evaluate_resume.
+ */
+int pbg_evaluate_begin(pbg_expr* e, pbg_error* err, pbg_frame* f)
+{
+	pbg_field* field;
+	int* children;
+	field = f->_field;
+	children = (int*) field->_data;
+	f->_next = 0;
+	switch(field->_type) {
+		case PBG_OP_NOT:
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			f->_child = pbg_field_get(e, children[0]);
+			return PBG_EVAL_CHILD;
+		case PBG_OP_EQ:
+			f->_child = pbg_field_get(e, children[0]);
+			if(pbg_type_isbool(f->_child->_type))
+				return PBG_EVAL_CHILD;
+			break;
+		case PBG_FU_NUMBER:
+		case PBG_FU_DATE:
+		case PBG_FU_STRING:
+			return pbg_evaluate_fused(e, err, field);
+		case PBG_OP_NEQ:
+		case PBG_OP_LT:
+		case PBG_OP_GT:
+		case PBG_OP_LTE:
+		case PBG_OP_GTE:
+			f->_child = pbg_field_get(e, children[0]);
+			if(pbg_type_isbool(f->_child->_type) && 
+					pbg_type_isbool(pbg_field_get(e, children[1])->_type))
+				return PBG_EVAL_CHILD;
+			break;
+		default:
+			break;
+	}
+	return pbg_evaluate_field(e, err, field);
+}
+
+/**
+ * Resumes the evaluation of the field of a frame with the result of the child
+ * it asked for.
+ * @param e       PBG expression the field belongs to.
+ * @param err     Used to store error, if any.
+ * @param f       Frame of the field being evaluated.
+ * @param result  Result of the child.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR,
+ *         PBG_EVAL_CHILD if the next child set in the frame must be evaluated.
+ */
+int pbg_evaluate_resume(pbg_expr* e, pbg_error* err, pbg_frame* f, int result)
+{
+	pbg_field* field;
+	int* children, last;
+	field = f->_field;
+	children = (int*) field->_data;
+	last = (f->_next == field->_int-1);
+	switch(field->_type) {
+		case PBG_OP_NOT:
+			if(result == PBG_ERROR) return PBG_ERROR;  /* Pass error through. */
+			return result == PBG_TRUE ? PBG_FALSE : PBG_TRUE;
+		case PBG_OP_AND:
+			if(result == PBG_ERROR) return PBG_ERROR;  /* Pass error through. */
+			if(result == PBG_FALSE) return PBG_FALSE;
+			if(last) return PBG_TRUE;
+			break;
+		case PBG_OP_OR:
+			if(result == PBG_ERROR) return PBG_ERROR;  /* Pass error through. */
+			if(result == PBG_TRUE)  return PBG_TRUE;
+			if(last) return PBG_FALSE;
+			break;
+		case PBG_OP_EQ:
+			/* We have a bunch of BOOLs! Compare them to the first. */
+			if(f->_next == 0) f->_first = result;
+			else if(result != f->_first) return PBG_FALSE;
+			if(last) return PBG_TRUE;
+			if(pbg_field_get(e, children[f->_next+1])->_type == PBG_NULL) {
 				pbg_err_op_arg_type(err, __LINE__, __FILE__, 
 						"NULL input given to EQ operator.");
 				return PBG_ERROR;
 			}
-			if(ci->_int != c0->_int || 
-					ci->_type != c0->_type)
-				return PBG_FALSE;
-			/* Ensure each data byte is identical. */
-			if(memcmp(ci->_data, c0->_data, c0->_int) != 0)
-				return PBG_FALSE;
+			break;
+		case PBG_OP_NEQ:
+			/* We have two BOOLs! Check if they are different. */
+			if(f->_next == 0) f->_first = result;
+			else return (f->_first != result) ? PBG_TRUE : PBG_FALSE;
+			break;
+		default:
+			/* We have two BOOLs! Order them. */
+			if(f->_next == 0) f->_first = result;
+			else return pbg_evaluate_order(err, field, f->_first - result);
+			break;
+	}
+	f->_child = pbg_field_get(e, children[++f->_next]);
+	return PBG_EVAL_CHILD;
+}
+
+/**
+ * Evaluates a field which does not need its children evaluated: a BOOL 
+ * literal, or an operator on non-BOOL fields.
+ * @param e      PBG expression the field belongs to.
+ * @param err    Used to store error, if any.
+ * @param field  Field to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_field(pbg_expr* e, pbg_error* err, pbg_field* field)
+{
+	if(pbg_type_isbool(field->_type)) {
+		switch(field->_type) {
+			case PBG_OP_EXST:  return pbg_evaluate_op_exst(e, err, field);
+			case PBG_OP_EQ:    return pbg_evaluate_op_eq(e, err, field);
+			case PBG_OP_NEQ:   return pbg_evaluate_op_neq(e, err, field);
+			case PBG_OP_LT:
+			case PBG_OP_GT:
+			case PBG_OP_LTE:
+			case PBG_OP_GTE:   return pbg_evaluate_op_order(e, err, field);
+			case PBG_OP_TYPE:  return pbg_evaluate_op_type(e, err, field);
+			case PBG_OP_PFX:
+			case PBG_OP_SFX:
+			case PBG_OP_CONT:
+			case PBG_AC_PFX:
+			case PBG_AC_SFX:
+			case PBG_AC_CONT:  return pbg_evaluate_op_match(e, err, field);
+			case PBG_LT_TRUE:  return PBG_TRUE;
+			case PBG_LT_FALSE: return PBG_FALSE;
+			case PBG_FU_NUMBER:
+			case PBG_FU_DATE:
+			case PBG_FU_STRING: return pbg_evaluate_fused(e, err, field);
+			default:
+				if(field->_type >= PBG_SP_NUMBER_EQ)
+					return pbg_evaluate_sp(e, err, field);
+				pbg_err_state(err, __LINE__, __FILE__,
+						"Unsupported operation.");
+		}
+	}
+	pbg_err_state(err, __LINE__, __FILE__, 
+			"Cannot evaluate a non-BOOL value.");
+	return PBG_ERROR;
+}
+
+int pbg_evaluate(pbg_expr* e, pbg_error* err, pbg_field (*dict)(char*, int))
+{
+	int i, result;
+	pbg_field* newvars, *var;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Variable resolution. Lookup every variable in provided dictionary. */
+	newvars = (pbg_field*) malloc(e->_numvars * sizeof(pbg_field));
+	if(newvars == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return PBG_ERROR;
+	}
+	for(i = 0; i < e->_numvars; i++) {
+		var = e->_variables+i;
+		newvars[i] = dict((char*)(var->_data), var->_int);
+	}
+	
+	/* Evaluate expression! */
+	result = pbg_evaluate_vars(e, err, newvars);
+	
+	/* Clean up malloc'd memory. */
+	for(i = 0; i < e->_numvars; i++)
+		pbg_field_free(newvars+i);
+	free(newvars);
+	
+	/* Done! */
+	return result;
+}
+
+int pbg_evaluate_vars(pbg_expr* e, pbg_error* err, pbg_field* vars)
+{
+	pbg_expr bound;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Variables must be of the types declared by pbg_specialize. */
+	if(e->_schema != NULL && !pbg_check_schema(e, err, vars))
+		return PBG_ERROR;
+	
+	/* Evaluate a shallow copy of the expression bound to the given variables,
+	 * leaving the shared expression untouched. */
+	bound = *e;
+	bound._variables = vars;
+	return pbg_evaluate_r(&bound, err, bound._constants);
+}
+
+int pbg_evaluate_lazy(pbg_expr* e, pbg_error* err, pbg_field* vars, 
+		pbg_field (*resolve)(void*, int), void* ctx)
+{
+	pbg_resolver resolver;
+	int i;
+	
+	/* Mark every variable as unresolved. These are resolved on first access
+	 * by pbg_field_get. */
+	resolver._resolve = resolve;
+	resolver._ctx = ctx;
+	for(i = 0; i < e->_numvars; i++)
+		vars[i] = pbg_field_init(PBG_LT_VAR, PBG_LAZY, &resolver);
+	return pbg_evaluate_vars(e, err, vars);
+}
+
+long pbg_evaluate_multiget(pbg_expr* e, pbg_error* err, long numrecords, 
+		pbg_field* vars, int* results, 
+		void (*multiget)(void*, char**, int*, int, long, pbg_field*), 
+		void* ctx)
+{
+	pbg_error recerr;
+	char** names;
+	int* lens;
+	int i, result;
+	long r, numtrue;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Resolve every variable of every record at once. */
+	if(e->_numvars > 0 && numrecords > 0) {
+		names = malloc(e->_numvars * sizeof(char*));
+		lens = malloc(e->_numvars * sizeof(int));
+		if(names == NULL || lens == NULL) {
+			free(names);
+			free(lens);
+			pbg_err_alloc(err, __LINE__, __FILE__);
+			return PBG_ERROR;
+		}
+		for(i = 0; i < e->_numvars; i++)
+			names[i] = pbg_var_name(e, i, lens+i);
+		multiget(ctx, names, lens, e->_numvars, numrecords, vars);
+		free(names);
+		free(lens);
+	}
+	
+	/* Evaluate each record, keeping the first error. */
+	for(r = numtrue = 0; r < numrecords; r++) {
+		result = pbg_evaluate_vars(e, &recerr, vars + r*e->_numvars);
+		if(recerr._type != PBG_ERR_NONE) {
+			result = PBG_ERROR;
+			if(err->_type == PBG_ERR_NONE)
+				*err = recerr;
+		}
+		numtrue += (result == PBG_TRUE);
+		if(results != NULL)
+			results[r] = result;
+	}
+	return numtrue;
+}
+
+int pbg_evaluate_budget(pbg_expr* e, pbg_error* err, pbg_field* vars, 
+		long visits, long nsec)
+{
+	pbg_frame local[PBG_FRAMES];
+	pbg_budget budget;
+	pbg_expr bound;
+	pbg_eval ev;
+	int result;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Variables must be of the types declared by pbg_specialize. */
+	if(e->_schema != NULL && !pbg_check_schema(e, err, vars))
+		return PBG_ERROR;
+	
+	/* Bind a shallow copy of the expression as pbg_evaluate_vars does, 
+	 * without caching or profiling, so that an evaluation given up on 
+	 * leaves nothing behind. */
+	bound = *e;
+	bound._variables = vars;
+	bound._incr = NULL;
+#ifdef PBG_PROFILE
+	bound._stats = NULL;
+#endif
+	budget._visits = (visits < 0) ? -1 : visits;
+	budget._deadline = (nsec <= 0) ? 0 : pbg_budget_clock() + nsec;
+	budget._check = PBG_BUDGET_CHECK;
+	ev._frames = local;
+	ev._cap = PBG_FRAMES;
+	ev._depth = 0;
+	local[0]._field = bound._constants;
+	result = pbg_evaluate_run(&bound, err, &ev, local, &budget);
+	if(ev._frames != local) free(ev._frames);
+	return result;
+}
+
+long pbg_cost(pbg_expr* e)
+{
+	pbg_field* field;
+	long* costs, cost, total;
+	int* stack, *children;
+	char* expanded;
+	int i, k, n, depth;
+	costs = malloc((e->_numconst+1) * sizeof(long));
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	expanded = calloc(e->_numconst+1, 1);
+	if(costs == NULL || stack == NULL || expanded == NULL) {
+		free(costs);
+		free(stack);
+		free(expanded);
+		return -1;
+	}
+	
+	/* Cost the children of an operator before the operator. Each child which
+	 * may be evaluated in a frame of its own costs as much as it does at the
+	 * root, and a variable which may be a BOOL costs one field. */
+	depth = 0;
+	stack[depth++] = 1;
+	while(depth > 0) {
+		k = stack[depth-1];
+		field = e->_constants + (k-1);
+		children = (int*) field->_data;
+		n = pbg_cost_children(e, field);
+		if(!expanded[k]) {
+			expanded[k] = 1;
+			for(i = 0; i < n; i++)
+				if(children[i] > 0 && !expanded[children[i]])
+					stack[depth++] = children[i];
+			continue;
+		}
+		depth--;
+		for(i = 0, total = 1; i < n; i++) {
+			cost = (children[i] > 0) ? costs[children[i]] : 1;
+			total = (total > LONG_MAX - cost) ? LONG_MAX : total + cost;
+		}
+		costs[k] = total;
+	}
+	total = costs[1];
+	free(costs);
+	free(stack);
+	free(expanded);
+	return total;
+}
+
+/**
+ * Counts the children of a field which pbg_evaluate_begin may evaluate in
+ * frames of their own: every child of NOT, AND, and OR, and those of a 
+ * comparison whose arguments may be BOOLs. Variables may be anything.
+ * @param e      PBG expression the field belongs to.
+ * @param field  Field to inspect.
+ * @return the number of children, which come first among its children.
+ */
+int pbg_cost_children(pbg_expr* e, pbg_field* field)
+{
+	int* children;
+	children = (int*) field->_data;
+	switch(field->_type) {
+		case PBG_OP_NOT:
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			return field->_int;
+		case PBG_OP_EQ:
+			if(children[0] < 0 || 
+					pbg_type_isbool(pbg_field_get(e, children[0])->_type))
+				return field->_int;
+			return 0;
+		case PBG_OP_NEQ:
+		case PBG_OP_LT:
+		case PBG_OP_GT:
+		case PBG_OP_LTE:
+		case PBG_OP_GTE:
+			if((children[0] < 0 || 
+					pbg_type_isbool(pbg_field_get(e, children[0])->_type)) &&
+					(children[1] < 0 || 
+					pbg_type_isbool(pbg_field_get(e, children[1])->_type)))
+				return 2;
+			return 0;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Spends a field of the budget of an evaluation, reading the clock once in 
+ * PBG_BUDGET_CHECK fields.
+ * @param budget  Budget to spend.
+ * @return 1 if the field may be begun, 0 if the budget is spent.
+ */
+int pbg_budget_spend(pbg_budget* budget)
+{
+	if(budget->_visits == 0)
+		return 0;
+	if(budget->_visits > 0)
+		budget->_visits--;
+	if(budget->_deadline > 0 && --budget->_check == 0) {
+		budget->_check = PBG_BUDGET_CHECK;
+		if(pbg_budget_clock() >= budget->_deadline) {
+			budget->_visits = 0;
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Reads a clock for budgets of time: the monotonic clock where POSIX has 
+ * one, and the processor time of the program otherwise.
+ * @return the time in nanoseconds, from an arbitrary origin.
+ */
+double pbg_budget_clock(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+#else
+	return clock() * (1e9 / CLOCKS_PER_SEC);
+#endif
+}
+
+int pbg_numvars(pbg_expr* e) {
+	return e->_numvars;
+}
+
+char* pbg_var_name(pbg_expr* e, int i, int* n)
+{
+	if(n != NULL) *n = e->_variables[i]._int;
+	return (char*) e->_variables[i]._data;
+}
+
+
+/************************
+ *                      *
+ * JANITORIAL FUNCTIONS *
+ *                      *
+ ************************/
+
+void pbg_free(pbg_expr* e)
+{
+	int i;
+	
+	/* Free individual constant fields. Some do not have _data malloc'd. */
+	for(i = e->_numconst-1; i >= 0; i--)
+		pbg_field_free(e->_constants+i);
+	
+	/* Free individual variable fields. All have _data malloc'd. */
+	for(i = 0; i < e->_numvars; i++)
+		pbg_field_free(e->_variables+i);
+	
+	/* Free internal field arrays. */
+	if(e->_constants != NULL) free(e->_constants);
+	if(e->_variables != NULL) free(e->_variables);
+	if(e->_schema != NULL) free(e->_schema);
+	e->_schema = NULL;
+	
+#ifdef PBG_PROFILE
+	/* Free statistics and the copy of the source. */
+	if(e->_stats != NULL) free(e->_stats);
+	if(e->_source != NULL) free(e->_source);
+	e->_stats = NULL;
+	e->_source = NULL;
+#endif
+}
+
+
+/*************************
+ *                       *
+ * SCHEMA SPECIALIZATION *
+ *                       *
+ *************************/
+
+void pbg_specialize(pbg_expr* e, pbg_error* err, 
+		pbg_field_type (*schema)(char*, int))
+{
+	pbg_field_type* types;
+	int i, apply;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Declare the type of every variable. */
+	types = malloc((e->_numvars+1) * sizeof(pbg_field_type));
+	if(types == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return;
+	}
+	for(i = 0; i < e->_numvars; i++) {
+		types[i] = schema((char*) e->_variables[i]._data, e->_variables[i]._int);
+		if(types[i] != PBG_NULL && types[i] != PBG_LT_NUMBER && 
+				types[i] != PBG_LT_DATE && types[i] != PBG_LT_STRING) {
+			pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+					"Variables may only be declared NUMBER, DATE, or STRING.");
+			free(types);
+			return;
+		}
+		/* Keep the declarations of a previous specialization. */
+		if(types[i] == PBG_NULL && e->_schema != NULL)
+			types[i] = e->_schema[i];
+	}
+	
+	/* Check every operator first, so the expression is unchanged on error. */
+	for(apply = 0; apply < 2; apply++)
+		for(i = 0; i < e->_numconst; i++)
+			if(!pbg_specialize_field(e, err, types, e->_constants+i, apply)) {
+				free(types);
+				return;
+			}
+	free(e->_schema);
+	e->_schema = types;
+}
+
+/**
+ * Finds the type a field is known to have whatever the variables it is given.
+ * @param e       Expression the field belongs to.
+ * @param schema  Declared type of each variable.
+ * @param index   Index of the field.
+ * @return the type of the field, PBG_SP_BOOL for any BOOL field, or PBG_NULL 
+ *         if its type is not known.
+ */
+pbg_field_type pbg_static_type(pbg_expr* e, pbg_field_type* schema, int index)
+{
+	pbg_field_type type;
+	if(index < 0)
+		return schema[-index-1];
+	type = pbg_field_get(e, index)->_type;
+	return pbg_type_isbool(type) ? PBG_SP_BOOL : type;
+}
+
+/**
+ * Specializes a single operator, see pbg_specialize.
+ * @param e       Expression the field belongs to.
+ * @param err     Used to store error, if any.
+ * @param schema  Declared type of each variable.
+ * @param field   Field to specialize. Only operators are specialized.
+ * @param apply   Whether to change the field, or only to check it.
+ * @return 1 if successful, 0 if the field can never be evaluated.
+ */
+int pbg_specialize_field(pbg_expr* e, pbg_error* err, pbg_field_type* schema,
+		pbg_field* field, int apply)
+{
+	pbg_field_type op, t0, t1, ti;
+	int* children, i, known, matches, scalar;
+	children = (int*) field->_data;
+	/* Fused comparisons and compiled string operators are checked as the 
+	 * operators they were. */
+	op = pbg_canonical_type(field);
+	switch(op) {
+		case PBG_OP_EXST:
+			/* Declared variables, literals, and operators are never NULL. */
+			for(i = 0; i < field->_int; i++)
+				if(pbg_static_type(e, schema, children[i]) == PBG_NULL)
+					return 1;
+			if(apply) pbg_fold(field, PBG_TRUE);
+			return 1;
+		case PBG_OP_TYPE:
+			t0 = pbg_static_type(e, schema, children[0]);
+			if(t0 <= PBG_MIN_LT_TP || t0 >= PBG_MAX_LT_TP)
+				return 1;
+			known = matches = 1;
+			for(i = 1; i < field->_int; i++) {
+				ti = pbg_static_type(e, schema, children[i]);
+				if(ti == PBG_NULL) known = 0;
+				else if(!((t0 == PBG_LT_TP_BOOL && ti == PBG_SP_BOOL) ||
+						(t0 == PBG_LT_TP_DATE && ti == PBG_LT_DATE) ||
+						(t0 == PBG_LT_TP_NUMBER && ti == PBG_LT_NUMBER) ||
+						(t0 == PBG_LT_TP_STRING && ti == PBG_LT_STRING)))
+					matches = 0;
+			}
+			/* A single known mismatch decides the check. */
+			if(apply && (known || !matches)) pbg_fold(field, matches);
+			return 1;
+		case PBG_OP_PFX:
+		case PBG_OP_SFX:
+		case PBG_OP_CONT:
+			for(i = 0; i < field->_int; i++) {
+				ti = pbg_static_type(e, schema, children[i]);
+				if(ti != PBG_NULL && ti != PBG_LT_STRING) {
+					pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+							"Non-STRING input given to string operator.");
+					return 0;
+				}
+			}
+			return 1;
+		case PBG_OP_EQ:
+		case PBG_OP_NEQ:
+		case PBG_OP_LT:
+		case PBG_OP_GT:
+		case PBG_OP_LTE:
+		case PBG_OP_GTE:
+			if(field->_int != 2)
+				return 1;
+			t0 = pbg_static_type(e, schema, children[0]);
+			t1 = pbg_static_type(e, schema, children[1]);
+			if(t0 == PBG_NULL || t1 == PBG_NULL || 
+					t0 == PBG_SP_BOOL || t1 == PBG_SP_BOOL)
+				return 1;
+			scalar = (t0 == PBG_LT_NUMBER || t0 == PBG_LT_DATE || 
+					t0 == PBG_LT_STRING);
+			/* Lower comparisons of a single type. Fused comparisons are already
+			 * as fast, but must now reject variables of other types. */
+			if(t0 == t1 && scalar) {
+				if(apply && op != field->_type)
+					((pbg_fused*) field->_data)->_strict = 1;
+				else if(apply) field->_type = (t0 == PBG_LT_NUMBER ? PBG_SP_NUMBER_EQ :
+						t0 == PBG_LT_DATE ? PBG_SP_DATE_EQ : PBG_SP_STRING_EQ) + 
+						(op == PBG_OP_EQ ? 0 : op == PBG_OP_NEQ ? 1 :
+						op == PBG_OP_LT ? 2 : op == PBG_OP_GT ? 3 :
+						op == PBG_OP_LTE ? 4 : 5);
+				return 1;
+			}
+			/* Values of different types are never equal. */
+			if(op == PBG_OP_EQ || op == PBG_OP_NEQ) {
+				if(apply && t0 != t1) pbg_fold(field, op == PBG_OP_NEQ);
+				return 1;
+			}
+			pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+					"Mismatched input types to comparison operator.");
+			return 0;
+		default:
+			return 1;
+	}
+}
+
+/**
+ * Replaces an operator by a BOOL literal. Its children are left in the 
+ * expression, unreferenced.
+ * @param field  Operator to replace.
+ * @param truth  Value of the operator.
+ */
+void pbg_fold(pbg_field* field, int truth)
+{
+	free(field->_data);
+	*field = pbg_field_init(truth ? PBG_LT_TRUE : PBG_LT_FALSE, 0, NULL);
+}
+
+/**
+ * Checks variables against the types declared by pbg_specialize. Variables
+ * which are yet to be resolved by pbg_evaluate_lazy are not checked.
+ * @param e     Specialized expression.
+ * @param err   Used to store error, if any.
+ * @param vars  One field for each variable of e.
+ * @return 1 if every variable is of its declared type, 0 otherwise.
+ */
+int pbg_check_schema(pbg_expr* e, pbg_error* err, pbg_field* vars)
+{
+	int i;
+	for(i = 0; i < e->_numvars; i++)
+		if(e->_schema[i] != PBG_NULL && vars[i]._type != PBG_LT_VAR && 
+				vars[i]._type != e->_schema[i]) {
+			pbg_err_op_arg_type(err, __LINE__, __FILE__, 
+					"Input does not match its declared type.");
+			return 0;
+		}
+	return 1;
+}
+
+/******************
+ *                *
+ * CANONICAL FORM *
+ *                *
+ ******************/
+
+void pbg_canonicalize(pbg_expr* e, pbg_error* err)
+{
+	unsigned char hash[PBG_HASH_SIZE];
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	if(!pbg_hash_r(e, 1, hash))
+		pbg_err_alloc(err, __LINE__, __FILE__);
+}
+
+void pbg_hash(pbg_expr* e, pbg_error* err, unsigned char* hash)
+{
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	if(!pbg_hash_r(e, 0, hash))
+		pbg_err_alloc(err, __LINE__, __FILE__);
+}
+
+int pbg_equal(pbg_expr* a, pbg_expr* b, pbg_error* err)
+{
+	pbg_field* fa, *fb;
+	int* stack;
+	int i, n, ia, ib, depth;
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Pairs of fields to compare, at most one per child of a. */
+	for(i = n = 0; i < a->_numconst; i++)
+		if(pbg_type_isop(a->_constants[i]._type))
+			n += a->_constants[i]._int;
+	stack = malloc((n+1) * 2 * sizeof(int));
+	if(stack == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return PBG_ERROR;
+	}
+	depth = 0;
+	stack[depth++] = 1;
+	stack[depth++] = 1;
+	while(depth > 0) {
+		ib = stack[--depth];
+		ia = stack[--depth];
+		if(!pbg_equal_field(a, ia, b, ib)) {
+			free(stack);
+			return PBG_FALSE;
+		}
+		if(ia < 0)
+			continue;
+		fa = a->_constants + (ia-1);
+		fb = b->_constants + (ib-1);
+		if(pbg_type_isop(fa->_type))
+			for(i = 0; i < fa->_int; i++) {
+				stack[depth++] = ((int*) fa->_data)[i];
+				stack[depth++] = ((int*) fb->_data)[i];
+			}
+	}
+	free(stack);
+	return PBG_TRUE;
+}
+
+/**
+ * Hashes an expression, see pbg_hash_fields.
+ * @param e     Expression to hash.
+ * @param sort  Whether to sort the arguments of commutative operators.
+ * @param hash  Filled with PBG_HASH_SIZE bytes of the hash of the root.
+ * @return 1 if successful, 0 if out of memory. The expression is unchanged
+ *         if out of memory.
+ */
+int pbg_hash_r(pbg_expr* e, int sort, unsigned char* hash)
+{
+	unsigned long* hashes, *root;
+	int i;
+	hashes = pbg_hash_fields(e, sort);
+	if(hashes == NULL)
+		return 0;
+	
+	/* Write the lanes of the root in little-endian order. */
+	root = pbg_hash_slot(e, hashes, 1);
+	for(i = 0; i < PBG_HASH_SIZE; i++)
+		hash[i] = (unsigned char) ((root[i/4] >> (8 * (i%4))) & 0xFF);
+	free(hashes);
+	return 1;
+}
+
+/**
+ * Hashes every field reachable from the root of an expression, children 
+ * before their parents, with an explicit stack. The arguments of commutative
+ * operators may first be sorted by their hashes, which yields the same order
+ * whatever order they were given in; arguments whose hashes are equal are 
+ * taken to be equal.
+ * @param e     Expression to hash.
+ * @param sort  Whether to sort the arguments of commutative operators.
+ * @return the hashes of the fields of e, see pbg_hash_slot, to be freed by 
+ *         the caller, or NULL if out of memory, in which case the expression
+ *         is unchanged.
+ */
+unsigned long* pbg_hash_fields(pbg_expr* e, int sort)
+{
+	pbg_field* field;
+	unsigned long* hashes;
+	int* stack, *tmp, *children;
+	char* expanded;
+	int i, k, depth, maxchildren;
+	
+	/* Allocate everything first, so the expression is left unchanged. */
+	for(i = maxchildren = 0; i < e->_numconst; i++)
+		if(pbg_type_isop(e->_constants[i]._type) && 
+				e->_constants[i]._int > maxchildren)
+			maxchildren = e->_constants[i]._int;
+	hashes = malloc((e->_numconst + e->_numvars) * PBG_HASH_LANES * 
+			sizeof(unsigned long));
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	tmp = malloc((maxchildren+1) * sizeof(int));
+	expanded = calloc(e->_numconst+1, 1);
+	if(hashes == NULL || stack == NULL || tmp == NULL || expanded == NULL) {
+		free(hashes);
+		free(stack);
+		free(tmp);
+		free(expanded);
+		return NULL;
+	}
+	
+	/* Variables are hashed by name, wherever they are used. */
+	for(i = 0; i < e->_numvars; i++)
+		pbg_hash_field(e, hashes, -(i+1), pbg_hash_slot(e, hashes, -(i+1)));
+	
+	/* Visit the children of an operator before hashing it. */
+	depth = 0;
+	stack[depth++] = 1;
+	while(depth > 0) {
+		k = stack[depth-1];
+		field = e->_constants + (k-1);
+		children = (int*) field->_data;
+		if(pbg_type_isop(field->_type) && !expanded[k]) {
+			expanded[k] = 1;
+			for(i = 0; i < field->_int; i++)
+				if(children[i] > 0)
+					stack[depth++] = children[i];
+			continue;
+		}
+		depth--;
+		if(sort && pbg_iscommutative(field))
+			pbg_sort_children(e, hashes, children, field->_int, tmp);
+		/* The patterns of a string operator may come in any order. */
+		else if(sort && pbg_canonical_type(field) >= PBG_OP_PFX && 
+				pbg_canonical_type(field) <= PBG_OP_CONT)
+			pbg_sort_children(e, hashes, children+1, field->_int-1, tmp);
+		pbg_hash_field(e, hashes, k, pbg_hash_slot(e, hashes, k));
+	}
+	free(stack);
+	free(tmp);
+	free(expanded);
+	return hashes;
+}
+
+/**
+ * Hashes a field given the hashes of its children. Fused comparisons hash as
+ * the comparisons they were parsed from, and variables hash by name.
+ * @param e       Expression the field belongs to.
+ * @param hashes  Hashes of the fields of e, see pbg_hash_slot.
+ * @param index   Index of the field.
+ * @param h       Filled with PBG_HASH_LANES lanes of hash.
+ */
+void pbg_hash_field(pbg_expr* e, unsigned long* hashes, int index, 
+		unsigned long* h)
+{
+	pbg_field* field;
+	pbg_lt_date* date;
+	unsigned long* child;
+	int i, j;
+	h[0] = 0x6A09E667UL;
+	h[1] = 0xBB67AE85UL;
+	h[2] = 0x3C6EF372UL;
+	h[3] = 0xA54FF53AUL;
+	/* Variables hold their names, see pbg_parse_var. */
+	field = (index < 0) ? e->_variables - (index+1) : e->_constants + (index-1);
+	if(index < 0) {
+		pbg_hash_word(h, PBG_LT_VAR);
+		pbg_hash_bytes(h, (unsigned char*) field->_data, field->_int);
+		return;
+	}
+	pbg_hash_word(h, pbg_canonical_type(field));
+	if(pbg_type_isop(field->_type)) {
+		pbg_hash_word(h, field->_int);
+		for(i = 0; i < field->_int; i++) {
+			child = pbg_hash_slot(e, hashes, ((int*) field->_data)[i]);
+			for(j = 0; j < PBG_HASH_LANES; j++)
+				pbg_hash_word(h, child[j]);
+		}
+	}
+	else if(field->_type == PBG_LT_DATE) {
+		date = (pbg_lt_date*) field->_data;
+		pbg_hash_word(h, date->_YYYY);
+		pbg_hash_word(h, date->_MM);
+		pbg_hash_word(h, date->_DD);
+	}
+	else
+		pbg_hash_bytes(h, (unsigned char*) field->_data, field->_int);
+}
+
+/**
+ * Finds the hash of a field: constants come first, then variables.
+ * @param e       Expression the field belongs to.
+ * @param hashes  Hashes of the fields of e.
+ * @param index   Index of the field.
+ * @return the PBG_HASH_LANES lanes of the hash of the field.
+ */
+unsigned long* pbg_hash_slot(pbg_expr* e, unsigned long* hashes, int index)
+{
+	if(index > 0)
+		return hashes + (index-1) * PBG_HASH_LANES;
+	return hashes + (e->_numconst - (index+1)) * PBG_HASH_LANES;
+}
+
+/**
+ * Mixes a 32-bit word into every lane of a hash. Each lane multiplies by its 
+ * own odd constant, then takes in its neighbour, so that lanes differ. All 
+ * arithmetic is modulo 2^32, whatever the width of unsigned long.
+ * @param h     Lanes of the hash.
+ * @param word  Word to mix in.
+ */
+void pbg_hash_word(unsigned long* h, unsigned long word)
+{
+	unsigned long x[PBG_HASH_LANES];
+	unsigned long mult[PBG_HASH_LANES];
+	int j;
+	mult[0] = 0x85EBCA6BUL;
+	mult[1] = 0xC2B2AE35UL;
+	mult[2] = 0x27D4EB2FUL;
+	mult[3] = 0x165667B1UL;
+	for(j = 0; j < PBG_HASH_LANES; j++) {
+		x[j] = ((h[j] ^ word) * mult[j]) & 0xFFFFFFFFUL;
+		x[j] ^= x[j] >> 16;
+		x[j] = (x[j] * 0x9E3779B1UL) & 0xFFFFFFFFUL;
+		x[j] ^= x[j] >> 13;
+	}
+	for(j = 0; j < PBG_HASH_LANES; j++)
+		h[j] = (x[j] + (x[(j+1) % PBG_HASH_LANES] << 1)) & 0xFFFFFFFFUL;
+}
+
+/**
+ * Mixes a length and run of bytes into a hash, four bytes at a time.
+ * @param h      Lanes of the hash.
+ * @param bytes  Bytes to mix in.
+ * @param n      Number of bytes.
+ */
+void pbg_hash_bytes(unsigned long* h, unsigned char* bytes, int n)
+{
+	unsigned long word;
+	int i;
+	pbg_hash_word(h, (unsigned long) n);
+	for(i = 0; i < n; i += 4) {
+		word = bytes[i];
+		if(i+1 < n) word |= (unsigned long) bytes[i+1] << 8;
+		if(i+2 < n) word |= (unsigned long) bytes[i+2] << 16;
+		if(i+3 < n) word |= (unsigned long) bytes[i+3] << 24;
+		pbg_hash_word(h, word);
+	}
+}
+
+/**
+ * Sorts the children of an operator by their hashes, with a merge sort which
+ * keeps children of equal hashes in their order.
+ * @param e         Expression the operator belongs to.
+ * @param hashes    Hashes of the fields of e.
+ * @param children  Children to sort.
+ * @param n         Number of children.
+ * @param tmp       Scratch space for n children.
+ */
+void pbg_sort_children(pbg_expr* e, unsigned long* hashes, int* children, 
+		int n, int* tmp)
+{
+	int width, lo, mid, hi, i, j, k;
+	for(width = 1; width < n; width *= 2) {
+		for(lo = 0; lo + width < n; lo += 2*width) {
+			mid = lo + width;
+			hi = (mid + width < n) ? mid + width : n;
+			for(i = lo, j = mid, k = lo; k < hi; k++) {
+				if(j >= hi || (i < mid && pbg_hash_cmp(
+						pbg_hash_slot(e, hashes, children[i]),
+						pbg_hash_slot(e, hashes, children[j])) <= 0))
+					tmp[k] = children[i++];
+				else
+					tmp[k] = children[j++];
+			}
+			memcpy(children + lo, tmp + lo, (hi - lo) * sizeof(int));
+		}
+	}
+}
+
+/**
+ * Orders two hashes.
+ * @param a  Lanes of the first hash.
+ * @param b  Lanes of the second hash.
+ * @return negative, zero, or positive if a is less than, equal to, or 
+ *         greater than b.
+ */
+int pbg_hash_cmp(unsigned long* a, unsigned long* b)
+{
+	int j;
+	for(j = 0; j < PBG_HASH_LANES; j++)
+		if(a[j] != b[j])
+			return (a[j] < b[j]) ? -1 : 1;
+	return 0;
+}
+
+/**
+ * Checks whether the order of the arguments of an operator leaves its result
+ * unchanged, errors aside.
+ * @param field  Field to check.
+ * @return 1 if the operator is commutative, 0 otherwise.
+ */
+int pbg_iscommutative(pbg_field* field)
+{
+	pbg_field_type type;
+	type = pbg_canonical_type(field);
+	if(type >= PBG_SP_NUMBER_EQ && type <= PBG_SP_STRING_GTE)
+		return (type - PBG_SP_NUMBER_EQ) % 6 < 2;
+	return type == PBG_OP_AND || type == PBG_OP_OR || type == PBG_OP_EQ || 
+			type == PBG_OP_NEQ || type == PBG_OP_EXST;
+}
+
+/**
+ * Finds the type of a field in the sense of pbg_hash: fused comparisons and
+ * compiled string operators are of the type of the operator they were parsed
+ * from.
+ * @param field  Field whose type to find.
+ * @return the type of the field.
+ */
+pbg_field_type pbg_canonical_type(pbg_field* field)
+{
+	if(field->_type >= PBG_FU_NUMBER && field->_type <= PBG_FU_STRING)
+		return ((pbg_fused*) field->_data)->_op;
+	if(field->_type >= PBG_AC_PFX && field->_type <= PBG_AC_CONT)
+		return field->_type - PBG_AC_PFX + PBG_OP_PFX;
+	return field->_type;
+}
+
+/**
+ * Compares two fields, but not their children.
+ * @param a   First expression.
+ * @param ia  Index of a field of a.
+ * @param b   Second expression.
+ * @param ib  Index of a field of b.
+ * @return 1 if the fields are alike, 0 otherwise.
+ */
+int pbg_equal_field(pbg_expr* a, int ia, pbg_expr* b, int ib)
+{
+	pbg_field* fa, *fb;
+	if((ia < 0) != (ib < 0))
+		return 0;
+	fa = (ia < 0) ? a->_variables - (ia+1) : a->_constants + (ia-1);
+	fb = (ib < 0) ? b->_variables - (ib+1) : b->_constants + (ib-1);
+	if(ia > 0 && pbg_canonical_type(fa) != pbg_canonical_type(fb))
+		return 0;
+	if(fa->_int != fb->_int)
+		return 0;
+	/* Operators compare their children instead of their data. */
+	if(ia > 0 && pbg_type_isop(fa->_type))
+		return 1;
+	return fa->_int == 0 || memcmp(fa->_data, fb->_data, fa->_int) == 0;
+}
+
+
+/*************
+ *           *
+ * ZONE MAPS *
+ *           *
+ *************/
+
+int pbg_evaluate_zone(pbg_expr* e, pbg_error* err, pbg_zone* zones)
+{
+	pbg_field* field;
+	char* outcomes, *expanded;
+	int* stack, *children;
+	int i, k, depth, result;
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	outcomes = malloc(e->_numconst+1);
+	expanded = calloc(e->_numconst+1, 1);
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	if(outcomes == NULL || expanded == NULL || stack == NULL) {
+		free(outcomes);
+		free(expanded);
+		free(stack);
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return PBG_ERROR;
+	}
+	
+	/* Decide the children of an operator before deciding it. */
+	depth = 0;
+	stack[depth++] = 1;
+	while(depth > 0) {
+		k = stack[depth-1];
+		field = e->_constants + (k-1);
+		if(!pbg_type_isop(field->_type)) {
+			depth--;
+			continue;
+		}
+		children = (field->_type >= PBG_FU_NUMBER && 
+				field->_type <= PBG_FU_STRING) ? 
+				((pbg_fused*) field->_data)->_children : (int*) field->_data;
+		if(!expanded[k]) {
+			expanded[k] = 1;
+			for(i = 0; i < field->_int; i++)
+				if(children[i] > 0)
+					stack[depth++] = children[i];
+			continue;
+		}
+		depth--;
+		outcomes[k] = (char) pbg_zone_op(e, zones, outcomes, field);
+	}
+	result = pbg_zone_bool(e, zones, outcomes, 1);
+	free(outcomes);
+	free(expanded);
+	free(stack);
+	if(!(result & PBG_ZONE_T))
+		return PBG_NEVER;
+	return (result == PBG_ZONE_T) ? PBG_ALWAYS : PBG_MAYBE;
+}
+
+/**
+ * Finds what a field may evaluate to as a BOOL over the records of a block.
+ * @param e         Expression the field belongs to.
+ * @param zones     Statistics of each variable of e.
+ * @param outcomes  Outcomes of the operators of e, by index.
+ * @param index     Index of the field.
+ * @return a mask of PBG_ZONE_T, PBG_ZONE_F, and PBG_ZONE_E.
+ */
+int pbg_zone_bool(pbg_expr* e, pbg_zone* zones, char* outcomes, int index)
+{
+	pbg_field* field;
+	pbg_range r;
+	int m;
+	if(index > 0) {
+		field = e->_constants + (index-1);
+		if(pbg_type_isop(field->_type)) return outcomes[index];
+		if(field->_type == PBG_LT_TRUE) return PBG_ZONE_T;
+		if(field->_type == PBG_LT_FALSE) return PBG_ZONE_F;
+		return PBG_ZONE_E;
+	}
+	pbg_zone_range(e, zones, index, &r);
+	m = r._null ? PBG_ZONE_E : 0;
+	if(!r._value)
+		return m;
+	if(r._type == PBG_NULL)
+		return PBG_ZONE_ALL;
+	if(r._type != PBG_SP_BOOL)
+		return m | PBG_ZONE_E;
+	if(r._lo->_type == PBG_LT_FALSE) m |= PBG_ZONE_F;
+	if(r._hi->_type == PBG_LT_TRUE) m |= PBG_ZONE_T;
+	return m;
+}
+
+/**
+ * Finds what an operator may evaluate to over the records of a block, given
+ * what its children may evaluate to. Children are taken to vary independently
+ * of one another, which may only add outcomes.
+ * @param e         Expression the operator belongs to.
+ * @param zones     Statistics of each variable of e.
+ * @param outcomes  Outcomes of the operators of e, by index.
+ * @param field     Operator to decide.
+ * @return a mask of PBG_ZONE_T, PBG_ZONE_F, and PBG_ZONE_E.
+ */
+int pbg_zone_op(pbg_expr* e, pbg_zone* zones, char* outcomes,
+		pbg_field* field)
+{
+	pbg_range a, b;
+	pbg_fused* fu;
+	pbg_field_type type, strict, want;
+	int* children;
+	int i, m, s, go, stop, more;
+	children = (int*) field->_data;
+	type = field->_type;
+	strict = PBG_NULL;
+	switch(type) {
+		case PBG_OP_NOT:
+			s = pbg_zone_bool(e, zones, outcomes, children[0]);
+			return (s & PBG_ZONE_E) | ((s & PBG_ZONE_T) ? PBG_ZONE_F : 0) |
+					((s & PBG_ZONE_F) ? PBG_ZONE_T : 0);
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			/* Arguments are evaluated in turn until one decides the result. */
+			go = (type == PBG_OP_AND) ? PBG_ZONE_T : PBG_ZONE_F;
+			stop = (type == PBG_OP_AND) ? PBG_ZONE_F : PBG_ZONE_T;
+			for(i = m = 0, more = 1; i < field->_int && more; i++) {
+				s = pbg_zone_bool(e, zones, outcomes, children[i]);
+				m |= s & (stop | PBG_ZONE_E);
+				more = (s & go) != 0;
+			}
+			return more ? (m | go) : m;
+		case PBG_OP_EXST:
+			for(i = 0, m = PBG_ZONE_T; i < field->_int; i++) {
+				pbg_zone_range(e, zones, children[i], &a);
+				if(a._null) m |= PBG_ZONE_F;
+				if(!a._value) m &= ~PBG_ZONE_T;
+			}
+			return m;
+		case PBG_OP_TYPE:
+			if(children[0] < 0)
+				return PBG_ZONE_ALL;
+			switch(e->_constants[children[0]-1]._type) {
+				case PBG_LT_TP_BOOL:   want = PBG_SP_BOOL; break;
+				case PBG_LT_TP_DATE:   want = PBG_LT_DATE; break;
+				case PBG_LT_TP_NUMBER: want = PBG_LT_NUMBER; break;
+				case PBG_LT_TP_STRING: want = PBG_LT_STRING; break;
+				default: return PBG_ZONE_E;
+			}
+			for(i = 1, m = PBG_ZONE_T; i < field->_int; i++) {
+				pbg_zone_range(e, zones, children[i], &a);
+				if(a._null) m |= PBG_ZONE_F;
+				if(!a._value || (a._type != PBG_NULL && a._type != want))
+					m &= ~PBG_ZONE_T;
+				if(a._value && a._type != want) m |= PBG_ZONE_F;
+			}
+			return m;
+		case PBG_OP_EQ:
+		case PBG_OP_NEQ:
+		case PBG_OP_LT:
+		case PBG_OP_GT:
+		case PBG_OP_LTE:
+		case PBG_OP_GTE:
+			break;
+		case PBG_FU_NUMBER:
+		case PBG_FU_DATE:
+		case PBG_FU_STRING:
+			/* A variable of the type of the constant is compared at once. */
+			fu = (pbg_fused*) field->_data;
+			children = fu->_children;
+			type = fu->_op;
+			strict = fu->_strict ? fu->_const._type : PBG_NULL;
+			break;
+		default:
+			if(type < PBG_SP_NUMBER_EQ || type > PBG_SP_STRING_GTE)
+				return PBG_ZONE_ALL;
+			i = type - PBG_SP_NUMBER_EQ;
+			strict = (i < 6) ? PBG_LT_NUMBER : 
+					(i < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+			type = (i % 6 == 0) ? PBG_OP_EQ : (i % 6 == 1) ? PBG_OP_NEQ :
+					(i % 6 == 2) ? PBG_OP_LT : (i % 6 == 3) ? PBG_OP_GT :
+					(i % 6 == 4) ? PBG_OP_LTE : PBG_OP_GTE;
+			break;
+	}
+	if(field->_int != 2)
+		return PBG_ZONE_ALL;
+	pbg_zone_range(e, zones, children[0], &a);
+	pbg_zone_range(e, zones, children[1], &b);
+	/* BOOLs are compared by pbg_evaluate_resume, which is not followed. */
+	if(strict == PBG_NULL && pbg_zone_maybool(&a) && 
+			(type == PBG_OP_EQ || pbg_zone_maybool(&b)))
+		return PBG_ZONE_ALL;
+	return pbg_zone_compare(type, &a, &b, strict);
+}
+
+/**
+ * Finds what a comparison of two fields other than BOOLs may evaluate to.
+ * @param op      PBG_OP_EQ, PBG_OP_NEQ, or an order operator.
+ * @param a       Range of the first field.
+ * @param b       Range of the second field.
+ * @param strict  Type both fields must be of, or PBG_NULL.
+ * @return a mask of PBG_ZONE_T, PBG_ZONE_F, and PBG_ZONE_E.
+ */
+int pbg_zone_compare(pbg_field_type op, pbg_range* a, pbg_range* b,
+		pbg_field_type strict)
+{
+	int m, signs, want;
+	m = (a->_null || b->_null) ? PBG_ZONE_E : 0;
+	if(!a->_value || !b->_value)
+		return m;
+	if(a->_type == PBG_NULL || b->_type == PBG_NULL)
+		return PBG_ZONE_ALL;
+	if(strict != PBG_NULL && (a->_type != strict || b->_type != strict))
+		return m | PBG_ZONE_E;
+	if(a->_type != b->_type)
+		return m | ((op == PBG_OP_EQ) ? PBG_ZONE_F : 
+				(op == PBG_OP_NEQ) ? PBG_ZONE_T : PBG_ZONE_E);
+	if(a->_type != PBG_LT_NUMBER && a->_type != PBG_LT_DATE && 
+			a->_type != PBG_LT_STRING)
+		return m | ((op == PBG_OP_EQ || op == PBG_OP_NEQ) ? 
+				PBG_ZONE_T | PBG_ZONE_F : PBG_ZONE_E);
+	
+	/* EQ and NEQ compare bytes, which are equal only if the values are. A 
+	 * NUMBER bounded by zero may be either of its signed zeros. */
+	if(op == PBG_OP_EQ || op == PBG_OP_NEQ) {
+		if(pbg_zone_cmp(a->_lo, b->_hi) <= 0 && pbg_zone_cmp(b->_lo, a->_hi) <= 0)
+			m |= (op == PBG_OP_EQ) ? PBG_ZONE_T : PBG_ZONE_F;
+		if(!pbg_zone_point(a) || !pbg_zone_point(b) || 
+				pbg_zone_cmp(a->_lo, b->_lo) != 0 || (a->_type == PBG_LT_NUMBER &&
+				((pbg_lt_number*) a->_lo->_data)->_val == 0))
+			m |= (op == PBG_OP_EQ) ? PBG_ZONE_F : PBG_ZONE_T;
+		return m;
+	}
+	signs = pbg_zone_signs(a, b);
+	want = (op == PBG_OP_LT) ? PBG_SIGN_NEG : (op == PBG_OP_GT) ? PBG_SIGN_POS :
+			(op == PBG_OP_LTE) ? PBG_SIGN_NEG | PBG_SIGN_ZERO : 
+			PBG_SIGN_POS | PBG_SIGN_ZERO;
+	if(signs & want) m |= PBG_ZONE_T;
+	if(signs & ~want & (PBG_SIGN_NEG | PBG_SIGN_ZERO | PBG_SIGN_POS))
+		m |= PBG_ZONE_F;
+	return m;
+}
+
+/**
+ * Finds the signs a comparison of two ranges of one ordered type may take.
+ * @param a  Range of the first field.
+ * @param b  Range of the second field.
+ * @return a mask of PBG_SIGN_NEG, PBG_SIGN_ZERO, and PBG_SIGN_POS.
+ */
+int pbg_zone_signs(pbg_range* a, pbg_range* b)
+{
+	int s;
+	s = 0;
+	if(pbg_zone_cmp(a->_lo, b->_hi) < 0) 
+		s |= PBG_SIGN_NEG;
+	if(pbg_zone_cmp(a->_lo, b->_hi) <= 0 && pbg_zone_cmp(b->_lo, a->_hi) <= 0)
+		s |= PBG_SIGN_ZERO;
+	if(pbg_zone_cmp(a->_hi, b->_lo) > 0)
+		s |= PBG_SIGN_POS;
+	return s;
+}
+
+/**
+ * Finds the values a field may take over the records of a block. Literals 
+ * are single values and operators are BOOLs.
+ * @param e      Expression the field belongs to.
+ * @param zones  Statistics of each variable of e.
+ * @param index  Index of the field.
+ * @param r      Filled with the range of the field.
+ */
+void pbg_zone_range(pbg_expr* e, pbg_zone* zones, int index, pbg_range* r)
+{
+	pbg_field* field;
+	pbg_zone* z;
+	if(index > 0) {
+		field = e->_constants + (index-1);
+		r->_null = 0;
+		r->_value = 1;
+		r->_type = pbg_type_isbool(field->_type) ? PBG_SP_BOOL : field->_type;
+		r->_lo = r->_hi = field;
+		return;
+	}
+	z = zones - (index+1);
+	r->_null = z->_nulls > 0;
+	r->_value = z->_nulls < z->_count;
+	r->_lo = &z->_min;
+	r->_hi = &z->_max;
+	if(pbg_type_isbool(z->_min._type) && pbg_type_isbool(z->_max._type))
+		r->_type = PBG_SP_BOOL;
+	else if(z->_min._type == z->_max._type)
+		r->_type = z->_min._type;
+	else
+		r->_type = PBG_NULL;
+}
+
+/**
+ * Checks whether a range may hold a BOOL.
+ * @param r  Range to check.
+ * @return 1 if it may, 0 otherwise.
+ */
+int pbg_zone_maybool(pbg_range* r)
+{
+	return r->_value && (r->_type == PBG_NULL || r->_type == PBG_SP_BOOL);
+}
+
+/**
+ * Checks whether a range of an ordered type holds a single value.
+ * @param r  Range to check.
+ * @return 1 if it does, 0 otherwise.
+ */
+int pbg_zone_point(pbg_range* r)
+{
+	return r->_lo == r->_hi || pbg_zone_cmp(r->_lo, r->_hi) == 0;
+}
+
+/**
+ * Orders two values of one ordered type, STRINGs byte by byte.
+ * @param a  First value.
+ * @param b  Second value.
+ * @return negative, zero, or positive if a is less than, equal to, or 
+ *         greater than b.
+ */
+int pbg_zone_cmp(pbg_field* a, pbg_field* b)
+{
+	if(a->_type == PBG_LT_NUMBER)
+		return pbg_cmpnumber(a->_data, b->_data);
+	if(a->_type == PBG_LT_DATE)
+		return pbg_cmpdate(a->_data, b->_data);
+	return pbg_cmpstring(a->_data, a->_int, b->_data, b->_int);
+}
+
+/**********************
+ *                    *
+ * PARTIAL EVALUATION *
+ *                    *
+ **********************/
+
+int pbg_partial_evaluate(pbg_expr* e, pbg_error* err, 
+		pbg_field (*dict)(char*, int), pbg_expr* residual)
+{
+	pbg_field* vals, *field;
+	int* status, *stack, *children;
+	char* unbound, *expanded;
+	int i, k, c, depth, result;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	vals = malloc((e->_numvars+1) * sizeof(pbg_field));
+	status = malloc((e->_numconst+1) * sizeof(int));
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	unbound = calloc(e->_numconst+1, 1);
+	expanded = calloc(e->_numconst+1, 1);
+	if(vals == NULL || status == NULL || stack == NULL || unbound == NULL ||
+			expanded == NULL) {
+		free(vals);
+		free(status);
+		free(stack);
+		free(unbound);
+		free(expanded);
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return PBG_ERROR;
+	}
+	for(i = 0; i < e->_numvars; i++)
+		vals[i] = dict((char*) e->_variables[i]._data, e->_variables[i]._int);
+	
+	/* Known variables must be of the types declared by pbg_specialize. */
+	result = PBG_ERROR;
+	if(e->_schema == NULL || pbg_check_schema(e, err, vals)) {
+		/* Find the operators which depend on unknown variables, children 
+		 * first. Known operators below them are evaluated whole. */
+		depth = 0;
+		if(pbg_type_isop(e->_constants[0]._type))
+			stack[depth++] = 1;
+		while(depth > 0) {
+			k = stack[depth-1];
+			field = e->_constants + (k-1);
+			children = (int*) field->_data;
+			if(!expanded[k]) {
+				expanded[k] = 1;
+				for(i = 0; i < field->_int; i++)
+					if(children[i] > 0 && 
+							pbg_type_isop(e->_constants[children[i]-1]._type))
+						stack[depth++] = children[i];
+				continue;
+			}
+			depth--;
+			for(i = 0; i < field->_int; i++) {
+				c = children[i];
+				if(c < 0 ? vals[-(c+1)]._type == PBG_LT_VAR : unbound[c])
+					unbound[k] = 1;
+			}
+			if(!unbound[k])
+				continue;
+			for(i = 0; i < field->_int; i++) {
+				c = children[i];
+				if(c > 0 && !unbound[c] && pbg_type_isop(e->_constants[c-1]._type))
+					status[c] = pbg_partial_eval(e, err, vals, c);
+			}
+			status[k] = pbg_partial_op(e, vals, status, field);
+		}
+		if(pbg_type_isop(e->_constants[0]._type) && !unbound[1])
+			status[1] = pbg_partial_eval(e, err, vals, 1);
+		result = pbg_partial_bool(e, vals, status, 1);
+		
+		/* Build the residual. One which must fail yields its error. */
+		if(!pbg_partial_build(e, vals, status, unbound, residual)) {
+			pbg_err_alloc(err, __LINE__, __FILE__);
+			result = PBG_ERROR;
+		}
+		else if(result == PBG_ERROR) {
+			pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+			pbg_partial_fail(residual, err);
+			pbg_free(residual);
+		}
+	}
+	
+	/* Clean up the values given by the dictionary. */
+	for(i = 0; i < e->_numvars; i++)
+		pbg_field_free(vals+i);
+	free(vals);
+	free(status);
+	free(stack);
+	free(unbound);
+	free(expanded);
+	return result;
+}
+
+/**
+ * Evaluates an operator whose variables are all known. As for pbg_evaluate, 
+ * an error may be set without the operator failing, as by an EQ of a BOOL 
+ * and another type; the first such error is kept.
+ * @param e      Expression the operator belongs to.
+ * @param err    Container to store error, if none is stored yet.
+ * @param vals   Value of each variable of e.
+ * @param index  Index of the operator.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_partial_eval(pbg_expr* e, pbg_error* err, pbg_field* vals, int index)
+{
+	pbg_expr bound;
+	pbg_error operr;
+	int result;
+	pbg_err_init(&operr, PBG_ERR_NONE, 0, NULL);
+	bound = *e;
+	bound._variables = vals;
+	bound._incr = NULL;
+#ifdef PBG_PROFILE
+	bound._stats = NULL;
+#endif
+	result = pbg_evaluate_r(&bound, &operr, e->_constants + (index-1));
+	if(operr._type != PBG_ERR_NONE && err->_type == PBG_ERR_NONE)
+		*err = operr;
+	else
+		pbg_error_free(&operr);
+	return result;
+}
+
+/**
+ * Decides what an operator which depends on unknown variables can be decided
+ * to, given its known arguments.
+ * @param e       Expression the operator belongs to.
+ * @param vals    Value of each variable of e, or unbound fields.
+ * @param status  Status of the operators of e, see pbg_partial_bool.
+ * @param field   Operator to decide.
+ * @return PBG_TRUE or PBG_FALSE if decided, PBG_ERROR if it must fail, or
+ *         PBG_MAYBE.
+ */
+int pbg_partial_op(pbg_expr* e, pbg_field* vals, int* status, 
+		pbg_field* field)
+{
+	pbg_field* ci;
+	pbg_field_type tp;
+	int* children;
+	int i, s, go, stop, kept;
+	children = (int*) field->_data;
+	switch(field->_type) {
+		case PBG_OP_NOT:
+			s = pbg_partial_bool(e, vals, status, children[0]);
+			if(s == PBG_TRUE) return PBG_FALSE;
+			if(s == PBG_FALSE) return PBG_TRUE;
+			return s;
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			/* Arguments which cannot decide the operator are skipped. The 
+			 * first which must decide it, or fail, ends it. */
+			go = (field->_type == PBG_OP_AND) ? PBG_TRUE : PBG_FALSE;
+			stop = (field->_type == PBG_OP_AND) ? PBG_FALSE : PBG_TRUE;
+			for(i = kept = 0; i < field->_int; i++) {
+				s = pbg_partial_bool(e, vals, status, children[i]);
+				if(s == go)
+					continue;
+				if(s == stop || s == PBG_ERROR)
+					return kept ? PBG_MAYBE : s;
+				kept = 1;
+			}
+			return kept ? PBG_MAYBE : go;
+		case PBG_OP_EXST:
+			for(i = 0; i < field->_int; i++) {
+				ci = pbg_partial_field(e, vals, children[i]);
+				if(ci != NULL && ci->_type == PBG_NULL)
+					return PBG_FALSE;
+			}
+			return PBG_MAYBE;
+		case PBG_OP_TYPE:
+			ci = pbg_partial_field(e, vals, children[0]);
+			if(ci == NULL)
+				return PBG_MAYBE;
+			tp = ci->_type;
+			if(tp < PBG_MIN_LT_TP || tp > PBG_MAX_LT_TP)
+				return PBG_ERROR;
+			for(i = 1; i < field->_int; i++) {
+				ci = pbg_partial_field(e, vals, children[i]);
+				if(ci == NULL)
+					continue;
+				if((tp == PBG_LT_TP_BOOL && !pbg_type_isbool(ci->_type)) ||
+						(tp == PBG_LT_TP_DATE && ci->_type != PBG_LT_DATE) ||
+						(tp == PBG_LT_TP_NUMBER && ci->_type != PBG_LT_NUMBER) ||
+						(tp == PBG_LT_TP_STRING && ci->_type != PBG_LT_STRING))
+					return PBG_FALSE;
+			}
+			return PBG_MAYBE;
+		default:
+			return PBG_MAYBE;
+	}
+}
+
+/**
+ * Decides what a field evaluates to as a BOOL, as far as it is known.
+ * @param e       Expression the field belongs to.
+ * @param vals    Value of each variable of e, or unbound fields.
+ * @param status  Status of the operators of e. Only operators whose parent 
+ *                depends on unknown variables, and the root, have one.
+ * @param index   Index of the field.
+ * @return PBG_TRUE or PBG_FALSE if decided, PBG_ERROR if it must fail, or
+ *         PBG_MAYBE.
+ */
+int pbg_partial_bool(pbg_expr* e, pbg_field* vals, int* status, int index)
+{
+	pbg_field* field;
+	if(index > 0 && pbg_type_isop(e->_constants[index-1]._type))
+		return status[index];
+	field = pbg_partial_field(e, vals, index);
+	if(field == NULL) return PBG_MAYBE;
+	if(field->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(field->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return PBG_ERROR;
+}
+
+/**
+ * Finds a field, or the value of a variable.
+ * @param e      Expression the field belongs to.
+ * @param vals   Value of each variable of e, or unbound fields.
+ * @param index  Index of the field.
+ * @return the field, or NULL if it is an unknown variable.
+ */
+pbg_field* pbg_partial_field(pbg_expr* e, pbg_field* vals, int index)
+{
+	if(index > 0)
+		return e->_constants + (index-1);
+	if(vals[-(index+1)]._type == PBG_LT_VAR)
+		return NULL;
+	return vals - (index+1);
+}
+
+/**
+ * Lists the arguments an operator which depends on unknown variables keeps in
+ * the residual: AND and OR keep those which cannot be skipped, up to the first
+ * which ends them, and EXST and TYPE keep unknown variables. 
+ * @param e       Expression the operator belongs to.
+ * @param vals    Value of each variable of e, or unbound fields.
+ * @param status  Status of the operators of e.
+ * @param field   Operator whose arguments to list.
+ * @param kept    Filled with the indices of the kept arguments.
+ * @return the number of kept arguments.
+ */
+int pbg_partial_children(pbg_expr* e, pbg_field* vals, int* status,
+		pbg_field* field, int* kept)
+{
+	int* children;
+	int i, n, s, go;
+	children = (int*) field->_data;
+	n = 0;
+	switch(field->_type) {
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			go = (field->_type == PBG_OP_AND) ? PBG_TRUE : PBG_FALSE;
+			for(i = 0; i < field->_int; i++) {
+				s = pbg_partial_bool(e, vals, status, children[i]);
+				if(s == go)
+					continue;
+				kept[n++] = children[i];
+				if(s != PBG_MAYBE)
+					break;
+			}
+			return n;
+		case PBG_OP_EXST:
+			for(i = 0; i < field->_int; i++)
+				if(pbg_partial_field(e, vals, children[i]) == NULL)
+					kept[n++] = children[i];
+			return n;
+		case PBG_OP_TYPE:
+			/* Arguments are only known to match a known type. */
+			kept[n++] = children[0];
+			for(i = 1; i < field->_int; i++)
+				if(pbg_partial_field(e, vals, children[i]) == NULL ||
+						pbg_partial_field(e, vals, children[0]) == NULL)
+					kept[n++] = children[i];
+			return n;
+		default:
+			for(i = 0; i < field->_int; i++)
+				kept[n++] = children[i];
+			return n;
+	}
+}
+
+/**
+ * Builds the residual of an expression from the root down. Decided operators
+ * become BOOL literals, known operators which must fail are copied whole, and
+ * AND or OR left with a single operator become it. Known variables become 
+ * literals, and unknown ones variables of the residual.
+ * @param e        Expression to build the residual of.
+ * @param vals     Value of each variable of e, or unbound fields.
+ * @param status   Status of the operators of e.
+ * @param unbound  Whether each operator of e depends on unknown variables.
+ * @param r        Expression to initialize with the residual.
+ * @return 1 if successful, 0 if out of memory, in which case r is freed.
+ */
+int pbg_partial_build(pbg_expr* e, pbg_field* vals, int* status, 
+		char* unbound, pbg_expr* r)
+{
+	pbg_field* field, lit;
+	void* data;
+	int* stack, *kept, *varmap;
+	int i, k, n, cap, depth, parent, pos, whole, pad, index, maxchildren, ok;
+	
+	for(i = cap = maxchildren = 0; i < e->_numconst; i++)
+		if(pbg_type_isop(e->_constants[i]._type)) {
+			cap += e->_constants[i]._int;
+			if(e->_constants[i]._int > maxchildren)
+				maxchildren = e->_constants[i]._int;
+		}
+	r->_constants = malloc((e->_numconst + cap) * sizeof(pbg_field));
+	r->_variables = malloc((e->_numvars+1) * sizeof(pbg_field));
+	r->_numconst = 0;
+	r->_numvars = 0;
+	r->_incr = NULL;
+	r->_schema = NULL;
+#ifdef PBG_PROFILE
+	r->_stats = NULL;
+	r->_source = NULL;
+	r->_srclen = 0;
+#endif
+	stack = malloc(4 * (cap+1) * sizeof(int));
+	kept = malloc((maxchildren+1) * sizeof(int));
+	varmap = calloc(e->_numvars+1, sizeof(int));
+	ok = (r->_constants != NULL && r->_variables != NULL && stack != NULL &&
+			kept != NULL && varmap != NULL);
+	
+	/* Each entry holds a field, the operator and position its index goes to,
+	 * and whether it is copied whole. */
+	depth = 0;
+	stack[depth++] = 1;
+	stack[depth++] = 0;
+	stack[depth++] = 0;
+	stack[depth++] = 0;
+	while(ok && depth > 0) {
+		whole = stack[--depth];
+		pos = stack[--depth];
+		parent = stack[--depth];
+		k = stack[--depth];
+		field = e->_constants + (k-1);
+		
+		/* Literals are copied, and decided operators become literals. Known 
+		 * operators which are not decided must fail, and are copied whole. */
+		index = -1;
+		n = pad = 0;
+		if(!pbg_type_isop(field->_type))
+			index = pbg_partial_ref(e, vals, r, varmap, k);
+		else if(!whole && (status[k] == PBG_TRUE || status[k] == PBG_FALSE)) {
+			lit = pbg_make_bool(status[k] == PBG_TRUE);
+			index = pbg_partial_store(r, &lit);
+		}
+		whole = whole || !unbound[k];
+		if(index < 0 && whole) {
+			n = field->_int;
+			memcpy(kept, field->_data, n * sizeof(int));
+		}
+		else if(index < 0)
+			n = pbg_partial_children(e, vals, status, field, kept);
+		
+		/* AND and OR of a single operator are that operator. */
+		if(index < 0 && !whole && n == 1 && (field->_type == PBG_OP_AND || 
+				field->_type == PBG_OP_OR) && kept[0] > 0 && 
+				pbg_type_isop(e->_constants[kept[0]-1]._type)) {
+			stack[depth++] = kept[0];
+			stack[depth++] = parent;
+			stack[depth++] = pos;
+			stack[depth++] = 0;
+			continue;
+		}
+		
+		/* Copy the operator. Fused comparisons keep their constant inline. */
+		if(index < 0 && field->_type >= PBG_FU_NUMBER && 
+				field->_type <= PBG_FU_STRING)
+			index = pbg_partial_fused(e, vals, r, varmap, field);
+		else if(index < 0) {
+			/* AND and OR of a single argument also take one which cannot 
+			 * decide them, to keep their arity. */
+			pad = (!whole && n == 1 && (field->_type == PBG_OP_AND || 
+					field->_type == PBG_OP_OR));
+			data = calloc(n+pad+1, sizeof(int));
+			lit = pbg_field_init(pbg_canonical_type(field), n+pad, data);
+			index = (data == NULL) ? 0 : pbg_partial_store(r, &lit);
+		}
+		if(index == 0) {
+			ok = 0;
+			break;
+		}
+		if(parent > 0)
+			((int*) r->_constants[parent-1]._data)[pos] = index;
+		if(!pbg_type_isop(r->_constants[index-1]._type) || 
+				(field->_type >= PBG_FU_NUMBER && field->_type <= PBG_FU_STRING))
+			continue;
+		
+		/* Fill in the arguments of the operator. */
+		data = r->_constants[index-1]._data;
+		for(i = 0; i < n && ok; i++) {
+			if(kept[i] > 0 && pbg_type_isop(e->_constants[kept[i]-1]._type)) {
+				stack[depth++] = kept[i];
+				stack[depth++] = index;
+				stack[depth++] = i;
+				stack[depth++] = whole;
+			}
+			else
+				ok = (((int*) data)[i] = 
+						pbg_partial_ref(e, vals, r, varmap, kept[i])) != 0;
+		}
+		if(ok && pad) {
+			lit = pbg_make_bool(field->_type == PBG_OP_AND);
+			ok = (((int*) data)[n] = pbg_partial_store(r, &lit)) != 0;
+		}
+	}
+	
+	/* Declared types carry over to the variables left. */
+	if(ok && e->_schema != NULL) {
+		r->_schema = malloc((r->_numvars+1) * sizeof(pbg_field_type));
+		ok = (r->_schema != NULL);
+		for(i = 0; ok && i < e->_numvars; i++)
+			if(varmap[i] != 0)
+				r->_schema[-(varmap[i]+1)] = e->_schema[i];
+	}
+	free(stack);
+	free(kept);
+	free(varmap);
+	if(!ok) {
+		pbg_free(r);
+		return 0;
+	}
+	/* String operators are copied as parsed, and compiled again. */
+	pbg_match_compile(r);
+	return 1;
+}
+
+/**
+ * Copies a fused comparison into the residual, with its arguments.
+ * @param e       Expression the comparison belongs to.
+ * @param vals    Value of each variable of e, or unbound fields.
+ * @param r       Residual being built.
+ * @param varmap  Index in r of each variable of e, or 0.
+ * @param field   Fused comparison to copy.
+ * @return the index of the copy in r, or 0 if out of memory.
+ */
+int pbg_partial_fused(pbg_expr* e, pbg_field* vals, pbg_expr* r, int* varmap,
+		pbg_field* field)
+{
+	pbg_fused* fu, *from;
+	pbg_field op;
+	int index, i;
+	from = (pbg_fused*) field->_data;
+	fu = malloc(sizeof(pbg_fused));
+	if(fu == NULL)
+		return 0;
+	
+	/* The comparison precedes its arguments, as the root must come first. */
+	*fu = *from;
+	op = pbg_field_init(field->_type, 2, fu);
+	index = pbg_partial_store(r, &op);
+	for(i = 0; i < 2; i++)
+		if((fu->_children[i] = pbg_partial_ref(e, vals, r, varmap, 
+				from->_children[i])) == 0)
+			return 0;
+	i = (from->_children[0] == from->_var) ? 0 : 1;
+	fu->_var = fu->_children[i];
+	fu->_const = r->_constants[fu->_children[!i]-1];
+	return index;
+}
+
+/**
+ * Copies an argument which is not an operator into the residual. Known 
+ * variables become literals, each use its own, and unknown variables become
+ * variables of the residual.
+ * @param e       Expression the argument belongs to.
+ * @param vals    Value of each variable of e, or unbound fields.
+ * @param r       Residual being built.
+ * @param varmap  Index in r of each variable of e, or 0. Updated.
+ * @param index   Index of the argument in e.
+ * @return the index of the copy in r, or 0 if out of memory.
+ */
+int pbg_partial_ref(pbg_expr* e, pbg_field* vals, pbg_expr* r, int* varmap,
+		int index)
+{
+	pbg_field* name, *var;
+	int i;
+	if(index > 0 || vals[-(index+1)]._type != PBG_LT_VAR)
+		return pbg_partial_store(r, pbg_partial_field(e, vals, index));
+	i = -(index+1);
+	if(varmap[i] != 0)
+		return varmap[i];
+	/* Variables hold their names, see pbg_parse_var. */
+	name = e->_variables + i;
+	var = r->_variables + r->_numvars;
+	var->_type = name->_type;
+	var->_int = name->_int;
+	var->_data = malloc(name->_int+1);
+	if(var->_data == NULL)
+		return 0;
+	memcpy(var->_data, name->_data, name->_int);
+	((char*) var->_data)[name->_int] = '\0';
+	varmap[i] = -(++r->_numvars);
+	return varmap[i];
+}
+
+/**
+ * Appends a copy of a field to the constants of the residual. The data of 
+ * literals is copied; that of operators is taken over.
+ * @param r      Residual being built, with room for the field.
+ * @param field  Field to append.
+ * @return the index of the copy, or 0 if out of memory.
+ */
+int pbg_partial_store(pbg_expr* r, pbg_field* field)
+{
+	pbg_field* copy;
+	copy = r->_constants + r->_numconst;
+	*copy = *field;
+	if(field->_data != NULL && !pbg_type_isop(field->_type)) {
+		copy->_data = malloc(field->_int > 0 ? field->_int : 1);
+		if(copy->_data == NULL)
+			return 0;
+		memcpy(copy->_data, field->_data, field->_int);
+	}
+	return ++r->_numconst;
+}
+
+/**
+ * Finds the error of a residual which fails whatever its variables. 
+ * @param r    Residual which must fail.
+ * @param err  Used to store the error.
+ */
+void pbg_partial_fail(pbg_expr* r, pbg_error* err)
+{
+	pbg_expr bound;
+	pbg_field* nulls;
+	int i;
+	nulls = malloc((r->_numvars+1) * sizeof(pbg_field));
+	if(nulls == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return;
+	}
+	for(i = 0; i < r->_numvars; i++)
+		nulls[i] = pbg_make_null();
+	bound = *r;
+	bound._variables = nulls;
+	pbg_evaluate_r(&bound, err, bound._constants);
+	free(nulls);
+}
+
+
+/************************
+ *                      *
+ * RESUMABLE EVALUATION *
+ *                      *
+ ************************/
+
+void pbg_eval_begin(pbg_eval* ev, pbg_error* err, pbg_expr* e, 
+		pbg_field* vars)
+{
+	pbg_frame* frames;
+	int i;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	pbg_err_init(&ev->_err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Bind a shallow copy of the expression to the variables, none of which
+	 * are supplied yet. */
+	for(i = 0; i < e->_numvars; i++)
+		vars[i] = pbg_make_unbound();
+	ev->_bound = *e;
+	ev->_bound._variables = vars;
+	ev->_depth = 0;
+	ev->_cap = PBG_EVAL_FRAMES;
+	ev->_result = PBG_NEED;
+	ev->_frames = frames = malloc(ev->_cap * sizeof(pbg_frame));
+	if(frames == NULL) {
+		pbg_err_alloc(&ev->_err, __LINE__, __FILE__);
+		ev->_result = PBG_ERROR;
+		*err = ev->_err;
+		return;
+	}
+	frames[0]._field = e->_constants;
+}
+
+int pbg_eval_step(pbg_eval* ev, pbg_error* err, int* var)
+{
+	int result;
+	
+	/* Once finished, give the same result. */
+	if(ev->_result != PBG_NEED) {
+		*err = ev->_err;
+		return ev->_result;
+	}
+	
+	/* Go on from the frame which was suspended. */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	result = pbg_evaluate_run(&ev->_bound, err, ev, NULL, NULL);
+	if(result == PBG_NEED) {
+		*var = ev->_result;
+		ev->_result = PBG_NEED;
+		return PBG_NEED;
+	}
+	ev->_err = *err;
+	return ev->_result = result;
+}
+
+void pbg_eval_resume(pbg_eval* ev, int var, pbg_field value)
+{
+	pbg_expr* e;
+	e = &ev->_bound;
+	e->_variables[var] = value;
+	
+	/* Variables must be of the types declared by pbg_specialize. */
+	if(ev->_result == PBG_NEED && e->_schema != NULL && 
+			e->_schema[var] != PBG_NULL && value._type != e->_schema[var]) {
+		pbg_err_op_arg_type(&ev->_err, __LINE__, __FILE__, 
+				"Input does not match its declared type.");
+		ev->_result = PBG_ERROR;
+	}
+}
+
+void pbg_eval_free(pbg_eval* ev)
+{
+	if(ev->_frames != NULL) free(ev->_frames);
+	ev->_frames = NULL;
+}
+
+/**
+ * Finds a variable which must be supplied before the field can be begun: the
+ * field itself, or one of the arguments of an operator whose arguments are 
+ * not evaluated as frames of their own.
+ * @param e      PBG expression the field belongs to.
+ * @param field  Field about to be begun.
+ * @return the index of a variable which has not been supplied, 
+ *         -1 if there is none.
+ */
+int pbg_eval_unbound(pbg_expr* e, pbg_field* field)
+{
+	int i, *children;
+	if(field >= e->_variables && field < e->_variables + e->_numvars)
+		return (field->_type == PBG_LT_VAR) ? (int)(field - e->_variables) : -1;
+	if(field->_type == PBG_OP_NOT || field->_type == PBG_OP_AND || 
+			field->_type == PBG_OP_OR || !pbg_type_isop(field->_type))
+		return -1;
+	children = (int*) field->_data;
+	for(i = 0; i < field->_int; i++)
+		if(children[i] < 0 && 
+				e->_variables[-(children[i]+1)]._type == PBG_LT_VAR)
+			return -(children[i]+1);
+	return -1;
+}
+
+
+/*************
+ *           *
+ * RULE SETS *
+ *           *
+ *************/
+
+void pbg_ruleset_init(pbg_ruleset* rs, pbg_error* err, pbg_expr* rules, 
+		int* priorities, int numrules)
+{
+	int* pairs;
+	int i;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	memset(rs, 0, sizeof(pbg_ruleset));
+	rs->_rules = rules;
+	rs->_numrules = numrules;
+	rs->_indexvar = rs->_rest = -1;
+	
+	/* Order the rules by priority, keeping the order given among equals. */
+	rs->_order = malloc((numrules+1) * sizeof(int));
+	pairs = malloc((2*numrules+1) * sizeof(int));
+	if(rs->_order == NULL || pairs == NULL) {
+		free(pairs);
+		pbg_ruleset_free(rs);
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return;
+	}
+	for(i = 0; i < numrules; i++) {
+		pairs[2*i] = (priorities == NULL) ? 0 : priorities[i];
+		pairs[2*i+1] = i;
+	}
+	qsort(pairs, numrules, 2*sizeof(int), pbg_ruleset_cmp);
+	for(i = 0; i < numrules; i++)
+		rs->_order[i] = pairs[2*i+1];
+	free(pairs);
+	
+	/* Share the variables of the rules, then index the rules by their keys. */
+	if(!pbg_ruleset_names(rs) || !pbg_ruleset_index(rs)) {
+		pbg_ruleset_free(rs);
+		pbg_err_alloc(err, __LINE__, __FILE__);
+	}
+}
+
+int pbg_ruleset_evaluate(pbg_ruleset* rs, pbg_error* err, pbg_field* vars, 
+		int* skipped)
+{
+	pbg_field local[PBG_RULESET_VARS], *scratch;
+	pbg_error ruleerr;
+	pbg_expr* e;
+	int i, a, b, pos, evaluated, match, result;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	if(skipped != NULL)
+		*skipped = rs->_numrules;
+	
+	/* Each rule is evaluated with its own variables, gathered here. */
+	scratch = (rs->_maxvars <= PBG_RULESET_VARS) ? local : 
+			malloc(rs->_maxvars * sizeof(pbg_field));
+	if(scratch == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return -1;
+	}
+	
+	/* The candidates are the rules indexed under the value of the variable 
+	 * of the index, and the rules which are not indexed. Both lists are in 
+	 * order of priority, so they are merged until a rule matches. */
+	a = -1;
+	if(rs->_indexvar >= 0 && pbg_ruleset_iskey(vars + rs->_indexvar))
+		a = rs->_slots[pbg_ruleset_hash(vars + rs->_indexvar) & 
+				(rs->_numslots-1)];
+	b = rs->_rest;
+	evaluated = 0;
+	match = -1;
+	while(match < 0 && (a >= 0 || b >= 0)) {
+		if(b < 0 || (a >= 0 && a < b))
+			pos = a, a = rs->_chain[a];
+		else
+			pos = b, b = rs->_chain[b];
+		/* Prune rules whose key the record does not have, including those
+		 * of other constants in the same slot. */
+		if(rs->_keyvar[pos] >= 0 && 
+				!pbg_ruleset_iskeyed(vars + rs->_keyvar[pos], rs->_keys[pos]))
+			continue;
+		e = rs->_rules + rs->_order[pos];
+		for(i = 0; i < e->_numvars; i++)
+			scratch[i] = vars[rs->_varmap[rs->_varstart[pos] + i]];
+		result = pbg_evaluate_vars(e, &ruleerr, scratch);
+		evaluated++;
+		if(ruleerr._type != PBG_ERR_NONE) {
+			if(err->_type == PBG_ERR_NONE)
+				*err = ruleerr;
+		}else if(result == PBG_TRUE)
+			match = rs->_order[pos];
+	}
+	if(scratch != local)
+		free(scratch);
+	if(skipped != NULL)
+		*skipped = rs->_numrules - evaluated;
+	return match;
+}
+
+int pbg_ruleset_numvars(pbg_ruleset* rs) {
+	return rs->_numvars;
+}
+
+char* pbg_ruleset_var_name(pbg_ruleset* rs, int i, int* n)
+{
+	if(n != NULL) *n = rs->_lens[i];
+	return rs->_names[i];
+}
+
+void pbg_ruleset_free(pbg_ruleset* rs)
+{
+	free(rs->_order);
+	free(rs->_names);
+	free(rs->_lens);
+	free(rs->_varmap);
+	free(rs->_varstart);
+	free(rs->_keyvar);
+	free(rs->_keys);
+	free(rs->_slots);
+	free(rs->_chain);
+	rs->_order = rs->_lens = rs->_varmap = rs->_varstart = NULL;
+	rs->_keyvar = rs->_slots = rs->_chain = NULL;
+	rs->_names = NULL;
+	rs->_keys = NULL;
+}
+
+/**
+ * Orders rules by descending priority, then by their position, for qsort.
+ * @param a  Priority and position of a rule.
+ * @param b  Priority and position of another rule.
+ * @return a negative number if a comes first, a positive number otherwise.
+ */
+int pbg_ruleset_cmp(const void* a, const void* b)
+{
+	const int* ra, *rb;
+	ra = (const int*) a, rb = (const int*) b;
+	if(ra[0] != rb[0])
+		return (ra[0] > rb[0]) ? -1 : 1;
+	return (ra[1] < rb[1]) ? -1 : (ra[1] > rb[1]);
+}
+
+/**
+ * Shares the variables of the rules of a rule set by name, through a hash 
+ * index of their names as pbg_store_variable does, and maps the variables of
+ * each rule to those of the rule set.
+ * @param rs  Rule set whose rules are ordered.
+ * @return 1 if successful, 0 if out of memory.
+ */
+int pbg_ruleset_names(pbg_ruleset* rs)
+{
+	pbg_expr* e;
+	char* name;
+	unsigned long h, mask;
+	int* slots;
+	int pos, i, n, total, numslots;
+	
+	/* Count the variables of every rule. */
+	rs->_varstart = malloc((rs->_numrules+1) * sizeof(int));
+	if(rs->_varstart == NULL)
+		return 0;
+	for(pos = total = 0; pos < rs->_numrules; pos++) {
+		e = rs->_rules + rs->_order[pos];
+		rs->_varstart[pos] = total;
+		total += e->_numvars;
+		if(e->_numvars > rs->_maxvars)
+			rs->_maxvars = e->_numvars;
+	}
+	rs->_varstart[rs->_numrules] = total;
+	for(numslots = 16; numslots < 2*total; numslots *= 2);
+	rs->_varmap = malloc((total+1) * sizeof(int));
+	rs->_names = malloc((total+1) * sizeof(char*));
+	rs->_lens = malloc((total+1) * sizeof(int));
+	slots = calloc(numslots, sizeof(int));
+	if(rs->_varmap == NULL || rs->_names == NULL || rs->_lens == NULL || 
+			slots == NULL) {
+		free(slots);
+		return 0;
+	}
+	
+	/* Map each variable to the first of its name. */
+	mask = numslots - 1;
+	for(pos = 0; pos < rs->_numrules; pos++) {
+		e = rs->_rules + rs->_order[pos];
+		for(i = 0; i < e->_numvars; i++) {
+			name = pbg_var_name(e, i, &n);
+			h = pbg_hash_name(name, n) & mask;
+			for(; slots[h] != 0; h = (h+1) & mask)
+				if(rs->_lens[slots[h]-1] == n && 
+						memcmp(rs->_names[slots[h]-1], name, n) == 0)
+					break;
+			if(slots[h] == 0) {
+				rs->_names[rs->_numvars] = name;
+				rs->_lens[rs->_numvars] = n;
+				slots[h] = ++rs->_numvars;
+			}
+			rs->_varmap[rs->_varstart[pos] + i] = slots[h] - 1;
+		}
+	}
+	free(slots);
+	return 1;
+}
+
+/**
+ * Finds the key of each rule, and indexes the rules whose key is on the
+ * variable which keys the most rules. The other rules are chained in order
+ * of priority.
+ * @param rs  Rule set whose variables are shared.
+ * @return 1 if successful, 0 if out of memory.
+ */
+int pbg_ruleset_index(pbg_ruleset* rs)
+{
+	int* counts;
+	int pos, var, slot;
+	rs->_keyvar = malloc((rs->_numrules+1) * sizeof(int));
+	rs->_keys = malloc((rs->_numrules+1) * sizeof(pbg_field*));
+	rs->_chain = malloc((rs->_numrules+1) * sizeof(int));
+	counts = calloc(rs->_numvars+1, sizeof(int));
+	if(rs->_keyvar == NULL || rs->_keys == NULL || rs->_chain == NULL || 
+			counts == NULL) {
+		free(counts);
+		return 0;
+	}
+	
+	/* Find the key of each rule, and the variable keying the most rules. */
+	for(pos = 0; pos < rs->_numrules; pos++) {
+		var = pbg_ruleset_key(rs->_rules + rs->_order[pos], rs->_keys + pos);
+		rs->_keyvar[pos] = (var < 0) ? -1 : 
+				rs->_varmap[rs->_varstart[pos] + var];
+		if(var >= 0 && ++counts[rs->_keyvar[pos]] > 
+				((rs->_indexvar < 0) ? 0 : counts[rs->_indexvar]))
+			rs->_indexvar = rs->_keyvar[pos];
+	}
+	
+	/* Chain the rules of each slot, and the rest, in order of priority. */
+	for(rs->_numslots = 16; rs->_indexvar >= 0 && 
+			rs->_numslots < 2*counts[rs->_indexvar]; rs->_numslots *= 2);
+	free(counts);
+	rs->_slots = malloc(rs->_numslots * sizeof(int));
+	if(rs->_slots == NULL)
+		return 0;
+	for(slot = 0; slot < rs->_numslots; slot++)
+		rs->_slots[slot] = -1;
+	for(pos = rs->_numrules-1; pos >= 0; pos--) {
+		if(rs->_indexvar >= 0 && rs->_keyvar[pos] == rs->_indexvar) {
+			slot = pbg_ruleset_hash(rs->_keys[pos]) & (rs->_numslots-1);
+			rs->_chain[pos] = rs->_slots[slot];
+			rs->_slots[slot] = pos;
+		}else {
+			rs->_chain[pos] = rs->_rest;
+			rs->_rest = pos;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Finds a comparison which a rule cannot be TRUE without: one of a variable
+ * and a NUMBER, DATE, or STRING constant by EQ, which is the rule itself or
+ * one of the arguments of the AND at its root. EQ compares bytes, so the 
+ * rule can only match records whose variable holds the constant exactly.
+ * @param e    Rule to inspect.
+ * @param key  Set to the constant, if any.
+ * @return the index of the variable in the rule, -1 if there is none.
+ */
+int pbg_ruleset_key(pbg_expr* e, pbg_field** key)
+{
+	pbg_field* root, *field;
+	pbg_fused* fu;
+	int i, n, *children, a, b;
+	root = e->_constants;
+	n = (root->_type == PBG_OP_AND) ? root->_int : 1;
+	for(i = 0; i < n; i++) {
+		/* Variables among the conjuncts are unbound, and cannot key a rule. */
+		if(root->_type == PBG_OP_AND && ((int*) root->_data)[i] < 0)
+			continue;
+		field = (root->_type == PBG_OP_AND) ? 
+				pbg_field_get(e, ((int*) root->_data)[i]) : root;
+		if(field->_type >= PBG_FU_NUMBER && field->_type <= PBG_FU_STRING) {
+			fu = (pbg_fused*) field->_data;
+			if(fu->_op == PBG_OP_EQ) {
+				*key = &fu->_const;
+				return -(fu->_var+1);
+			}
+			continue;
+		}
+		if((field->_type != PBG_OP_EQ && field->_type != PBG_SP_NUMBER_EQ &&
+				field->_type != PBG_SP_DATE_EQ && 
+				field->_type != PBG_SP_STRING_EQ) || field->_int != 2)
+			continue;
+		children = (int*) field->_data;
+		a = children[0], b = children[1];
+		if(a > 0 && b < 0)
+			a = children[1], b = children[0];
+		if(a < 0 && b > 0 && pbg_ruleset_iskey(pbg_field_get(e, b))) {
+			*key = pbg_field_get(e, b);
+			return -(a+1);
+		}
+	}
+	return -1;
+}
+
+/**
+ * Checks whether a field may key a rule: a NUMBER, DATE, or STRING.
+ * @param field  Field to check.
+ * @return 1 if the field may be a key, 0 otherwise.
+ */
+int pbg_ruleset_iskey(pbg_field* field)
+{
+	return field->_type == PBG_LT_NUMBER || field->_type == PBG_LT_DATE || 
+			field->_type == PBG_LT_STRING;
+}
+
+/**
+ * Checks whether a value is a key, as EQ compares them.
+ * @param value  Value of the variable of the key.
+ * @param key    Key of a rule.
+ * @return 1 if the value is the key, 0 otherwise.
+ */
+int pbg_ruleset_iskeyed(pbg_field* value, pbg_field* key)
+{
+	return value->_type == key->_type && value->_int == key->_int && 
+			memcmp(value->_data, key->_data, key->_int) == 0;
+}
+
+/**
+ * Hashes a key by its type and bytes.
+ * @param key  Key to hash.
+ * @return the hash of the key.
+ */
+unsigned long pbg_ruleset_hash(pbg_field* key)
+{
+	return pbg_hash_name((char*) key->_data, key->_int) ^ 
+			((unsigned long) key->_type * 0x9E3779B1UL & 0xFFFFFFFFUL);
+}
+
+
+/*********************
+ *                   *
+ * DECISION DIAGRAMS *
+ *                   *
+ *********************/
+
+void pbg_bdd_compile(pbg_bdd* bdd, pbg_error* err, pbg_expr* e, int maxnodes)
+{
+	pbg_bdd_tables t;
+	int* leafof, *counts, *order, *levels, *nodes;
+	int i, j, n, size, tries, built, swap;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Tables hold twice as many entries as there may be nodes. Larger 
+	 * diagrams would not fit in memory anyway. */
+	if(maxnodes < 0) maxnodes = 0;
+	if(maxnodes > PBG_BDD_MAXNODES) maxnodes = PBG_BDD_MAXNODES;
+	for(size = 64; size < 2 * (maxnodes + PBG_BDD_SINKS); size *= 2);
+	bdd->_expr = e;
+	bdd->_numleaves = 0;
+	bdd->_numnodes = 0;
+	bdd->_root = PBG_BDD_E;
+	bdd->_leaves = malloc((PBG_BDD_MAXLEAVES+1) * sizeof(int));
+	bdd->_nodes = malloc(4 * (maxnodes + PBG_BDD_SINKS) * sizeof(int));
+	t._bdd = bdd;
+	t._maxnodes = maxnodes + PBG_BDD_SINKS;
+	t._mask = size-1;
+	t._unique = malloc(size * sizeof(int));
+	t._cache = malloc(4 * size * sizeof(int));
+	leafof = malloc((e->_numconst + e->_numvars) * sizeof(int));
+	counts = calloc(3 * (PBG_BDD_MAXLEAVES+1), sizeof(int));
+	order = counts + (PBG_BDD_MAXLEAVES+1);
+	levels = order + (PBG_BDD_MAXLEAVES+1);
+	n = -1;
+	if(bdd->_leaves != NULL && bdd->_nodes != NULL && t._unique != NULL &&
+			t._cache != NULL && leafof != NULL && counts != NULL)
+		n = pbg_bdd_leaves(bdd, leafof, counts);
+	
+	/* Order the leaves as they first occur, then by how often they occur. 
+	 * The first leaf is always evaluated, so it stays first, and leaves which
+	 * occur alike often keep their order. */
+	built = 0;
+	for(tries = 0; n >= 0 && n <= PBG_BDD_MAXLEAVES && tries < 2; tries++) {
+		for(i = 0; i < n; i++)
+			order[i] = i;
+		for(i = 1; tries == 1 && i < n; i++)
+			for(j = i; j > 1 && counts[order[j-1]] < counts[order[j]]; j--) {
+				swap = order[j];
+				order[j] = order[j-1];
+				order[j-1] = swap;
+			}
+		for(i = j = 0; i < n; i++) {
+			levels[order[i]] = i;
+			j += (order[i] != i);
+		}
+		if(tries == 1 && j == 0)
+			break;
+		bdd->_numleaves = n;
+		built = pbg_bdd_build(&t, leafof, levels);
+		if(built != 0)
+			break;
+	}
+	free(t._unique);
+	free(t._cache);
+	free(leafof);
+	
+	/* Keep the leaves by level, and only the nodes which are reachable. */
+	if(built == 1) {
+		for(i = 0; i < n; i++)
+			levels[i] = bdd->_leaves[order[i]];
+		memcpy(bdd->_leaves, levels, n * sizeof(int));
+		pbg_bdd_compact(bdd);
+		nodes = realloc(bdd->_nodes, 4 * bdd->_numnodes * sizeof(int));
+		if(nodes != NULL)
+			bdd->_nodes = nodes;
+	}
+	else {
+		pbg_bdd_free(bdd);
+		bdd->_numleaves = 0;
+		bdd->_numnodes = 0;
+		if(n < 0 || built < 0)
+			pbg_err_alloc(err, __LINE__, __FILE__);
+	}
+	free(counts);
+}
+
+int pbg_bdd_evaluate(pbg_bdd* bdd, pbg_error* err, pbg_field* vars)
+{
+	pbg_expr bound;
+	pbg_error leaf;
+	int* node;
+	int n, result;
+	
+	/* Expressions without a diagram are evaluated as a tree. */
+	if(bdd->_nodes == NULL)
+		return pbg_evaluate_vars(bdd->_expr, err, vars);
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Variables must be of the types declared by pbg_specialize. */
+	if(bdd->_expr->_schema != NULL && !pbg_check_schema(bdd->_expr, err, vars))
+		return PBG_ERROR;
+	
+	/* Test leaves from the root down to a sink. */
+	bound = *bdd->_expr;
+	bound._variables = vars;
+	n = bdd->_root;
+	while(n >= PBG_BDD_SINKS) {
+		node = bdd->_nodes + 4*n;
+		pbg_err_init(&leaf, PBG_ERR_NONE, 0, NULL);
+		result = pbg_evaluate_r(&bound, &leaf, 
+				pbg_field_get(&bound, bdd->_leaves[node[0]]));
+		if(leaf._type != PBG_ERR_NONE)
+			n = node[1+PBG_BDD_E];
+		else
+			n = node[1 + (result == PBG_TRUE ? PBG_BDD_T : PBG_BDD_F)];
+	}
+	
+	/* Failures are rare, so the tree evaluator finds their error. */
+	if(n == PBG_BDD_E)
+		return pbg_evaluate_r(&bound, err, bound._constants);
+	return (n == PBG_BDD_T) ? PBG_TRUE : PBG_FALSE;
+}
+
+void pbg_bdd_free(pbg_bdd* bdd)
+{
+	if(bdd->_leaves != NULL) free(bdd->_leaves);
+	if(bdd->_nodes != NULL) free(bdd->_nodes);
+	bdd->_leaves = NULL;
+	bdd->_nodes = NULL;
+}
+
+/**
+ * Checks whether a field is combined into the diagram rather than tested as
+ * a leaf.
+ * @param field  Field to check.
+ * @return 1 if field is AND, OR, or NOT, 0 otherwise.
+ */
+int pbg_bdd_isgate(pbg_field* field)
+{
+	return field->_type == PBG_OP_AND || field->_type == PBG_OP_OR ||
+			field->_type == PBG_OP_NOT;
+}
+
+/**
+ * Finds the leaves of an expression, in the order the tree evaluator first
+ * reaches them. Variables and operators other than AND, OR, and NOT are 
+ * leaves; literals are not. Leaves whose hashes are equal are taken to be 
+ * alike, see pbg_hash_fields, and are the same leaf.
+ * @param bdd     Diagram being compiled. Its leaves are set to the index of
+ *                the first occurrence of each leaf.
+ * @param leafof  Set to the leaf of each field, see pbg_bdd_slot.
+ * @param counts  Incremented by the number of occurrences of each leaf.
+ * @return the number of leaves, PBG_BDD_MAXLEAVES+1 if there are more, or -1
+ *         if out of memory.
+ */
+int pbg_bdd_leaves(pbg_bdd* bdd, int* leafof, int* counts)
+{
+	pbg_expr* e;
+	pbg_field* field;
+	unsigned long* hashes;
+	int* stack, *children;
+	int i, j, k, n, depth;
+	e = bdd->_expr;
+	for(i = n = 0; i < e->_numconst; i++)
+		if(pbg_type_isop(e->_constants[i]._type))
+			n += e->_constants[i]._int;
+	hashes = pbg_hash_fields(e, 0);
+	stack = malloc((n+1) * sizeof(int));
+	if(hashes == NULL || stack == NULL) {
+		free(hashes);
+		free(stack);
+		return -1;
+	}
+	
+	/* Visit the arguments of AND, OR, and NOT from the first. */
+	n = depth = 0;
+	stack[depth++] = 1;
+	while(depth > 0 && n <= PBG_BDD_MAXLEAVES) {
+		k = stack[--depth];
+		field = e->_constants + (k-1);
+		if(k > 0 && pbg_bdd_isgate(field)) {
+			children = (int*) field->_data;
+			for(i = field->_int-1; i >= 0; i--)
+				stack[depth++] = children[i];
+			continue;
+		}
+		if(k > 0 && !pbg_type_isop(field->_type))
+			continue;
+		for(j = 0; j < n; j++)
+			if(pbg_hash_cmp(pbg_hash_slot(e, hashes, k), 
+					pbg_hash_slot(e, hashes, bdd->_leaves[j])) == 0)
+				break;
+		if(j == n)
+			bdd->_leaves[n++] = k;
+		leafof[pbg_bdd_slot(e, k)] = j;
+		counts[j]++;
+	}
+	free(hashes);
+	free(stack);
+	return n;
+}
+
+/**
+ * Builds the diagram of an expression for an order of its leaves, combining
+ * the diagrams of the arguments of AND, OR, and NOT before their own.
+ * @param t       Tables of the diagram being compiled.
+ * @param leafof  Leaf of each field, see pbg_bdd_slot.
+ * @param levels  Level of each leaf.
+ * @return 1 if successful, 0 if the diagram would have too many nodes, or -1
+ *         if out of memory.
+ */
+int pbg_bdd_build(pbg_bdd_tables* t, int* leafof, int* levels)
+{
+	pbg_bdd* bdd;
+	pbg_expr* e;
+	pbg_field* field;
+	int* dd, *stack, *children, *node;
+	char* expanded;
+	int i, k, op, acc, depth;
+	bdd = t->_bdd;
+	e = bdd->_expr;
+	dd = malloc((e->_numconst+1) * sizeof(int));
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	expanded = calloc(e->_numconst+1, 1);
+	if(dd == NULL || stack == NULL || expanded == NULL) {
+		free(dd);
+		free(stack);
+		free(expanded);
+		return -1;
+	}
+	
+	/* Start with the sinks, below every level, and empty tables. */
+	bdd->_numnodes = 0;
+	for(i = 0; i < PBG_BDD_SINKS; i++) {
+		node = bdd->_nodes + 4 * bdd->_numnodes++;
+		node[0] = bdd->_numleaves;
+		node[1] = node[2] = node[3] = i;
+	}
+	for(i = 0; i <= t->_mask; i++) {
+		t->_unique[i] = -1;
+		t->_cache[4*i] = -1;
+	}
+	t->_full = 0;
+	
+	/* The tree evaluator reaches arguments from the first, so each argument
+	 * decides whether the following ones are reached. */
+	depth = 0;
+	if(pbg_bdd_isgate(e->_constants))
+		stack[depth++] = 1;
+	while(depth > 0 && !t->_full) {
+		k = stack[depth-1];
+		field = e->_constants + (k-1);
+		children = (int*) field->_data;
+		if(!expanded[k]) {
+			expanded[k] = 1;
+			for(i = 0; i < field->_int; i++)
+				if(children[i] > 0 && 
+						pbg_bdd_isgate(e->_constants + (children[i]-1)))
+					stack[depth++] = children[i];
+			continue;
+		}
+		depth--;
+		op = (field->_type == PBG_OP_AND) ? PBG_BDD_AND : PBG_BDD_OR;
+		acc = pbg_bdd_child(t, dd, leafof, levels, children[field->_int-1]);
+		if(field->_type == PBG_OP_NOT)
+			acc = pbg_bdd_apply(t, PBG_BDD_NOT, acc, PBG_BDD_F);
+		for(i = field->_int-2; i >= 0; i--)
+			acc = pbg_bdd_apply(t, op, 
+					pbg_bdd_child(t, dd, leafof, levels, children[i]), acc);
+		dd[k] = acc;
+	}
+	bdd->_root = pbg_bdd_child(t, dd, leafof, levels, 1);
+	free(dd);
+	free(stack);
+	free(expanded);
+	return !t->_full;
+}
+
+/**
+ * Finds the diagram of an argument of AND, OR, or NOT.
+ * @param t       Tables of the diagram being compiled.
+ * @param dd      Diagram of each AND, OR, and NOT built so far.
+ * @param leafof  Leaf of each field, see pbg_bdd_slot.
+ * @param levels  Level of each leaf.
+ * @param index   Index of the argument.
+ * @return the node of the diagram of the argument.
+ */
+int pbg_bdd_child(pbg_bdd_tables* t, int* dd, int* leafof, int* levels, 
+		int index)
+{
+	pbg_expr* e;
+	pbg_field* field;
+	e = t->_bdd->_expr;
+	if(index > 0) {
+		field = e->_constants + (index-1);
+		if(pbg_bdd_isgate(field))
+			return dd[index];
+		/* Literals other than TRUE and FALSE fail to evaluate. */
+		if(field->_type == PBG_LT_TRUE)
+			return PBG_BDD_T;
+		if(field->_type == PBG_LT_FALSE)
+			return PBG_BDD_F;
+		if(!pbg_type_isop(field->_type))
+			return PBG_BDD_E;
+	}
+	return pbg_bdd_node(t, levels[leafof[pbg_bdd_slot(e, index)]], 
+			PBG_BDD_F, PBG_BDD_T, PBG_BDD_E);
+}
+
+/**
+ * Applies NOT, AND, or OR to diagrams, as the tree evaluator would to their 
+ * results: a failure fails the result, and the second diagram is only reached
+ * when the first does not decide the result. Recursion is bounded by the 
+ * number of levels. Results are cached, though entries may be overwritten.
+ * @param t   Tables of the diagram being compiled.
+ * @param op  PBG_BDD_NOT, PBG_BDD_AND, or PBG_BDD_OR.
+ * @param a   First diagram.
+ * @param b   Second diagram, or PBG_BDD_F for NOT.
+ * @return the resulting diagram, or PBG_BDD_E if the tables are full.
+ */
+int pbg_bdd_apply(pbg_bdd_tables* t, int op, int a, int b)
+{
+	int* na, *nb, *entry;
+	int i, level, r[PBG_BDD_SINKS];
+	if(t->_full)
+		return PBG_BDD_E;
+	if(a < PBG_BDD_SINKS) {
+		if(a == PBG_BDD_E) return PBG_BDD_E;
+		if(op == PBG_BDD_NOT) return (a == PBG_BDD_T) ? PBG_BDD_F : PBG_BDD_T;
+		if(op == PBG_BDD_AND) return (a == PBG_BDD_T) ? b : PBG_BDD_F;
+		return (a == PBG_BDD_F) ? b : PBG_BDD_T;
+	}
+	if(op != PBG_BDD_NOT && a == b)
+		return a;
+	entry = t->_cache + 4 * (pbg_bdd_hash(op, a, b, 0) & t->_mask);
+	if(entry[0] == op && entry[1] == a && entry[2] == b)
+		return entry[3];
+	
+	/* Split both diagrams on the leaf of the highest level. */
+	na = t->_bdd->_nodes + 4*a;
+	nb = t->_bdd->_nodes + 4*b;
+	level = (na[0] < nb[0]) ? na[0] : nb[0];
+	for(i = 0; i < PBG_BDD_SINKS; i++)
+		r[i] = pbg_bdd_apply(t, op, (na[0] == level) ? na[1+i] : a, 
+				(nb[0] == level) ? nb[1+i] : b);
+	entry[0] = op;
+	entry[1] = a;
+	entry[2] = b;
+	entry[3] = pbg_bdd_node(t, level, r[PBG_BDD_F], r[PBG_BDD_T], r[PBG_BDD_E]);
+	return entry[3];
+}
+
+/**
+ * Finds the node testing a leaf with the given successors, making it if it
+ * does not exist yet. A node whose successors are all alike is not made.
+ * @param t       Tables of the diagram being compiled.
+ * @param level   Level of the leaf to test.
+ * @param f       Successor if the leaf is FALSE.
+ * @param tr      Successor if the leaf is TRUE.
+ * @param er      Successor if the leaf fails.
+ * @return the node, or PBG_BDD_E if the diagram is full.
+ */
+int pbg_bdd_node(pbg_bdd_tables* t, int level, int f, int tr, int er)
+{
+	int* node;
+	unsigned long h;
+	int n;
+	if(f == tr && tr == er)
+		return f;
+	h = pbg_bdd_hash(level, f, tr, er) & t->_mask;
+	for(; (n = t->_unique[h]) != -1; h = (h+1) & t->_mask) {
+		node = t->_bdd->_nodes + 4*n;
+		if(node[0] == level && node[1] == f && node[2] == tr && node[3] == er)
+			return n;
+	}
+	if(t->_bdd->_numnodes == t->_maxnodes) {
+		t->_full = 1;
+		return PBG_BDD_E;
+	}
+	n = t->_bdd->_numnodes++;
+	node = t->_bdd->_nodes + 4*n;
+	node[0] = level;
+	node[1] = f;
+	node[2] = tr;
+	node[3] = er;
+	t->_unique[h] = n;
+	return n;
+}
+
+/**
+ * Drops the nodes which are not reachable from the root, which applying 
+ * operations leaves behind. Nodes are made after their successors, so one
+ * pass from the last node finds the reachable ones, and renumbering them in
+ * order keeps successors first.
+ * @param bdd  Diagram to compact.
+ */
+void pbg_bdd_compact(pbg_bdd* bdd)
+{
+	int* ids, *from, *to;
+	int i, n, m;
+	ids = malloc(bdd->_numnodes * sizeof(int));
+	if(ids == NULL)
+		return;  /* Unreachable nodes are harmless. */
+	for(n = 0; n < bdd->_numnodes; n++)
+		ids[n] = (n < PBG_BDD_SINKS || n == bdd->_root);
+	for(n = bdd->_numnodes-1; n >= PBG_BDD_SINKS; n--)
+		for(i = 1; ids[n] && i <= PBG_BDD_SINKS; i++)
+			ids[bdd->_nodes[4*n+i]] = 1;
+	for(n = m = 0; n < bdd->_numnodes; n++) {
+		if(!ids[n])
+			continue;
+		ids[n] = m;
+		from = bdd->_nodes + 4*n;
+		to = bdd->_nodes + 4*m++;
+		to[0] = from[0];
+		for(i = 1; i <= PBG_BDD_SINKS; i++)
+			to[i] = ids[from[i]];
+	}
+	bdd->_root = ids[bdd->_root];
+	bdd->_numnodes = m;
+	free(ids);
+}
+
+/**
+ * Finds the position of a field among the constants, then variables, of an 
+ * expression.
+ * @param e      Expression the field belongs to.
+ * @param index  Index of the field.
+ * @return the position of the field.
+ */
+int pbg_bdd_slot(pbg_expr* e, int index)
+{
+	return (index > 0) ? index-1 : e->_numconst - (index+1);
+}
+
+/**
+ * Hashes four words for the tables of a diagram.
+ * @param a  First word.
+ * @param b  Second word.
+ * @param c  Third word.
+ * @param d  Fourth word.
+ * @return the hash, modulo 2^32.
+ */
+unsigned long pbg_bdd_hash(int a, int b, int c, int d)
+{
+	unsigned long h;
+	h = ((unsigned long) a * 0x9E3779B1UL) & 0xFFFFFFFFUL;
+	h = ((h ^ (unsigned long) b) * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+	h = ((h ^ (unsigned long) c) * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+	h = ((h ^ (unsigned long) d) * 0x27D4EB2FUL) & 0xFFFFFFFFUL;
+	return h ^ (h >> 16);
+}
+
+
+/*******************
+ *                 *
+ * STRING MATCHING *
+ *                 *
+ *******************/
+
+/**
+ * Compiles the patterns of every string operator given at least 
+ * PBG_MATCH_MINPATTERNS STRING literals into a single Aho-Corasick automaton,
+ * so that one scan of its first argument tests every pattern. The children of
+ * such operators are kept, so the tree can still be walked as before. 
+ * Operators are left as they are if out of memory.
+ * @param e  Expression to compile.
+ */
+void pbg_match_compile(pbg_expr* e)
+{
+	pbg_field* field, *k;
+	void* data;
+	int i, j, *children;
+	for(i = 0; i < e->_numconst; i++) {
+		field = e->_constants + i;
+		if((field->_type != PBG_OP_PFX && field->_type != PBG_OP_SFX && 
+				field->_type != PBG_OP_CONT) || 
+				field->_int-1 < PBG_MATCH_MINPATTERNS)
+			continue;
+		children = (int*) field->_data;
+		for(j = 1; j < field->_int; j++) {
+			if(children[j] < 0)
+				break;
+			k = pbg_field_get(e, children[j]);
+			if(k->_type != PBG_LT_STRING)
+				break;
+		}
+		if(j != field->_int || (data = pbg_match_build(e, field)) == NULL)
+			continue;
+		free(field->_data);
+		field->_data = data;
+		field->_type = field->_type - PBG_OP_PFX + PBG_AC_PFX;
+	}
+}
+
+/**
+ * Builds the automaton of the patterns of a string operator. Bytes which 
+ * occur in the same patterns share a class, and every state has a transition
+ * on each class, so a scan takes one step per byte whatever the patterns. 
+ * The data holds the children of the operator, then the pbg_matcher, its 
+ * transitions by state and class, and the info of each state: its depth 
+ * shifted left by two, with PBG_MATCH_END and PBG_MATCH_ANY.
+ * @param e      Expression the operator belongs to.
+ * @param field  Operator whose patterns are all STRING literals.
+ * @return the data of the compiled operator, or NULL if out of memory or if
+ *         the patterns are too long.
+ */
+void* pbg_match_build(pbg_expr* e, pbg_field* field)
+{
+	pbg_matcher m, *dst;
+	pbg_field* k;
+	unsigned char* str;
+	int* children, *next, *info, *fail, *queue, *data;
+	int i, j, c, s, t, len, nc, head, tail, numstates;
+	
+	/* Bytes in no pattern make up class 0. */
+	children = (int*) field->_data;
+	memset(m._class, 0, sizeof(m._class));
+	for(i = 1, len = 0; i < field->_int; i++) {
+		k = pbg_field_get(e, children[i]);
+		if(k->_int > PBG_MATCH_MAXLEN - len)
+			return NULL;
+		len += k->_int;
+		for(j = 0; j < k->_int; j++)
+			m._class[((unsigned char*) k->_data)[j]] = 1;
+	}
+	for(c = 0, nc = 1; c < 256; c++)
+		if(m._class[c]) m._class[c] = (unsigned char) nc++;
+	
+	/* Build the trie of the patterns, with -1 for missing transitions. */
+	next = malloc((len+1) * nc * sizeof(int));
+	info = calloc(len+1, sizeof(int));
+	fail = malloc((len+1) * sizeof(int));
+	queue = malloc((len+1) * sizeof(int));
+	if(next == NULL || info == NULL || fail == NULL || queue == NULL) {
+		free(next);
+		free(info);
+		free(fail);
+		free(queue);
+		return NULL;
+	}
+	for(i = 0; i < nc; i++)
+		next[i] = -1;
+	numstates = 1;
+	for(i = 1; i < field->_int; i++) {
+		k = pbg_field_get(e, children[i]);
+		str = (unsigned char*) k->_data;
+		for(j = s = 0; j < k->_int; j++) {
+			t = s*nc + m._class[str[j]];
+			if(next[t] < 0) {
+				for(c = 0; c < nc; c++)
+					next[numstates*nc + c] = -1;
+				info[numstates] = (j+1) << 2;
+				next[t] = numstates++;
+			}
+			s = next[t];
+		}
+		info[s] |= PBG_MATCH_END | PBG_MATCH_ANY;
+	}
+	
+	/* Fill in the missing transitions breadth first, following the failure
+	 * link of each state: the state of its longest proper suffix. */
+	head = tail = 0;
+	for(c = 0; c < nc; c++) {
+		if(next[c] < 0)
+			next[c] = 0;
+		else {
+			fail[next[c]] = 0;
+			queue[tail++] = next[c];
+		}
+	}
+	while(head < tail) {
+		s = queue[head++];
+		info[s] |= info[fail[s]] & PBG_MATCH_ANY;
+		for(c = 0; c < nc; c++) {
+			t = next[s*nc + c];
+			if(t < 0)
+				next[s*nc + c] = next[fail[s]*nc + c];
+			else {
+				fail[t] = next[fail[s]*nc + c];
+				queue[tail++] = t;
+			}
+		}
+	}
+	
+	/* Bytes which leave the root as is are skipped by pbg_match_scan. */
+	m._numstates = numstates;
+	m._numclasses = nc;
+	for(c = j = 0; c < 256; c++) {
+		m._stay[c] = (next[m._class[c]] == 0);
+		if(!m._stay[c]) {
+			m._first = c;
+			j++;
+		}
+	}
+	if(j != 1) m._first = -1;
+	
+	/* Lay out the children, the automaton, and its tables. */
+	data = malloc(field->_int * sizeof(int) + sizeof(pbg_matcher) + 
+			numstates * (nc+1) * sizeof(int));
+	if(data != NULL) {
+		memcpy(data, children, field->_int * sizeof(int));
+		dst = (pbg_matcher*) (data + field->_int);
+		*dst = m;
+		memcpy(dst + 1, next, numstates * nc * sizeof(int));
+		memcpy((int*) (dst + 1) + numstates * nc, info, 
+				numstates * sizeof(int));
+	}
+	free(next);
+	free(info);
+	free(fail);
+	free(queue);
+	return data;
+}
+
+/**
+ * Scans a string with the automaton of a compiled string operator. Runs of
+ * bytes which start no pattern are skipped from the root at once, with 
+ * memchr if a single byte starts every pattern.
+ * @param m     Automaton of the operator.
+ * @param type  PBG_AC_PFX, PBG_AC_SFX, or PBG_AC_CONT.
+ * @param str   String to scan.
+ * @param n     Length of str.
+ * @return PBG_TRUE if a pattern starts, ends, or occurs in the string, 
+ *         according to type, PBG_FALSE otherwise.
+ */
+int pbg_match_scan(pbg_matcher* m, pbg_field_type type, unsigned char* str, 
+		int n)
+{
+	unsigned char* hit;
+	int* next, *info;
+	int i, s, nc;
+	nc = m->_numclasses;
+	next = (int*) (m + 1);
+	info = next + m->_numstates * nc;
+	s = 0;
+	
+	/* A prefix follows the trie, whose states are one deeper each byte. */
+	if(type == PBG_AC_PFX) {
+		for(i = 0; !(info[s] & PBG_MATCH_END); i++) {
+			if(i == n) return PBG_FALSE;
+			s = next[s*nc + m->_class[str[i]]];
+			if((info[s] >> 2) != i+1) return PBG_FALSE;
+		}
+		return PBG_TRUE;
+	}
+	if(type == PBG_AC_CONT && (info[0] & PBG_MATCH_ANY))
+		return PBG_TRUE;
+	for(i = 0; i < n; i++) {
+		if(s == 0) {
+			if(m->_first >= 0) {
+				hit = memchr(str+i, m->_first, n-i);
+				if(hit == NULL) break;
+				i = hit - str;
+			}
+			else {
+				while(i < n && m->_stay[str[i]]) i++;
+				if(i == n) break;
+			}
+		}
+		s = next[s*nc + m->_class[str[i]]];
+		if(type == PBG_AC_CONT && (info[s] & PBG_MATCH_ANY))
+			return PBG_TRUE;
+	}
+	/* A suffix is a pattern ending the text of the last state. */
+	return (type == PBG_AC_SFX && (info[s] & PBG_MATCH_ANY)) ? 
+			PBG_TRUE : PBG_FALSE;
+}
+
+/**
+ * Tests a single pattern of a string operator which was not compiled.
+ * @param type     PBG_OP_PFX, PBG_OP_SFX, or PBG_OP_CONT.
+ * @param str      STRING to test.
+ * @param pattern  STRING pattern.
+ * @return 1 if the pattern starts, ends, or occurs in the string, according
+ *         to type, 0 otherwise.
+ */
+int pbg_match_one(pbg_field_type type, pbg_field* str, pbg_field* pattern)
+{
+	char* s, *p, *hit;
+	int n, m;
+	s = (char*) str->_data, n = str->_int;
+	p = (char*) pattern->_data, m = pattern->_int;
+	if(m > n) return 0;
+	if(m == 0) return 1;
+	if(type == PBG_OP_PFX) return memcmp(s, p, m) == 0;
+	if(type == PBG_OP_SFX) return memcmp(s + n-m, p, m) == 0;
+	for(hit = s; (hit = memchr(hit, p[0], s + n-m+1 - hit)) != NULL; hit++)
+		if(memcmp(hit, p, m) == 0)
+			return 1;
+	return 0;
+}
+
+
+/***************
+ *             *
+ * CSV RECORDS *
+ *             *
+ ***************/
+
+void pbg_csv_bind(pbg_csv* csv, pbg_error* err, pbg_expr* e, 
+		char* header, size_t n, char delim)
+{
+	size_t i, end, len;
+	int col, var;
+	char* name;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	csv->_expr = e;
+	csv->_delim = delim;
+	csv->_maxcol = -1;
+	csv->_scrused = 0;
+	
+	/* Count the columns named by the header. */
+	csv->_numcols = 0;
+	for(i = 0; ; i = end+1) {
+		end = pbg_csv_scan(header, n, i, delim);
+		csv->_numcols++;
+		if(end >= n) break;
+	}
+	
+	/* Allocate space for the binding and the state of a record. */
+	csv->_colvar = malloc(csv->_numcols * sizeof(int));
+	csv->_start = malloc((e->_numvars+1) * sizeof(char*));
+	csv->_len = malloc((e->_numvars+1) * sizeof(size_t));
+	csv->_vars = malloc((e->_numvars+1) * sizeof(pbg_field));
+	csv->_numbers = malloc((e->_numvars+1) * sizeof(pbg_lt_number));
+	csv->_dates = malloc((e->_numvars+1) * sizeof(pbg_lt_date));
+	csv->_scratch = malloc((csv->_scrcap = n+1));
+	if(csv->_colvar == NULL || csv->_start == NULL || csv->_len == NULL || 
+			csv->_vars == NULL || csv->_numbers == NULL || 
+			csv->_dates == NULL || csv->_scratch == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		pbg_csv_free(csv);
+		return;
+	}
+	
+	/* Bind each variable to the first column with its name. Until a record 
+	 * is split, _start marks which variables have been bound. */
+	for(var = 0; var < e->_numvars; var++)
+		csv->_start[var] = NULL;
+	for(col = 0, i = 0; col < csv->_numcols; col++, i = end+1) {
+		end = pbg_csv_scan(header, n, i, delim);
+		csv->_colvar[col] = -1;
+		name = header+i;
+		len = pbg_csv_unquote(&name, end-i, csv->_scratch);
+		for(var = 0; var < e->_numvars; var++) {
+			if(csv->_start[var] == NULL && 
+					(size_t) e->_variables[var]._int == len && 
+					memcmp(e->_variables[var]._data, name, len) == 0) {
+				csv->_colvar[col] = var;
+				csv->_start[var] = header;
+				csv->_maxcol = col;
+				break;
+			}
+		}
+	}
+}
+
+int pbg_csv_evaluate(pbg_csv* csv, pbg_error* err, char* record, size_t n)
+{
+	size_t i, end;
+	int col, var;
+	char* scratch;
+	
+	/* Unquoted fields never outgrow the record. */
+	if(csv->_scrcap < n) {
+		scratch = realloc(csv->_scratch, n);
+		if(scratch == NULL) {
+			pbg_err_alloc(err, __LINE__, __FILE__);
+			return PBG_ERROR;
+		}
+		csv->_scratch = scratch;
+		csv->_scrcap = n;
+	}
+	csv->_scrused = 0;
+	
+	/* Fields of variables without a column in this record are NULL. */
+	for(var = 0; var < csv->_expr->_numvars; var++)
+		csv->_start[var] = NULL;
+	
+	/* Split the record up to the last bound column. Columns after it are 
+	 * never scanned. */
+	for(col = 0, i = 0; col <= csv->_maxcol; col++, i = end+1) {
+		end = pbg_csv_scan(record, n, i, csv->_delim);
+		var = csv->_colvar[col];
+		if(var >= 0) {
+			csv->_start[var] = record+i;
+			csv->_len[var] = end-i;
+		}
+		if(end >= n) break;
+	}
+	
+	/* Evaluate, converting fields as the variables are reached. */
+	return pbg_evaluate_lazy(csv->_expr, err, csv->_vars, pbg_csv_resolve, csv);
+}
+
+void pbg_csv_free(pbg_csv* csv)
+{
+	free(csv->_colvar);
+	free(csv->_start);
+	free(csv->_len);
+	free(csv->_vars);
+	free(csv->_numbers);
+	free(csv->_dates);
+	free(csv->_scratch);
+	csv->_colvar = NULL;
+	csv->_start = NULL;
+	csv->_len = NULL;
+	csv->_vars = NULL;
+	csv->_numbers = NULL;
+	csv->_dates = NULL;
+	csv->_scratch = NULL;
+}
+
+/**
+ * Finds the end of the CSV field starting at the given index of a record.
+ * Delimiters within quotes do not end a field.
+ * @param str    Record to scan.
+ * @param n      Length of the record.
+ * @param i      Index of the start of the field.
+ * @param delim  Field delimiter.
+ * @return the index of the delimiter ending the field, or n if the field 
+ *         ends the record.
+ */
+size_t pbg_csv_scan(char* str, size_t n, size_t i, char delim)
+{
+	char* end;
+	if(i < n && str[i] == '"') {
+		for(i++; i < n; i++) {
+			if(str[i] != '"') continue;
+			if(i+1 < n && str[i+1] == '"') i++;  /* Escaped quote. */
+			else { i++; break; }
+		}
+	}
+	if(i >= n) return n;
+	end = memchr(str+i, delim, n-i);
+	return (end == NULL) ? n : (size_t) (end - str);
+}
+
+/**
+ * Strips the quotes from a quoted CSV field. The field is only copied if it
+ * contains escaped quotes.
+ * @param str      Field to unquote. Set to the unquoted contents.
+ * @param n        Length of the field.
+ * @param scratch  Storage for the unquoted field, of at least n bytes.
+ * @return the length of the unquoted field.
+ */
+size_t pbg_csv_unquote(char** str, size_t n, char* scratch)
+{
+	char* src;
+	size_t i, len;
+	int escaped;
+	src = *str;
+	if(n == 0 || src[0] != '"')
+		return n;
+	/* Find the closing quote. */
+	escaped = 0;
+	for(i = 1; i < n; i++) {
+		if(src[i] != '"') continue;
+		if(i+1 < n && src[i+1] == '"') escaped = 1, i++;
+		else break;
+	}
+	if(!escaped) {
+		*str = src+1;
+		return i-1;
+	}
+	/* Collapse escaped quotes. */
+	for(len = 0, n = i, i = 1; i < n; i++) {
+		scratch[len++] = src[i];
+		if(src[i] == '"') i++;
+	}
+	*str = scratch;
+	return len;
+}
+
+/**
+ * Converts the field bound to a variable of the current record. This is the
+ * resolver given to pbg_evaluate_lazy by pbg_csv_evaluate.
+ * @param ctx  CSV binding.
+ * @param var  Index of the variable to resolve.
+ * @return the field of the variable.
+ */
+pbg_field pbg_csv_resolve(void* ctx, int var)
+{
+	pbg_csv* csv;
+	char* str;
+	size_t len;
+	int n;
+	csv = (pbg_csv*) ctx;
+	if(csv->_start[var] == NULL)
+		return pbg_make_null();
+	str = csv->_start[var];
+	len = pbg_csv_unquote(&str, csv->_len[var], csv->_scratch + csv->_scrused);
+	if(str == csv->_scratch + csv->_scrused)
+		csv->_scrused += len;
+	/* The length of a field must be an int, see pbg_init_string. */
+	if(len == 0 || len > INT_MAX)
+		return pbg_make_null();
+	n = (int) len;
+	if(pbg_istrue(str, n))
+		return pbg_make_bool(1);
+	if(pbg_isfalse(str, n))
+		return pbg_make_bool(0);
+	if(pbg_isdate(str, n)) {
+		pbg_todate(csv->_dates+var, str, n);
+		return pbg_field_init(PBG_LT_DATE, sizeof(pbg_lt_date), csv->_dates+var);
+	}
+	if(pbg_read_number(str, n, &csv->_numbers[var]._val))
+		return pbg_field_init(PBG_LT_NUMBER, sizeof(pbg_lt_number), 
+				csv->_numbers+var);
+	return pbg_init_string(str, n);
+}
+
+
+/*****************
+ *               *
+ * ARROW RECORDS *
+ *               *
+ *****************/
+
+void pbg_arrow_bind(pbg_arrow* a, pbg_error* err, pbg_expr* e, 
+		struct ArrowSchema* schema)
+{
+	struct ArrowSchema* column;
+	int var, col;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	a->_expr = e;
+	a->_numcols = (int) schema->n_children;
+	a->_batch = NULL;
+	a->_row = 0;
+	a->_column = malloc((e->_numvars+1) * sizeof(int));
+	a->_format = malloc(e->_numvars+1);
+	a->_vars = malloc((e->_numvars+1) * sizeof(pbg_field));
+	a->_numbers = malloc((e->_numvars+1) * sizeof(pbg_lt_number));
+	a->_dates = malloc((e->_numvars+1) * sizeof(pbg_lt_date));
+	if(a->_column == NULL || a->_format == NULL || a->_vars == NULL || 
+			a->_numbers == NULL || a->_dates == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		pbg_arrow_free(a);
+		return;
+	}
+	if(strcmp(schema->format, "+s") != 0) {
+		pbg_err_state(err, __LINE__, __FILE__, 
+				"Arrow schema of a batch must be a struct.");
+		pbg_arrow_free(a);
+		return;
+	}
+	
+	/* Bind each variable to the first column with its name. */
+	for(var = 0; var < e->_numvars; var++) {
+		a->_column[var] = -1;
+		a->_format[var] = 'n';
+		column = NULL;
+		for(col = 0; col < a->_numcols; col++) {
+			column = schema->children[col];
+			if(column->name != NULL && 
+					(int) strlen(column->name) == e->_variables[var]._int &&
+					memcmp(column->name, e->_variables[var]._data, 
+					e->_variables[var]._int) == 0)
+				break;
+		}
+		if(column == NULL || col == a->_numcols)
+			continue;
+		a->_column[var] = col;
+		a->_format[var] = pbg_arrow_format(column->format);
+		if(a->_format[var] == '\0') {
+			pbg_err_state(err, __LINE__, __FILE__, 
+					"Unsupported format of Arrow column.");
+			pbg_arrow_free(a);
+			return;
+		}
+	}
+}
+
+long pbg_arrow_evaluate(pbg_arrow* a, pbg_error* err, struct ArrowArray* batch,
+		struct ArrowArray* out, struct ArrowSchema* schema)
+{
+	pbg_error rowerr;
+	unsigned char* valid, *values;
+	const void** buffers;
+	long numtrue, numerrors, nbytes;
+	int64_t r;
+	int result;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Check the batch before reading its buffers. */
+	if(!pbg_arrow_check(a, batch)) {
+		pbg_err_state(err, __LINE__, __FILE__, 
+				"Arrow batch does not match its schema.");
+		return -1;
+	}
+	
+	/* The buffers of the result and the pointers to them are allocated 
+	 * together, and freed together by pbg_arrow_release. */
+	nbytes = (long) ((batch->length + 7) / 8);
+	buffers = malloc(2*sizeof(void*) + 2*nbytes + 1);
+	if(buffers == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return -1;
+	}
+	valid = (unsigned char*) (buffers + 2);
+	values = valid + nbytes;
+	memset(valid, 0, 2*nbytes);
+	
+	/* Evaluate each row, resolving a variable when the evaluation reaches it, 
+	 * and keeping the first error. */
+	a->_batch = batch;
+	numtrue = numerrors = 0;
+	for(r = 0; r < batch->length; r++) {
+		a->_row = batch->offset + r;
+		result = pbg_evaluate_lazy(a->_expr, &rowerr, a->_vars, 
+				pbg_arrow_resolve, a);
+		if(rowerr._type != PBG_ERR_NONE) {
+			if(err->_type == PBG_ERR_NONE)
+				*err = rowerr;
+			numerrors++;
+			continue;
+		}
+		valid[r >> 3] |= 1 << (r & 7);
+		if(result == PBG_TRUE) {
+			values[r >> 3] |= 1 << (r & 7);
+			numtrue++;
+		}
+	}
+	a->_batch = NULL;
+	
+	/* Describe the result as an Arrow boolean array, which needs no validity
+	 * bitmap if no row failed. */
+	buffers[0] = (numerrors == 0) ? NULL : valid;
+	buffers[1] = values;
+	out->length = batch->length;
+	out->null_count = numerrors;
+	out->offset = 0;
+	out->n_buffers = 2;
+	out->n_children = 0;
+	out->buffers = buffers;
+	out->children = NULL;
+	out->dictionary = NULL;
+	out->release = pbg_arrow_release;
+	out->private_data = buffers;
+	if(schema != NULL) {
+		schema->format = "b";
+		schema->name = "";
+		schema->metadata = NULL;
+		schema->flags = ARROW_FLAG_NULLABLE;
+		schema->n_children = 0;
+		schema->children = NULL;
+		schema->dictionary = NULL;
+		schema->release = pbg_arrow_release_schema;
+		schema->private_data = NULL;
+	}
+	return numtrue;
+}
+
+void pbg_arrow_free(pbg_arrow* a)
+{
+	free(a->_column);
+	free(a->_format);
+	free(a->_vars);
+	free(a->_numbers);
+	free(a->_dates);
+	a->_column = NULL;
+	a->_format = NULL;
+	a->_vars = NULL;
+	a->_numbers = NULL;
+	a->_dates = NULL;
+}
+
+/**
+ * Finds the format of a column which variables may be bound to.
+ * @param format  Arrow format string of the column.
+ * @return the first character of the format, 'D' for date32, or '\0' if the
+ *         format is not supported.
+ */
+char pbg_arrow_format(const char* format)
+{
+	if(strcmp(format, "tdD") == 0)
+		return 'D';
+	if(strlen(format) == 1 && strchr("glubn", format[0]) != NULL)
+		return format[0];
+	return '\0';
+}
+
+/**
+ * Checks that a batch has the columns and buffers its binding reads.
+ * @param a      Arrow binding to evaluate with.
+ * @param batch  Batch to check.
+ * @return 1 if the batch may be evaluated, 0 otherwise.
+ */
+int pbg_arrow_check(pbg_arrow* a, struct ArrowArray* batch)
+{
+	struct ArrowArray* column;
+	int var, need;
+	if(batch->n_children != a->_numcols || batch->length < 0 || 
+			batch->length > LONG_MAX - 16)
+		return 0;
+	for(var = 0; var < a->_expr->_numvars; var++) {
+		if(a->_column[var] < 0 || a->_format[var] == 'n')
+			continue;
+		column = batch->children[a->_column[var]];
+		need = (a->_format[var] == 'u') ? 3 : 2;
+		if(column->n_buffers != need || column->buffers[1] == NULL || 
+				(need == 3 && column->buffers[2] == NULL) ||
+				column->offset + column->length < batch->offset + batch->length)
+			return 0;
+	}
+	return 1;
+}
+
+/**
+ * Resolves a variable of the row being evaluated from its column, see 
+ * pbg_evaluate_lazy. NUMBERs of float64 columns and STRINGs point into the 
+ * buffers of the batch.
+ * @param ctx  Arrow binding being evaluated.
+ * @param var  Index of the variable to resolve.
+ * @return the field of the variable in the row.
+ */
+pbg_field pbg_arrow_resolve(void* ctx, int var)
+{
+	pbg_arrow* a;
+	struct ArrowArray* column;
+	const unsigned char* bits;
+	const int32_t* offsets;
+	int64_t i;
+	a = (pbg_arrow*) ctx;
+	
+	/* Rows of the batch which are null have no columns. */
+	bits = (const unsigned char*) a->_batch->buffers[0];
+	if(a->_column[var] < 0 || a->_format[var] == 'n' ||
+			(a->_batch->n_buffers > 0 && bits != NULL && 
+			!(bits[a->_row >> 3] & (1 << (a->_row & 7)))))
+		return pbg_make_null();
+	column = a->_batch->children[a->_column[var]];
+	i = column->offset + a->_row;
+	bits = (const unsigned char*) column->buffers[0];
+	if(bits != NULL && !(bits[i >> 3] & (1 << (i & 7))))
+		return pbg_make_null();
+	switch(a->_format[var]) {
+		case 'g':
+			return pbg_field_init(PBG_LT_NUMBER, sizeof(pbg_lt_number), 
+					(double*) column->buffers[1] + i);
+		case 'l':
+			return pbg_init_number(a->_numbers + var, 
+					(double) ((const int64_t*) column->buffers[1])[i]);
+		case 'D':
+			return pbg_arrow_date(a->_dates + var, 
+					((const int32_t*) column->buffers[1])[i]);
+		case 'u':
+			offsets = (const int32_t*) column->buffers[1];
+			return pbg_init_string((char*) column->buffers[2] + offsets[i], 
+					offsets[i+1] - offsets[i]);
+		default:
+			bits = (const unsigned char*) column->buffers[1];
+			return pbg_make_bool((bits[i >> 3] >> (i & 7)) & 1);
+	}
+}
+
+/**
+ * Converts a date32 entry, counting days since 1970-01-01, to a DATE.
+ * @param data  Storage for the DATE.
+ * @param days  Days since 1970-01-01.
+ * @return the DATE, or NULL if it is before year 0.
+ */
+pbg_field pbg_arrow_date(pbg_lt_date* data, long days)
+{
+	long z, era, doe, yoe, doy, mp, year, month;
+	
+	/* Count from 0000-03-01, so that leap days end each cycle of years. */
+	z = days + 719468L;
+	if(z < 0)
+		return pbg_make_null();
+	era = z / 146097L;
+	doe = z - era * 146097L;
+	yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+	doy = doe - (365*yoe + yoe/4 - yoe/100);
+	mp = (5*doy + 2) / 153;
+	month = (mp < 10) ? mp+3 : mp-9;
+	year = yoe + era*400 + (month <= 2);
+	return pbg_init_date(data, (int) year, (int) month, 
+			(int) (doy - (153*mp + 2)/5 + 1));
+}
+
+/**
+ * Releases an array made by pbg_arrow_evaluate.
+ * @param array  Array to release.
+ */
+void pbg_arrow_release(struct ArrowArray* array)
+{
+	free(array->private_data);
+	array->release = NULL;
+}
+
+/**
+ * Releases a schema made by pbg_arrow_evaluate, which owns nothing.
+ * @param schema  Schema to release.
+ */
+void pbg_arrow_release_schema(struct ArrowSchema* schema)
+{
+	schema->release = NULL;
+}
+
+
+/**************************
+ *                        *
+ * INCREMENTAL EVALUATION *
+ *                        *
+ **************************/
+
+void pbg_incr_bind(pbg_incr* incr, pbg_error* err, pbg_expr* e, 
+		pbg_field* vars)
+{
+	pbg_field* field;
+	int i, j, child, numrefs;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	incr->_expr = e;
+	incr->_vars = vars;
+	incr->_numevals = 0;
+	incr->_results = malloc(e->_numconst * sizeof(int));
+	incr->_errors = malloc(e->_numconst * sizeof(pbg_error));
+	incr->_parents = malloc(e->_numconst * sizeof(int));
+	incr->_refstart = calloc(e->_numvars + 1, sizeof(int));
+	incr->_refs = NULL;
+	if(incr->_results == NULL || incr->_errors == NULL || 
+			incr->_parents == NULL || incr->_refstart == NULL) {
+		pbg_incr_free(incr);
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return;
+	}
+	
+	/* Link every constant to its parent, and count the operators which 
+	 * reference each variable. */
+	numrefs = 0;
+	incr->_parents[0] = -1;
+	for(i = 0; i < e->_numconst; i++) {
+		incr->_results[i] = PBG_INCR_STALE;
+		field = e->_constants + i;
+		if(!pbg_type_isop(field->_type))
+			continue;
+		for(j = 0; j < field->_int; j++) {
+			child = ((int*)field->_data)[j];
+			if(child > 0) incr->_parents[child-1] = i;
+			else incr->_refstart[-child-1]++, numrefs++;
+		}
+	}
+	
+	/* Lay out the operators of each variable contiguously. _refstart[v] 
+	 * counts the references to variable v, then holds the end of its range,
+	 * and finally its start once the range is filled. */
+	incr->_refs = malloc((numrefs + 1) * sizeof(int));
+	if(incr->_refs == NULL) {
+		pbg_incr_free(incr);
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return;
+	}
+	for(i = 1; i <= e->_numvars; i++)
+		incr->_refstart[i] += incr->_refstart[i-1];
+	for(i = e->_numconst-1; i >= 0; i--) {
+		field = e->_constants + i;
+		if(!pbg_type_isop(field->_type))
+			continue;
+		for(j = field->_int-1; j >= 0; j--) {
+			child = ((int*)field->_data)[j];
+			if(child < 0)
+				incr->_refs[--incr->_refstart[-child-1]] = i;
+		}
+	}
+}
+
+void pbg_incr_set(pbg_incr* incr, int var, pbg_field value)
+{
+	int i, node;
+	incr->_vars[var] = value;
+	/* Mark the paths to the root as stale. A path ends early at a stale 
+	 * operator: its ancestors are either stale already, or did not need its
+	 * result when they were last evaluated. */
+	for(i = incr->_refstart[var]; i < incr->_refstart[var+1]; i++) {
+		node = incr->_refs[i];
+		while(node != -1 && incr->_results[node] != PBG_INCR_STALE) {
+			incr->_results[node] = PBG_INCR_STALE;
+			node = incr->_parents[node];
+		}
+	}
+}
+
+int pbg_incr_evaluate(pbg_incr* incr, pbg_error* err)
+{
+	pbg_expr bound;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	/* Evaluate a shallow copy of the expression bound to the handle. */
+	bound = *incr->_expr;
+	bound._variables = incr->_vars;
+	bound._incr = incr;
+	return pbg_evaluate_r(&bound, err, bound._constants);
+}
+
+void pbg_incr_free(pbg_incr* incr)
+{
+	free(incr->_results);
+	free(incr->_errors);
+	free(incr->_parents);
+	free(incr->_refstart);
+	free(incr->_refs);
+	incr->_results = NULL;
+	incr->_errors = NULL;
+	incr->_parents = NULL;
+	incr->_refstart = NULL;
+	incr->_refs = NULL;
+}
+
+/**
+ * Looks up the cached result of a field evaluated through a pbg_incr. Only
+ * operators are cached; literals are cheaper to evaluate than to look up.
+ * @param e       Shallow copy of the expression bound to the handle.
+ * @param err     Set to the cached error if the cached result is ERROR.
+ * @param field   Field to look up.
+ * @param result  Set to the cached result, if any.
+ * @return 1 if the field has a cached result, 0 if it must be evaluated.
+ */
+int pbg_incr_cached(pbg_expr* e, pbg_error* err, pbg_field* field, int* result)
+{
+	int i;
+	if(!pbg_type_isop(field->_type))
+		return 0;
+	i = field - e->_constants;
+	if(e->_incr->_results[i] == PBG_INCR_STALE)
+		return 0;
+	*result = e->_incr->_results[i];
+	if(*result == PBG_ERROR)
+		*err = e->_incr->_errors[i];
+	return 1;
+}
+
+/**
+ * Caches the result of a field evaluated through a pbg_incr. Errors are held
+ * inline, so they are cached by value.
+ * @param e       Shallow copy of the expression bound to the handle.
+ * @param err     Error of the evaluation, if any.
+ * @param field   Field which was evaluated.
+ * @param result  Result of the evaluation.
+ */
+void pbg_incr_store(pbg_expr* e, pbg_error* err, pbg_field* field, int result)
+{
+	int i;
+	if(!pbg_type_isop(field->_type))
+		return;
+	i = field - e->_constants;
+	e->_incr->_results[i] = result;
+	if(result == PBG_ERROR)
+		e->_incr->_errors[i] = *err;
+	e->_incr->_numevals++;
+}
+
+
+/***********************
+ *                     *
+ * PARALLEL EVALUATION *
+ *                     *
+ ***********************/
+
+#ifdef PBG_THREADS
+
+long pbg_evaluate_parallel(pbg_expr* e, pbg_error* err, pbg_batch* batch, 
+		int numthreads)
+{
+	pbg_parallel par;
+	par._expr = e;
+	par._ruleset = NULL;
+	par._batch = batch;
+	return pbg_parallel_run(&par, err, numthreads);
+}
+
+long pbg_ruleset_parallel(pbg_ruleset* rs, pbg_error* err, pbg_batch* batch, 
+		int numthreads)
+{
+	pbg_parallel par;
+	par._expr = NULL;
+	par._ruleset = rs;
+	par._batch = batch;
+	return pbg_parallel_run(&par, err, numthreads);
+}
+
+/**
+ * Evaluates the expression or rule set of the evaluation against every 
+ * record of its batch, see pbg_evaluate_parallel and pbg_ruleset_parallel.
+ * @param par         Evaluation to run, with its expression or rule set and
+ *                    its batch set.
+ * @param err         Container to store error, if any occurs.
+ * @param numthreads  Number of threads to evaluate with.
+ * @return the number of records which evaluated to TRUE or matched a rule.
+ */
+long pbg_parallel_run(pbg_parallel* par, pbg_error* err, int numthreads)
+{
+	pbg_batch* batch;
+	pbg_worker* w;
+	long numtrue, share;
+	int i, j, numvars, started;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	if(numthreads < 1) numthreads = 1;
+	
+	batch = par->_batch;
+	numvars = (par->_expr != NULL) ? par->_expr->_numvars : 
+			par->_ruleset->_numvars;
+	par->_numworkers = numthreads;
+	par->_workers = calloc(numthreads, sizeof(pbg_worker));
+	if(par->_workers == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return 0;
+	}
+	
+	/* Give each worker an equal range of records, and its own variables. */
+	share = (batch->_numrecords / numthreads + 7) & ~7L;
+	for(i = 0; i < numthreads; i++) {
+		w = par->_workers + i;
+		w->_par = par;
+		w->_id = i;
+		w->_begin = i * share < batch->_numrecords ? i * share : batch->_numrecords;
+		w->_end = (i+1) * share < batch->_numrecords && i != numthreads-1 ? 
+				(i+1) * share : batch->_numrecords;
+		w->_vars = malloc((numvars+1) * sizeof(pbg_field));
+		w->_touched = malloc((numvars+1) * sizeof(int));
+		w->_sels = malloc((PBG_SELECT_DEPTH+1) * sizeof(pbg_selection));
+		w->_results = malloc(PBG_MORSEL);
+		w->_matched = (par->_ruleset != NULL) ? 
+				malloc(PBG_MORSEL * sizeof(int)) : NULL;
+		pbg_err_init(&w->_err, PBG_ERR_NONE, 0, NULL);
+		pthread_mutex_init(&w->_lock, NULL);
+		if((w->_vars == NULL || w->_touched == NULL || w->_sels == NULL || 
+				w->_results == NULL || (par->_ruleset != NULL && 
+				w->_matched == NULL)) && !pbg_iserror(err))
+			pbg_err_alloc(err, __LINE__, __FILE__);
+		if(par->_expr == NULL)
+			continue;
+		w->_bound = *par->_expr;
+		w->_bound._variables = w->_vars;
+		w->_resolver._resolve = pbg_worker_resolve;
+		w->_resolver._ctx = w;
+		/* Variables start unresolved, see pbg_worker_row. */
+		for(j = 0; w->_vars != NULL && j < numvars; j++)
+			w->_vars[j] = pbg_field_init(PBG_LT_VAR, PBG_LAZY, 
+					&w->_resolver);
+	}
+	
+	/* Run the workers. The calling thread is worker 0. Should a thread fail 
+	 * to start, its range is stolen by the others. */
+	started = 1;
+	if(!pbg_iserror(err)) {
+		for(; started < numthreads; started++)
+			if(pthread_create(&par->_workers[started]._thread, NULL, 
+					pbg_worker_run, par->_workers+started) != 0)
+				break;
+		pbg_worker_run(par->_workers);
+	}
+	for(i = 1; i < started; i++)
+		pthread_join(par->_workers[i]._thread, NULL);
+	
+	/* Merge results and clean up. */
+	numtrue = 0;
+	for(i = 0; i < numthreads; i++) {
+		w = par->_workers + i;
+		numtrue += w->_numtrue;
+		if(pbg_iserror(&w->_err) && !pbg_iserror(err))
+			*err = w->_err;
+		else
+			pbg_error_free(&w->_err);
+		pthread_mutex_destroy(&w->_lock);
+		free(w->_vars);
+		free(w->_touched);
+		free(w->_sels);
+		free(w->_results);
+		free(w->_matched);
+	}
+	free(par->_workers);
+	return numtrue;
+}
+
+/**
+ * Runs a worker until no records are left to evaluate, in its own range or
+ * in the range of any other worker.
+ * @param arg  Worker to run.
+ * @return NULL.
+ */
+void* pbg_worker_run(void* arg)
+{
+	pbg_worker* w;
+	long begin, end;
+	w = (pbg_worker*) arg;
+	for(;;) {
+		/* Take a morsel from the front of the worker's own range. */
+		pthread_mutex_lock(&w->_lock);
+		begin = w->_begin;
+		end = (w->_end - begin > PBG_MORSEL) ? begin + PBG_MORSEL : w->_end;
+		w->_begin = end;
+		pthread_mutex_unlock(&w->_lock);
+		if(begin != end)
+			pbg_worker_evaluate(w, begin, end);
+		else if(!pbg_worker_steal(w))
+			break;
+	}
+	return NULL;
+}
+
+/**
+ * Steals the back half of the range of the first other worker which has 
+ * records left.
+ * @param w  Worker whose range is empty.
+ * @return 1 if records were stolen, 0 if no records are left.
+ */
+int pbg_worker_steal(pbg_worker* w)
+{
+	pbg_worker* victim;
+	long mid, end;
+	int i;
+	for(i = 1; i < w->_par->_numworkers; i++) {
+		victim = w->_par->_workers + (w->_id + i) % w->_par->_numworkers;
+		pthread_mutex_lock(&victim->_lock);
+		if(victim->_begin == victim->_end) {
+			pthread_mutex_unlock(&victim->_lock);
+			continue;
+		}
+		/* Split at a multiple of 8, leaving the victim at least one record 
+		 * unless it has fewer than 8 left. */
+		mid = (victim->_begin + (victim->_end - victim->_begin)/2 + 7) & ~7L;
+		if(mid >= victim->_end) mid = victim->_begin;
+		end = victim->_end;
+		victim->_end = mid;
+		pthread_mutex_unlock(&victim->_lock);
+		/* Never hold two locks at once, lest two thieves deadlock. */
+		pthread_mutex_lock(&w->_lock);
+		w->_begin = mid;
+		w->_end = end;
+		pthread_mutex_unlock(&w->_lock);
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * Evaluates a morsel of records, writing whole bytes of the bitmaps. The 
+ * morsel is evaluated a column at a time by pbg_worker_select, or a record 
+ * at a time by pbg_worker_rules for rule sets, then results are reported in 
+ * order of records. Records left out by the filter of the batch are FALSE.
+ * @param w      Worker evaluating the morsel.
+ * @param begin  First record of the morsel, a multiple of 8.
+ * @param end    End of the morsel, a multiple of 8 or the end of the batch.
+ */
+void pbg_worker_evaluate(pbg_worker* w, long begin, long end)
+{
+	pbg_batch* batch;
+	unsigned char bits, errors, *filter;
+	long record;
+	int result;
+	batch = w->_par->_batch;
+	w->_morsel = begin;
+	filter = (batch->_filter != NULL) ? batch->_filter + (begin >> 3) : NULL;
+	memset(w->_results, PBG_FALSE, end - begin);
+	if(w->_par->_ruleset != NULL)
+		pbg_worker_rules(w, begin, end, filter);
+	else {
+		pbg_select_all(w->_sels, (int) (end - begin), filter);
+		pbg_worker_select(w, 1, w->_sels, 0);
+	}
+	bits = errors = 0;
+	for(record = begin; record < end; record++) {
+		result = w->_results[record - begin];
+		if(result == PBG_TRUE) {
+			w->_numtrue++;
+			bits |= 1 << (record & 7);
+		}
+		else if(result == PBG_ERROR)
+			errors |= 1 << (record & 7);
+		if(batch->_emit != NULL && (filter == NULL || 
+				(filter[(record - begin) >> 3] >> (record & 7)) & 1))
+			batch->_emit(batch->_ctx, w->_id, record, 
+					(w->_matched != NULL) ? w->_matched[record - begin] : result);
+		if((record & 7) == 7 || record == end-1) {
+			if(batch->_matches != NULL) batch->_matches[record >> 3] = bits;
+			if(batch->_errors != NULL) batch->_errors[record >> 3] = errors;
+			bits = errors = 0;
+		}
+	}
+}
+
+/**
+ * Evaluates the rule set for each row of the morsel left in by the filter. 
+ * All variables of a record are resolved up front, as the rule set reads the
+ * variables of its index and keys directly. A row is TRUE if a rule matches,
+ * and ERROR if none does and some rule failed.
+ * @param w       Worker evaluating the morsel.
+ * @param begin   First record of the morsel.
+ * @param end     End of the morsel.
+ * @param filter  Filter of the morsel, or NULL if every record is evaluated.
+ */
+void pbg_worker_rules(pbg_worker* w, long begin, long end, 
+		unsigned char* filter)
+{
+	pbg_batch* batch;
+	pbg_error err;
+	int i, row, numrows;
+	batch = w->_par->_batch;
+	numrows = (int) (end - begin);
+	for(row = 0; row < numrows; row++) {
+		w->_matched[row] = -1;
+		if(filter != NULL && !((filter[row >> 3] >> (row & 7)) & 1))
+			continue;
+		for(i = 0; i < w->_par->_ruleset->_numvars; i++)
+			w->_vars[i] = batch->_resolve(batch->_ctx, w->_id, begin + row, i);
+		w->_matched[row] = pbg_ruleset_evaluate(w->_par->_ruleset, &err, 
+				w->_vars, NULL);
+		if(w->_matched[row] >= 0)
+			w->_results[row] = PBG_TRUE;
+		else if(pbg_iserror(&err))
+			w->_results[row] = PBG_ERROR;
+		/* Keep the first error, as pbg_worker_row does. */
+		if(pbg_iserror(&err) && !pbg_iserror(&w->_err))
+			w->_err = err;
+		else
+			pbg_error_free(&err);
+	}
+}
+
+/**
+ * Evaluates a field for the selected rows of the morsel, storing the result 
+ * of each in the results of the worker. The children of an AND are evaluated
+ * one after the other, each for the rows still TRUE after the previous ones,
+ * and likewise for the rows still FALSE under an OR. Rows are thereby dropped
+ * by a selective child before a costly one is evaluated, as they would be by
+ * evaluating each record on its own. Other fields, and fields nested deeper 
+ * than PBG_SELECT_DEPTH, are evaluated row by row.
+ * @param w      Worker evaluating the morsel.
+ * @param index  Index of the field to evaluate.
+ * @param sel    Rows to evaluate the field for.
+ * @param depth  Number of ANDs, ORs, and NOTs above the field.
+ */
+void pbg_worker_select(pbg_worker* w, int index, pbg_selection* sel, int depth)
+{
+	pbg_selection* live;
+	pbg_field* field;
+	int* children;
+	int i, pos, row, keep;
+	field = (index > 0) ? w->_bound._constants + (index-1) : NULL;
+	if(field == NULL || depth == PBG_SELECT_DEPTH || (field->_type != PBG_OP_AND
+			&& field->_type != PBG_OP_OR && field->_type != PBG_OP_NOT)) {
+		for(pos = 0; (row = pbg_select_next(sel, &pos)) >= 0; )
+			w->_results[row] = (signed char) pbg_worker_row(w, row, index);
+		return;
+	}
+	children = (int*) field->_data;
+	
+	/* NOT flips the results of its child, passing errors through. */
+	if(field->_type == PBG_OP_NOT) {
+		pbg_worker_select(w, children[0], sel, depth+1);
+		for(pos = 0; (row = pbg_select_next(sel, &pos)) >= 0; )
+			if(w->_results[row] != PBG_ERROR)
+				w->_results[row] = (w->_results[row] == PBG_TRUE) ? 
+						PBG_FALSE : PBG_TRUE;
+		return;
+	}
+	
+	/* Narrow a copy of the selection to the rows each child leaves open. The
+	 * rows left after the last child hold its result, which is the result of
+	 * the AND or OR. */
+	keep = (field->_type == PBG_OP_AND) ? PBG_TRUE : PBG_FALSE;
+	live = w->_sels + depth + 1;
+	live->_count = sel->_count;
+	live->_dense = sel->_dense;
+	if(sel->_dense)
+		memcpy(live->_bits, sel->_bits, sizeof(sel->_bits));
+	else
+		memcpy(live->_rows, sel->_rows, sel->_count * sizeof(short));
+	for(i = 0; i < field->_int && live->_count > 0; i++) {
+		pbg_worker_select(w, children[i], live, depth+1);
+		pbg_select_keep(live, w->_results, keep);
+	}
+}
+
+/**
+ * Evaluates a field for a single row of the morsel. Variables resolved along
+ * the way are forgotten afterwards, as the next evaluation is likely for 
+ * another record.
+ * @param w      Worker evaluating the morsel.
+ * @param row    Row of the record to evaluate the field for.
+ * @param index  Index of the field to evaluate.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_worker_row(pbg_worker* w, int row, int index)
+{
+	pbg_error err;
+	pbg_field* field;
+	int result, i;
+	pbg_err_init(&err, PBG_ERR_NONE, 0, NULL);
+	w->_record = w->_morsel + row;
+	field = pbg_field_get(&w->_bound, index);
+	/* Fused comparisons, the most common leaves, need no frames. */
+	if(field->_type >= PBG_FU_NUMBER && field->_type <= PBG_FU_STRING)
+		result = pbg_evaluate_fused(&w->_bound, &err, field);
+	else
+		result = pbg_evaluate_r(&w->_bound, &err, field);
+	if(pbg_iserror(&err)) {
+		if(!pbg_iserror(&w->_err)) w->_err = err;
+		else pbg_error_free(&err);
+	}
+	for(i = 0; i < w->_numtouched; i++)
+		w->_vars[w->_touched[i]] = pbg_field_init(PBG_LT_VAR, PBG_LAZY, 
+				&w->_resolver);
+	w->_numtouched = 0;
+	return result;
+}
+
+/**
+ * Resolves a variable of the record being evaluated by a worker, noting it
+ * so that pbg_worker_row may forget it. This is the resolver of the 
+ * variables of the worker.
+ * @param ctx  Worker.
+ * @param var  Index of the variable to resolve.
+ * @return the field of the variable.
+ */
+pbg_field pbg_worker_resolve(void* ctx, int var)
+{
+	pbg_worker* w;
+	w = (pbg_worker*) ctx;
+	w->_touched[w->_numtouched++] = var;
+	return w->_par->_batch->_resolve(w->_par->_batch->_ctx, w->_id, 
+			w->_record, var);
+}
+
+/**
+ * Selects the first rows of a morsel, or those of them set in a filter. 
+ * Selections of few rows are listed rather than held in a bitmap.
+ * @param sel      Selection to initialize.
+ * @param numrows  Number of rows of the morsel.
+ * @param filter   Bitset of the rows to select, starting at the first row of
+ *                 the morsel, or NULL to select every row.
+ */
+void pbg_select_all(pbg_selection* sel, int numrows, unsigned char* filter)
+{
+	int i;
+	sel->_dense = 1;
+	memset(sel->_bits, 0, sizeof(sel->_bits));
+	memset(sel->_bits, 0xFF, numrows / 8);
+	for(i = numrows & ~7; i < numrows; i++)
+		sel->_bits[i >> 3] |= 1 << (i & 7);
+	if(filter != NULL)
+		pbg_bits_and(sel->_bits, sel->_bits, filter, numrows);
+	sel->_count = (filter != NULL) ? pbg_bits_count(sel->_bits, numrows) : numrows;
+	pbg_select_list(sel);
+}
+
+/**
+ * Iterates over the rows of a selection, in increasing order. Bitmaps are 
+ * scanned a byte at a time, skipping bytes without any row.
+ * @param sel  Selection to iterate over.
+ * @param pos  Position of the iteration, initially 0.
+ * @return the next row of the selection, or -1 if there are none left.
+ */
+int pbg_select_next(pbg_selection* sel, int* pos)
+{
+	int row;
+	if(!sel->_dense)
+		return (*pos < sel->_count) ? sel->_rows[(*pos)++] : -1;
+	while(*pos < PBG_MORSEL) {
+		if(sel->_bits[*pos >> 3] == 0) {
+			*pos = (*pos | 7) + 1;
+			continue;
+		}
+		row = (*pos)++;
+		if((sel->_bits[row >> 3] >> (row & 7)) & 1)
+			return row;
+	}
+	return -1;
+}
+
+/**
+ * Narrows a selection to the rows with the given result. A bitmap which 
+ * becomes sparse is turned into a list.
+ * @param sel      Selection to narrow.
+ * @param results  Result of each row of the morsel.
+ * @param keep     Result of the rows to keep.
+ */
+void pbg_select_keep(pbg_selection* sel, signed char* results, int keep)
+{
+	int i, n, pos, row;
+	if(!sel->_dense) {
+		for(i = n = 0; i < sel->_count; i++)
+			if(results[sel->_rows[i]] == keep)
+				sel->_rows[n++] = sel->_rows[i];
+		sel->_count = n;
+		return;
+	}
+	for(pos = 0; (row = pbg_select_next(sel, &pos)) >= 0; )
+		if(results[row] != keep) {
+			sel->_bits[row >> 3] &= ~(1 << (row & 7));
+			sel->_count--;
+		}
+	pbg_select_list(sel);
+}
+
+/**
+ * Turns a bitmap selection into a list if few enough rows are selected.
+ * @param sel  Selection to turn into a list.
+ */
+void pbg_select_list(pbg_selection* sel)
+{
+	int n, pos, row;
+	if(!sel->_dense || sel->_count * PBG_SPARSE >= PBG_MORSEL)
+		return;
+	for(pos = n = 0; (row = pbg_select_next(sel, &pos)) >= 0; )
+		sel->_rows[n++] = (short) row;
+	sel->_dense = 0;
+}
+
+#endif  /* PBG_THREADS */
+
+
+/**************
+ *            *
+ * HOT RELOAD *
+ *            *
+ **************/
+
+#ifdef PBG_THREADS
+
+void pbg_reload_init(pbg_reload* r, pbg_error* err, int numreaders)
+{
+	int i;
+	
+	/* Always start with a clean error! */
+	pbg_err_init(err, PBG_ERR_NONE, 0, NULL);
+	
+	r->_current = r->_retired = NULL;
+	r->_epoch = 1;
+	r->_numreaders = numreaders;
+	r->_readers = malloc((numreaders * PBG_RELOAD_STRIDE + 1) * 
+			sizeof(unsigned long));
+	r->_lock = malloc(sizeof(pthread_mutex_t));
+	if(r->_readers == NULL || r->_lock == NULL) {
+		free((void*) r->_readers);
+		free(r->_lock);
+		r->_readers = NULL;
+		r->_lock = NULL;
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return;
+	}
+	for(i = 0; i < numreaders; i++)
+		r->_readers[i * PBG_RELOAD_STRIDE] = 0;
+	pthread_mutex_init((pthread_mutex_t*) r->_lock, NULL);
+}
+
+long pbg_reload_publish(pbg_reload* r, pbg_error* err, pbg_expr* rules, 
+		int* priorities, int numrules)
+{
+	pbg_version* v, *old;
+	
+	/* Build the version before taking the lock, so writers only contend 
+	 * for the swap. */
+	if((v = malloc(sizeof(pbg_version))) == NULL) {
+		pbg_err_alloc(err, __LINE__, __FILE__);
+		return -1;
+	}
+	pbg_ruleset_init(&v->_rs, err, rules, priorities, numrules);
+	if(pbg_iserror(err)) {
+		free(v);
+		return -1;
+	}
+	v->_next = NULL;
+	
+	/* The version must be complete before readers can see it, and readers 
+	 * must see it before the epoch moves on, see pbg_reload_enter. */
+	pthread_mutex_lock((pthread_mutex_t*) r->_lock);
+	old = (pbg_version*) r->_current;
+	v->_number = (old == NULL) ? 1 : old->_number+1;
+	__sync_synchronize();
+	r->_current = v;
+	__sync_synchronize();
+	r->_epoch++;
+	if(old != NULL) {
+		old->_retired = r->_epoch;
+		old->_next = (pbg_version*) r->_retired;
+		r->_retired = old;
+	}
+	__sync_synchronize();
+	pbg_reload_collect(r);
+	pthread_mutex_unlock((pthread_mutex_t*) r->_lock);
+	return v->_number;
+}
+
+pbg_ruleset* pbg_reload_enter(pbg_reload* r, int reader, long* version)
+{
+	pbg_version* v;
+	
+	/* Announce the epoch before reading the version. A writer either sees 
+	 * the announcement and keeps what the reader may read, or replaced the
+	 * version before the reader read it. An epoch read before a publication 
+	 * only keeps more versions than needed. */
+	r->_readers[reader * PBG_RELOAD_STRIDE] = r->_epoch;
+	__sync_synchronize();
+	v = (pbg_version*) r->_current;
+	if(version != NULL)
+		*version = (v == NULL) ? 0 : v->_number;
+	return (v == NULL) ? NULL : &v->_rs;
+}
+
+void pbg_reload_exit(pbg_reload* r, int reader)
+{
+	__sync_synchronize();
+	r->_readers[reader * PBG_RELOAD_STRIDE] = 0;
+}
+
+int pbg_reload_reclaim(pbg_reload* r)
+{
+	int pending;
+	pthread_mutex_lock((pthread_mutex_t*) r->_lock);
+	pending = pbg_reload_collect(r);
+	pthread_mutex_unlock((pthread_mutex_t*) r->_lock);
+	return pending;
+}
+
+void pbg_reload_free(pbg_reload* r)
+{
+	pbg_version* v;
+	if(r->_current != NULL) {
+		v = (pbg_version*) r->_current;
+		v->_next = (pbg_version*) r->_retired;
+		r->_retired = v;
+		r->_current = NULL;
+	}
+	while((v = (pbg_version*) r->_retired) != NULL) {
+		r->_retired = v->_next;
+		pbg_version_free(v);
+	}
+	if(r->_lock != NULL)
+		pthread_mutex_destroy((pthread_mutex_t*) r->_lock);
+	free(r->_lock);
+	free((void*) r->_readers);
+	r->_lock = NULL;
+	r->_readers = NULL;
+}
+
+/**
+ * Frees the retired versions which no reader can hold: those replaced at or
+ * before the oldest epoch announced. Must be called by the writer holding
+ * the lock.
+ * @param r  Rule set to reclaim versions of.
+ * @return the number of retired versions left.
+ */
+int pbg_reload_collect(pbg_reload* r)
+{
+	pbg_version* v, **prev;
+	unsigned long oldest, epoch;
+	int i, pending;
+	oldest = r->_epoch;
+	for(i = 0; i < r->_numreaders; i++) {
+		epoch = r->_readers[i * PBG_RELOAD_STRIDE];
+		if(epoch != 0 && epoch < oldest)
+			oldest = epoch;
+	}
+	
+	/* Versions are retired newest first, so the rest of the list can go
+	 * once one version can. */
+	pending = 0;
+	for(prev = (pbg_version**) &r->_retired; *prev != NULL; pending++) {
+		if((*prev)->_retired <= oldest)
+			break;
+		prev = &(*prev)->_next;
+	}
+	while((v = *prev) != NULL) {
+		*prev = v->_next;
+		pbg_version_free(v);
+	}
+	return pending;
+}
+
+/**
+ * Frees a version, its rule set, and its rules.
+ * @param v  Version to free.
+ */
+void pbg_version_free(pbg_version* v)
+{
+	int i;
+	for(i = 0; i < v->_rs._numrules; i++)
+		pbg_free(v->_rs._rules + i);
+	free(v->_rs._rules);
+	pbg_ruleset_free(&v->_rs);
+	free(v);
+}
+
+#endif  /* PBG_THREADS */
+
+
+/***********
+ *         *
+ * BITSETS *
+ *         *
+ ***********/
+
+void pbg_bits_and(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits)
+{
+	pbg_bits_op(dst, a, b, numbits, PBG_AND);
+}
+
+void pbg_bits_or(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits)
+{
+	pbg_bits_op(dst, a, b, numbits, PBG_OR);
+}
+
+void pbg_bits_andnot(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits)
+{
+	pbg_bits_op(dst, a, b, numbits, PBG_ANDNOT);
+}
+
+long pbg_bits_count(unsigned char* bits, long numbits)
+{
+	long i, n, count;
+	n = numbits / 8;
+	count = 0;
+	for(i = 0; i + (long) sizeof(unsigned long) <= n; i += sizeof(unsigned long))
+		count += pbg_bits_popcount(pbg_bits_word(bits + i));
+	for(; i < n; i++)
+		count += pbg_bits_popcount(bits[i]);
+	if(numbits & 7)
+		count += pbg_bits_popcount(bits[n] & ((1 << (numbits & 7)) - 1));
+	return count;
+}
+
+/**
+ * Combines two bitsets a machine word at a time, then a byte at a time for
+ * the bytes left over. Words are copied in and out of the bitsets, which 
+ * need not be aligned; compilers turn these copies into plain loads and
+ * stores, and loops of them into vector instructions where available.
+ * @param dst      Bitset to store the result in.
+ * @param a        First operand.
+ * @param b        Second operand.
+ * @param numbits  Number of bits of the bitsets.
+ * @param op       PBG_AND, PBG_OR, or PBG_ANDNOT.
+ */
+void pbg_bits_op(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits, int op)
+{
+	unsigned long x, y;
+	long i, n;
+	n = (numbits + 7) / 8;
+	for(i = 0; i + (long) sizeof(unsigned long) <= n; i += sizeof(unsigned long)) {
+		x = pbg_bits_word(a + i);
+		y = pbg_bits_word(b + i);
+		x = (op == PBG_AND) ? x & y : (op == PBG_OR) ? x | y : x & ~y;
+		memcpy(dst + i, &x, sizeof(unsigned long));
+	}
+	for(; i < n; i++)
+		dst[i] = (op == PBG_AND) ? a[i] & b[i] : (op == PBG_OR) ? 
+				a[i] | b[i] : a[i] & ~b[i];
+}
+
+/**
+ * Reads a machine word from a bitset, which need not be aligned.
+ * @param bits  Bitset to read from.
+ * @return the word at the start of bits.
+ */
+unsigned long pbg_bits_word(unsigned char* bits)
+{
+	unsigned long word;
+	memcpy(&word, bits, sizeof(unsigned long));
+	return word;
+}
+
+/**
+ * Counts the bits set in a word, summing adjacent bits, then pairs, then 
+ * nibbles, and finally every byte at once. This works for any width of 
+ * unsigned long, and compilers recognize it as a population count.
+ * @param word  Word to count.
+ * @return the number of bits set.
+ */
+int pbg_bits_popcount(unsigned long word)
+{
+	word = word - ((word >> 1) & (~0UL/3));
+	word = (word & (~0UL/15*3)) + ((word >> 2) & (~0UL/15*3));
+	word = (word + (word >> 4)) & (~0UL/255*15);
+	return (int) ((word * (~0UL/255)) >> ((sizeof(unsigned long) - 1) * CHAR_BIT));
+}
+
+
+/*****************************
+ *                           *
+ * AHEAD-OF-TIME COMPILATION *
+ *                           *
+ *****************************/
+
+/* Static helpers of the generated source, emitted only when used. Each is a
+ * transcription of the part of the evaluator it is named after, so compiled
+ * expressions yield the same results and errors as interpreted ones. */
+char* pbg_compile_helpers[] = {
+	/* PBG_USE_FAIL: pbg_err_init, returning PBG_ERROR. */
+	"static int $_fail(pbg_error* err, pbg_error_type type, int line, char* msg)\n",
+	"{\n",
+	"\terr->_type = type;\n",
+	"\terr->_line = line;\n",
+	"\terr->_file = __FILE__;\n",
+	"\terr->_msg = msg;\n",
+	"\terr->_str = NULL;\n",
+	"\terr->_i = 0;\n",
+	"\terr->_int = 0;\n",
+	"\treturn PBG_ERROR;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_ISBOOL: pbg_type_isbool. */
+	"static int $_isbool(pbg_field_type type)\n",
+	"{\n",
+	"\treturn type == PBG_LT_TRUE || type == PBG_LT_FALSE || \n",
+	"\t\t\t(type < PBG_MAX_OP && type > PBG_MIN_OP);\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_BOOL: pbg_evaluate_field of a literal. */
+	"static int $_bool(pbg_field* f, pbg_error* err)\n",
+	"{\n",
+	"\tif(f->_type == PBG_LT_TRUE) return PBG_TRUE;\n",
+	"\tif(f->_type == PBG_LT_FALSE) return PBG_FALSE;\n",
+	"\treturn $_fail(err, PBG_ERR_STATE, __LINE__, \"Cannot evaluate a non-BOOL value.\");\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_CMP: pbg_cmpnumber, pbg_cmpdate, and pbg_cmpstring. */
+	"static int $_cmp(pbg_field* c0, pbg_field* c1)\n",
+	"{\n",
+	"\tpbg_lt_number* n0, *n1;\n",
+	"\tpbg_lt_date* d0, *d1;\n",
+	"\tint n;\n",
+	"\tif(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {\n",
+	"\t\tn0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;\n",
+	"\t\treturn (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;\n",
+	"\t}\n",
+	"\tif(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {\n",
+	"\t\td0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;\n",
+	"\t\tif(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;\n",
+	"\t\tif(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;\n",
+	"\t\tif(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;\n",
+	"\t\treturn 0;\n",
+	"\t}\n",
+	"\tif(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {\n",
+	"\t\tn = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);\n",
+	"\t\tif(n != 0) return (n < 0) ? -1 : 1;\n",
+	"\t\treturn (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;\n",
+	"\t}\n",
+	"\treturn -2;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_ORDER: pbg_evaluate_order. */
+	"static int $_order(pbg_error* err, pbg_field_type op, int result)\n",
+	"{\n",
+	"\tif(result == -2)\n",
+	"\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"Unknown input type to comparison operator\");\n",
+	"\tif(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\tif(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\tif(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\treturn result >= 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_COMPARE: pbg_evaluate_op_order. */
+	"static int $_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)\n",
+	"{\n",
+	"\tif(c0->_type == PBG_NULL || c1->_type == PBG_NULL)\n",
+	"\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"NULL input given to comparison operator.\");\n",
+	"\treturn $_order(err, op, $_cmp(c0, c1));\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_EQ: pbg_evaluate_op_eq. */
+	"static int $_eq(pbg_field** c, int n, pbg_error* err)\n",
+	"{\n",
+	"\tint i;\n",
+	"\tif(c[0]->_type == PBG_NULL)\n",
+	"\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"NULL input given to EQ operator.\");\n",
+	"\tfor(i = 1; i < n; i++) {\n",
+	"\t\tif(c[i]->_type == PBG_NULL)\n",
+	"\t\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"NULL input given to EQ operator.\");\n",
+	"\t\tif(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || \n",
+	"\t\t\t\tmemcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)\n",
+	"\t\t\treturn PBG_FALSE;\n",
+	"\t}\n",
+	"\treturn PBG_TRUE;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_NEQ: pbg_evaluate_op_neq. */
+	"static int $_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)\n",
+	"{\n",
+	"\tif(c0->_type == PBG_NULL || c1->_type == PBG_NULL)\n",
+	"\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"NULL input given to NEQ operator.\");\n",
+	"\treturn (c1->_type != c0->_type || c1->_int != c0->_int || \n",
+	"\t\t\tmemcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_EXST: pbg_evaluate_op_exst. */
+	"static int $_exst(pbg_field** c, int n)\n",
+	"{\n",
+	"\tint i;\n",
+	"\tfor(i = 0; i < n; i++)\n",
+	"\t\tif(c[i]->_type == PBG_NULL)\n",
+	"\t\t\treturn PBG_FALSE;\n",
+	"\treturn PBG_TRUE;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_TYPE: pbg_evaluate_op_type. */
+	"static int $_type(pbg_field** c, int n, pbg_error* err)\n",
+	"{\n",
+	"\tpbg_field_type type;\n",
+	"\tint i;\n",
+	"\ttype = c[0]->_type;\n",
+	"\tif(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)\n",
+	"\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"First input to TYPE operator must be a type literal.\");\n",
+	"\tfor(i = 1; i < n; i++)\n",
+	"\t\tif((type == PBG_LT_TP_BOOL && !$_isbool(c[i]->_type)) || \n",
+	"\t\t\t\t(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || \n",
+	"\t\t\t\t(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || \n",
+	"\t\t\t\t(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))\n",
+	"\t\t\treturn PBG_FALSE;\n",
+	"\treturn PBG_TRUE;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_SP: pbg_evaluate_sp. */
+	"static int $_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)\n",
+	"{\n",
+	"\tpbg_field_type type;\n",
+	"\tint result;\n",
+	"\ttype = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;\n",
+	"\tif(c0->_type != type || c1->_type != type)\n",
+	"\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"Input does not match its declared type.\");\n",
+	"\tif(sp % 6 < 2) {\n",
+	"\t\tresult = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);\n",
+	"\t\treturn (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;\n",
+	"\t}\n",
+	"\tresult = $_cmp(c0, c1);\n",
+	"\tswitch(sp % 6) {\n",
+	"\t\tcase 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\t\tcase 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\t\tcase 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\t\tdefault: return result >= 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\t}\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_FUSED: pbg_evaluate_fused, given a variable of the type of
+	 * the constant. */
+	"static int $_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)\n",
+	"{\n",
+	"\tint result;\n",
+	"\tif(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {\n",
+	"\t\tresult = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);\n",
+	"\t\treturn (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;\n",
+	"\t}\n",
+	"\tresult = $_cmp(var, k);\n",
+	"\tif(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\tif(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\tif(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"\treturn result >= 0 ? PBG_TRUE : PBG_FALSE;\n",
+	"}\n",
+	NULL,
+	/* PBG_USE_MATCH: pbg_evaluate_op_match and pbg_match_one. */
+	"static int $_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)\n",
+	"{\n",
+	"\tchar* s, *p;\n",
+	"\tint i, j, len;\n",
+	"\tfor(i = 0; i < n; i++) {\n",
+	"\t\tif(c[i]->_type == PBG_NULL)\n",
+	"\t\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"NULL input given to string operator.\");\n",
+	"\t\tif(c[i]->_type != PBG_LT_STRING)\n",
+	"\t\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, \"Non-STRING input given to string operator.\");\n",
+	"\t}\n",
+	"\ts = (char*) c[0]->_data;\n",
+	"\tfor(i = 1; i < n; i++) {\n",
+	"\t\tp = (char*) c[i]->_data, len = c[i]->_int;\n",
+	"\t\tif(len > c[0]->_int) continue;\n",
+	"\t\tif(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;\n",
+	"\t\tif(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;\n",
+	"\t\tfor(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)\n",
+	"\t\t\tif(memcmp(s + j, p, len) == 0) return PBG_TRUE;\n",
+	"\t}\n",
+	"\treturn PBG_FALSE;\n",
+	"}\n",
+	NULL,
+	""
+};
+
+/* Names of field types in the generated source, in the order of the enum. */
+char* pbg_compile_types[] = {
+	"PBG_NULL", "PBG_MIN_LT_TP", "PBG_LT_TP_DATE", "PBG_LT_TP_BOOL",
+	"PBG_LT_TP_NUMBER", "PBG_LT_TP_STRING", "PBG_MAX_LT_TP", "PBG_MIN_LT",
+	"PBG_LT_TRUE", "PBG_LT_FALSE", "PBG_LT_NUMBER", "PBG_LT_STRING",
+	"PBG_LT_DATE", "PBG_LT_VAR", "PBG_MAX_LT", "PBG_MIN_OP", "PBG_OP_NOT",
+	"PBG_OP_AND", "PBG_OP_OR", "PBG_OP_EQ", "PBG_OP_LT", "PBG_OP_GT",
+	"PBG_OP_EXST", "PBG_OP_NEQ", "PBG_OP_LTE", "PBG_OP_GTE", "PBG_OP_TYPE",
+	"PBG_OP_PFX", "PBG_OP_SFX", "PBG_OP_CONT",
+	"PBG_SP_NUMBER_EQ", "PBG_SP_NUMBER_NEQ", "PBG_SP_NUMBER_LT",
+	"PBG_SP_NUMBER_GT", "PBG_SP_NUMBER_LTE", "PBG_SP_NUMBER_GTE",
+	"PBG_SP_DATE_EQ", "PBG_SP_DATE_NEQ", "PBG_SP_DATE_LT", "PBG_SP_DATE_GT",
+	"PBG_SP_DATE_LTE", "PBG_SP_DATE_GTE", "PBG_SP_STRING_EQ",
+	"PBG_SP_STRING_NEQ", "PBG_SP_STRING_LT", "PBG_SP_STRING_GT",
+	"PBG_SP_STRING_LTE", "PBG_SP_STRING_GTE", "PBG_FU_NUMBER", "PBG_FU_DATE",
+	"PBG_FU_STRING", "PBG_AC_PFX", "PBG_AC_SFX", "PBG_AC_CONT", "PBG_MAX_OP"
+};
+
+size_t pbg_compile(pbg_expr* e, char* name, char* buf, size_t size)
+{
+	pbg_compiler c;
+	char* reach;
+	int i, k;
+	
+	if(size > 0)
+		buf[0] = '\0';
+	
+	/* Only compile the operators evaluated from the root. Others are left 
+	 * behind by pbg_specialize, or only compared or tested for their type. */
+	reach = pbg_compile_reach(e);
+	if(reach == NULL)
+		return 0;
+	
+	/* Compile the functions once without output to learn which helpers and
+	 * tables they use, so that the source has nothing unused. */
+	c._buf = NULL;
+	c._size = 0;
+	c._len = 0;
+	c._name = name;
+	c._uses = PBG_USE_FAIL;
+	pbg_compile_body(&c, e, reach);
+	c._buf = buf;
+	c._size = size;
+	c._len = 0;
+	
+	pbg_emit(&c, "/* Generated by pbg_compile. */\n"
+			"#include \"pbg.h\"\n#include <math.h>\n"
+			"#include <stdlib.h>\n#include <string.h>\n\n"
+			"int $(pbg_field* v, pbg_error* err);\n"
+			"int $_dict(pbg_field (*dict)(char*, int), pbg_error* err);\n\n");
+	
+	/* Helpers, each a run of lines ending with NULL. */
+	for(i = k = 0; pbg_compile_helpers[k][0] != '\0'; i++, k++) {
+		for(; pbg_compile_helpers[k] != NULL; k++)
+			if(c._uses & (1 << i))
+				pbg_emit(&c, pbg_compile_helpers[k]);
+		if(c._uses & (1 << i))
+			pbg_emit(&c, "\n");
+	}
+	
+	/* Constants, and the names of variables for the dictionary. */
+	if(c._uses & PBG_USE_CONST)
+		pbg_compile_constants(&c, e);
+	pbg_emit(&c, "static char* $_names[] = {");
+	for(i = 0; i < e->_numvars; i++) {
+		pbg_emit_string(&c, e->_variables[i]._data, e->_variables[i]._int);
+		pbg_emit(&c, ", ");
+	}
+	pbg_emit(&c, "NULL};\nstatic int $_lens[] = {");
+	for(i = 0; i < e->_numvars; i++) {
+		pbg_emit_int(&c, e->_variables[i]._int);
+		pbg_emit(&c, ", ");
+	}
+	pbg_emit(&c, "0};\n\n");
+	
+	pbg_compile_body(&c, e, reach);
+	free(reach);
+	return c._len;
+}
+
+/**
+ * Marks the operators evaluated from the root of an expression, walking it 
+ * with an explicit stack. Operators which are only compared or tested for 
+ * their type are not evaluated, and need no function.
+ * @param e  Expression to walk.
+ * @return an array of e->_numconst+1 flags indexed by constant index, or 
+ *         NULL if it could not be allocated.
+ */
+char* pbg_compile_reach(pbg_expr* e)
+{
+	pbg_field* field;
+	pbg_field_type type;
+	char* reach;
+	int* stack, *children;
+	int depth, i, k;
+	reach = calloc(e->_numconst+1, 1);
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	if(reach == NULL || stack == NULL) {
+		free(reach);
+		free(stack);
+		return NULL;
+	}
+	depth = 0;
+	if(e->_numconst > 0 && pbg_type_isop(e->_constants[0]._type)) {
+		reach[1] = 1;
+		stack[depth++] = 1;
+	}
+	while(depth > 0) {
+		field = e->_constants + (stack[--depth]-1);
+		type = field->_type;
+		children = (int*) field->_data;
+		if(type >= PBG_FU_NUMBER && type <= PBG_FU_STRING) {
+			if(((pbg_fused*) field->_data)->_strict)
+				continue;
+			type = ((pbg_fused*) field->_data)->_op;
+		}
+		if(!pbg_compile_isbool(e, type, children))
+			continue;
+		for(i = 0; i < field->_int; i++) {
+			k = children[i];
+			if(k > 0 && !reach[k] && pbg_type_isop(e->_constants[k-1]._type)) {
+				reach[k] = 1;
+				stack[depth++] = k;
+			}
+		}
+	}
+	free(stack);
+	return reach;
+}
+
+/**
+ * Checks whether an operator may evaluate its children as BOOLs. NOT, AND,
+ * and OR always do. EQ, NEQ, and comparisons do unless one of the arguments 
+ * pbg_evaluate_begin looks at is a constant other than a BOOL.
+ * @param e         Expression to compile.
+ * @param type      Type of the operator.
+ * @param children  Children of the operator.
+ * @return 1 if the children may be evaluated, 0 otherwise.
+ */
+int pbg_compile_isbool(pbg_expr* e, pbg_field_type type, int* children)
+{
+	int i;
+	switch(type) {
+		case PBG_OP_NOT:
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			return 1;
+		case PBG_OP_EQ:
+		case PBG_OP_NEQ:
+		case PBG_OP_LT:
+		case PBG_OP_GT:
+		case PBG_OP_LTE:
+		case PBG_OP_GTE:
+			for(i = 0; i < ((type == PBG_OP_EQ) ? 1 : 2); i++)
+				if(children[i] > 0 && 
+						!pbg_type_isbool(e->_constants[children[i]-1]._type))
+					return 0;
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Emits the entry points of the generated source and a function for each
+ * operator they evaluate.
+ * @param c      Compiler to emit to.
+ * @param e      Expression to compile.
+ * @param reach  Operators evaluated from the root, see pbg_compile_reach.
+ */
+void pbg_compile_body(pbg_compiler* c, pbg_expr* e, char* reach)
+{
+	int i, k;
+	for(k = 1; k <= e->_numconst; k++)
+		if(reach[k]) {
+			pbg_emit(c, "static int $_f");
+			pbg_emit_int(c, k);
+			pbg_emit(c, "(pbg_field* v, pbg_error* err);\n");
+		}
+	
+	/* Evaluate bound variables, as pbg_evaluate_vars does. */
+	pbg_emit(c, "\nint $(pbg_field* v, pbg_error* err)\n{\n"
+			"\tPBG_UNUSED(v);\n\t$_fail(err, PBG_ERR_NONE, 0, NULL);\n");
+	for(i = 0; e->_schema != NULL && i < e->_numvars; i++)
+		if(e->_schema[i] != PBG_NULL) {
+			pbg_emit(c, "\tif(v[");
+			pbg_emit_int(c, i);
+			pbg_emit(c, "]._type != ");
+			pbg_emit(c, pbg_compile_types[e->_schema[i]]);
+			pbg_emit(c, ")\n\t\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, "
+					"__LINE__, \"Input does not match its declared type.\");\n");
+		}
+	pbg_emit(c, "\treturn ");
+	pbg_emit_bool(c, e, 1);
+	pbg_emit(c, ";\n}\n\n");
+	
+	/* Resolve variables and free them afterwards, as pbg_evaluate does. */
+	pbg_emit(c, "int $_dict(pbg_field (*dict)(char*, int), pbg_error* err)\n{\n"
+			"\tpbg_field v[");
+	pbg_emit_int(c, e->_numvars > 0 ? e->_numvars : 1);
+	pbg_emit(c, "];\n\tint i, result;\n\tfor(i = 0; i < ");
+	pbg_emit_int(c, e->_numvars);
+	pbg_emit(c, "; i++)\n\t\tv[i] = dict($_names[i], $_lens[i]);\n"
+			"\tresult = $(v, err);\n\tfor(i = 0; i < ");
+	pbg_emit_int(c, e->_numvars);
+	pbg_emit(c, "; i++)\n\t\tif(v[i]._data != NULL)\n\t\t\tfree(v[i]._data);\n"
+			"\treturn result;\n}\n");
+	
+	for(k = 1; k <= e->_numconst; k++)
+		if(reach[k])
+			pbg_compile_node(c, e, k);
+}
+
+/**
+ * Emits the function evaluating an operator. Fused comparisons compare a 
+ * variable of the type of their constant at once, and otherwise evaluate as
+ * they were parsed, as pbg_evaluate_fused does.
+ * @param c  Compiler to emit to.
+ * @param e  Expression to compile.
+ * @param k  Index of the operator.
+ */
+void pbg_compile_node(pbg_compiler* c, pbg_expr* e, int k)
+{
+	pbg_field* field;
+	pbg_fused* fu;
+	pbg_field_type type;
+	int* children;
+	field = e->_constants + (k-1);
+	type = field->_type;
+	children = (int*) field->_data;
+	fu = NULL;
+	if(type >= PBG_FU_NUMBER && type <= PBG_FU_STRING) {
+		fu = (pbg_fused*) field->_data;
+		type = fu->_op;
+	}
+	/* Compiled string operators test their patterns in turn. */
+	if(type >= PBG_AC_PFX && type <= PBG_AC_CONT)
+		type = pbg_canonical_type(field);
+	pbg_emit(c, "\nstatic int $_f");
+	pbg_emit_int(c, k);
+	pbg_emit(c, "(pbg_field* v, pbg_error* err)\n{\n");
+	if(fu == NULL || !fu->_strict)
+		pbg_compile_op(c, e, type, children, field->_int, 0);
+	pbg_emit(c, "\tPBG_UNUSED(v);\n\tPBG_UNUSED(err);\n");
+	if(fu != NULL) {
+		c->_uses |= PBG_USE_FUSED;
+		pbg_emit(c, "\tif(");
+		pbg_emit_field(c, fu->_var);
+		pbg_emit(c, "->_type == ");
+		pbg_emit(c, pbg_compile_types[fu->_const._type]);
+		pbg_emit(c, ")\n\t\treturn $_fused(");
+		pbg_emit_field(c, fu->_var);
+		pbg_emit(c, ", ");
+		pbg_emit_field(c, fu->_children[fu->_children[0] == fu->_var]);
+		pbg_emit(c, ", ");
+		pbg_emit(c, pbg_compile_types[fu->_cmp]);
+		pbg_emit(c, ");\n");
+		if(fu->_strict)
+			pbg_emit(c, "\treturn $_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "
+					"\"Input does not match its declared type.\");\n");
+	}
+	if(fu == NULL || !fu->_strict)
+		pbg_compile_op(c, e, type, children, field->_int, 1);
+	pbg_emit(c, "}\n");
+}
+
+/**
+ * Emits the declarations or the statements of the body of an operator, 
+ * following pbg_evaluate_begin and pbg_evaluate_resume. Whether the children
+ * of EQ, NEQ, and comparisons are BOOLs is settled at compile time for 
+ * constants, and tested at run time for variables.
+ * @param c         Compiler to emit to.
+ * @param e         Expression to compile.
+ * @param type      Type of the operator.
+ * @param children  Children of the operator.
+ * @param n         Number of children.
+ * @param stmts     0 to emit the declarations, 1 to emit the statements.
+ */
+void pbg_compile_op(pbg_compiler* c, pbg_expr* e, pbg_field_type type, 
+		int* children, int n, int stmts)
+{
+	char* tab;
+	int i, bools, others;
+	
+	/* Whether EQ, NEQ, and comparisons may evaluate their children as BOOLs,
+	 * and whether they may compare them instead. */
+	bools = pbg_compile_isbool(e, type, children);
+	others = !bools;
+	for(i = 0; i < n && i < ((type == PBG_OP_EQ) ? 1 : 2); i++)
+		others = others || (children[i] < 0);
+	
+	if(!stmts) {
+		switch(type) {
+			case PBG_OP_NOT:
+			case PBG_OP_AND:
+			case PBG_OP_OR:
+				pbg_emit(c, "\tint r;\n");
+				break;
+			case PBG_OP_EQ:
+				if(bools) pbg_emit(c, "\tint first;\n");
+				/* Fall through. */
+			case PBG_OP_EXST:
+			case PBG_OP_TYPE:
+			case PBG_OP_PFX:
+			case PBG_OP_SFX:
+			case PBG_OP_CONT:
+				if(type == PBG_OP_EQ && !others) break;
+				pbg_emit(c, "\tpbg_field* c[");
+				pbg_emit_int(c, n);
+				pbg_emit(c, "];\n");
+				break;
+			case PBG_OP_NEQ:
+			case PBG_OP_LT:
+			case PBG_OP_GT:
+			case PBG_OP_LTE:
+			case PBG_OP_GTE:
+				if(bools) pbg_emit(c, "\tint first;\n");
+				break;
+			default:
+				break;
+		}
+		return;
+	}
+	
+	switch(type) {
+		case PBG_OP_NOT:
+			pbg_emit(c, "\tr = ");
+			pbg_emit_bool(c, e, children[0]);
+			pbg_emit(c, ";\n\tif(r == PBG_ERROR) return PBG_ERROR;\n"
+					"\treturn (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;\n");
+			return;
+		case PBG_OP_AND:
+		case PBG_OP_OR:
+			/* Return the first result which decides the operator. */
+			for(i = 0; i < n-1; i++) {
+				pbg_emit(c, "\tif((r = ");
+				pbg_emit_bool(c, e, children[i]);
+				pbg_emit(c, type == PBG_OP_AND ? ") != PBG_TRUE) return r;\n" :
+						") != PBG_FALSE) return r;\n");
+			}
+			pbg_emit(c, "\tr = ");
+			pbg_emit_bool(c, e, children[n-1]);
+			pbg_emit(c, ";\n\treturn r;\n");
+			return;
+		case PBG_OP_EXST:
+		case PBG_OP_TYPE:
+			pbg_compile_children(c, children, n);
+			c->_uses |= (type == PBG_OP_EXST) ? PBG_USE_EXST : PBG_USE_TYPE;
+			pbg_emit(c, (type == PBG_OP_EXST) ? "\treturn $_exst(c, " : 
+					"\treturn $_type(c, ");
+			pbg_emit_int(c, n);
+			pbg_emit(c, (type == PBG_OP_EXST) ? ");\n" : ", err);\n");
+			return;
+		case PBG_OP_PFX:
+		case PBG_OP_SFX:
+		case PBG_OP_CONT:
+			pbg_compile_children(c, children, n);
+			c->_uses |= PBG_USE_MATCH;
+			pbg_emit(c, "\treturn $_match(c, ");
+			pbg_emit_int(c, n);
+			pbg_emit(c, ", ");
+			pbg_emit(c, pbg_compile_types[type]);
+			pbg_emit(c, ", err);\n");
+			return;
+		default:
+			break;
+	}
+	if(type >= PBG_SP_NUMBER_EQ) {
+		c->_uses |= PBG_USE_SP;
+		pbg_emit(c, "\treturn $_sp(");
+		pbg_emit_field(c, children[0]);
+		pbg_emit(c, ", ");
+		pbg_emit_field(c, children[1]);
+		pbg_emit(c, ", ");
+		pbg_emit_int(c, type - PBG_SP_NUMBER_EQ);
+		pbg_emit(c, ", err);\n");
+		return;
+	}
+	
+	/* EQ, NEQ, and comparisons of BOOLs evaluate their children. */
+	if(bools) {
+		/* Statements of a run time test are indented by one more tab. */
+		tab = others ? "\t\t" : "\t";
+		if(others) {
+			pbg_emit(c, "\tif(");
+			for(i = 0; i < (type == PBG_OP_EQ ? 1 : 2); i++) {
+				if(i > 0) pbg_emit(c, " && ");
+				pbg_emit_isbool(c, e, children[i]);
+			}
+			pbg_emit(c, ") {\n");
 		}
-		return PBG_TRUE;
+		pbg_emit(c, tab);
+		pbg_emit(c, "first = ");
+		pbg_emit_bool(c, e, children[0]);
+		pbg_emit(c, ";\n");
+		if(type == PBG_OP_EQ) {
+			for(i = 1; i < n; i++) {
+				if(children[i] < 0) {
+					c->_uses |= PBG_USE_FAIL;
+					pbg_emit(c, tab);
+					pbg_emit(c, "if(");
+					pbg_emit_field(c, children[i]);
+					pbg_emit(c, "->_type == PBG_NULL) return $_fail(err, "
+							"PBG_ERR_OP_ARG_TYPE, __LINE__, "
+							"\"NULL input given to EQ operator.\");\n");
+				}
+				pbg_emit(c, tab);
+				pbg_emit(c, "if(");
+				pbg_emit_bool(c, e, children[i]);
+				pbg_emit(c, " != first) return PBG_FALSE;\n");
+			}
+			pbg_emit(c, tab);
+			pbg_emit(c, "return PBG_TRUE;\n");
+		}
+		else if(type == PBG_OP_NEQ) {
+			pbg_emit(c, tab);
+			pbg_emit(c, "return (first != ");
+			pbg_emit_bool(c, e, children[1]);
+			pbg_emit(c, ") ? PBG_TRUE : PBG_FALSE;\n");
+		}
+		else {
+			c->_uses |= PBG_USE_ORDER;
+			pbg_emit(c, tab);
+			pbg_emit(c, "return $_order(err, ");
+			pbg_emit(c, pbg_compile_types[type]);
+			pbg_emit(c, ", first - ");
+			pbg_emit_bool(c, e, children[1]);
+			pbg_emit(c, ");\n");
+		}
+		if(others)
+			pbg_emit(c, "\t}\n");
+	}
+	if(!others)
+		return;
+	
+	/* Otherwise their values are compared. */
+	if(type == PBG_OP_EQ) {
+		c->_uses |= PBG_USE_EQ;
+		pbg_compile_children(c, children, n);
+		pbg_emit(c, "\treturn $_eq(c, ");
+		pbg_emit_int(c, n);
+		pbg_emit(c, ", err);\n");
+		return;
 	}
+	c->_uses |= (type == PBG_OP_NEQ) ? PBG_USE_NEQ : PBG_USE_COMPARE;
+	pbg_emit(c, (type == PBG_OP_NEQ) ? "\treturn $_neq(" : "\treturn $_compare(");
+	pbg_emit_field(c, children[0]);
+	pbg_emit(c, ", ");
+	pbg_emit_field(c, children[1]);
+	if(type != PBG_OP_NEQ) {
+		pbg_emit(c, ", ");
+		pbg_emit(c, pbg_compile_types[type]);
+	}
+	pbg_emit(c, ", err);\n");
 }
 
-int pbg_evaluate_op_neq(pbg_expr* e, pbg_error* err, pbg_field* field)
+/**
+ * Emits the statements filling the array c with the children of an operator.
+ * @param c         Compiler to emit to.
+ * @param children  Children of the operator.
+ * @param n         Number of children.
+ */
+void pbg_compile_children(pbg_compiler* c, int* children, int n)
 {
-	int child0, child1;
-	pbg_field* c0, *c1;
-	PBG_UNUSED(err);
-	child0 = ((int*)field->_data)[0], child1 = ((int*)field->_data)[1];
-	c0 = pbg_field_get(e, child0), c1 = pbg_field_get(e, child1);
-	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL) {
-		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
-				"NULL input given to NEQ operator.");
-		return PBG_ERROR;
+	int i;
+	for(i = 0; i < n; i++) {
+		pbg_emit(c, "\tc[");
+		pbg_emit_int(c, i);
+		pbg_emit(c, "] = ");
+		pbg_emit_field(c, children[i]);
+		pbg_emit(c, ";\n");
 	}
-	/* We have two BOOLs! Evaluate them, and check if they are different. */
-	if(pbg_type_isbool(c0->_type) && pbg_type_isbool(c1->_type))
-		return (pbg_evaluate_r(e, err, c0) != pbg_evaluate_r(e, err, c1)) ? 
-			PBG_TRUE : PBG_FALSE;
-	/* We don't have a bunch of BOOLs! Do standard difference check. */
-	else return (c1->_type != c0->_type || c1->_int != c0->_int || 
-			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
 }
 
-int pbg_evaluate_op_order(pbg_expr* e, pbg_error* err, pbg_field* field)
+/**
+ * Emits the literal data of every constant, and the array of constant fields
+ * referring to it.
+ * @param c  Compiler to emit to.
+ * @param e  Expression to compile.
+ */
+void pbg_compile_constants(pbg_compiler* c, pbg_expr* e)
 {
-	int result;
-	int child0, child1;
-	pbg_field* c0, *c1;
-	child0 = ((int*)field->_data)[0], child1 = ((int*)field->_data)[1];
-	c0 = pbg_field_get(e, child0), c1 = pbg_field_get(e, child1);
-	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL) {
-		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
-				"NULL input given to comparison operator.");
-		return PBG_ERROR;
+	pbg_field* field;
+	pbg_lt_date* date;
+	char num[32];
+	int k;
+	for(k = 1; k <= e->_numconst; k++) {
+		field = e->_constants + (k-1);
+		if(field->_type == PBG_LT_NUMBER) {
+			pbg_emit(c, "static pbg_lt_number $_n");
+			pbg_emit_int(c, k);
+			pbg_emit(c, " = {");
+			/* Print enough digits to read back the same double. */
+			sprintf(num, "%.17g", ((pbg_lt_number*) field->_data)->_val);
+			if(strchr(num, 'n') != NULL)
+				pbg_emit(c, num[0] == '-' ? "-HUGE_VAL" : "HUGE_VAL");
+			else {
+				pbg_emit(c, num);
+				if(strchr(num, '.') == NULL && strchr(num, 'e') == NULL)
+					pbg_emit(c, ".0");
+			}
+			pbg_emit(c, "};\n");
+		}
+		else if(field->_type == PBG_LT_DATE) {
+			date = (pbg_lt_date*) field->_data;
+			pbg_emit(c, "static pbg_lt_date $_d");
+			pbg_emit_int(c, k);
+			pbg_emit(c, " = {");
+			pbg_emit_int(c, date->_YYYY);
+			pbg_emit(c, ", ");
+			pbg_emit_int(c, date->_MM);
+			pbg_emit(c, ", ");
+			pbg_emit_int(c, date->_DD);
+			pbg_emit(c, "};\n");
+		}
+		else if(field->_type == PBG_LT_STRING) {
+			pbg_emit(c, "static char $_s");
+			pbg_emit_int(c, k);
+			pbg_emit(c, "[] = ");
+			pbg_emit_string(c, field->_data, field->_int);
+			pbg_emit(c, ";\n");
+		}
 	}
-	result = -2;
-	/* Both are NUMBERs. */
-	if(c0->_type == PBG_LT_NUMBER &&
-			c1->_type == PBG_LT_NUMBER)
-		result = pbg_cmpnumber(c0->_data, c1->_data);
-	/* Both are DATEs. */
-	if(c0->_type == PBG_LT_DATE &&
-			c1->_type == PBG_LT_DATE)
-		result = pbg_cmpdate(c0->_data, c1->_data);
-	/* Both are STRINGs. */
-	if(c0->_type == PBG_LT_STRING &&
-			c1->_type == PBG_LT_STRING)
-		result = pbg_cmpstring(c0->_data, c1->_data, c0->_int);
-	/* Both are BOOLs. */
-	if(pbg_type_isbool(c0->_type) && pbg_type_isbool(c1->_type))
-		result = pbg_evaluate_r(e, err, c0) - pbg_evaluate_r(e, err, c1);
-	/* Check if mismatched or invalid types. */
-	if(result == -2) {
-		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
-				"Unknown input type to comparison operator");
-		return PBG_ERROR;
-	/* Compare results according to type of comparison operator. */
-	}else{
-		if(field->_type == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
-		if(field->_type == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
-		if(field->_type == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
-		if(field->_type == PBG_OP_GTE) return result >= 0 ? PBG_TRUE : PBG_FALSE;
-		pbg_err_state(err, __LINE__, __FILE__, 
-				"Unknown result from select comparison function.");
-		return PBG_ERROR;
+	pbg_emit(c, "static pbg_field $_c[] = {\n");
+	for(k = 1; k <= e->_numconst; k++) {
+		field = e->_constants + (k-1);
+		pbg_emit(c, "\t{");
+		pbg_emit(c, pbg_compile_types[field->_type]);
+		pbg_emit(c, ", ");
+		if(field->_type == PBG_LT_NUMBER)
+			pbg_emit(c, "sizeof(pbg_lt_number), &$_n");
+		else if(field->_type == PBG_LT_DATE)
+			pbg_emit(c, "sizeof(pbg_lt_date), &$_d");
+		else if(field->_type == PBG_LT_STRING) {
+			pbg_emit_int(c, field->_int);
+			pbg_emit(c, ", $_s");
+		}
+		else {
+			pbg_emit_int(c, field->_int);
+			pbg_emit(c, ", NULL},\n");
+			continue;
+		}
+		pbg_emit_int(c, k);
+		pbg_emit(c, "},\n");
 	}
+	pbg_emit(c, "};\n\n");
 }
 
-int pbg_evaluate_op_type(pbg_expr* e, pbg_error* err, pbg_field* field)
+/**
+ * Emits an expression evaluating a field as a BOOL, see pbg_evaluate_r.
+ * @param c      Compiler to emit to.
+ * @param e      Expression to compile.
+ * @param index  Index of the field.
+ */
+void pbg_emit_bool(pbg_compiler* c, pbg_expr* e, int index)
 {
-	int i, child0, childi;
-	pbg_field* c0, *ci;
 	pbg_field_type type;
-	child0 = ((int*)field->_data)[0];
-	c0 = pbg_field_get(e, child0);
-	type = c0->_type;
-	/* Ensure the first argument is a type literal. */
-	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP) {
-		pbg_err_op_arg_type(err, __LINE__, __FILE__, 
-				"First input to TYPE operator must be a type literal.");
-		return PBG_ERROR;
+	type = (index > 0) ? e->_constants[index-1]._type : PBG_LT_VAR;
+	if(pbg_type_isop(type)) {
+		pbg_emit(c, "$_f");
+		pbg_emit_int(c, index);
+		pbg_emit(c, "(v, err)");
 	}
-	/* Verify types of all trailing arguments. */
-	for(i = 1; i < field->_int; i++) {
-		childi = ((int*)field->_data)[i];
-		ci = pbg_field_get(e, childi);
-		if(type == PBG_LT_TP_BOOL && !pbg_type_isbool(ci->_type))
-			return PBG_FALSE;
-		if(type == PBG_LT_TP_DATE && ci->_type != PBG_LT_DATE)
-			return PBG_FALSE;
-		if(type == PBG_LT_TP_NUMBER && ci->_type != PBG_LT_NUMBER)
-			return PBG_FALSE;
-		if(type == PBG_LT_TP_STRING && ci->_type != PBG_LT_STRING)
-			return PBG_FALSE;
+	else if(type == PBG_LT_TRUE)
+		pbg_emit(c, "PBG_TRUE");
+	else if(type == PBG_LT_FALSE)
+		pbg_emit(c, "PBG_FALSE");
+	else {
+		c->_uses |= PBG_USE_BOOL;
+		pbg_emit(c, "$_bool(");
+		pbg_emit_field(c, index);
+		pbg_emit(c, ", err)");
 	}
-	return PBG_TRUE;
 }
 
-int pbg_evaluate_r(pbg_expr* e, pbg_error* err, pbg_field* field)
+/**
+ * Emits an expression testing whether a field is a BOOL, see 
+ * pbg_type_isbool. Only variables are tested at run time.
+ * @param c      Compiler to emit to.
+ * @param e      Expression to compile.
+ * @param index  Index of the field.
+ */
+void pbg_emit_isbool(pbg_compiler* c, pbg_expr* e, int index)
 {
-	if(pbg_type_isbool(field->_type)) {
-		switch(field->_type) {
-			case PBG_OP_NOT:   return pbg_evaluate_op_not(e, err, field);
-			case PBG_OP_AND:   return pbg_evaluate_op_and(e, err, field);
-			case PBG_OP_OR:    return pbg_evaluate_op_or(e, err, field);
-			case PBG_OP_EXST:  return pbg_evaluate_op_exst(e, err, field);
-			case PBG_OP_EQ:    return pbg_evaluate_op_eq(e, err, field);
-			case PBG_OP_NEQ:   return pbg_evaluate_op_neq(e, err, field);
-			case PBG_OP_LT:
-			case PBG_OP_GT:
-			case PBG_OP_LTE:
-			case PBG_OP_GTE:   return pbg_evaluate_op_order(e, err, field);
-			case PBG_OP_TYPE:  return pbg_evaluate_op_type(e, err, field);
-			case PBG_LT_TRUE:  return PBG_TRUE;
-			case PBG_LT_FALSE: return PBG_FALSE;
-			default: pbg_err_state(err, __LINE__, __FILE__,
-							"Unsupported operation.");
-		}
+	if(index > 0) {
+		pbg_emit(c, pbg_type_isbool(e->_constants[index-1]._type) ? "1" : "0");
+		return;
 	}
-	pbg_err_state(err, __LINE__, __FILE__, 
-			"Cannot evaluate a non-BOOL value.");
-	return PBG_ERROR;
+	c->_uses |= PBG_USE_ISBOOL;
+	pbg_emit(c, "$_isbool(");
+	pbg_emit_field(c, index);
+	pbg_emit(c, "->_type)");
 }
 
-int pbg_evaluate(pbg_expr* e, pbg_error* err, pbg_field (*dict)(char*, int))
+/**
+ * Emits a pointer to a field: a bound variable, or a constant.
+ * @param c      Compiler to emit to.
+ * @param index  Index of the field.
+ */
+void pbg_emit_field(pbg_compiler* c, int index)
 {
-	int i, result;
-	pbg_field* newvars, *var, *oldvars;
-	
-	/* Always start with a clean error! */
-	pbg_err_init(err, PBG_ERR_NONE, 0, NULL, 0, NULL);
-	
-	/* Variable resolution. Lookup every variable in provided dictionary. */
-	newvars = (pbg_field*) malloc(e->_numvars * sizeof(pbg_field));
-	if(newvars == NULL) {
-		pbg_err_alloc(err, __LINE__, __FILE__);
-		return PBG_ERROR;
+	if(index < 0) {
+		pbg_emit(c, "(v + ");
+		pbg_emit_int(c, -(index+1));
 	}
-	for(i = 0; i < e->_numvars; i++) {
-		var = e->_variables+i;
-		newvars[i] = dict((char*)(var->_data), var->_int);
+	else {
+		c->_uses |= PBG_USE_CONST;
+		pbg_emit(c, "(&$_c[");
+		pbg_emit_int(c, index-1);
+		pbg_emit(c, "]");
 	}
-	
-	/* Swap out variable literals with dictionary equivalents. */
-	oldvars = e->_variables;
-	e->_variables = newvars;
-	
-	/* Evaluate expression! */
-	result = pbg_evaluate_r(e, err, e->_constants);
-	
-	/* Restore old variable literal array. */
-	e->_variables = oldvars;
-	
-	/* Clean up malloc'd memory. */
-	for(i = 0; i < e->_numvars; i++)
-		pbg_field_free(newvars+i);
-	free(newvars);
-	
-	/* Done! */
-	return result;
+	pbg_emit(c, ")");
 }
 
+/**
+ * Appends text to the generated source, replacing each '$' with the name of
+ * the compiled function.
+ * @param c    Compiler to emit to.
+ * @param str  Text to append.
+ */
+void pbg_emit(pbg_compiler* c, char* str)
+{
+	size_t n;
+	while(*str != '\0') {
+		for(n = 0; str[n] != '\0' && str[n] != '$'; n++);
+		c->_len = pbg_format_str(c->_buf, c->_size, c->_len, str, n);
+		str += n;
+		if(*str == '$') {
+			c->_len = pbg_format_str(c->_buf, c->_size, c->_len, c->_name, 
+					strlen(c->_name));
+			str++;
+		}
+	}
+}
 
-/************************
- *                      *
- * JANITORIAL FUNCTIONS *
- *                      *
- ************************/
+/**
+ * Appends an integer to the generated source.
+ * @param c      Compiler to emit to.
+ * @param value  Integer to append.
+ */
+void pbg_emit_int(pbg_compiler* c, long value) {
+	c->_len = pbg_format_int(c->_buf, c->_size, c->_len, value);
+}
 
-void pbg_free(pbg_expr* e)
+/**
+ * Appends a C string literal to the generated source. Characters other than
+ * printable ASCII are escaped in octal, as are quotes, backslashes, and 
+ * question marks, which could otherwise begin trigraphs.
+ * @param c    Compiler to emit to.
+ * @param str  Characters of the string.
+ * @param n    Number of characters.
+ */
+void pbg_emit_string(pbg_compiler* c, char* str, int n)
 {
+	char esc[5];
+	unsigned char ch;
 	int i;
+	c->_len = pbg_format_str(c->_buf, c->_size, c->_len, "\"", 1);
+	for(i = 0; i < n; i++) {
+		ch = (unsigned char) str[i];
+		if(ch >= ' ' && ch <= '~' && ch != '"' && ch != '\\' && ch != '?')
+			c->_len = pbg_format_str(c->_buf, c->_size, c->_len, str+i, 1);
+		else {
+			esc[0] = '\\';
+			esc[1] = (char) ('0' + (ch >> 6));
+			esc[2] = (char) ('0' + ((ch >> 3) & 7));
+			esc[3] = (char) ('0' + (ch & 7));
+			c->_len = pbg_format_str(c->_buf, c->_size, c->_len, esc, 4);
+		}
+	}
+	c->_len = pbg_format_str(c->_buf, c->_size, c->_len, "\"", 1);
+}
+
+
+/*************
+ *           *
+ * PROFILING *
+ *           *
+ *************/
+
+#ifdef PBG_PROFILE
+
+/**
+ * Allocates zeroed statistics for every constant field of the expression and
+ * records the span of source text each field was parsed from. Operators span
+ * from their opening to their closing parenthesis. This walks the string the
+ * same way the parser does, so constants are numbered in the same order.
+ * @param e    Freshly parsed PBG expression.
+ * @param str  String the expression was parsed from.
+ * @param n    Length of str.
+ * @return 1 if successful, 0 if an allocation failed.
+ */
+int pbg_profile_init(pbg_expr* e, char* str, size_t n)
+{
+	size_t i, start, opened;
+	int constid;
+	int* stack, stacksz;
+	pbg_node_stats* stats;
 	
-	/* Free individual constant fields. Some do not have _data malloc'd. */
-	for(i = e->_numconst-1; i >= 0; i--)
-		pbg_field_free(e->_constants+i);
-	
-	/* Free individual variable fields. All have _data malloc'd. */
-	for(i = 0; i < e->_numvars; i++)
-		pbg_field_free(e->_variables+i);
+	/* Statistics are zeroed by calloc. */
+	e->_stats = calloc(e->_numconst, sizeof(pbg_node_stats));
+	e->_source = malloc(n > 0 ? n : 1);
+	stack = malloc((e->_numconst+1) * sizeof(int));
+	if(e->_stats == NULL || e->_source == NULL || stack == NULL) {
+		free(stack);
+		return 0;
+	}
+	memcpy(e->_source, str, n);
+	e->_srclen = n;
 	
-	/* Free internal field arrays. */
-	if(e->_constants != NULL) free(e->_constants);
-	if(e->_variables != NULL) free(e->_variables);
+	/* Stack of operator IDs (0 for a group not yet given an operator). */
+	opened = stacksz = constid = 0;
+	for(i = 0; i < n; i++) {
+		if(pbg_iswhitespace(str[i])) continue;
+		if(str[i] == '(') {
+			opened = i+1;
+			stack[stacksz++] = 0;
+		}else if(str[i] == ')') {
+			if(stack[--stacksz] != 0) {
+				stats = e->_stats + (stack[stacksz]-1);
+				stats->_len = i - stats->_start + 1;
+			}
+		}else{
+			start = i;
+			if(str[i] == '\'') {
+				do i++; while(i != n && !(str[i] == '\'' && str[i-1] != '\\'));
+			}else if(str[i] == '[') {
+				do i++; while(i != n && !(str[i] == ']' && str[i-1] != '\\'));
+				opened = 0;
+				continue;  /* Variables are not constants. */
+			}else
+				while(i != n-1 && !pbg_iswhitespace(str[i+1]) && str[i+1] != '[' && 
+						str[i+1] != '(' && str[i+1] != ')') i++;
+			/* Constants are numbered in the order they appear. */
+			stats = e->_stats + constid++;
+			if(opened) {
+				stats->_start = opened-1;
+				stack[stacksz-1] = constid;
+			}else{
+				stats->_start = start;
+				stats->_len = i - start + 1;
+			}
+			opened = 0;
+		}
+	}
+	free(stack);
+	return 1;
+}
+
+/**
+ * Reads the monotonic clock.
+ * @return the current time in nanoseconds.
+ */
+double pbg_profile_clock(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * Records the outcome of a single evaluation of the given field. Fields which
+ * are not constants of the expression (e.g. BOOLs resolved from variables) are
+ * not tracked.
+ * @param e       PBG expression the field belongs to.
+ * @param field   Field that was evaluated.
+ * @param result  Result of the evaluation.
+ * @param start   Time at which the evaluation started.
+ */
+void pbg_profile_record(pbg_expr* e, pbg_field* field, int result, double start)
+{
+	pbg_node_stats* stats;
+	if(e->_stats == NULL || field < e->_constants || 
+			field >= e->_constants + e->_numconst)
+		return;
+	stats = e->_stats + (field - e->_constants);
+	stats->_evals++;
+	if(result == PBG_TRUE)  stats->_true++;
+	if(result == PBG_FALSE) stats->_false++;
+	if(result == PBG_ERROR) stats->_error++;
+	stats->_nsec += pbg_profile_clock() - start;
+}
+
+void pbg_expr_stats(pbg_expr* e)
+{
+	int i;
+	pbg_node_stats* stats;
+	if(e->_stats == NULL)
+		return;
+	printf("%5s %-16s %10s %10s %10s %10s %14s %10s  %s\n", "field", "type",
+			"evals", "true", "false", "error", "total ns", "avg ns", "source");
+	for(i = 0; i < e->_numconst; i++) {
+		stats = e->_stats + i;
+		if(stats->_evals == 0) continue;
+		printf("%5d %-16s %10ld %10ld %10ld %10ld %14.0f %10.1f  %.*s\n", i+1, 
+				pbg_field_type_str(e->_constants[i]._type), stats->_evals, 
+				stats->_true, stats->_false, stats->_error, stats->_nsec, 
+				stats->_nsec / stats->_evals, (int) stats->_len, 
+				e->_source + stats->_start);
+	}
+}
+
+void pbg_expr_stats_reset(pbg_expr* e)
+{
+	int i;
+	pbg_node_stats* stats;
+	if(e->_stats == NULL)
+		return;
+	for(i = 0; i < e->_numconst; i++) {
+		stats = e->_stats + i;
+		stats->_evals = stats->_true = stats->_false = stats->_error = 0;
+		stats->_nsec = 0;
+	}
 }
 
+#endif  /* PBG_PROFILE */
+
 
 /*********************************
  *                               *
@@ -1126,10 +7628,38 @@ char* pbg_field_type_str(pbg_field_type type)
 		case PBG_OP_NEQ: return "PBG_OP_NEQ";
 		case PBG_OP_LTE: return "PBG_OP_LTE";
 		case PBG_OP_GTE: return "PBG_OP_GTE";
+		case PBG_OP_TYPE: return "PBG_OP_TYPE";
+		case PBG_OP_PFX: return "PBG_OP_PFX";
+		case PBG_OP_SFX: return "PBG_OP_SFX";
+		case PBG_OP_CONT: return "PBG_OP_CONT";
 		case PBG_LT_TP_DATE: return "PBG_LT_TP_DATE";
 		case PBG_LT_TP_BOOL: return "PBG_LT_TP_BOOL";
 		case PBG_LT_TP_NUMBER: return "PBG_LT_TP_NUMBER";
 		case PBG_LT_TP_STRING: return "PBG_LT_TP_STRING";
+		case PBG_SP_NUMBER_EQ: return "PBG_SP_NUMBER_EQ";
+		case PBG_SP_NUMBER_NEQ: return "PBG_SP_NUMBER_NEQ";
+		case PBG_SP_NUMBER_LT: return "PBG_SP_NUMBER_LT";
+		case PBG_SP_NUMBER_GT: return "PBG_SP_NUMBER_GT";
+		case PBG_SP_NUMBER_LTE: return "PBG_SP_NUMBER_LTE";
+		case PBG_SP_NUMBER_GTE: return "PBG_SP_NUMBER_GTE";
+		case PBG_SP_DATE_EQ: return "PBG_SP_DATE_EQ";
+		case PBG_SP_DATE_NEQ: return "PBG_SP_DATE_NEQ";
+		case PBG_SP_DATE_LT: return "PBG_SP_DATE_LT";
+		case PBG_SP_DATE_GT: return "PBG_SP_DATE_GT";
+		case PBG_SP_DATE_LTE: return "PBG_SP_DATE_LTE";
+		case PBG_SP_DATE_GTE: return "PBG_SP_DATE_GTE";
+		case PBG_SP_STRING_EQ: return "PBG_SP_STRING_EQ";
+		case PBG_SP_STRING_NEQ: return "PBG_SP_STRING_NEQ";
+		case PBG_SP_STRING_LT: return "PBG_SP_STRING_LT";
+		case PBG_SP_STRING_GT: return "PBG_SP_STRING_GT";
+		case PBG_SP_STRING_LTE: return "PBG_SP_STRING_LTE";
+		case PBG_SP_STRING_GTE: return "PBG_SP_STRING_GTE";
+		case PBG_FU_NUMBER: return "PBG_FU_NUMBER";
+		case PBG_FU_DATE: return "PBG_FU_DATE";
+		case PBG_FU_STRING: return "PBG_FU_STRING";
+		case PBG_AC_PFX: return "PBG_AC_PFX";
+		case PBG_AC_SFX: return "PBG_AC_SFX";
+		case PBG_AC_CONT: return "PBG_AC_CONT";
 		default: return "PBG_NULL";
 	}
 }
@@ -1149,6 +7679,7 @@ char* pbg_error_str(pbg_error_type type)
 		case PBG_ERR_UNKNOWN_TYPE: return "PBG_ERR_UNKNOWN_TYPE";
 		case PBG_ERR_OP_ARITY:     return "PBG_ERR_OP_ARITY";
 		case PBG_ERR_OP_ARG_TYPE:  return "PBG_ERR_OP_ARG_TYPE";
+		case PBG_ERR_BUDGET:       return "PBG_ERR_BUDGET";
 	}
 	return "PBG_ERR_???";
 }
@@ -1186,6 +7717,9 @@ pbg_field_type pbg_gettype(char* str, int n)
 		if(str[0] == '!' && str[1] == '=') return PBG_OP_NEQ;
 		if(str[0] == '<' && str[1] == '=') return PBG_OP_LTE;
 		if(str[0] == '>' && str[1] == '=') return PBG_OP_GTE;
+		if(str[0] == '^' && str[1] == '=') return PBG_OP_PFX;
+		if(str[0] == '$' && str[1] == '=') return PBG_OP_SFX;
+		if(str[0] == '*' && str[1] == '=') return PBG_OP_CONT;
 	}
 	
 	/* It isn't anything! */
@@ -1245,54 +7779,127 @@ int pbg_isfalse(char* str, int n) {
 		str[4]=='E';
 }
 
-int pbg_isnumber(char* str, int n)
+int pbg_isnumber(char* str, int n) {
+	return pbg_read_number(str, n, NULL);
+}
+
+int pbg_read_number(char* str, size_t n, double* value)
 {
-	int i;
+	static const double pow10[PBG_NUMBER_MAXPOW+1] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	char buf[64], *copy;
+	double w;
+	size_t i;
+	int neg, digits, exact, scale, exp, expneg;
 	
-	/* Start at the beginning of the string. */
-	i = 0;
-	
-	/* Check if negative or positive */
-	if(str[i] == '-' || str[i] == '+') i++;
-	/* Otherwise, ensure first character is a digit. */
-	else if(!pbg_isdigit(str[i]))
+	/* Check the sign, which must be followed by a digit. */
+	i = neg = 0;
+	if(n > 0 && (str[0] == '-' || str[0] == '+'))
+		neg = (str[i++] == '-');
+	if(i == n || !pbg_isdigit(str[i]))
 		return 0;
 	
-	/* Parse everything before the dot. */
-	if(str[i] != '0' && pbg_isdigit(str[i])) {
-		while(i != n && pbg_isdigit(str[i])) i++;
-		if(i != n && !pbg_isdigit(str[i]) && str[i] != '.') return 0;
-	}else if(str[i] == '0') {
-		if(++i != n && !(str[i] == '.' || str[i] == 'e' || str[i] == 'E')) return 0;
+	/* Read the significand while it is exact, skipping leading zeros. */
+	w = 0.0;
+	digits = scale = 0;
+	exact = 1;
+	if(str[i] == '0')
+		i++;
+	else
+		for(; i != n && pbg_isdigit(str[i]); i++) {
+			if(digits == PBG_NUMBER_DIGITS) {
+				exact = 0;
+				scale++;
+				continue;
+			}
+			w = w * 10.0 + (str[i] - '0');
+			digits++;
+		}
+	if(i != n && str[i] == '.') {
+		if(++i == n || !pbg_isdigit(str[i]))
+			return 0;
+		for(; i != n && pbg_isdigit(str[i]); i++) {
+			if(digits == PBG_NUMBER_DIGITS) {
+				exact = exact && str[i] == '0';
+				continue;
+			}
+			w = w * 10.0 + (str[i] - '0');
+			digits += (w != 0.0);
+			scale--;
+		}
 	}
 	
-	/* Parse everything after the dot. */
-	if(str[i] == '.') {
-		/* Last character must be a digit. */
-		if(i++ == n-1) return 0;
-		/* Exhaust all digits. */
-		while(i != n && pbg_isdigit(str[i])) i++;
-		if(i != n && !pbg_isdigit(str[i]) && str[i] != 'e' && str[i] != 'E') return 0;
+	/* Read the exponent, which need only be exact while it is small. */
+	exp = expneg = 0;
+	if(i != n && (str[i] == 'e' || str[i] == 'E')) {
+		if(++i != n && (str[i] == '-' || str[i] == '+'))
+			expneg = (str[i++] == '-');
+		if(i == n || !pbg_isdigit(str[i]))
+			return 0;
+		for(; i != n && pbg_isdigit(str[i]); i++)
+			if(exp < 100000)
+				exp = exp * 10 + (str[i] - '0');
 	}
+	if(i != n)
+		return 0;
+	if(value == NULL)
+		return 1;
+	exp = (expneg ? -exp : exp) + scale;
 	
-	/* Parse everything after the exponent. */
-	if(str[i] == 'e' || str[i] == 'E') {
-		/* Last character must be a digit. */
-		if(i++ == n-1) return 0;
-		/* Parse positive or negative sign. */
-		if(str[i] == '-' || str[i] == '+') i++;
-		/* Exhaust all digits. */
-		while(i != n && pbg_isdigit(str[i])) i++;
-		if(i != n && !pbg_isdigit(str[i])) return 0;
+	/* The significand and the power of ten are exact doubles, so a single 
+	 * rounding gives the nearest double. Short significands can absorb part
+	 * of a larger power exactly. */
+	if(exact && w == 0.0) {
+		*value = neg ? -0.0 : 0.0;
+		return 1;
+	}
+	if(exact && exp >= -PBG_NUMBER_MAXPOW && exp <= PBG_NUMBER_MAXPOW) {
+		w = (exp < 0) ? w / pow10[-exp] : w * pow10[exp];
+		*value = neg ? -w : w;
+		return 1;
+	}
+	if(exact && exp > PBG_NUMBER_MAXPOW && 
+			exp <= PBG_NUMBER_MAXPOW + PBG_NUMBER_DIGITS - digits) {
+		w = w * pow10[exp - PBG_NUMBER_MAXPOW] * pow10[PBG_NUMBER_MAXPOW];
+		*value = neg ? -w : w;
+		return 1;
 	}
 	
-	/* Probably a number! */
+	/* Otherwise leave the rounding to strtod, which needs a terminated copy. */
+	copy = (n < sizeof(buf)) ? buf : malloc(n+1);
+	if(copy == NULL) {
+		/* Out of memory, so settle for a nearby value. */
+		w = pbg_scale_number(w, exp);
+		*value = neg ? -w : w;
+		return 1;
+	}
+	memcpy(copy, str, n);
+	copy[n] = '\0';
+	*value = strtod(copy, NULL);
+	if(copy != buf)
+		free(copy);
 	return 1;
 }
 
+/**
+ * Scales a number by a power of ten, rounding at each step, for 
+ * pbg_read_number when it cannot make a terminated copy for strtod.
+ * @param w    Number to scale.
+ * @param exp  Power of ten to scale by.
+ * @return w times ten to the exp, approximately.
+ */
+double pbg_scale_number(double w, int exp)
+{
+	for(; exp > 0 && w < 1e308; exp--) w *= 10.0;
+	for(; exp < 0 && w > 0.0; exp++) w /= 10.0;
+	return w;
+}
+
 void pbg_tonumber(pbg_lt_number* ptr, char* str, int n) {
-	PBG_UNUSED(n);
-	ptr->_val = atof(str);
+	if(!pbg_read_number(str, n, &ptr->_val))
+		ptr->_val = 0.0;
 }
 
 int pbg_cmpnumber(pbg_lt_number* n1, pbg_lt_number* n2) {
@@ -1311,8 +7918,12 @@ int pbg_cmpdate(pbg_lt_date* n1, pbg_lt_date* n2) {
 	return 0;
 }
 
-int pbg_cmpstring(pbg_lt_string* s1, pbg_lt_string* s2, int n) {
-	return strncmp(s1, s2, n);
+int pbg_cmpstring(pbg_lt_string* s1, int n1, pbg_lt_string* s2, int n2) {
+	int result;
+	/* STRINGs need not be terminated, and a prefix precedes its extensions. */
+	result = memcmp(s1, s2, (n1 < n2) ? n1 : n2);
+	if(result != 0) return (result < 0) ? -1 : 1;
+	return (n1 < n2) ? -1 : (n1 > n2) ? 1 : 0;
 }
 
 int pbg_isvar(char* str, int n) {
@@ -1,6 +1,8 @@
 #ifndef __PBG_H__
 #define __PBG_H__
 
+#include <stddef.h>  /* size_t */
+
 /*********************************************************
  *                                                       *
  * Prefix Boolean Grammar (PBG), a lightweight C library *
@@ -18,6 +20,9 @@
 #define PBG_TRUE   1
 #define PBG_ERROR -1
 
+/* Used by a resumable evaluation which cannot go on without a variable. */
+#define PBG_NEED  -2
+
 /*****************************
  *                           *
  * EXPRESSION REPRESENTATION *
@@ -63,10 +68,61 @@ typedef enum {
 	PBG_OP_LTE,   /* <=  LESS THAN OR EQUAL TO */
 	PBG_OP_GTE,   /* >=  GREATER THAN OR EQUAL TO */
 	PBG_OP_TYPE,  /* @   TYPE OF */
+	PBG_OP_PFX,   /* ^=  STARTS WITH */
+	PBG_OP_SFX,   /* $=  ENDS WITH */
+	PBG_OP_CONT,  /* *=  CONTAINS */
 	/* Add more operators here. */
+	
+	/* Monomorphic comparisons, see pbg_specialize. Each group follows the
+	 * order EQ, NEQ, LT, GT, LTE, GTE. */
+	PBG_SP_NUMBER_EQ,
+	PBG_SP_NUMBER_NEQ,
+	PBG_SP_NUMBER_LT,
+	PBG_SP_NUMBER_GT,
+	PBG_SP_NUMBER_LTE,
+	PBG_SP_NUMBER_GTE,
+	PBG_SP_DATE_EQ,
+	PBG_SP_DATE_NEQ,
+	PBG_SP_DATE_LT,
+	PBG_SP_DATE_GT,
+	PBG_SP_DATE_LTE,
+	PBG_SP_DATE_GTE,
+	PBG_SP_STRING_EQ,
+	PBG_SP_STRING_NEQ,
+	PBG_SP_STRING_LT,
+	PBG_SP_STRING_GT,
+	PBG_SP_STRING_LTE,
+	PBG_SP_STRING_GTE,
+	
+	/* Comparisons of a variable to a constant, fused at parse time. */
+	PBG_FU_NUMBER,
+	PBG_FU_DATE,
+	PBG_FU_STRING,
+	
+	/* String operators whose patterns are compiled into an automaton at parse
+	 * time. These follow the order PFX, SFX, CONT. */
+	PBG_AC_PFX,
+	PBG_AC_SFX,
+	PBG_AC_CONT,
 	PBG_MAX_OP
 } pbg_field_type;
 
+/**
+ * Data representations of literal fields. These are exposed so that fields 
+ * can be initialized in caller-provided storage, see pbg_init_number.
+ */
+typedef struct {
+	double _val;
+} pbg_lt_number;  /* PBG_LT_NUMBER */
+
+typedef struct {
+	unsigned int  _YYYY;  /* year */
+	unsigned int  _MM;    /* month */
+	unsigned int  _DD;    /* day */
+} pbg_lt_date;  /* PBG_LT_DATE */
+
+typedef char pbg_lt_string; /* PBG_LT_STRING */
+
 /**
  * This struct represents a PBG field. A field can be either a literal or an 
  * operator. This is determined by its type. For operators, the data pointer
@@ -79,6 +135,25 @@ typedef struct {
 	void*           _data;  /* Arbitrary data! */
 } pbg_field;
 
+#ifdef PBG_PROFILE
+/**
+ * Evaluation statistics kept for each constant field of an expression when
+ * the library is compiled with PBG_PROFILE defined. Times are inclusive of 
+ * the time spent evaluating children.
+ */
+typedef struct {
+	long    _evals;  /* Number of times the field was evaluated. */
+	long    _true;   /* Number of evaluations yielding PBG_TRUE. */
+	long    _false;  /* Number of evaluations yielding PBG_FALSE. */
+	long    _error;  /* Number of evaluations yielding PBG_ERROR. */
+	double  _nsec;   /* Cumulative evaluation time in nanoseconds. */
+	size_t  _start;  /* Index of the field in the source string. */
+	size_t  _len;    /* Length of the field in the source string. */
+} pbg_node_stats;
+#endif
+
+struct pbg_incr;  /* See pbg_incr_bind. */
+
 /**
  * This struct represents a PBG expression. There are two arrays in this 
  * representation: one for constants, and one for variables. Both types are
@@ -89,6 +164,13 @@ typedef struct {
 	pbg_field*  _variables;  /* Variables. */
 	int         _numconst;   /* Number of constants. */
 	int         _numvars;    /* Number of variables. */
+	struct pbg_incr*  _incr; /* Incremental evaluation, if any. */
+	pbg_field_type*   _schema; /* Declared variable types, if specialized. */
+#ifdef PBG_PROFILE
+	pbg_node_stats*  _stats;   /* Statistics, one per constant. */
+	char*            _source;  /* Copy of the parsed string. */
+	size_t           _srclen;  /* Length of the parsed string. */
+#endif
 } pbg_expr;
 
 
@@ -108,19 +190,24 @@ typedef enum {
 	PBG_ERR_SYNTAX,
 	PBG_ERR_UNKNOWN_TYPE,
 	PBG_ERR_OP_ARITY,
-	PBG_ERR_OP_ARG_TYPE
+	PBG_ERR_OP_ARG_TYPE,
+	PBG_ERR_BUDGET
 } pbg_error_type;
 
 /**
  * Represents a PBG error. Errors may be generated during parsing and 
- * evaluation and should be checked by the caller.
+ * evaluation and should be checked by the caller. Errors are held inline and
+ * never allocate, so they may be copied freely. Syntax and unknown type 
+ * errors refer to the parsed string, which must outlive them to be formatted.
  */
 typedef struct {
 	pbg_error_type  _type;  /* Error type. */
 	int             _line;  /* Line of file where error occurred. */
 	char*           _file;  /* File in which error occurred. */
-	int             _int;   /* Type determines what this is used for! */
-	void*           _data;  /* Data to be included with error report. */
+	char*           _msg;   /* Static description or operator name, if any. */
+	char*           _str;   /* Input in which the error occurred, if any. */
+	size_t          _i;     /* Position in, or length of, _str. */
+	int             _int;   /* Number of arguments given to an operator. */
 } pbg_error;
 
 
@@ -145,7 +232,7 @@ void pbg_parse(pbg_expr* e, pbg_error* err, char* str);
  * @param str  String to parse.
  * @param n    Length of the string.
  */
-void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n);
+void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, size_t n);
 
 /**
  * Evaluates the PBG expression with the provided assignments.
@@ -157,6 +244,112 @@ void pbg_parse_n(pbg_expr* e, pbg_error* err, char* str, int n);
  */
 int pbg_evaluate(pbg_expr* e, pbg_error* err, pbg_field (*dict)(char*, int));
 
+/**
+ * Evaluates the PBG expression with the provided variable fields. Unlike 
+ * pbg_evaluate, the fields are borrowed: they are neither modified nor freed,
+ * so they may be initialized with pbg_init_number and friends. The expression
+ * is not modified either, so several threads may evaluate it at once.
+ * @param e     PBG expression to evaluate.
+ * @param err   Container to store error, if any occurs.
+ * @param vars  One field for each variable of e, indexed as by pbg_var_name.
+ * @return 1 if the PBG expression evaluates to true with the given fields. 
+ *         0 otherwise.
+ */
+int pbg_evaluate_vars(pbg_expr* e, pbg_error* err, pbg_field* vars);
+
+/**
+ * Evaluates the PBG expression, resolving each variable the first time the
+ * evaluation reaches it. Variables which are never reached are never resolved.
+ * As with pbg_evaluate_vars, resolved fields are borrowed and the expression 
+ * is not modified.
+ * @param e        PBG expression to evaluate.
+ * @param err      Container to store error, if any occurs.
+ * @param vars     Storage for one field for each variable of e. After the 
+ *                 evaluation, it holds the fields which were resolved.
+ * @param resolve  Called with ctx and the index of a variable, as used by
+ *                 pbg_var_name, to resolve it. Must not return a VAR field.
+ * @param ctx      Context given to resolve.
+ * @return 1 if the PBG expression evaluates to true with the resolved fields. 
+ *         0 otherwise.
+ */
+int pbg_evaluate_lazy(pbg_expr* e, pbg_error* err, pbg_field* vars, 
+		pbg_field (*resolve)(void*, int), void* ctx);
+
+/**
+ * Evaluates the PBG expression against a batch of records, resolving the
+ * variables of every record with a single call to multiget, so that a store
+ * which looks up many keys as cheaply as one may pipeline or prefetch them.
+ * Fields are borrowed, as with pbg_evaluate_vars, and the expression is not 
+ * modified.
+ * @param e           PBG expression to evaluate.
+ * @param err         Container to store error, if any occurs. If records fail
+ *                    to evaluate, holds the error of the first of them.
+ * @param numrecords  Number of records, numbered from 0. A single evaluation
+ *                    is a batch of one record.
+ * @param vars        Storage for pbg_numvars(e) fields for each record.
+ * @param results     If not NULL, set to the result of each record: PBG_TRUE,
+ *                    PBG_FALSE, or PBG_ERROR.
+ * @param multiget    Called once with ctx, the name and length of each 
+ *                    distinct variable of e, as by pbg_var_name, the number of
+ *                    variables, the number of records, and vars. It sets the 
+ *                    field of variable i of record r at vars[r*numvars + i]. 
+ *                    Must not set VAR fields. Not called if e has no 
+ *                    variables.
+ * @param ctx         Context given to multiget.
+ * @return the number of records which evaluated to TRUE, or PBG_ERROR if out
+ *         of memory.
+ */
+long pbg_evaluate_multiget(pbg_expr* e, pbg_error* err, long numrecords, 
+		pbg_field* vars, int* results, 
+		void (*multiget)(void*, char**, int*, int, long, pbg_field*), 
+		void* ctx);
+
+/**
+ * Evaluates the PBG expression as pbg_evaluate_vars does, giving up once it
+ * has begun evaluating a number of fields or once some time has passed. An 
+ * evaluation given up on fails with a PBG_ERR_BUDGET error, and leaves 
+ * neither the statistics of PBG_PROFILE nor the results of pbg_incr_bind 
+ * behind, which this function never updates.
+ * @param e       PBG expression to evaluate.
+ * @param err     Container to store error, if any occurs.
+ * @param vars    One field for each variable of e, borrowed.
+ * @param visits  Most fields to begin evaluating, each operator and each 
+ *                BOOL argument counting as one, or -1 if unbounded. 
+ *                Evaluations never begin more than pbg_cost(e) fields.
+ * @param nsec    Most nanoseconds to evaluate for, or 0 if unbounded. The 
+ *                clock is read once in a few hundred fields, so evaluations 
+ *                may overrun by that many fields.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_evaluate_budget(pbg_expr* e, pbg_error* err, pbg_field* vars, 
+		long visits, long nsec);
+
+/**
+ * Estimates the cost of evaluating the PBG expression before evaluating it,
+ * e.g. to reject expressions too costly to be evaluated, as the most fields
+ * any evaluation may begin. Evaluations which short-circuit cost less.
+ * @param e  PBG expression to inspect.
+ * @return the cost of e, at most LONG_MAX, or -1 if out of memory.
+ */
+long pbg_cost(pbg_expr* e);
+
+/**
+ * Gets the number of distinct variables in the PBG expression. A variable
+ * referenced several times in the expression is counted once.
+ * @param e  PBG expression to inspect.
+ * @return the number of distinct variables.
+ */
+int pbg_numvars(pbg_expr* e);
+
+/**
+ * Gets the name of a variable in the PBG expression.
+ * @param e  PBG expression to inspect.
+ * @param i  Index of the variable, from 0 to pbg_numvars(e)-1.
+ * @param n  If not NULL, set to the length of the name.
+ * @return the name of the variable, terminated with '\0'.
+ */
+char* pbg_var_name(pbg_expr* e, int i, int* n);
+
 /**
  * Destroys the PBG expression instance and frees all associated resources.
  * This function does not free the provided pointer.
@@ -164,6 +357,959 @@ int pbg_evaluate(pbg_expr* e, pbg_error* err, pbg_field (*dict)(char*, int));
  */
 void pbg_free(pbg_expr* e);
 
+#ifdef PBG_PROFILE
+/**
+ * Prints the evaluation statistics of every field of the expression visited
+ * by pbg_evaluate to the standard output, alongside its source text. Only 
+ * available when the library is compiled with PBG_PROFILE defined.
+ * @param e  PBG expression to report on.
+ */
+void pbg_expr_stats(pbg_expr* e);
+
+/**
+ * Resets the evaluation statistics of the expression to zero. Only available
+ * when the library is compiled with PBG_PROFILE defined.
+ * @param e  PBG expression to reset.
+ */
+void pbg_expr_stats_reset(pbg_expr* e);
+#endif
+
+
+/********************
+ *                  *
+ * STREAMING PARSER *
+ *                  *
+ ********************/
+
+/**
+ * Parses an expression pushed in chunks of arbitrary size, e.g. as they are
+ * read from a pipe or decompressed. Tokens may be split across chunks. The 
+ * tree is built as fields arrive, so the parser only buffers the token being
+ * read and the children of the groups still open. Yields the same expression
+ * as pbg_parse_n given the concatenated input.
+ */
+typedef struct {
+	pbg_expr    _expr;         /* Expression being built. */
+	int         _constcap;     /* Capacity of the constants of _expr. */
+	int         _varcap;       /* Capacity of the variables of _expr. */
+	int*        _varslots;     /* Hash index of the variables of _expr. */
+	int         _varslotcap;   /* Number of slots in _varslots. */
+	char*       _tok;          /* Token being read. */
+	int         _toklen;       /* Length of the token being read. */
+	int         _tokcap;       /* Capacity of _tok. */
+	int         _state;        /* Kind of token being read, if any. */
+	int*        _groups;       /* Operator and first child of open groups. */
+	int         _depth;        /* Number of open groups. */
+	int         _groupcap;     /* Capacity of _groups, in groups. */
+	int*        _children;     /* Children of the open groups, in order. */
+	int         _numchildren;  /* Number of children of the open groups. */
+	int         _childcap;     /* Capacity of _children. */
+	int         _opened;       /* Whether the next field opens a group. */
+	int         _done;         /* Whether the whole expression was read. */
+	pbg_error   _err;          /* First error encountered, if any. */
+#ifdef PBG_PROFILE
+	char*       _source;       /* Copy of the input, for source spans. */
+	int         _srclen;       /* Length of _source. */
+	int         _srccap;       /* Capacity of _source. */
+#endif
+} pbg_parser;
+
+/**
+ * Makes a new streaming parser.
+ * @return the parser, or NULL if out of memory.
+ */
+pbg_parser* pbg_parser_new(void);
+
+/**
+ * Feeds the next chunk of the expression to the parser. Once an error occurs,
+ * the remaining input is ignored and the error is reported by 
+ * pbg_parser_finish.
+ * @param p      Parser to feed.
+ * @param chunk  Next chunk of the expression. Need not outlive the call.
+ * @param n      Length of the chunk. With PBG_PROFILE, the input is copied 
+ *               for its source spans, which fails past INT_MAX/2 bytes.
+ * @return 1 if the input is well-formed so far, 0 if an error occurred.
+ */
+int pbg_parser_feed(pbg_parser* p, char* chunk, size_t n);
+
+/**
+ * Ends the input and destroys the parser, yielding the parsed expression. 
+ * Must be called once for every parser, even after an error.
+ * @param p    Parser to finish. Freed by this function.
+ * @param e    Expression to initialize. Must be destroyed with pbg_free 
+ *             unless an error occurred.
+ * @param err  Container to store error, if any occurs.
+ */
+void pbg_parser_finish(pbg_parser* p, pbg_expr* e, pbg_error* err);
+
+
+/*************************
+ *                       *
+ * SCHEMA SPECIALIZATION *
+ *                       *
+ *************************/
+
+/**
+ * Specializes the expression to a schema declaring the types of its 
+ * variables. Comparisons whose arguments are mismatched NUMBERs, DATEs, or 
+ * STRINGs are rejected. Existence and type checks of declared variables and 
+ * literals are folded to TRUE or FALSE, as are EQ and NEQ of mismatched 
+ * types. Binary comparisons of two arguments of the same declared type are 
+ * lowered to monomorphic operators which skip the NULL and type dispatch of 
+ * generic comparisons.
+ * 
+ * Declared variables are never NULL. Evaluating a specialized expression with
+ * a variable which is NULL or not of its declared type yields a
+ * PBG_ERR_OP_ARG_TYPE error. Variables resolved by pbg_evaluate_lazy are only
+ * checked by the monomorphic operators which use them.
+ * @param e       PBG expression to specialize. On error, it is unchanged.
+ * @param err     Container to store error, if any occurs.
+ * @param schema  Called with the name of each variable and its length. 
+ *                Returns PBG_LT_NUMBER, PBG_LT_DATE, or PBG_LT_STRING to 
+ *                declare its type, or PBG_NULL to leave it undeclared.
+ */
+void pbg_specialize(pbg_expr* e, pbg_error* err, 
+		pbg_field_type (*schema)(char*, int));
+
+
+/******************
+ *                *
+ * CANONICAL FORM *
+ *                *
+ ******************/
+
+#define PBG_HASH_SIZE 16  /* Bytes of a structural hash, see pbg_hash. */
+
+/**
+ * Sorts the arguments of AND, OR, EQ, NEQ, and EXST, including fused and
+ * monomorphic EQ and NEQ, into an order which only depends on the structure 
+ * of each argument. Expressions which differ only in the order of these
+ * arguments, in the spelling of their literals (3 and 3.0), or in whitespace
+ * then have the same form. Reordered arguments are evaluated in their new 
+ * order, so the canonical expression may fail where the original expression
+ * short-circuited, or the reverse; otherwise both yield the same results.
+ * @param e    PBG expression to canonicalize. On error, it is unchanged.
+ * @param err  Container to store error, if any occurs.
+ */
+void pbg_canonicalize(pbg_expr* e, pbg_error* err);
+
+/**
+ * Computes a 128-bit structural hash of an expression, stable across runs of
+ * the same build. Variables are hashed by name and literals by value, and 
+ * fused comparisons hash as the comparisons they were parsed from. The first
+ * 8 bytes may be used on their own as a 64-bit hash. Canonicalize the 
+ * expression first so that equivalent expressions hash alike.
+ * @param e     PBG expression to hash.
+ * @param err   Container to store error, if any occurs.
+ * @param hash  Filled with PBG_HASH_SIZE bytes of hash.
+ */
+void pbg_hash(pbg_expr* e, pbg_error* err, unsigned char* hash);
+
+/**
+ * Checks whether two expressions have the same structure, in the sense of
+ * pbg_hash. Canonicalize both first so that equivalent expressions are equal.
+ * @param a    First PBG expression.
+ * @param b    Second PBG expression.
+ * @param err  Container to store error, if any occurs.
+ * @return PBG_TRUE if the expressions are equal, PBG_FALSE if they are not,
+ *         PBG_ERROR if out of memory.
+ */
+int pbg_equal(pbg_expr* a, pbg_expr* b, pbg_error* err);
+
+
+/*************
+ *           *
+ * ZONE MAPS *
+ *           *
+ *************/
+
+#define PBG_NEVER   0  /* No record of a block satisfies the expression. */
+#define PBG_ALWAYS  1  /* Every record of a block satisfies the expression. */
+#define PBG_MAYBE   2  /* Only evaluating the records decides the expression. */
+
+/**
+ * Statistics of a variable over a block of records. Every value other than
+ * NULL is of the type of _min and lies between _min and _max; a BOOL variable
+ * is bounded by FALSE and TRUE. If either bound is NULL, or the bounds are of
+ * different types, nothing is known of the values other than NULL. STRINGs
+ * are ordered byte by byte, a prefix before the strings it begins, as the 
+ * comparison operators order them.
+ */
+typedef struct {
+	pbg_field  _min;    /* Least value other than NULL. */
+	pbg_field  _max;    /* Greatest value other than NULL. */
+	long       _nulls;  /* Number of records in which the variable is NULL. */
+	long       _count;  /* Number of records in the block. */
+} pbg_zone;
+
+/**
+ * Decides from the statistics of a block whether its records can satisfy an
+ * expression, so that blocks are skipped without being decoded. Comparisons
+ * of variables to literals and to one another are decided by their bounds,
+ * EXST by the number of NULLs, and AND, OR, and NOT from their arguments.
+ * A record for which evaluation fails does not satisfy the expression. The
+ * answer is never wrong, but may be PBG_MAYBE when another is true.
+ * @param e      PBG expression to decide.
+ * @param err    Container to store error, if any occurs.
+ * @param zones  Statistics of each variable, in the order of e->_variables.
+ * @return PBG_NEVER if no record can evaluate to PBG_TRUE,
+ *         PBG_ALWAYS if every record evaluates to PBG_TRUE,
+ *         PBG_MAYBE otherwise, or PBG_ERROR if out of memory.
+ */
+int pbg_evaluate_zone(pbg_expr* e, pbg_error* err, pbg_zone* zones);
+
+
+/**********************
+ *                    *
+ * PARTIAL EVALUATION *
+ *                    *
+ **********************/
+
+/**
+ * Evaluates an expression given only some of its variables, yielding a 
+ * residual expression of the others. Every operator whose arguments are known
+ * is folded to TRUE or FALSE. AND and OR drop arguments which cannot decide
+ * them and stop at the first which must, NOT is folded over a known argument,
+ * and EXST and TYPE are decided by a known argument which fails them. 
+ * Operators which must fail are kept with the values of their variables, so
+ * the residual fails wherever the expression would. Evaluating the residual 
+ * with the remaining variables yields what evaluating the expression with all 
+ * of them would.
+ * @param e         PBG expression to evaluate. It is unchanged.
+ * @param err       Container to store error, if any occurs. As for 
+ *                  pbg_evaluate, a known operator may store an error without
+ *                  failing, as an EQ of a BOOL and another type does.
+ * @param dict      Called with the name of each variable and its length. 
+ *                  Returns its value, which is freed as by pbg_evaluate, or 
+ *                  pbg_make_unbound() to leave the variable in the residual.
+ * @param residual  Expression to initialize with the residual, unless 
+ *                  PBG_ERROR is returned. Must be destroyed with pbg_free.
+ * @return PBG_TRUE or PBG_FALSE if the expression is decided, in which case
+ *         the residual is that literal; PBG_MAYBE if the residual depends on
+ *         its variables; PBG_ERROR if the expression fails whatever its 
+ *         remaining variables, with the error it fails with, or if out of 
+ *         memory.
+ */
+int pbg_partial_evaluate(pbg_expr* e, pbg_error* err, 
+		pbg_field (*dict)(char*, int), pbg_expr* residual);
+
+
+/************************
+ *                      *
+ * RESUMABLE EVALUATION *
+ *                      *
+ ************************/
+
+/**
+ * State of an evaluation which suspends when it reaches a variable whose 
+ * value has not been supplied, rather than waiting for it, so that a single 
+ * thread may interleave many evaluations whose variables come from slow 
+ * sources. See pbg_eval_begin.
+ */
+typedef struct {
+	pbg_expr   _bound;   /* Expression bound to the supplied variables. */
+	void*      _frames;  /* Fields under evaluation, innermost last. */
+	int        _depth;   /* Frame to evaluate next. */
+	int        _cap;     /* Number of frames allocated. */
+	int        _result;  /* Result once finished, PBG_NEED until then. */
+	pbg_error  _err;     /* Error of the evaluation, if any. */
+} pbg_eval;
+
+/**
+ * Begins a resumable evaluation. No variable is supplied yet, and none is 
+ * resolved until pbg_eval_step asks for it. The fields are borrowed, as with
+ * pbg_evaluate_vars, and the expression is not modified, so it may be 
+ * evaluated by any number of resumable evaluations at once.
+ * @param ev    Evaluation to initialize.
+ * @param err   Container to store error, if any occurs.
+ * @param e     PBG expression to evaluate. Must outlive the evaluation.
+ * @param vars  Storage for one field for each variable of e, indexed as by 
+ *              pbg_var_name. Must outlive the evaluation.
+ */
+void pbg_eval_begin(pbg_eval* ev, pbg_error* err, pbg_expr* e, 
+		pbg_field* vars);
+
+/**
+ * Evaluates until the evaluation finishes or reaches a variable which has 
+ * not been supplied. Operators short-circuit as they do for pbg_evaluate_lazy,
+ * so only the variables the result depends on are asked for. Once finished, 
+ * stepping again gives the same result and error.
+ * @param ev   Evaluation to go on with.
+ * @param err  Container to store error, if any occurs.
+ * @param var  If PBG_NEED is returned, set to the index of the variable to 
+ *             supply with pbg_eval_resume before stepping again.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR once finished, 
+ *         PBG_NEED if a variable must be supplied first.
+ */
+int pbg_eval_step(pbg_eval* ev, pbg_error* err, int* var);
+
+/**
+ * Supplies the value of a variable, which may be done before it is asked 
+ * for. The evaluation goes on from where it stopped with the next call to 
+ * pbg_eval_step. A value which does not match the type declared by 
+ * pbg_specialize makes the evaluation fail.
+ * @param ev     Evaluation to supply.
+ * @param var    Index of the variable.
+ * @param value  Value of the variable, borrowed. Must not be a VAR field.
+ */
+void pbg_eval_resume(pbg_eval* ev, int var, pbg_field value);
+
+/**
+ * Frees the resources used by the evaluation, finished or not. This function
+ * does not free the provided pointer, nor the expression or its variables.
+ * @param ev  Evaluation to destroy.
+ */
+void pbg_eval_free(pbg_eval* ev);
+
+
+/*************
+ *           *
+ * RULE SETS *
+ *           *
+ *************/
+
+/**
+ * An ordered list of PBG expressions, its rules, of which only the first to
+ * match a record matters, as in a routing table. Rules are tried in order of
+ * priority, and none is evaluated once a rule of higher priority has matched.
+ * Rules which require a variable to equal a constant, as in 
+ * (& (= [route] 'eu') ...), are indexed by that constant, so only the rules 
+ * whose constant the record has are candidates. The variables of all rules 
+ * are shared by name, and indexed as by pbg_ruleset_var_name.
+ */
+typedef struct {
+	pbg_expr*    _rules;      /* Rules, borrowed, in the order given. */
+	int          _numrules;   /* Number of rules. */
+	int*         _order;      /* Position of each rule by priority. */
+	char**       _names;      /* Name of each distinct variable. */
+	int*         _lens;       /* Length of each name. */
+	int          _numvars;    /* Number of distinct variables. */
+	int*         _varmap;     /* Variables of each rule, by priority. */
+	int*         _varstart;   /* Start of each rule in _varmap. */
+	int          _maxvars;    /* Most variables of a rule. */
+	int*         _keyvar;     /* Variable each rule requires to equal its 
+	                           * key, or -1, by priority. */
+	pbg_field**  _keys;       /* Constant each rule requires, borrowed. */
+	int          _indexvar;   /* Variable of the index, or -1 if none. */
+	int*         _slots;      /* First rule of each slot of the index. */
+	int          _numslots;   /* Number of slots, a power of two. */
+	int*         _chain;      /* Next rule of the slot or of the rest. */
+	int          _rest;       /* First rule which is not indexed. */
+} pbg_ruleset;
+
+/**
+ * Builds a rule set from parsed rules. Each rule keeps the variables of its
+ * own expression, which are mapped to those of the rule set. The rules must
+ * not be modified while the rule set is in use.
+ * @param rs          Rule set to initialize.
+ * @param err         Container to store error, if any occurs.
+ * @param rules       Parsed rules. Must outlive the rule set.
+ * @param priorities  Priority of each rule, greatest first. Rules of the same
+ *                    priority are tried in the order given. If NULL, rules 
+ *                    are tried in the order given.
+ * @param numrules    Number of rules.
+ */
+void pbg_ruleset_init(pbg_ruleset* rs, pbg_error* err, pbg_expr* rules, 
+		int* priorities, int numrules);
+
+/**
+ * Finds the rule of highest priority which evaluates to TRUE. Rules which
+ * fail to evaluate do not match. The rule set is not modified, so several 
+ * threads may evaluate it at once.
+ * @param rs       Rule set to evaluate.
+ * @param err      Container to store error, if any occurs. If rules fail to
+ *                 evaluate, holds the error of the first of them.
+ * @param vars     One field for each variable of the rule set, borrowed.
+ * @param skipped  If not NULL, set to the number of rules which were not 
+ *                 evaluated, whether not candidates or of lower priority 
+ *                 than the match.
+ * @return the position of the matching rule in the rules given, 
+ *         -1 if no rule matches or if out of memory.
+ */
+int pbg_ruleset_evaluate(pbg_ruleset* rs, pbg_error* err, pbg_field* vars, 
+		int* skipped);
+
+/**
+ * Gets the number of distinct variables of the rules of a rule set.
+ * @param rs  Rule set to inspect.
+ * @return the number of distinct variables.
+ */
+int pbg_ruleset_numvars(pbg_ruleset* rs);
+
+/**
+ * Gets the name of a variable of a rule set.
+ * @param rs  Rule set to inspect.
+ * @param i   Index of the variable, from 0 to pbg_ruleset_numvars(rs)-1.
+ * @param n   If not NULL, set to the length of the name.
+ * @return the name of the variable, terminated with '\0'.
+ */
+char* pbg_ruleset_var_name(pbg_ruleset* rs, int i, int* n);
+
+/**
+ * Frees the resources used by the rule set. This function does not free the
+ * provided pointer, nor the rules.
+ * @param rs  Rule set to destroy.
+ */
+void pbg_ruleset_free(pbg_ruleset* rs);
+
+
+/*********************
+ *                   *
+ * DECISION DIAGRAMS *
+ *                   *
+ *********************/
+
+#define PBG_BDD_MAXLEAVES  1024  /* Most leaves a diagram is compiled over. */
+
+/**
+ * The AND, OR, and NOT operators at the top of a PBG expression, compiled to 
+ * a reduced ordered decision diagram over the fields they combine, its leaves.
+ * Each node tests a leaf and moves on by whether it is TRUE, FALSE, or fails,
+ * so evaluating the diagram evaluates each leaf at most once, and leaves which
+ * are alike are evaluated once however often they occur. Failures are decided
+ * as the tree evaluator short-circuits them, so the diagram agrees with 
+ * pbg_evaluate_vars. The first three nodes are the sinks PBG_FALSE, PBG_TRUE,
+ * and PBG_ERROR.
+ */
+typedef struct {
+	pbg_expr*  _expr;       /* Expression the diagram decides. */
+	int*       _leaves;     /* Index in _expr of the leaf of each level. */
+	int        _numleaves;  /* Number of levels. */
+	int*       _nodes;      /* Level of each node, then its successors on 
+	                         * FALSE, TRUE, and ERROR. NULL if the expression
+	                         * is evaluated as a tree instead. */
+	int        _numnodes;   /* Number of nodes, sinks included. */
+	int        _root;       /* Node to start from. */
+} pbg_bdd;
+
+/**
+ * Compiles the boolean structure of an expression to a decision diagram. 
+ * Leaves are ordered as they first occur or, if that makes too many nodes, by
+ * how often they occur after the first. If both do, or there are more than 
+ * PBG_BDD_MAXLEAVES leaves, no diagram is kept and the expression is 
+ * evaluated as a tree.
+ * @param bdd       Diagram to initialize.
+ * @param err       Container to store error, if any occurs.
+ * @param e         PBG expression to compile. Must outlive the diagram.
+ * @param maxnodes  Most nodes which may be made while compiling, sinks 
+ *                  excluded. Those left unreachable are then dropped.
+ */
+void pbg_bdd_compile(pbg_bdd* bdd, pbg_error* err, pbg_expr* e, int maxnodes);
+
+/**
+ * Evaluates the compiled expression against the given variables, as 
+ * pbg_evaluate_vars does. When a record fails, the expression is evaluated 
+ * again as a tree to find its error.
+ * @param bdd   Diagram to evaluate.
+ * @param err   Container to store error, if any occurs.
+ * @param vars  One field for each variable of the expression, indexed as by 
+ *              pbg_var_name. Fields are borrowed.
+ * @return PBG_TRUE or PBG_FALSE, or PBG_ERROR with the error in err.
+ */
+int pbg_bdd_evaluate(pbg_bdd* bdd, pbg_error* err, pbg_field* vars);
+
+/**
+ * Frees the resources used by the diagram. This function does not free the
+ * provided pointer, nor the compiled expression.
+ * @param bdd  Diagram to destroy.
+ */
+void pbg_bdd_free(pbg_bdd* bdd);
+
+
+/***************
+ *             *
+ * CSV RECORDS *
+ *             *
+ ***************/
+
+/**
+ * Binds the variables of a PBG expression to the columns of CSV records, so
+ * that records can be evaluated in place. Records are split without copying,
+ * and the field of a column is only converted when the evaluation reaches a
+ * variable bound to it. Each field is typed as the pbg literal it spells: a
+ * NUMBER, DATE, TRUE or FALSE, and a STRING otherwise. Empty fields, missing
+ * fields, and variables not named by the header are NULL, as are fields too
+ * long for a STRING, see pbg_init_string. Fields may be quoted with '"', in 
+ * which case "" stands for a single quote.
+ * 
+ * A pbg_csv holds the state of the record being evaluated, so each thread 
+ * needs its own.
+ */
+typedef struct {
+	pbg_expr*       _expr;     /* Expression whose variables are bound. */
+	char            _delim;    /* Field delimiter. */
+	int             _numcols;  /* Number of columns named by the header. */
+	int             _maxcol;   /* Last column bound to a variable. */
+	int*            _colvar;   /* Variable bound to each column, or -1. */
+	char**          _start;    /* Start of the field of each variable, or NULL. */
+	size_t*         _len;      /* Length of the field of each variable. */
+	pbg_field*      _vars;     /* Resolved fields of the current record. */
+	pbg_lt_number*  _numbers;  /* Storage for NUMBER fields. */
+	pbg_lt_date*    _dates;    /* Storage for DATE fields. */
+	char*           _scratch;  /* Storage for unquoted STRING fields. */
+	size_t          _scrcap;   /* Capacity of _scratch. */
+	size_t          _scrused;  /* Bytes of _scratch in use. */
+} pbg_csv;
+
+/**
+ * Binds the variables of the expression to the columns named by the header.
+ * If a column is named more than once, the first one is bound.
+ * @param csv     CSV binding to initialize.
+ * @param err     Container to store error, if any occurs.
+ * @param e       PBG expression to bind. Must outlive the binding.
+ * @param header  Header record naming each column.
+ * @param n       Length of the header, excluding any line terminator.
+ * @param delim   Field delimiter, usually ','.
+ */
+void pbg_csv_bind(pbg_csv* csv, pbg_error* err, pbg_expr* e, 
+		char* header, size_t n, char delim);
+
+/**
+ * Evaluates the bound expression against a CSV record.
+ * @param csv     CSV binding to evaluate with.
+ * @param err     Container to store error, if any occurs.
+ * @param record  Record to evaluate. Need not be terminated with '\0'.
+ * @param n       Length of the record, excluding any line terminator.
+ * @return 1 if the PBG expression evaluates to true for the record,
+ *         0 otherwise.
+ */
+int pbg_csv_evaluate(pbg_csv* csv, pbg_error* err, char* record, size_t n);
+
+/**
+ * Frees the resources used by the CSV binding. This function does not free
+ * the provided pointer, nor the bound expression.
+ * @param csv  CSV binding to destroy.
+ */
+void pbg_csv_free(pbg_csv* csv);
+
+
+/*****************
+ *               *
+ * ARROW RECORDS *
+ *               *
+ *****************/
+
+/* The Arrow C data interface, as specified by Apache Arrow. Its definitions
+ * are guarded as the specification asks, so that they may come from another
+ * header as well. */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+#include <stdint.h>  /* int64_t */
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+	const char*  format;
+	const char*  name;
+	const char*  metadata;
+	int64_t      flags;
+	int64_t      n_children;
+	struct ArrowSchema**  children;
+	struct ArrowSchema*   dictionary;
+	void  (*release)(struct ArrowSchema*);
+	void*   private_data;
+};
+
+struct ArrowArray {
+	int64_t       length;
+	int64_t       null_count;
+	int64_t       offset;
+	int64_t       n_buffers;
+	int64_t       n_children;
+	const void**  buffers;
+	struct ArrowArray**  children;
+	struct ArrowArray*   dictionary;
+	void  (*release)(struct ArrowArray*);
+	void*   private_data;
+};
+#endif
+
+/**
+ * Binds the variables of a PBG expression to the columns of Arrow record 
+ * batches, so that batches can be evaluated where they lie. Columns of 
+ * float64 ("g") are NUMBERs, int64 ("l") NUMBERs, date32 ("tdD") DATEs, 
+ * utf8 ("u") STRINGs, bool ("b") BOOLs, and null ("n") NULLs, and entries 
+ * unset in a validity bitmap are NULL. NUMBERs of float64 columns and STRINGs
+ * point into the buffers of the batch; only int64 and date32 entries are 
+ * converted, as the evaluation reaches them. Variables not named by the 
+ * schema are NULL.
+ * 
+ * A pbg_arrow holds the state of the record being evaluated, so each thread 
+ * needs its own.
+ */
+typedef struct {
+	pbg_expr*       _expr;     /* Expression whose variables are bound. */
+	int             _numcols;  /* Number of columns of the schema. */
+	int*            _column;   /* Column bound to each variable, or -1. */
+	char*           _format;   /* Format of the column of each variable. */
+	struct ArrowArray*  _batch;  /* Batch being evaluated. */
+	int64_t         _row;      /* Row being evaluated, offset included. */
+	pbg_field*      _vars;     /* Resolved fields of the current record. */
+	pbg_lt_number*  _numbers;  /* Storage for int64 entries. */
+	pbg_lt_date*    _dates;    /* Storage for date32 entries. */
+} pbg_arrow;
+
+/**
+ * Binds the variables of a PBG expression to the columns of a schema: a 
+ * struct ("+s") whose children are the columns. Each variable is bound to 
+ * the first column with its name.
+ * @param a       Arrow binding to initialize.
+ * @param err     Container to store error, if any occurs. Binding a variable
+ *                to a column of any other format is an error.
+ * @param e       PBG expression to bind. Must outlive the binding.
+ * @param schema  Schema of the batches to evaluate, borrowed.
+ */
+void pbg_arrow_bind(pbg_arrow* a, pbg_error* err, pbg_expr* e, 
+		struct ArrowSchema* schema);
+
+/**
+ * Evaluates the bound PBG expression against every row of a record batch.
+ * @param a       Arrow binding to evaluate.
+ * @param err     Container to store error, if any occurs. If rows fail to 
+ *                evaluate, holds the error of the first of them.
+ * @param batch   Struct array of the schema given to pbg_arrow_bind, 
+ *                borrowed.
+ * @param out     Set to a boolean array with an entry for each row: TRUE or
+ *                FALSE, or null if the row fails to evaluate. It is released
+ *                through its release callback, as any Arrow array.
+ * @param schema  If not NULL, set to the schema of out, likewise.
+ * @return the number of rows which evaluated to TRUE, or -1 if the batch does
+ *         not fit the schema or if out of memory, in which case out and 
+ *         schema are not set.
+ */
+long pbg_arrow_evaluate(pbg_arrow* a, pbg_error* err, struct ArrowArray* batch,
+		struct ArrowArray* out, struct ArrowSchema* schema);
+
+/**
+ * Frees the resources used by the Arrow binding. This function does not free
+ * the provided pointer, nor the bound expression.
+ * @param a  Arrow binding to destroy.
+ */
+void pbg_arrow_free(pbg_arrow* a);
+
+
+/**************************
+ *                        *
+ * INCREMENTAL EVALUATION *
+ *                        *
+ **************************/
+
+/**
+ * Evaluates a PBG expression repeatedly against variables which change a few
+ * at a time. The handle remembers the last result of every operator and the
+ * operators which reference each variable. Updating a variable marks the 
+ * operators on its paths to the root as stale, and only stale operators are
+ * evaluated again, so the cost of an evaluation is proportional to the change
+ * rather than to the size of the expression.
+ */
+typedef struct pbg_incr {
+	pbg_expr*   _expr;      /* Expression being evaluated. */
+	pbg_field*  _vars;      /* Current value of each variable. */
+	int*        _results;   /* Last result of each constant, or -2 if stale. */
+	pbg_error*  _errors;    /* Error of each constant whose result is ERROR. */
+	int*        _parents;   /* Parent of each constant, or -1 for the root. */
+	int*        _refs;      /* Operators referencing each variable. */
+	int*        _refstart;  /* Start of each variable's operators in _refs. */
+	long        _numevals;  /* Number of operators evaluated so far. */
+} pbg_incr;
+
+/**
+ * Binds an incremental evaluation handle to an expression and its variables.
+ * Every operator starts out stale.
+ * @param incr  Handle to initialize.
+ * @param err   Container to store error, if any occurs.
+ * @param e     PBG expression to evaluate. Must outlive the handle.
+ * @param vars  Value of each variable, indexed as by pbg_var_name. Fields are
+ *              borrowed and must remain valid until replaced by pbg_incr_set.
+ *              The array is used in place and must outlive the handle.
+ */
+void pbg_incr_bind(pbg_incr* incr, pbg_error* err, pbg_expr* e, 
+		pbg_field* vars);
+
+/**
+ * Updates the value of a variable, marking the operators which depend on it
+ * as stale. A variable whose data was modified in place must be set again.
+ * @param incr   Handle to update.
+ * @param var    Index of the variable to update.
+ * @param value  New value of the variable, borrowed.
+ */
+void pbg_incr_set(pbg_incr* incr, int var, pbg_field value);
+
+/**
+ * Evaluates the expression, reusing the results of operators which are not 
+ * stale.
+ * @param incr  Handle to evaluate.
+ * @param err   Container to store error, if any occurs.
+ * @return PBG_TRUE, PBG_FALSE, or PBG_ERROR.
+ */
+int pbg_incr_evaluate(pbg_incr* incr, pbg_error* err);
+
+/**
+ * Frees the resources used by the handle. This function does not free the 
+ * provided pointer, nor the expression or its variables.
+ * @param incr  Handle to destroy.
+ */
+void pbg_incr_free(pbg_incr* incr);
+
+
+#ifdef PBG_THREADS
+/***********************
+ *                     *
+ * PARALLEL EVALUATION *
+ *                     *
+ ***********************/
+
+/**
+ * Describes a batch of records to evaluate with pbg_evaluate_parallel or
+ * pbg_ruleset_parallel, and where to put the results. Only available when 
+ * the library is compiled with PBG_THREADS defined (and linked with 
+ * pthreads).
+ */
+typedef struct {
+	long  _numrecords;  /* Number of records, numbered from 0. */
+	
+	/* Resolves a variable of a record, by index as used by pbg_var_name, or
+	 * by pbg_ruleset_var_name when evaluating a rule set. 
+	 * Called concurrently by all threads; thread identifies the calling 
+	 * thread, from 0 to numthreads-1, so that it may use its own storage.
+	 * Returned fields are borrowed, as with pbg_evaluate_lazy, and must 
+	 * remain valid until the thread moves on to the next record. Records 
+	 * are evaluated a field at a time, so a thread may come back to a 
+	 * record and resolve a variable of it again. */
+	pbg_field  (*_resolve)(void* ctx, int thread, long record, int var);
+	void*        _ctx;  /* Context given to _resolve and _emit. */
+	
+	/* If not NULL, bit i (i%8 of byte i/8) is set if record i is TRUE and 
+	 * cleared otherwise. Must hold at least (_numrecords+7)/8 bytes. */
+	unsigned char*  _matches;
+	
+	/* If not NULL, bit i is set if record i is ERROR and cleared otherwise.
+	 * Must hold at least (_numrecords+7)/8 bytes. */
+	unsigned char*  _errors;
+	
+	/* If not NULL, only records whose bit is set are evaluated, e.g. the 
+	 * _matches of an earlier batch. Other records are neither resolved nor
+	 * emitted, and are cleared in _matches and _errors. */
+	unsigned char*  _filter;
+	
+	/* If not NULL, called concurrently by all threads with the result of 
+	 * each record, or with the matched rule for a rule set. */
+	void  (*_emit)(void* ctx, int thread, long record, int result);
+} pbg_batch;
+
+/**
+ * Evaluates the PBG expression against every record of the batch using a
+ * pool of threads. Records are partitioned into morsels which each thread 
+ * takes from its own range, stealing half of another thread's range when its
+ * own runs out. Each thread evaluates with its own variables, so the shared
+ * expression is only ever read. Within a morsel, each child of an AND is
+ * evaluated for the records still TRUE after the previous children, and each
+ * child of an OR for the records still FALSE, so costly fields placed after 
+ * selective ones are only evaluated for the records which need them.
+ * @param e           PBG expression to evaluate.
+ * @param err         Container to store error, if any occurs. If records fail
+ *                    to evaluate, holds the error of one of them.
+ * @param batch       Records to evaluate.
+ * @param numthreads  Number of threads to evaluate with, including the 
+ *                    calling thread.
+ * @return the number of records which evaluated to TRUE.
+ */
+long pbg_evaluate_parallel(pbg_expr* e, pbg_error* err, pbg_batch* batch, 
+		int numthreads);
+
+/**
+ * Matches the rule set against every record of the batch using a pool of 
+ * threads, partitioned as by pbg_evaluate_parallel. Each record is matched 
+ * as by pbg_ruleset_evaluate, with all of its variables resolved up front. 
+ * The bit of a record is set in _matches if a rule matched it, and in 
+ * _errors if none did and some rule failed. _emit is given the index of the
+ * matched rule, or -1 if none matched.
+ * @param rs          Rule set to match.
+ * @param err         Container to store error, if any occurs. If rules fail
+ *                    to evaluate, holds the error of one of them.
+ * @param batch       Records to match.
+ * @param numthreads  Number of threads to evaluate with, including the 
+ *                    calling thread.
+ * @return the number of records which matched a rule.
+ */
+long pbg_ruleset_parallel(pbg_ruleset* rs, pbg_error* err, pbg_batch* batch, 
+		int numthreads);
+#endif
+
+
+#ifdef PBG_THREADS
+/**************
+ *            *
+ * HOT RELOAD *
+ *            *
+ **************/
+
+/**
+ * A versioned rule set, republished as its rules change while readers go on
+ * evaluating it. Writers build each version of the rule set before 
+ * publishing it, and never wait on readers. Readers take a snapshot of the
+ * latest version without locking, and evaluate it for as long as they like. 
+ * Versions replaced by a newer one are freed once no reader can still hold 
+ * them: each reader announces the epoch, numbered by publication, at which
+ * it took its snapshot, and a version is only freed once every reader has 
+ * left or taken its snapshot after the version was replaced. Only available
+ * when the library is compiled with PBG_THREADS defined (and linked with 
+ * pthreads).
+ */
+typedef struct {
+	void* volatile           _current;     /* Latest version published. */
+	volatile unsigned long   _epoch;       /* Number of publications, +1. */
+	volatile unsigned long*  _readers;     /* Epoch each reader took its 
+	                                        * snapshot at, or 0 if none. */
+	int                      _numreaders;  /* Number of readers. */
+	void*                    _retired;     /* Versions replaced but not 
+	                                        * freed, newest first. */
+	void*                    _lock;        /* Serializes writers. */
+} pbg_reload;
+
+/**
+ * Initializes a versioned rule set with no version published.
+ * @param r           Rule set to initialize.
+ * @param err         Container to store error, if any occurs.
+ * @param numreaders  Number of readers, each of which is numbered from 0 to 
+ *                    numreaders-1 and used by one thread at a time.
+ */
+void pbg_reload_init(pbg_reload* r, pbg_error* err, int numreaders);
+
+/**
+ * Publishes a new version of the rules, as with pbg_ruleset_init, and frees
+ * the versions no reader holds any longer. Readers which take their snapshot
+ * after this function returns see the new version. Writers may publish from
+ * any thread, one at a time.
+ * @param r           Rule set to publish to.
+ * @param err         Container to store error, if any occurs.
+ * @param rules       Parsed rules, allocated with malloc. If successful, 
+ *                    the rules and the array are owned and freed by the rule
+ *                    set, and must not be used by the caller any longer.
+ * @param priorities  Priority of each rule, as for pbg_ruleset_init. Copied.
+ * @param numrules    Number of rules.
+ * @return the number of the version published, counting from 1, or -1 if 
+ *         out of memory, in which case the current version is unchanged.
+ */
+long pbg_reload_publish(pbg_reload* r, pbg_error* err, pbg_expr* rules, 
+		int* priorities, int numrules);
+
+/**
+ * Takes a snapshot of the latest version without locking. The snapshot 
+ * remains valid, whatever is published meanwhile, until the reader calls
+ * pbg_reload_exit, and must not be freed or modified.
+ * @param r        Rule set to read.
+ * @param reader   Reader taking the snapshot, which must not hold one.
+ * @param version  If not NULL, set to the number of the version, or 0.
+ * @return the snapshot, or NULL if no version has been published.
+ */
+pbg_ruleset* pbg_reload_enter(pbg_reload* r, int reader, long* version);
+
+/**
+ * Releases the snapshot of a reader, so that it may be freed.
+ * @param r       Rule set read.
+ * @param reader  Reader holding the snapshot.
+ */
+void pbg_reload_exit(pbg_reload* r, int reader);
+
+/**
+ * Frees the versions no reader holds any longer. This is done by each
+ * publication, but lets writers free old versions held by slow readers 
+ * without publishing.
+ * @param r  Rule set to reclaim versions of.
+ * @return the number of versions replaced but not yet freed.
+ */
+int pbg_reload_reclaim(pbg_reload* r);
+
+/**
+ * Frees every version of the rule set. No reader may hold a snapshot. This
+ * function does not free the provided pointer.
+ * @param r  Rule set to destroy.
+ */
+void pbg_reload_free(pbg_reload* r);
+#endif
+
+
+/***********
+ *         *
+ * BITSETS *
+ *         *
+ ***********/
+
+/* Bitsets hold bit i of a set as bit i%8 of byte i/8, as do the _matches, 
+ * _errors, and _filter of a pbg_batch. Operations work a machine word at a 
+ * time, and only the first numbits bits of their result are meaningful. The 
+ * result may be either of the operands. */
+
+/**
+ * Stores the intersection of two bitsets.
+ * @param dst      Bitset to store the result in.
+ * @param a        First operand.
+ * @param b        Second operand.
+ * @param numbits  Number of bits of the bitsets.
+ */
+void pbg_bits_and(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits);
+
+/**
+ * Stores the union of two bitsets.
+ * @param dst      Bitset to store the result in.
+ * @param a        First operand.
+ * @param b        Second operand.
+ * @param numbits  Number of bits of the bitsets.
+ */
+void pbg_bits_or(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits);
+
+/**
+ * Stores the bits of a which are not set in b.
+ * @param dst      Bitset to store the result in.
+ * @param a        First operand.
+ * @param b        Second operand, whose bits are removed from a.
+ * @param numbits  Number of bits of the bitsets.
+ */
+void pbg_bits_andnot(unsigned char* dst, unsigned char* a, unsigned char* b, 
+		long numbits);
+
+/**
+ * Counts the bits set among the first numbits bits of a bitset.
+ * @param bits     Bitset to count.
+ * @param numbits  Number of bits to count.
+ * @return the number of bits set.
+ */
+long pbg_bits_count(unsigned char* bits, long numbits);
+
+
+/*****************************
+ *                           *
+ * AHEAD-OF-TIME COMPILATION *
+ *                           *
+ *****************************/
+
+/**
+ * Translates an expression into C89 source which evaluates it without the 
+ * interpreter. The source includes pbg.h and defines two functions:
+ * 
+ *     int NAME(pbg_field* vars, pbg_error* err);
+ *     int NAME_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+ * 
+ * which behave as pbg_evaluate_vars and pbg_evaluate do on the expression, 
+ * yielding the same results and the same types of errors. Each operator 
+ * becomes a function whose children are called or compared directly, and 
+ * constants become static data. The source only depends on the types of
+ * pbg.h, so it may be compiled into a program without linking pbg.c. Like 
+ * snprintf, at most size-1 characters are written, followed by a NUL.
+ * @param e     Expression to compile.
+ * @param name  Name of the generated function, a valid C identifier.
+ * @param buf   Buffer to write the source to. May be NULL if size is 0.
+ * @param size  Size of buf.
+ * @return the length of the whole source, which was truncated if it is not 
+ *         less than size; 0 if out of memory.
+ */
+size_t pbg_compile(pbg_expr* e, char* name, char* buf, size_t size);
+
 
 /**************
  *            *
@@ -207,6 +1353,63 @@ pbg_field pbg_make_string(char* str);
  */
 pbg_field pbg_make_null(void);
 
+/**
+ * Makes a field standing for a variable whose value is not yet known, see 
+ * pbg_partial_evaluate.
+ * @return a new unbound field.
+ */
+pbg_field pbg_make_unbound(void);
+
+/**
+ * Initializes a field representing a NUMBER without allocating. The field
+ * refers to the provided storage, which must outlive it. Such fields are 
+ * borrowed and must never be returned by a dictionary given to pbg_evaluate.
+ * @param data   Storage for the NUMBER.
+ * @param value  Numeric value of the NUMBER.
+ * @return a new NUMBER field referring to data.
+ */
+pbg_field pbg_init_number(pbg_lt_number* data, double value);
+
+/**
+ * Initializes a field representing a DATE without allocating. The field
+ * refers to the provided storage, which must outlive it. Such fields are 
+ * borrowed and must never be returned by a dictionary given to pbg_evaluate.
+ * @param data   Storage for the DATE.
+ * @param year   Year of the date.
+ * @param month  Month of the date.
+ * @param day    Day of the date.
+ * @return a new DATE field referring to data.
+ */
+pbg_field pbg_init_date(pbg_lt_date* data, int year, int month, int day);
+
+/**
+ * Initializes a field representing a STRING without allocating or copying. 
+ * The field refers to the provided characters, which must outlive it. Such 
+ * fields are borrowed and must never be returned by a dictionary given to 
+ * pbg_evaluate.
+ * @param str  Characters of the STRING. Need not be terminated with '\0'.
+ * @param n    Number of characters. The length of a field is an int, so a 
+ *             STRING holds at most INT_MAX characters.
+ * @return a new STRING field referring to str.
+ */
+pbg_field pbg_init_string(char* str, int n);
+
+/**
+ * Reads a NUMBER in a single pass, checking that it is written as a pbg 
+ * NUMBER literal, formatted as JSON numbers are but for an optional leading 
+ * '+'. Only the first n characters are read, so str need not be terminated, 
+ * which suits values split from CSV records or JSON documents in place. The 
+ * value is the double nearest the decimal, found exactly in one or two 
+ * floating point operations when the significand has at most 15 digits and 
+ * the exponent is small, and by strtod otherwise.
+ * @param str    Characters of the NUMBER. Need not be terminated with '\0'.
+ * @param n      Number of characters.
+ * @param value  Set to the value of the NUMBER if valid. May be NULL, to only
+ *               check whether str is a NUMBER.
+ * @return 1 if str is a NUMBER, 0 otherwise.
+ */
+int pbg_read_number(char* str, size_t n, double* value);
+
 
 /***************
  *             *
@@ -229,7 +1432,21 @@ int pbg_iserror(pbg_error* err);
 void pbg_error_print(pbg_error* err);
 
 /**
- * Frees resources being used by the given error, if any. This function does
+ * Writes a human-readable representation of the given pbg_error to a buffer,
+ * as printed by pbg_error_print but without a newline. Neither allocates nor
+ * uses stdio. The text is truncated to fit the buffer, which is always 
+ * terminated with '\0' unless size is 0.
+ * @param err   Error to format.
+ * @param buf   Buffer to write to.
+ * @param size  Size of the buffer.
+ * @return the length of the untruncated text, so it was truncated if this is
+ *         at least size.
+ */
+size_t pbg_error_format(pbg_error* err, char* buf, size_t size);
+
+/**
+ * Frees resources being used by the given error, if any. Errors currently 
+ * hold no resources, but callers should still free them. This function does
  * not free the provided pointer.
  * @param e  PBG error to clean up.
  */
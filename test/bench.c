@@ -0,0 +1,349 @@
+#define _POSIX_C_SOURCE 200112L  /* clock_gettime, sysconf */
+
+#include "../pbg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Benchmarks in this file. */
+int bench_parallel(long numrecords, int maxthreads);
+int bench_stress(long maxleaves);
+int bench_leaves(long numrecords);
+
+/* Helpers. */
+double bench_clock(void);
+int bench_columns(long numrecords);
+char* bench_build(int shape, long numleaves, size_t* n);
+double bench_rule(char* rule, long numrecords, long* numtrue);
+pbg_field bench_resolve(void* ctx, int thread, long record, int var);
+
+/* Synthetic columnar records. Column 0 is [a], a number in [0,1000); column 1
+ * is [s], one of a few strings; column 2 is [d], a date in 2018. */
+#define BENCH_NUMCOLS 3
+pbg_field*      bench_cols[BENCH_NUMCOLS];
+pbg_lt_number*  bench_numbers;
+pbg_lt_date*    bench_dates;
+
+/* Expressions to benchmark. */
+char* bench_exprs[] = {
+	"(< [a] 500)",
+	"(& (< [a] 900) (= [s] 'beta') (> [d] 2018-06-30))",
+	"(| (& (>= [a] 100) (< [a] 200)) (& (@ STRING [s]) (! (= [s] 'alpha'))))",
+	NULL
+};
+
+/* Maps the variables of an expression to columns. */
+typedef struct {
+	int  _cols[8];
+} bench_ctx;
+
+/* Leaf-heavy rules of bench_leaves. Each appears twice: comparing variables
+ * to constants, which are fused, then to variables bound to the same
+ * constants, which are not. Bound variables are named [#NUMBER], [@DATE],
+ * and [$STRING]. */
+char* bench_rules[] = {
+	"(& (>= [a] 100) (< [a] 900) (!= [s] 'alpha') (> [d] 2018-03-01) (<= [d] 2018-11-30))",
+	"(& (>= [a] [#100]) (< [a] [#900]) (!= [s] [$alpha]) (> [d] [@2018-03-01]) (<= [d] [@2018-11-30]))",
+	"(| (< [a] 10) (> [a] 990) (= [s] 'omega') (= [a] 500) (< [d] 2018-01-05) (> [d] 2018-12-25) (= [s] 'zeta') (= [a] 123))",
+	"(| (< [a] [#10]) (> [a] [#990]) (= [s] [$omega]) (= [a] [#500]) (< [d] [@2018-01-05]) (> [d] [@2018-12-25]) (= [s] [$zeta]) (= [a] [#123]))",
+	NULL
+};
+
+/* Shapes of the expressions of bench_stress. */
+char* bench_shapes[] = { "flat", "nested", "variables", NULL };
+
+/* Run benchmarks. Usage: bench [numrecords] [maxthreads]
+ *                        bench stress [maxleaves]
+ *                        bench leaves [numrecords] */
+int main(int argc, char** argv)
+{
+	long numrecords;
+	int maxthreads;
+	if(argc > 1 && strcmp(argv[1], "stress") == 0)
+		return bench_stress((argc > 2) ? atol(argv[2]) : 10000000L);
+	if(argc > 1 && strcmp(argv[1], "leaves") == 0) {
+		numrecords = (argc > 2) ? atol(argv[2]) : 4000000L;
+		if(numrecords < 1 || !bench_columns(numrecords)) {
+			fprintf(stderr, "usage: %s leaves [numrecords]\n", argv[0]);
+			return 1;
+		}
+		return bench_leaves(numrecords);
+	}
+	numrecords = (argc > 1) ? atol(argv[1]) : 4000000L;
+	maxthreads = (argc > 2) ? atoi(argv[2]) : (int) sysconf(_SC_NPROCESSORS_ONLN);
+	if(numrecords < 1 || maxthreads < 1) {
+		fprintf(stderr, "usage: %s [numrecords] [maxthreads]\n", argv[0]);
+		return 1;
+	}
+	if(!bench_columns(numrecords)) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+	return bench_parallel(numrecords, maxthreads);
+}
+
+
+/**************
+ *            *
+ * BENCHMARKS *
+ *            *
+ **************/
+
+/* Reports throughput, speedup, and efficiency of pbg_evaluate_parallel for
+ * 1, 2, 4, ... threads up to maxthreads. */
+int bench_parallel(long numrecords, int maxthreads)
+{
+	pbg_error err;
+	pbg_expr e;
+	pbg_batch batch;
+	bench_ctx ctx;
+	double start, secs, base;
+	long numtrue;
+	char* name;
+	int i, j, threads;
+	
+	printf("pbg_evaluate_parallel: %ld records, up to %d threads\n",
+			numrecords, maxthreads);
+	for(i = 0; bench_exprs[i] != NULL; i++) {
+		pbg_parse(&e, &err, bench_exprs[i]);
+		if(pbg_iserror(&err)) {
+			pbg_error_print(&err);
+			pbg_error_free(&err);
+			return 1;
+		}
+		for(j = 0; j < pbg_numvars(&e) && j < 8; j++) {
+			name = pbg_var_name(&e, j, NULL);
+			ctx._cols[j] = (name[0] == 'a') ? 0 : (name[0] == 's') ? 1 : 2;
+		}
+		batch._numrecords = numrecords;
+		batch._resolve = bench_resolve;
+		batch._ctx = &ctx;
+		batch._matches = malloc(numrecords/8 + 1);
+		batch._errors = NULL;
+		batch._filter = NULL;
+		batch._emit = NULL;
+	
+		printf("%s\n", bench_exprs[i]);
+		printf("  threads      records/s   speedup  efficiency   matches\n");
+		base = 0;
+		for(threads = 1; threads <= maxthreads; threads *= 2) {
+			start = bench_clock();
+			numtrue = pbg_evaluate_parallel(&e, &err, &batch, threads);
+			secs = bench_clock() - start;
+			if(threads == 1) base = secs;
+			printf("  %7d  %13.0f  %8.2f  %9.0f%%  %8ld\n", threads,
+					numrecords / secs, base / secs, 100 * base / secs / threads,
+					numtrue);
+			pbg_error_free(&err);
+			if(threads < maxthreads && threads*2 > maxthreads)
+				threads = maxthreads / 2;
+		}
+		free(batch._matches);
+		pbg_free(&e);
+	}
+	return 0;
+}
+
+/* Reports the time taken to parse, evaluate, and free expressions of 1M, 2M, 
+ * 5M, and 10M leaves, up to maxleaves. The time per leaf should stay flat. */
+int bench_stress(long maxleaves)
+{
+	static long sizes[] = { 1000000L, 2000000L, 5000000L, 10000000L, 0 };
+	pbg_error err;
+	pbg_expr e;
+	pbg_field* vars;
+	double start, parse, eval, freed;
+	char* str;
+	size_t n;
+	long numleaves;
+	int i, j, result;
+	
+	printf("parse/evaluate/free: up to %ld leaves\n", maxleaves);
+	printf("  shape         leaves   parse (s)    eval (s)    free (s)   ns/leaf\n");
+	for(i = 0; bench_shapes[i] != NULL; i++) {
+		for(j = 0; sizes[j] != 0 && sizes[j] <= maxleaves; j++) {
+			numleaves = sizes[j];
+			if((str = bench_build(i, numleaves, &n)) == NULL) {
+				fprintf(stderr, "out of memory\n");
+				return 1;
+			}
+			start = bench_clock();
+			pbg_parse_n(&e, &err, str, n);
+			parse = bench_clock() - start;
+			free(str);
+			if(pbg_iserror(&err)) {
+				pbg_error_print(&err);
+				pbg_error_free(&err);
+				return 1;
+			}
+			/* Unresolved variables are NULL, so every leaf is evaluated. */
+			vars = calloc(pbg_numvars(&e) + 1, sizeof(pbg_field));
+			start = bench_clock();
+			result = pbg_evaluate_vars(&e, &err, vars);
+			eval = bench_clock() - start;
+			free(vars);
+			start = bench_clock();
+			pbg_free(&e);
+			freed = bench_clock() - start;
+			if(pbg_iserror(&err) || result != PBG_TRUE) {
+				fprintf(stderr, "unexpected result\n");
+				pbg_error_free(&err);
+				return 1;
+			}
+			printf("  %-9s  %9ld  %10.3f  %10.3f  %10.3f  %8.1f\n", 
+					bench_shapes[i], numleaves, parse, eval, freed,
+					(parse + eval + freed) * 1e9 / numleaves);
+		}
+	}
+	return 0;
+}
+
+/* Reports the throughput of leaf-heavy rules on a single thread, with and
+ * without fused comparisons of variables to constants. */
+int bench_leaves(long numrecords)
+{
+	double fused, generic;
+	long numtrue, check;
+	int i;
+	printf("fused comparisons: %ld records, 1 thread\n", numrecords);
+	for(i = 0; bench_rules[i] != NULL; i += 2) {
+		fused = bench_rule(bench_rules[i], numrecords, &numtrue);
+		generic = bench_rule(bench_rules[i+1], numrecords, &check);
+		if(fused < 0 || generic < 0 || numtrue != check) {
+			fprintf(stderr, "unexpected result\n");
+			return 1;
+		}
+		printf("%s\n", bench_rules[i]);
+		printf("  fused %13.0f records/s, generic %13.0f records/s, "
+				"speedup %.2f, matches %ld\n", numrecords / fused, 
+				numrecords / generic, generic / fused, numtrue);
+	}
+	return 0;
+}
+
+
+/***********
+ *         *
+ * HELPERS *
+ *         *
+ ***********/
+
+/* Monotonic time in seconds. */
+double bench_clock(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Fills the columns with pseudo-random records. Returns 0 if out of memory. */
+int bench_columns(long numrecords)
+{
+	static char* strings[] = { "alpha", "beta", "gamma", "delta" };
+	unsigned long seed;
+	long i;
+	int j;
+	for(j = 0; j < BENCH_NUMCOLS; j++)
+		if((bench_cols[j] = malloc(numrecords * sizeof(pbg_field))) == NULL)
+			return 0;
+	bench_numbers = malloc(numrecords * sizeof(pbg_lt_number));
+	bench_dates = malloc(numrecords * sizeof(pbg_lt_date));
+	if(bench_numbers == NULL || bench_dates == NULL)
+		return 0;
+	seed = 12345;
+	for(i = 0; i < numrecords; i++) {
+		seed = seed * 1103515245UL + 12345UL;
+		bench_cols[0][i] = pbg_init_number(bench_numbers+i, (seed >> 8) % 1000);
+		bench_cols[1][i] = (i % 17 == 0) ? pbg_make_null() :
+				pbg_init_string(strings[(seed >> 4) & 3],
+				strlen(strings[(seed >> 4) & 3]));
+		bench_cols[2][i] = pbg_init_date(bench_dates+i, 2018,
+				1 + (seed >> 12) % 12, 1 + (seed >> 16) % 28);
+	}
+	return 1;
+}
+
+/* Builds an expression of numleaves leaves which evaluates to TRUE only 
+ * after visiting every leaf. Shape 0 is a single OR of FALSE leaves, shape 1
+ * nests an OR in each level, and shape 2 is a single OR testing distinct 
+ * variables. Returns NULL if out of memory. */
+char* bench_build(int shape, long numleaves, size_t* n)
+{
+	char* str, *end;
+	long i;
+	str = malloc(numleaves * 24 + 32);
+	if(str == NULL)
+		return NULL;
+	end = str;
+	if(shape != 1)
+		end += sprintf(end, "(|");
+	for(i = 1; i < numleaves; i++) {
+		if(shape == 0)
+			end += sprintf(end, " FALSE");
+		else if(shape == 1)
+			end += sprintf(end, "(| FALSE ");
+		else
+			end += sprintf(end, " (? [v%ld])", i);
+	}
+	end += sprintf(end, shape == 1 ? "TRUE" : " TRUE)");
+	for(i = 1; shape == 1 && i < numleaves; i++)
+		*end++ = ')';
+	*end = '\0';
+	*n = end - str;
+	return str;
+}
+
+/* Evaluates a rule over every record with pbg_evaluate_vars, binding the
+ * variables named after constants once. Returns the time taken in seconds, or
+ * -1 if an error occurred. */
+double bench_rule(char* rule, long numrecords, long* numtrue)
+{
+	pbg_error err;
+	pbg_expr e;
+	pbg_field vars[16];
+	pbg_lt_number numbers[16];
+	pbg_lt_date dates[16];
+	int cols[16], i, n, year, month, day, result;
+	double start;
+	char* name;
+	long r;
+	pbg_parse(&e, &err, rule);
+	if(pbg_iserror(&err) || pbg_numvars(&e) > 16) {
+		pbg_error_free(&err);
+		return -1;
+	}
+	for(i = 0; i < pbg_numvars(&e); i++) {
+		name = pbg_var_name(&e, i, &n);
+		cols[i] = (name[0] == 'a') ? 0 : (name[0] == 's') ? 1 : 
+				(name[0] == 'd') ? 2 : -1;
+		if(name[0] == '#')
+			vars[i] = pbg_init_number(numbers+i, atof(name+1));
+		else if(name[0] == '$')
+			vars[i] = pbg_init_string(name+1, n-1);
+		else if(name[0] == '@' && sscanf(name+1, "%d-%d-%d", &year, &month, &day) == 3)
+			vars[i] = pbg_init_date(dates+i, year, month, day);
+	}
+	*numtrue = 0;
+	start = bench_clock();
+	for(r = 0; r < numrecords; r++) {
+		for(i = 0; i < pbg_numvars(&e); i++)
+			if(cols[i] >= 0)
+				vars[i] = bench_cols[cols[i]][r];
+		result = pbg_evaluate_vars(&e, &err, vars);
+		if(result == PBG_TRUE) (*numtrue)++;
+		pbg_error_free(&err);
+	}
+	start = bench_clock() - start;
+	pbg_free(&e);
+	return start;
+}
+
+/* Resolves a variable from its column. Fields are read-only, so every thread
+ * shares them. */
+pbg_field bench_resolve(void* ctx, int thread, long record, int var)
+{
+	PBG_UNUSED(thread);
+	return bench_cols[((bench_ctx*) ctx)->_cols[var]][record];
+}
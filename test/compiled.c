@@ -0,0 +1,30236 @@
+/* Generated by test/corpus, see test_compile. */
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_0(pbg_field* v, pbg_error* err);
+int corpus_0_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_0_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_0_names[] = {NULL};
+static int corpus_0_lens[] = {0};
+
+
+int corpus_0(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_0_fail(err, PBG_ERR_NONE, 0, NULL);
+	return PBG_TRUE;
+}
+
+int corpus_0_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_0_names[i], corpus_0_lens[i]);
+	result = corpus_0(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_1(pbg_field* v, pbg_error* err);
+int corpus_1_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_1_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_1_names[] = {NULL};
+static int corpus_1_lens[] = {0};
+
+
+int corpus_1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_1_fail(err, PBG_ERR_NONE, 0, NULL);
+	return PBG_TRUE;
+}
+
+int corpus_1_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_1_names[i], corpus_1_lens[i]);
+	result = corpus_1(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_2(pbg_field* v, pbg_error* err);
+int corpus_2_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_2_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_2_names[] = {NULL};
+static int corpus_2_lens[] = {0};
+
+
+int corpus_2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_2_fail(err, PBG_ERR_NONE, 0, NULL);
+	return PBG_TRUE;
+}
+
+int corpus_2_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_2_names[i], corpus_2_lens[i]);
+	result = corpus_2(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_3(pbg_field* v, pbg_error* err);
+int corpus_3_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_3_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_3_names[] = {NULL};
+static int corpus_3_lens[] = {0};
+
+
+int corpus_3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_3_fail(err, PBG_ERR_NONE, 0, NULL);
+	return PBG_FALSE;
+}
+
+int corpus_3_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_3_names[i], corpus_3_lens[i]);
+	result = corpus_3(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_4(pbg_field* v, pbg_error* err);
+int corpus_4_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_4_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_4_names[] = {NULL};
+static int corpus_4_lens[] = {0};
+
+
+int corpus_4(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_4_fail(err, PBG_ERR_NONE, 0, NULL);
+	return PBG_FALSE;
+}
+
+int corpus_4_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_4_names[i], corpus_4_lens[i]);
+	result = corpus_4(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_5(pbg_field* v, pbg_error* err);
+int corpus_5_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_5_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_5_names[] = {NULL};
+static int corpus_5_lens[] = {0};
+
+
+int corpus_5(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_5_fail(err, PBG_ERR_NONE, 0, NULL);
+	return PBG_FALSE;
+}
+
+int corpus_5_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_5_names[i], corpus_5_lens[i]);
+	result = corpus_5(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_6(pbg_field* v, pbg_error* err);
+int corpus_6_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_6_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_6_names[] = {NULL};
+static int corpus_6_lens[] = {0};
+
+static int corpus_6_f1(pbg_field* v, pbg_error* err);
+
+int corpus_6(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_6_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_6_f1(v, err);
+}
+
+int corpus_6_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_6_names[i], corpus_6_lens[i]);
+	result = corpus_6(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_6_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = PBG_FALSE;
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_7(pbg_field* v, pbg_error* err);
+int corpus_7_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_7_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_7_names[] = {NULL};
+static int corpus_7_lens[] = {0};
+
+static int corpus_7_f1(pbg_field* v, pbg_error* err);
+
+int corpus_7(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_7_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_7_f1(v, err);
+}
+
+int corpus_7_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_7_names[i], corpus_7_lens[i]);
+	result = corpus_7(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_7_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = PBG_TRUE;
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_8(pbg_field* v, pbg_error* err);
+int corpus_8_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_8_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_8_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_8_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_8_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_8_n3 = {10.0};
+static pbg_lt_number corpus_8_n4 = {10.0};
+static pbg_field corpus_8_c[] = {
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_8_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_8_n4},
+};
+
+static char* corpus_8_names[] = {NULL};
+static int corpus_8_lens[] = {0};
+
+static int corpus_8_f1(pbg_field* v, pbg_error* err);
+static int corpus_8_f2(pbg_field* v, pbg_error* err);
+
+int corpus_8(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_8_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_8_f1(v, err);
+}
+
+int corpus_8_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_8_names[i], corpus_8_lens[i]);
+	result = corpus_8(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_8_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_8_f2(v, err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+static int corpus_8_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_8_c[2]);
+	c[1] = (&corpus_8_c[3]);
+	return corpus_8_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_9(pbg_field* v, pbg_error* err);
+int corpus_9_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_9_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_9_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_9_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_9_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_9_n3 = {10.0};
+static pbg_lt_number corpus_9_n4 = {10.0};
+static pbg_field corpus_9_c[] = {
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_9_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_9_n4},
+};
+
+static char* corpus_9_names[] = {NULL};
+static int corpus_9_lens[] = {0};
+
+static int corpus_9_f1(pbg_field* v, pbg_error* err);
+static int corpus_9_f2(pbg_field* v, pbg_error* err);
+
+int corpus_9(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_9_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_9_f1(v, err);
+}
+
+int corpus_9_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_9_names[i], corpus_9_lens[i]);
+	result = corpus_9(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_9_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_9_f2(v, err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+static int corpus_9_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_9_c[2]);
+	c[1] = (&corpus_9_c[3]);
+	return corpus_9_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_10(pbg_field* v, pbg_error* err);
+int corpus_10_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_10_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_10_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_10_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_10_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_10_n3 = {9.0};
+static pbg_lt_number corpus_10_n4 = {10.0};
+static pbg_field corpus_10_c[] = {
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_10_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_10_n4},
+};
+
+static char* corpus_10_names[] = {NULL};
+static int corpus_10_lens[] = {0};
+
+static int corpus_10_f1(pbg_field* v, pbg_error* err);
+static int corpus_10_f2(pbg_field* v, pbg_error* err);
+
+int corpus_10(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_10_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_10_f1(v, err);
+}
+
+int corpus_10_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_10_names[i], corpus_10_lens[i]);
+	result = corpus_10(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_10_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_10_f2(v, err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+static int corpus_10_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_10_c[2]);
+	c[1] = (&corpus_10_c[3]);
+	return corpus_10_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_11(pbg_field* v, pbg_error* err);
+int corpus_11_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_11_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_11_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_11_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_11_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_11_n4 = {9.0};
+static pbg_lt_number corpus_11_n5 = {10.0};
+static pbg_field corpus_11_c[] = {
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_11_n4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_11_n5},
+};
+
+static char* corpus_11_names[] = {NULL};
+static int corpus_11_lens[] = {0};
+
+static int corpus_11_f1(pbg_field* v, pbg_error* err);
+static int corpus_11_f2(pbg_field* v, pbg_error* err);
+static int corpus_11_f3(pbg_field* v, pbg_error* err);
+
+int corpus_11(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_11_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_11_f1(v, err);
+}
+
+int corpus_11_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_11_names[i], corpus_11_lens[i]);
+	result = corpus_11(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_11_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_11_f2(v, err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+static int corpus_11_f2(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_11_f3(v, err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+static int corpus_11_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_11_c[3]);
+	c[1] = (&corpus_11_c[4]);
+	return corpus_11_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_12(pbg_field* v, pbg_error* err);
+int corpus_12_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_12_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_12_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_12_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_12_names[] = {"1", NULL};
+static int corpus_12_lens[] = {1, 0};
+
+static int corpus_12_f1(pbg_field* v, pbg_error* err);
+
+int corpus_12(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_12_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_12_f1(v, err);
+}
+
+int corpus_12_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_12_names[i], corpus_12_lens[i]);
+	result = corpus_12(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_12_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_12_bool((v + 0), err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_13(pbg_field* v, pbg_error* err);
+int corpus_13_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_13_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_13_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_13_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_13_names[] = {"0", NULL};
+static int corpus_13_lens[] = {1, 0};
+
+static int corpus_13_f1(pbg_field* v, pbg_error* err);
+
+int corpus_13(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_13_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_13_f1(v, err);
+}
+
+int corpus_13_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_13_names[i], corpus_13_lens[i]);
+	result = corpus_13(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_13_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_13_bool((v + 0), err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_14(pbg_field* v, pbg_error* err);
+int corpus_14_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_14_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_14_names[] = {NULL};
+static int corpus_14_lens[] = {0};
+
+static int corpus_14_f1(pbg_field* v, pbg_error* err);
+
+int corpus_14(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_14_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_14_f1(v, err);
+}
+
+int corpus_14_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_14_names[i], corpus_14_lens[i]);
+	result = corpus_14(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_14_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_15(pbg_field* v, pbg_error* err);
+int corpus_15_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_15_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_15_names[] = {NULL};
+static int corpus_15_lens[] = {0};
+
+static int corpus_15_f1(pbg_field* v, pbg_error* err);
+
+int corpus_15(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_15_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_15_f1(v, err);
+}
+
+int corpus_15_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_15_names[i], corpus_15_lens[i]);
+	result = corpus_15(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_15_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	r = PBG_FALSE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_16(pbg_field* v, pbg_error* err);
+int corpus_16_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_16_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_16_names[] = {NULL};
+static int corpus_16_lens[] = {0};
+
+static int corpus_16_f1(pbg_field* v, pbg_error* err);
+
+int corpus_16(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_16_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_16_f1(v, err);
+}
+
+int corpus_16_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_16_names[i], corpus_16_lens[i]);
+	result = corpus_16(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_16_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_TRUE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_17(pbg_field* v, pbg_error* err);
+int corpus_17_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_17_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_17_names[] = {NULL};
+static int corpus_17_lens[] = {0};
+
+static int corpus_17_f1(pbg_field* v, pbg_error* err);
+
+int corpus_17(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_17_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_17_f1(v, err);
+}
+
+int corpus_17_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_17_names[i], corpus_17_lens[i]);
+	result = corpus_17(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_17_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_TRUE) return r;
+	r = PBG_FALSE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_18(pbg_field* v, pbg_error* err);
+int corpus_18_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_18_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_18_names[] = {NULL};
+static int corpus_18_lens[] = {0};
+
+static int corpus_18_f1(pbg_field* v, pbg_error* err);
+
+int corpus_18(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_18_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_18_f1(v, err);
+}
+
+int corpus_18_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_18_names[i], corpus_18_lens[i]);
+	result = corpus_18(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_18_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_19(pbg_field* v, pbg_error* err);
+int corpus_19_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_19_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_19_names[] = {NULL};
+static int corpus_19_lens[] = {0};
+
+static int corpus_19_f1(pbg_field* v, pbg_error* err);
+
+int corpus_19(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_19_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_19_f1(v, err);
+}
+
+int corpus_19_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_19_names[i], corpus_19_lens[i]);
+	result = corpus_19(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_19_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	if((r = PBG_TRUE) != PBG_TRUE) return r;
+	if((r = PBG_FALSE) != PBG_TRUE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_20(pbg_field* v, pbg_error* err);
+int corpus_20_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_20_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_20_names[] = {NULL};
+static int corpus_20_lens[] = {0};
+
+static int corpus_20_f1(pbg_field* v, pbg_error* err);
+static int corpus_20_f2(pbg_field* v, pbg_error* err);
+
+int corpus_20(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_20_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_20_f1(v, err);
+}
+
+int corpus_20_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_20_names[i], corpus_20_lens[i]);
+	result = corpus_20(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_20_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_20_f2(v, err)) != PBG_TRUE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+static int corpus_20_f2(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_TRUE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_21(pbg_field* v, pbg_error* err);
+int corpus_21_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_21_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_21_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_21_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_21_names[] = {"1", NULL};
+static int corpus_21_lens[] = {1, 0};
+
+static int corpus_21_f1(pbg_field* v, pbg_error* err);
+
+int corpus_21(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_21_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_21_f1(v, err);
+}
+
+int corpus_21_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_21_names[i], corpus_21_lens[i]);
+	result = corpus_21(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_21_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_21_bool((v + 0), err)) != PBG_TRUE) return r;
+	r = corpus_21_bool((v + 0), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_22(pbg_field* v, pbg_error* err);
+int corpus_22_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_22_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_22_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_22_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_22_names[] = {"0", "1", NULL};
+static int corpus_22_lens[] = {1, 1, 0};
+
+static int corpus_22_f1(pbg_field* v, pbg_error* err);
+
+int corpus_22(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_22_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_22_f1(v, err);
+}
+
+int corpus_22_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_22_names[i], corpus_22_lens[i]);
+	result = corpus_22(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_22_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_22_bool((v + 0), err)) != PBG_TRUE) return r;
+	r = corpus_22_bool((v + 1), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_23(pbg_field* v, pbg_error* err);
+int corpus_23_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_23_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_23_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_23_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_23_names[] = {"1", "0", NULL};
+static int corpus_23_lens[] = {1, 1, 0};
+
+static int corpus_23_f1(pbg_field* v, pbg_error* err);
+
+int corpus_23(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_23_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_23_f1(v, err);
+}
+
+int corpus_23_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_23_names[i], corpus_23_lens[i]);
+	result = corpus_23(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_23_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_23_bool((v + 0), err)) != PBG_TRUE) return r;
+	r = corpus_23_bool((v + 1), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_24(pbg_field* v, pbg_error* err);
+int corpus_24_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_24_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_24_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_24_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_24_names[] = {"0", NULL};
+static int corpus_24_lens[] = {1, 0};
+
+static int corpus_24_f1(pbg_field* v, pbg_error* err);
+
+int corpus_24(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_24_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_24_f1(v, err);
+}
+
+int corpus_24_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_24_names[i], corpus_24_lens[i]);
+	result = corpus_24(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_24_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_24_bool((v + 0), err)) != PBG_TRUE) return r;
+	r = corpus_24_bool((v + 0), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_25(pbg_field* v, pbg_error* err);
+int corpus_25_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_25_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_25_names[] = {NULL};
+static int corpus_25_lens[] = {0};
+
+static int corpus_25_f1(pbg_field* v, pbg_error* err);
+
+int corpus_25(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_25_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_25_f1(v, err);
+}
+
+int corpus_25_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_25_names[i], corpus_25_lens[i]);
+	result = corpus_25(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_25_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_FALSE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_26(pbg_field* v, pbg_error* err);
+int corpus_26_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_26_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_26_names[] = {NULL};
+static int corpus_26_lens[] = {0};
+
+static int corpus_26_f1(pbg_field* v, pbg_error* err);
+
+int corpus_26(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_26_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_26_f1(v, err);
+}
+
+int corpus_26_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_26_names[i], corpus_26_lens[i]);
+	result = corpus_26(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_26_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_FALSE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_27(pbg_field* v, pbg_error* err);
+int corpus_27_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_27_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_27_names[] = {NULL};
+static int corpus_27_lens[] = {0};
+
+static int corpus_27_f1(pbg_field* v, pbg_error* err);
+
+int corpus_27(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_27_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_27_f1(v, err);
+}
+
+int corpus_27_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_27_names[i], corpus_27_lens[i]);
+	result = corpus_27(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_27_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_FALSE) return r;
+	r = PBG_FALSE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_28(pbg_field* v, pbg_error* err);
+int corpus_28_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_28_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_28_names[] = {NULL};
+static int corpus_28_lens[] = {0};
+
+static int corpus_28_f1(pbg_field* v, pbg_error* err);
+
+int corpus_28(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_28_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_28_f1(v, err);
+}
+
+int corpus_28_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_28_names[i], corpus_28_lens[i]);
+	result = corpus_28(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_28_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_29(pbg_field* v, pbg_error* err);
+int corpus_29_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_29_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_29_names[] = {NULL};
+static int corpus_29_lens[] = {0};
+
+static int corpus_29_f1(pbg_field* v, pbg_error* err);
+
+int corpus_29(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_29_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_29_f1(v, err);
+}
+
+int corpus_29_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_29_names[i], corpus_29_lens[i]);
+	result = corpus_29(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_29_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = PBG_FALSE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_30(pbg_field* v, pbg_error* err);
+int corpus_30_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_30_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_30_names[] = {NULL};
+static int corpus_30_lens[] = {0};
+
+static int corpus_30_f1(pbg_field* v, pbg_error* err);
+
+int corpus_30(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_30_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_30_f1(v, err);
+}
+
+int corpus_30_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_30_names[i], corpus_30_lens[i]);
+	result = corpus_30(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_30_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = PBG_FALSE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_31(pbg_field* v, pbg_error* err);
+int corpus_31_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_31_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_31_names[] = {NULL};
+static int corpus_31_lens[] = {0};
+
+static int corpus_31_f1(pbg_field* v, pbg_error* err);
+
+int corpus_31(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_31_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_31_f1(v, err);
+}
+
+int corpus_31_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_31_names[i], corpus_31_lens[i]);
+	result = corpus_31(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_31_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	if((r = PBG_TRUE) != PBG_FALSE) return r;
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = PBG_FALSE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_32(pbg_field* v, pbg_error* err);
+int corpus_32_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_32_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_32_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_32_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_32_names[] = {"1", NULL};
+static int corpus_32_lens[] = {1, 0};
+
+static int corpus_32_f1(pbg_field* v, pbg_error* err);
+
+int corpus_32(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_32_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_32_f1(v, err);
+}
+
+int corpus_32_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_32_names[i], corpus_32_lens[i]);
+	result = corpus_32(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_32_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_32_bool((v + 0), err)) != PBG_FALSE) return r;
+	r = corpus_32_bool((v + 0), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_33(pbg_field* v, pbg_error* err);
+int corpus_33_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_33_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_33_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_33_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_33_names[] = {"0", "1", NULL};
+static int corpus_33_lens[] = {1, 1, 0};
+
+static int corpus_33_f1(pbg_field* v, pbg_error* err);
+
+int corpus_33(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_33_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_33_f1(v, err);
+}
+
+int corpus_33_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_33_names[i], corpus_33_lens[i]);
+	result = corpus_33(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_33_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_33_bool((v + 0), err)) != PBG_FALSE) return r;
+	r = corpus_33_bool((v + 1), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_34(pbg_field* v, pbg_error* err);
+int corpus_34_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_34_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_34_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_34_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_34_names[] = {"1", "0", NULL};
+static int corpus_34_lens[] = {1, 1, 0};
+
+static int corpus_34_f1(pbg_field* v, pbg_error* err);
+
+int corpus_34(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_34_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_34_f1(v, err);
+}
+
+int corpus_34_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_34_names[i], corpus_34_lens[i]);
+	result = corpus_34(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_34_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_34_bool((v + 0), err)) != PBG_FALSE) return r;
+	r = corpus_34_bool((v + 1), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_35(pbg_field* v, pbg_error* err);
+int corpus_35_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_35_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_35_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_35_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char* corpus_35_names[] = {"0", NULL};
+static int corpus_35_lens[] = {1, 0};
+
+static int corpus_35_f1(pbg_field* v, pbg_error* err);
+
+int corpus_35(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_35_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_35_f1(v, err);
+}
+
+int corpus_35_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_35_names[i], corpus_35_lens[i]);
+	result = corpus_35(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_35_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_35_bool((v + 0), err)) != PBG_FALSE) return r;
+	r = corpus_35_bool((v + 0), err);
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_36(pbg_field* v, pbg_error* err);
+int corpus_36_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_36_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_36_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_36_names[] = {"c", NULL};
+static int corpus_36_lens[] = {1, 0};
+
+static int corpus_36_f1(pbg_field* v, pbg_error* err);
+
+int corpus_36(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_36_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_36_f1(v, err);
+}
+
+int corpus_36_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_36_names[i], corpus_36_lens[i]);
+	result = corpus_36(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_36_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_36_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_37(pbg_field* v, pbg_error* err);
+int corpus_37_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_37_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_37_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_37_names[] = {"d", NULL};
+static int corpus_37_lens[] = {1, 0};
+
+static int corpus_37_f1(pbg_field* v, pbg_error* err);
+
+int corpus_37(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_37_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_37_f1(v, err);
+}
+
+int corpus_37_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_37_names[i], corpus_37_lens[i]);
+	result = corpus_37(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_37_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_37_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_38(pbg_field* v, pbg_error* err);
+int corpus_38_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_38_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_38_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_38_names[] = {"c", NULL};
+static int corpus_38_lens[] = {1, 0};
+
+static int corpus_38_f1(pbg_field* v, pbg_error* err);
+
+int corpus_38(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_38_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_38_f1(v, err);
+}
+
+int corpus_38_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_38_names[i], corpus_38_lens[i]);
+	result = corpus_38(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_38_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (v + 0);
+	return corpus_38_exst(c, 2);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_39(pbg_field* v, pbg_error* err);
+int corpus_39_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_39_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_39_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_39_names[] = {"a", "c", NULL};
+static int corpus_39_lens[] = {1, 1, 0};
+
+static int corpus_39_f1(pbg_field* v, pbg_error* err);
+
+int corpus_39(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_39_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_39_f1(v, err);
+}
+
+int corpus_39_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_39_names[i], corpus_39_lens[i]);
+	result = corpus_39(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_39_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	c[2] = (v + 1);
+	return corpus_39_exst(c, 3);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_40(pbg_field* v, pbg_error* err);
+int corpus_40_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_40_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_40_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_40_names[] = {"a", "c", "d", NULL};
+static int corpus_40_lens[] = {1, 1, 1, 0};
+
+static int corpus_40_f1(pbg_field* v, pbg_error* err);
+
+int corpus_40(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_40_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_40_f1(v, err);
+}
+
+int corpus_40_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_40_names[i], corpus_40_lens[i]);
+	result = corpus_40(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_40_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	c[2] = (v + 2);
+	return corpus_40_exst(c, 3);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_41(pbg_field* v, pbg_error* err);
+int corpus_41_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_41_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_41_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_41_names[] = {"a", "d", "c", NULL};
+static int corpus_41_lens[] = {1, 1, 1, 0};
+
+static int corpus_41_f1(pbg_field* v, pbg_error* err);
+
+int corpus_41(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_41_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_41_f1(v, err);
+}
+
+int corpus_41_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_41_names[i], corpus_41_lens[i]);
+	result = corpus_41(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_41_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	c[2] = (v + 2);
+	return corpus_41_exst(c, 3);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_42(pbg_field* v, pbg_error* err);
+int corpus_42_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_42_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_42_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_42_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_42_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_42_n2 = {10.0};
+static pbg_lt_number corpus_42_n3 = {10.0};
+static pbg_field corpus_42_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_42_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_42_n3},
+};
+
+static char* corpus_42_names[] = {NULL};
+static int corpus_42_lens[] = {0};
+
+static int corpus_42_f1(pbg_field* v, pbg_error* err);
+
+int corpus_42(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_42_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_42_f1(v, err);
+}
+
+int corpus_42_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_42_names[i], corpus_42_lens[i]);
+	result = corpus_42(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_42_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_42_c[1]);
+	c[1] = (&corpus_42_c[2]);
+	return corpus_42_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_43(pbg_field* v, pbg_error* err);
+int corpus_43_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_43_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_43_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_43_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_43_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_43_n2 = {10.0};
+static pbg_lt_number corpus_43_n3 = {10.0};
+static pbg_lt_number corpus_43_n4 = {10.0};
+static pbg_lt_number corpus_43_n5 = {10.0};
+static pbg_lt_number corpus_43_n6 = {10.0};
+static pbg_field corpus_43_c[] = {
+	{PBG_OP_EQ, 5, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_43_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_43_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_43_n4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_43_n5},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_43_n6},
+};
+
+static char* corpus_43_names[] = {NULL};
+static int corpus_43_lens[] = {0};
+
+static int corpus_43_f1(pbg_field* v, pbg_error* err);
+
+int corpus_43(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_43_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_43_f1(v, err);
+}
+
+int corpus_43_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_43_names[i], corpus_43_lens[i]);
+	result = corpus_43(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_43_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_43_c[1]);
+	c[1] = (&corpus_43_c[2]);
+	c[2] = (&corpus_43_c[3]);
+	c[3] = (&corpus_43_c[4]);
+	c[4] = (&corpus_43_c[5]);
+	return corpus_43_eq(c, 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_44(pbg_field* v, pbg_error* err);
+int corpus_44_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_44_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_44_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_44_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_44_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_44_n2 = {10.0};
+static pbg_lt_number corpus_44_n3 = {10.0};
+static pbg_lt_number corpus_44_n4 = {10.0};
+static pbg_lt_number corpus_44_n5 = {9.0};
+static pbg_lt_number corpus_44_n6 = {10.0};
+static pbg_field corpus_44_c[] = {
+	{PBG_OP_EQ, 5, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_44_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_44_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_44_n4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_44_n5},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_44_n6},
+};
+
+static char* corpus_44_names[] = {NULL};
+static int corpus_44_lens[] = {0};
+
+static int corpus_44_f1(pbg_field* v, pbg_error* err);
+
+int corpus_44(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_44_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_44_f1(v, err);
+}
+
+int corpus_44_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_44_names[i], corpus_44_lens[i]);
+	result = corpus_44(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_44_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_44_c[1]);
+	c[1] = (&corpus_44_c[2]);
+	c[2] = (&corpus_44_c[3]);
+	c[3] = (&corpus_44_c[4]);
+	c[4] = (&corpus_44_c[5]);
+	return corpus_44_eq(c, 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_45(pbg_field* v, pbg_error* err);
+int corpus_45_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_45_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_45_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_45_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_45_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_45_n2 = {9.0};
+static pbg_lt_number corpus_45_n3 = {10.0};
+static pbg_field corpus_45_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_45_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_45_n3},
+};
+
+static char* corpus_45_names[] = {NULL};
+static int corpus_45_lens[] = {0};
+
+static int corpus_45_f1(pbg_field* v, pbg_error* err);
+
+int corpus_45(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_45_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_45_f1(v, err);
+}
+
+int corpus_45_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_45_names[i], corpus_45_lens[i]);
+	result = corpus_45(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_45_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_45_c[1]);
+	c[1] = (&corpus_45_c[2]);
+	return corpus_45_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_46(pbg_field* v, pbg_error* err);
+int corpus_46_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_46_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_46_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_46_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_46_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_46_n2 = {10.0};
+static pbg_lt_number corpus_46_n3 = {9.0};
+static pbg_field corpus_46_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_46_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_46_n3},
+};
+
+static char* corpus_46_names[] = {NULL};
+static int corpus_46_lens[] = {0};
+
+static int corpus_46_f1(pbg_field* v, pbg_error* err);
+
+int corpus_46(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_46_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_46_f1(v, err);
+}
+
+int corpus_46_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_46_names[i], corpus_46_lens[i]);
+	result = corpus_46(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_46_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_46_c[1]);
+	c[1] = (&corpus_46_c[2]);
+	return corpus_46_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_47(pbg_field* v, pbg_error* err);
+int corpus_47_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_47_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_47_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_47_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_47_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_47_s2[] = "hi";
+static pbg_lt_number corpus_47_n3 = {9.0};
+static pbg_field corpus_47_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_47_s2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_47_n3},
+};
+
+static char* corpus_47_names[] = {NULL};
+static int corpus_47_lens[] = {0};
+
+static int corpus_47_f1(pbg_field* v, pbg_error* err);
+
+int corpus_47(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_47_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_47_f1(v, err);
+}
+
+int corpus_47_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_47_names[i], corpus_47_lens[i]);
+	result = corpus_47(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_47_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_47_c[1]);
+	c[1] = (&corpus_47_c[2]);
+	return corpus_47_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_48(pbg_field* v, pbg_error* err);
+int corpus_48_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_48_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_48_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_48_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_48_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_48_n2 = {-10.0};
+static char corpus_48_s3[] = "hi";
+static pbg_field corpus_48_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_48_n2},
+	{PBG_LT_STRING, 2, corpus_48_s3},
+};
+
+static char* corpus_48_names[] = {NULL};
+static int corpus_48_lens[] = {0};
+
+static int corpus_48_f1(pbg_field* v, pbg_error* err);
+
+int corpus_48(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_48_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_48_f1(v, err);
+}
+
+int corpus_48_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_48_names[i], corpus_48_lens[i]);
+	result = corpus_48(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_48_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_48_c[1]);
+	c[1] = (&corpus_48_c[2]);
+	return corpus_48_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_49(pbg_field* v, pbg_error* err);
+int corpus_49_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_49_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_49_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_49_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_49_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_49_n2 = {-10.0};
+static pbg_lt_number corpus_49_n3 = {-10.0};
+static pbg_field corpus_49_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_49_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_49_n3},
+};
+
+static char* corpus_49_names[] = {NULL};
+static int corpus_49_lens[] = {0};
+
+static int corpus_49_f1(pbg_field* v, pbg_error* err);
+
+int corpus_49(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_49_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_49_f1(v, err);
+}
+
+int corpus_49_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_49_names[i], corpus_49_lens[i]);
+	result = corpus_49(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_49_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_49_c[1]);
+	c[1] = (&corpus_49_c[2]);
+	return corpus_49_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_50(pbg_field* v, pbg_error* err);
+int corpus_50_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_50_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_50_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_50_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_50_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_50_s2[] = "hi";
+static char corpus_50_s3[] = "hi";
+static pbg_field corpus_50_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_50_s2},
+	{PBG_LT_STRING, 2, corpus_50_s3},
+};
+
+static char* corpus_50_names[] = {NULL};
+static int corpus_50_lens[] = {0};
+
+static int corpus_50_f1(pbg_field* v, pbg_error* err);
+
+int corpus_50(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_50_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_50_f1(v, err);
+}
+
+int corpus_50_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_50_names[i], corpus_50_lens[i]);
+	result = corpus_50(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_50_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_50_c[1]);
+	c[1] = (&corpus_50_c[2]);
+	return corpus_50_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_51(pbg_field* v, pbg_error* err);
+int corpus_51_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_51_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_51_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_51_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_51_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_51_s2[] = "a, b\134'c";
+static char corpus_51_s3[] = "a, b\134'c";
+static pbg_field corpus_51_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 7, corpus_51_s2},
+	{PBG_LT_STRING, 7, corpus_51_s3},
+};
+
+static char* corpus_51_names[] = {NULL};
+static int corpus_51_lens[] = {0};
+
+static int corpus_51_f1(pbg_field* v, pbg_error* err);
+
+int corpus_51(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_51_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_51_f1(v, err);
+}
+
+int corpus_51_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_51_names[i], corpus_51_lens[i]);
+	result = corpus_51(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_51_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_51_c[1]);
+	c[1] = (&corpus_51_c[2]);
+	return corpus_51_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_52(pbg_field* v, pbg_error* err);
+int corpus_52_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_52_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_52_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_52_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_52_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_52_s2[] = "ab\134'c";
+static char corpus_52_s3[] = "ab\134'd";
+static pbg_field corpus_52_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 5, corpus_52_s2},
+	{PBG_LT_STRING, 5, corpus_52_s3},
+};
+
+static char* corpus_52_names[] = {NULL};
+static int corpus_52_lens[] = {0};
+
+static int corpus_52_f1(pbg_field* v, pbg_error* err);
+
+int corpus_52(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_52_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_52_f1(v, err);
+}
+
+int corpus_52_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_52_names[i], corpus_52_lens[i]);
+	result = corpus_52(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_52_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_52_c[1]);
+	c[1] = (&corpus_52_c[2]);
+	return corpus_52_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_53(pbg_field* v, pbg_error* err);
+int corpus_53_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_53_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_53_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_53_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_53_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_53_s2[] = "hia";
+static char corpus_53_s3[] = "hi";
+static pbg_field corpus_53_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_53_s2},
+	{PBG_LT_STRING, 2, corpus_53_s3},
+};
+
+static char* corpus_53_names[] = {NULL};
+static int corpus_53_lens[] = {0};
+
+static int corpus_53_f1(pbg_field* v, pbg_error* err);
+
+int corpus_53(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_53_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_53_f1(v, err);
+}
+
+int corpus_53_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_53_names[i], corpus_53_lens[i]);
+	result = corpus_53(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_53_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_53_c[1]);
+	c[1] = (&corpus_53_c[2]);
+	return corpus_53_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_54(pbg_field* v, pbg_error* err);
+int corpus_54_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_54_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_54_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_54_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_54_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_54_s2[] = "hi";
+static char corpus_54_s3[] = "h ";
+static pbg_field corpus_54_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_54_s2},
+	{PBG_LT_STRING, 2, corpus_54_s3},
+};
+
+static char* corpus_54_names[] = {NULL};
+static int corpus_54_lens[] = {0};
+
+static int corpus_54_f1(pbg_field* v, pbg_error* err);
+
+int corpus_54(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_54_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_54_f1(v, err);
+}
+
+int corpus_54_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_54_names[i], corpus_54_lens[i]);
+	result = corpus_54(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_54_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_54_c[1]);
+	c[1] = (&corpus_54_c[2]);
+	return corpus_54_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_55(pbg_field* v, pbg_error* err);
+int corpus_55_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_55_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_55_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_55_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_55_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_55_d2 = {2018, 10, 12};
+static char corpus_55_s3[] = "h ";
+static pbg_field corpus_55_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_55_d2},
+	{PBG_LT_STRING, 2, corpus_55_s3},
+};
+
+static char* corpus_55_names[] = {NULL};
+static int corpus_55_lens[] = {0};
+
+static int corpus_55_f1(pbg_field* v, pbg_error* err);
+
+int corpus_55(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_55_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_55_f1(v, err);
+}
+
+int corpus_55_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_55_names[i], corpus_55_lens[i]);
+	result = corpus_55(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_55_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_55_c[1]);
+	c[1] = (&corpus_55_c[2]);
+	return corpus_55_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_56(pbg_field* v, pbg_error* err);
+int corpus_56_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_56_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_56_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_56_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_56_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_56_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_56_d3 = {2018, 10, 12};
+static pbg_field corpus_56_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_56_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_56_d3},
+};
+
+static char* corpus_56_names[] = {NULL};
+static int corpus_56_lens[] = {0};
+
+static int corpus_56_f1(pbg_field* v, pbg_error* err);
+
+int corpus_56(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_56_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_56_f1(v, err);
+}
+
+int corpus_56_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_56_names[i], corpus_56_lens[i]);
+	result = corpus_56(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_56_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_56_c[1]);
+	c[1] = (&corpus_56_c[2]);
+	return corpus_56_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_57(pbg_field* v, pbg_error* err);
+int corpus_57_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_57_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_57_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_57_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_57_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_57_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_57_d3 = {2018, 10, 13};
+static pbg_field corpus_57_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_57_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_57_d3},
+};
+
+static char* corpus_57_names[] = {NULL};
+static int corpus_57_lens[] = {0};
+
+static int corpus_57_f1(pbg_field* v, pbg_error* err);
+
+int corpus_57(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_57_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_57_f1(v, err);
+}
+
+int corpus_57_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_57_names[i], corpus_57_lens[i]);
+	result = corpus_57(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_57_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_57_c[1]);
+	c[1] = (&corpus_57_c[2]);
+	return corpus_57_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_58(pbg_field* v, pbg_error* err);
+int corpus_58_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_58_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_58_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_58_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_58_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_58_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_58_d3 = {2018, 10, 12};
+static pbg_field corpus_58_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_58_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_58_d3},
+};
+
+static char* corpus_58_names[] = {NULL};
+static int corpus_58_lens[] = {0};
+
+static int corpus_58_f1(pbg_field* v, pbg_error* err);
+
+int corpus_58(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_58_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_58_f1(v, err);
+}
+
+int corpus_58_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_58_names[i], corpus_58_lens[i]);
+	result = corpus_58(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_58_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_58_c[1]);
+	c[1] = (&corpus_58_c[2]);
+	return corpus_58_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_59(pbg_field* v, pbg_error* err);
+int corpus_59_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_59_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_59_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_59_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_59_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_59_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_59_d3 = {2017, 10, 13};
+static pbg_field corpus_59_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_59_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_59_d3},
+};
+
+static char* corpus_59_names[] = {NULL};
+static int corpus_59_lens[] = {0};
+
+static int corpus_59_f1(pbg_field* v, pbg_error* err);
+
+int corpus_59(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_59_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_59_f1(v, err);
+}
+
+int corpus_59_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_59_names[i], corpus_59_lens[i]);
+	result = corpus_59(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_59_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_59_c[1]);
+	c[1] = (&corpus_59_c[2]);
+	return corpus_59_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_60(pbg_field* v, pbg_error* err);
+int corpus_60_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_60_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_60_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_60_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_60_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_60_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_60_d3 = {2018, 11, 13};
+static pbg_field corpus_60_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_60_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_60_d3},
+};
+
+static char* corpus_60_names[] = {NULL};
+static int corpus_60_lens[] = {0};
+
+static int corpus_60_f1(pbg_field* v, pbg_error* err);
+
+int corpus_60(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_60_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_60_f1(v, err);
+}
+
+int corpus_60_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_60_names[i], corpus_60_lens[i]);
+	result = corpus_60(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_60_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_60_c[1]);
+	c[1] = (&corpus_60_c[2]);
+	return corpus_60_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_61(pbg_field* v, pbg_error* err);
+int corpus_61_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_61_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_61_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_61_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_61_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_61_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_61_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_61_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_61_names[] = {"a", NULL};
+static int corpus_61_lens[] = {1, 0};
+
+static int corpus_61_f1(pbg_field* v, pbg_error* err);
+
+int corpus_61(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_61_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_61_f1(v, err);
+}
+
+int corpus_61_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_61_names[i], corpus_61_lens[i]);
+	result = corpus_61(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_61_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_61_isbool((v + 0)->_type)) {
+		first = corpus_61_bool((v + 0), err);
+		if((v + 0)->_type == PBG_NULL) return corpus_61_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_61_bool((v + 0), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 0);
+	return corpus_61_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_62(pbg_field* v, pbg_error* err);
+int corpus_62_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_62_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_62_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_62_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_62_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_62_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_62_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_62_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_62_names[] = {"a", "b", NULL};
+static int corpus_62_lens[] = {1, 1, 0};
+
+static int corpus_62_f1(pbg_field* v, pbg_error* err);
+
+int corpus_62(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_62_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_62_f1(v, err);
+}
+
+int corpus_62_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_62_names[i], corpus_62_lens[i]);
+	result = corpus_62(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_62_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_62_isbool((v + 0)->_type)) {
+		first = corpus_62_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_62_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_62_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_62_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_63(pbg_field* v, pbg_error* err);
+int corpus_63_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_63_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_63_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_63_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_63_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_63_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_63_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_63_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_63_names[] = {"a", "c", NULL};
+static int corpus_63_lens[] = {1, 1, 0};
+
+static int corpus_63_f1(pbg_field* v, pbg_error* err);
+
+int corpus_63(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_63_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_63_f1(v, err);
+}
+
+int corpus_63_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_63_names[i], corpus_63_lens[i]);
+	result = corpus_63(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_63_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_63_isbool((v + 0)->_type)) {
+		first = corpus_63_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_63_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_63_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_63_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_64(pbg_field* v, pbg_error* err);
+int corpus_64_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_64_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_64_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_64_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_64_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_64_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_64_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_64_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_64_names[] = {"c", "b", NULL};
+static int corpus_64_lens[] = {1, 1, 0};
+
+static int corpus_64_f1(pbg_field* v, pbg_error* err);
+
+int corpus_64(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_64_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_64_f1(v, err);
+}
+
+int corpus_64_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_64_names[i], corpus_64_lens[i]);
+	result = corpus_64(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_64_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_64_isbool((v + 0)->_type)) {
+		first = corpus_64_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_64_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_64_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_64_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_65(pbg_field* v, pbg_error* err);
+int corpus_65_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_65_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_65_names[] = {NULL};
+static int corpus_65_lens[] = {0};
+
+static int corpus_65_f1(pbg_field* v, pbg_error* err);
+
+int corpus_65(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_65_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_65_f1(v, err);
+}
+
+int corpus_65_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_65_names[i], corpus_65_lens[i]);
+	result = corpus_65(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_65_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_TRUE;
+	if(PBG_TRUE != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_66(pbg_field* v, pbg_error* err);
+int corpus_66_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_66_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_66_names[] = {NULL};
+static int corpus_66_lens[] = {0};
+
+static int corpus_66_f1(pbg_field* v, pbg_error* err);
+
+int corpus_66(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_66_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_66_f1(v, err);
+}
+
+int corpus_66_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_66_names[i], corpus_66_lens[i]);
+	result = corpus_66(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_66_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_TRUE;
+	if(PBG_FALSE != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_67(pbg_field* v, pbg_error* err);
+int corpus_67_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_67_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_67_names[] = {NULL};
+static int corpus_67_lens[] = {0};
+
+static int corpus_67_f1(pbg_field* v, pbg_error* err);
+
+int corpus_67(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_67_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_67_f1(v, err);
+}
+
+int corpus_67_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_67_names[i], corpus_67_lens[i]);
+	result = corpus_67(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_67_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_FALSE;
+	if(PBG_TRUE != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_68(pbg_field* v, pbg_error* err);
+int corpus_68_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_68_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_68_names[] = {NULL};
+static int corpus_68_lens[] = {0};
+
+static int corpus_68_f1(pbg_field* v, pbg_error* err);
+
+int corpus_68(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_68_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_68_f1(v, err);
+}
+
+int corpus_68_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_68_names[i], corpus_68_lens[i]);
+	result = corpus_68(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_68_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_FALSE;
+	if(PBG_FALSE != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_69(pbg_field* v, pbg_error* err);
+int corpus_69_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_69_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_69_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_69_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_69_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_69_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_69_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_69_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_69_names[] = {"1", NULL};
+static int corpus_69_lens[] = {1, 0};
+
+static int corpus_69_f1(pbg_field* v, pbg_error* err);
+
+int corpus_69(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_69_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_69_f1(v, err);
+}
+
+int corpus_69_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_69_names[i], corpus_69_lens[i]);
+	result = corpus_69(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_69_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_69_isbool((v + 0)->_type)) {
+		first = corpus_69_bool((v + 0), err);
+		if((v + 0)->_type == PBG_NULL) return corpus_69_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_69_bool((v + 0), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 0);
+	return corpus_69_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_70(pbg_field* v, pbg_error* err);
+int corpus_70_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_70_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_70_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_70_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_70_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_70_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_70_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_70_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_70_names[] = {"1", "0", NULL};
+static int corpus_70_lens[] = {1, 1, 0};
+
+static int corpus_70_f1(pbg_field* v, pbg_error* err);
+
+int corpus_70(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_70_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_70_f1(v, err);
+}
+
+int corpus_70_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_70_names[i], corpus_70_lens[i]);
+	result = corpus_70(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_70_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_70_isbool((v + 0)->_type)) {
+		first = corpus_70_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_70_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_70_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_70_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_71(pbg_field* v, pbg_error* err);
+int corpus_71_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_71_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_71_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_71_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_71_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_71_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_71_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_71_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_71_names[] = {"0", "1", NULL};
+static int corpus_71_lens[] = {1, 1, 0};
+
+static int corpus_71_f1(pbg_field* v, pbg_error* err);
+
+int corpus_71(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_71_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_71_f1(v, err);
+}
+
+int corpus_71_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_71_names[i], corpus_71_lens[i]);
+	result = corpus_71(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_71_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_71_isbool((v + 0)->_type)) {
+		first = corpus_71_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_71_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_71_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_71_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_72(pbg_field* v, pbg_error* err);
+int corpus_72_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_72_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_72_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_72_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_72_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_72_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_72_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_72_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_72_names[] = {"0", NULL};
+static int corpus_72_lens[] = {1, 0};
+
+static int corpus_72_f1(pbg_field* v, pbg_error* err);
+
+int corpus_72(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_72_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_72_f1(v, err);
+}
+
+int corpus_72_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_72_names[i], corpus_72_lens[i]);
+	result = corpus_72(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_72_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_72_isbool((v + 0)->_type)) {
+		first = corpus_72_bool((v + 0), err);
+		if((v + 0)->_type == PBG_NULL) return corpus_72_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_72_bool((v + 0), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 0);
+	return corpus_72_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_73(pbg_field* v, pbg_error* err);
+int corpus_73_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_73_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_73_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_73_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_73_n2 = {10.0};
+static pbg_lt_number corpus_73_n3 = {10.0};
+static pbg_field corpus_73_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_73_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_73_n3},
+};
+
+static char* corpus_73_names[] = {NULL};
+static int corpus_73_lens[] = {0};
+
+static int corpus_73_f1(pbg_field* v, pbg_error* err);
+
+int corpus_73(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_73_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_73_f1(v, err);
+}
+
+int corpus_73_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_73_names[i], corpus_73_lens[i]);
+	result = corpus_73(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_73_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_73_neq((&corpus_73_c[1]), (&corpus_73_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_74(pbg_field* v, pbg_error* err);
+int corpus_74_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_74_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_74_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_74_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_74_n2 = {9.0};
+static pbg_lt_number corpus_74_n3 = {10.0};
+static pbg_field corpus_74_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_74_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_74_n3},
+};
+
+static char* corpus_74_names[] = {NULL};
+static int corpus_74_lens[] = {0};
+
+static int corpus_74_f1(pbg_field* v, pbg_error* err);
+
+int corpus_74(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_74_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_74_f1(v, err);
+}
+
+int corpus_74_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_74_names[i], corpus_74_lens[i]);
+	result = corpus_74(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_74_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_74_neq((&corpus_74_c[1]), (&corpus_74_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_75(pbg_field* v, pbg_error* err);
+int corpus_75_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_75_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_75_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_75_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_75_n2 = {10.0};
+static pbg_lt_number corpus_75_n3 = {9.0};
+static pbg_field corpus_75_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_75_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_75_n3},
+};
+
+static char* corpus_75_names[] = {NULL};
+static int corpus_75_lens[] = {0};
+
+static int corpus_75_f1(pbg_field* v, pbg_error* err);
+
+int corpus_75(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_75_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_75_f1(v, err);
+}
+
+int corpus_75_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_75_names[i], corpus_75_lens[i]);
+	result = corpus_75(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_75_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_75_neq((&corpus_75_c[1]), (&corpus_75_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_76(pbg_field* v, pbg_error* err);
+int corpus_76_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_76_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_76_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_76_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_76_s2[] = "hi";
+static pbg_lt_number corpus_76_n3 = {9.0};
+static pbg_field corpus_76_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_76_s2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_76_n3},
+};
+
+static char* corpus_76_names[] = {NULL};
+static int corpus_76_lens[] = {0};
+
+static int corpus_76_f1(pbg_field* v, pbg_error* err);
+
+int corpus_76(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_76_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_76_f1(v, err);
+}
+
+int corpus_76_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_76_names[i], corpus_76_lens[i]);
+	result = corpus_76(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_76_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_76_neq((&corpus_76_c[1]), (&corpus_76_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_77(pbg_field* v, pbg_error* err);
+int corpus_77_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_77_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_77_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_77_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_77_n2 = {-10.0};
+static char corpus_77_s3[] = "hi";
+static pbg_field corpus_77_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_77_n2},
+	{PBG_LT_STRING, 2, corpus_77_s3},
+};
+
+static char* corpus_77_names[] = {NULL};
+static int corpus_77_lens[] = {0};
+
+static int corpus_77_f1(pbg_field* v, pbg_error* err);
+
+int corpus_77(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_77_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_77_f1(v, err);
+}
+
+int corpus_77_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_77_names[i], corpus_77_lens[i]);
+	result = corpus_77(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_77_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_77_neq((&corpus_77_c[1]), (&corpus_77_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_78(pbg_field* v, pbg_error* err);
+int corpus_78_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_78_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_78_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_78_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_78_n2 = {-10.0};
+static pbg_lt_number corpus_78_n3 = {-10.0};
+static pbg_field corpus_78_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_78_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_78_n3},
+};
+
+static char* corpus_78_names[] = {NULL};
+static int corpus_78_lens[] = {0};
+
+static int corpus_78_f1(pbg_field* v, pbg_error* err);
+
+int corpus_78(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_78_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_78_f1(v, err);
+}
+
+int corpus_78_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_78_names[i], corpus_78_lens[i]);
+	result = corpus_78(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_78_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_78_neq((&corpus_78_c[1]), (&corpus_78_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_79(pbg_field* v, pbg_error* err);
+int corpus_79_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_79_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_79_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_79_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_79_s2[] = "hi";
+static char corpus_79_s3[] = "hi";
+static pbg_field corpus_79_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_79_s2},
+	{PBG_LT_STRING, 2, corpus_79_s3},
+};
+
+static char* corpus_79_names[] = {NULL};
+static int corpus_79_lens[] = {0};
+
+static int corpus_79_f1(pbg_field* v, pbg_error* err);
+
+int corpus_79(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_79_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_79_f1(v, err);
+}
+
+int corpus_79_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_79_names[i], corpus_79_lens[i]);
+	result = corpus_79(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_79_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_79_neq((&corpus_79_c[1]), (&corpus_79_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_80(pbg_field* v, pbg_error* err);
+int corpus_80_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_80_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_80_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_80_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_80_s2[] = "a,b\134'c";
+static char corpus_80_s3[] = "a,b\134'c";
+static pbg_field corpus_80_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_STRING, 6, corpus_80_s2},
+	{PBG_LT_STRING, 6, corpus_80_s3},
+};
+
+static char* corpus_80_names[] = {NULL};
+static int corpus_80_lens[] = {0};
+
+static int corpus_80_f1(pbg_field* v, pbg_error* err);
+
+int corpus_80(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_80_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_80_f1(v, err);
+}
+
+int corpus_80_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_80_names[i], corpus_80_lens[i]);
+	result = corpus_80(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_80_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_80_neq((&corpus_80_c[1]), (&corpus_80_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_81(pbg_field* v, pbg_error* err);
+int corpus_81_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_81_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_81_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_81_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_81_s2[] = "ab\134'c";
+static char corpus_81_s3[] = "ab\134'd";
+static pbg_field corpus_81_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_STRING, 5, corpus_81_s2},
+	{PBG_LT_STRING, 5, corpus_81_s3},
+};
+
+static char* corpus_81_names[] = {NULL};
+static int corpus_81_lens[] = {0};
+
+static int corpus_81_f1(pbg_field* v, pbg_error* err);
+
+int corpus_81(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_81_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_81_f1(v, err);
+}
+
+int corpus_81_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_81_names[i], corpus_81_lens[i]);
+	result = corpus_81(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_81_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_81_neq((&corpus_81_c[1]), (&corpus_81_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_82(pbg_field* v, pbg_error* err);
+int corpus_82_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_82_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_82_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_82_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_82_s2[] = "hia";
+static char corpus_82_s3[] = "hi";
+static pbg_field corpus_82_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_82_s2},
+	{PBG_LT_STRING, 2, corpus_82_s3},
+};
+
+static char* corpus_82_names[] = {NULL};
+static int corpus_82_lens[] = {0};
+
+static int corpus_82_f1(pbg_field* v, pbg_error* err);
+
+int corpus_82(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_82_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_82_f1(v, err);
+}
+
+int corpus_82_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_82_names[i], corpus_82_lens[i]);
+	result = corpus_82(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_82_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_82_neq((&corpus_82_c[1]), (&corpus_82_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_83(pbg_field* v, pbg_error* err);
+int corpus_83_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_83_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_83_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_83_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_83_s2[] = "hi";
+static char corpus_83_s3[] = "h ";
+static pbg_field corpus_83_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_83_s2},
+	{PBG_LT_STRING, 2, corpus_83_s3},
+};
+
+static char* corpus_83_names[] = {NULL};
+static int corpus_83_lens[] = {0};
+
+static int corpus_83_f1(pbg_field* v, pbg_error* err);
+
+int corpus_83(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_83_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_83_f1(v, err);
+}
+
+int corpus_83_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_83_names[i], corpus_83_lens[i]);
+	result = corpus_83(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_83_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_83_neq((&corpus_83_c[1]), (&corpus_83_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_84(pbg_field* v, pbg_error* err);
+int corpus_84_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_84_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_84_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_84_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_84_d2 = {2018, 10, 12};
+static char corpus_84_s3[] = "h ";
+static pbg_field corpus_84_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_84_d2},
+	{PBG_LT_STRING, 2, corpus_84_s3},
+};
+
+static char* corpus_84_names[] = {NULL};
+static int corpus_84_lens[] = {0};
+
+static int corpus_84_f1(pbg_field* v, pbg_error* err);
+
+int corpus_84(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_84_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_84_f1(v, err);
+}
+
+int corpus_84_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_84_names[i], corpus_84_lens[i]);
+	result = corpus_84(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_84_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_84_neq((&corpus_84_c[1]), (&corpus_84_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_85(pbg_field* v, pbg_error* err);
+int corpus_85_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_85_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_85_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_85_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_85_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_85_d3 = {2018, 10, 12};
+static pbg_field corpus_85_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_85_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_85_d3},
+};
+
+static char* corpus_85_names[] = {NULL};
+static int corpus_85_lens[] = {0};
+
+static int corpus_85_f1(pbg_field* v, pbg_error* err);
+
+int corpus_85(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_85_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_85_f1(v, err);
+}
+
+int corpus_85_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_85_names[i], corpus_85_lens[i]);
+	result = corpus_85(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_85_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_85_neq((&corpus_85_c[1]), (&corpus_85_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_86(pbg_field* v, pbg_error* err);
+int corpus_86_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_86_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_86_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_86_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_86_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_86_d3 = {2018, 10, 13};
+static pbg_field corpus_86_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_86_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_86_d3},
+};
+
+static char* corpus_86_names[] = {NULL};
+static int corpus_86_lens[] = {0};
+
+static int corpus_86_f1(pbg_field* v, pbg_error* err);
+
+int corpus_86(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_86_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_86_f1(v, err);
+}
+
+int corpus_86_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_86_names[i], corpus_86_lens[i]);
+	result = corpus_86(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_86_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_86_neq((&corpus_86_c[1]), (&corpus_86_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_87(pbg_field* v, pbg_error* err);
+int corpus_87_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_87_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_87_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_87_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_87_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_87_d3 = {2018, 10, 12};
+static pbg_field corpus_87_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_87_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_87_d3},
+};
+
+static char* corpus_87_names[] = {NULL};
+static int corpus_87_lens[] = {0};
+
+static int corpus_87_f1(pbg_field* v, pbg_error* err);
+
+int corpus_87(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_87_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_87_f1(v, err);
+}
+
+int corpus_87_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_87_names[i], corpus_87_lens[i]);
+	result = corpus_87(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_87_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_87_neq((&corpus_87_c[1]), (&corpus_87_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_88(pbg_field* v, pbg_error* err);
+int corpus_88_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_88_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_88_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_88_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_88_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_88_d3 = {2017, 10, 13};
+static pbg_field corpus_88_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_88_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_88_d3},
+};
+
+static char* corpus_88_names[] = {NULL};
+static int corpus_88_lens[] = {0};
+
+static int corpus_88_f1(pbg_field* v, pbg_error* err);
+
+int corpus_88(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_88_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_88_f1(v, err);
+}
+
+int corpus_88_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_88_names[i], corpus_88_lens[i]);
+	result = corpus_88(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_88_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_88_neq((&corpus_88_c[1]), (&corpus_88_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_89(pbg_field* v, pbg_error* err);
+int corpus_89_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_89_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_89_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_89_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_89_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_89_d3 = {2018, 11, 13};
+static pbg_field corpus_89_c[] = {
+	{PBG_OP_NEQ, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_89_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_89_d3},
+};
+
+static char* corpus_89_names[] = {NULL};
+static int corpus_89_lens[] = {0};
+
+static int corpus_89_f1(pbg_field* v, pbg_error* err);
+
+int corpus_89(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_89_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_89_f1(v, err);
+}
+
+int corpus_89_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_89_names[i], corpus_89_lens[i]);
+	result = corpus_89(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_89_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_89_neq((&corpus_89_c[1]), (&corpus_89_c[2]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_90(pbg_field* v, pbg_error* err);
+int corpus_90_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_90_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_90_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_90_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_90_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_90_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_90_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_90_names[] = {"a", NULL};
+static int corpus_90_lens[] = {1, 0};
+
+static int corpus_90_f1(pbg_field* v, pbg_error* err);
+
+int corpus_90(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_90_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_90_f1(v, err);
+}
+
+int corpus_90_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_90_names[i], corpus_90_lens[i]);
+	result = corpus_90(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_90_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_90_isbool((v + 0)->_type) && corpus_90_isbool((v + 0)->_type)) {
+		first = corpus_90_bool((v + 0), err);
+		return (first != corpus_90_bool((v + 0), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_90_neq((v + 0), (v + 0), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_91(pbg_field* v, pbg_error* err);
+int corpus_91_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_91_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_91_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_91_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_91_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_91_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_91_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_91_names[] = {"a", "b", NULL};
+static int corpus_91_lens[] = {1, 1, 0};
+
+static int corpus_91_f1(pbg_field* v, pbg_error* err);
+
+int corpus_91(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_91_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_91_f1(v, err);
+}
+
+int corpus_91_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_91_names[i], corpus_91_lens[i]);
+	result = corpus_91(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_91_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_91_isbool((v + 0)->_type) && corpus_91_isbool((v + 1)->_type)) {
+		first = corpus_91_bool((v + 0), err);
+		return (first != corpus_91_bool((v + 1), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_91_neq((v + 0), (v + 1), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_92(pbg_field* v, pbg_error* err);
+int corpus_92_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_92_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_92_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_92_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_92_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_92_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_92_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_92_names[] = {"a", "c", NULL};
+static int corpus_92_lens[] = {1, 1, 0};
+
+static int corpus_92_f1(pbg_field* v, pbg_error* err);
+
+int corpus_92(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_92_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_92_f1(v, err);
+}
+
+int corpus_92_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_92_names[i], corpus_92_lens[i]);
+	result = corpus_92(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_92_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_92_isbool((v + 0)->_type) && corpus_92_isbool((v + 1)->_type)) {
+		first = corpus_92_bool((v + 0), err);
+		return (first != corpus_92_bool((v + 1), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_92_neq((v + 0), (v + 1), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_93(pbg_field* v, pbg_error* err);
+int corpus_93_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_93_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_93_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_93_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_93_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_93_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_93_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_93_names[] = {"c", "b", NULL};
+static int corpus_93_lens[] = {1, 1, 0};
+
+static int corpus_93_f1(pbg_field* v, pbg_error* err);
+
+int corpus_93(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_93_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_93_f1(v, err);
+}
+
+int corpus_93_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_93_names[i], corpus_93_lens[i]);
+	result = corpus_93(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_93_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_93_isbool((v + 0)->_type) && corpus_93_isbool((v + 1)->_type)) {
+		first = corpus_93_bool((v + 0), err);
+		return (first != corpus_93_bool((v + 1), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_93_neq((v + 0), (v + 1), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_94(pbg_field* v, pbg_error* err);
+int corpus_94_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_94_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_94_names[] = {NULL};
+static int corpus_94_lens[] = {0};
+
+static int corpus_94_f1(pbg_field* v, pbg_error* err);
+
+int corpus_94(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_94_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_94_f1(v, err);
+}
+
+int corpus_94_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_94_names[i], corpus_94_lens[i]);
+	result = corpus_94(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_94_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_TRUE;
+	return (first != PBG_TRUE) ? PBG_TRUE : PBG_FALSE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_95(pbg_field* v, pbg_error* err);
+int corpus_95_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_95_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_95_names[] = {NULL};
+static int corpus_95_lens[] = {0};
+
+static int corpus_95_f1(pbg_field* v, pbg_error* err);
+
+int corpus_95(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_95_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_95_f1(v, err);
+}
+
+int corpus_95_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_95_names[i], corpus_95_lens[i]);
+	result = corpus_95(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_95_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_TRUE;
+	return (first != PBG_FALSE) ? PBG_TRUE : PBG_FALSE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_96(pbg_field* v, pbg_error* err);
+int corpus_96_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_96_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_96_names[] = {NULL};
+static int corpus_96_lens[] = {0};
+
+static int corpus_96_f1(pbg_field* v, pbg_error* err);
+
+int corpus_96(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_96_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_96_f1(v, err);
+}
+
+int corpus_96_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_96_names[i], corpus_96_lens[i]);
+	result = corpus_96(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_96_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_FALSE;
+	return (first != PBG_TRUE) ? PBG_TRUE : PBG_FALSE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_97(pbg_field* v, pbg_error* err);
+int corpus_97_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_97_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_97_names[] = {NULL};
+static int corpus_97_lens[] = {0};
+
+static int corpus_97_f1(pbg_field* v, pbg_error* err);
+
+int corpus_97(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_97_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_97_f1(v, err);
+}
+
+int corpus_97_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_97_names[i], corpus_97_lens[i]);
+	result = corpus_97(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_97_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = PBG_FALSE;
+	return (first != PBG_FALSE) ? PBG_TRUE : PBG_FALSE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_98(pbg_field* v, pbg_error* err);
+int corpus_98_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_98_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_98_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_98_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_98_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_98_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_98_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_98_names[] = {"1", NULL};
+static int corpus_98_lens[] = {1, 0};
+
+static int corpus_98_f1(pbg_field* v, pbg_error* err);
+
+int corpus_98(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_98_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_98_f1(v, err);
+}
+
+int corpus_98_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_98_names[i], corpus_98_lens[i]);
+	result = corpus_98(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_98_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_98_isbool((v + 0)->_type) && corpus_98_isbool((v + 0)->_type)) {
+		first = corpus_98_bool((v + 0), err);
+		return (first != corpus_98_bool((v + 0), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_98_neq((v + 0), (v + 0), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_99(pbg_field* v, pbg_error* err);
+int corpus_99_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_99_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_99_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_99_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_99_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_99_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_99_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_99_names[] = {"1", "0", NULL};
+static int corpus_99_lens[] = {1, 1, 0};
+
+static int corpus_99_f1(pbg_field* v, pbg_error* err);
+
+int corpus_99(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_99_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_99_f1(v, err);
+}
+
+int corpus_99_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_99_names[i], corpus_99_lens[i]);
+	result = corpus_99(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_99_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_99_isbool((v + 0)->_type) && corpus_99_isbool((v + 1)->_type)) {
+		first = corpus_99_bool((v + 0), err);
+		return (first != corpus_99_bool((v + 1), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_99_neq((v + 0), (v + 1), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_100(pbg_field* v, pbg_error* err);
+int corpus_100_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_100_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_100_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_100_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_100_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_100_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_100_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_100_names[] = {"0", "1", NULL};
+static int corpus_100_lens[] = {1, 1, 0};
+
+static int corpus_100_f1(pbg_field* v, pbg_error* err);
+
+int corpus_100(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_100_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_100_f1(v, err);
+}
+
+int corpus_100_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_100_names[i], corpus_100_lens[i]);
+	result = corpus_100(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_100_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_100_isbool((v + 0)->_type) && corpus_100_isbool((v + 1)->_type)) {
+		first = corpus_100_bool((v + 0), err);
+		return (first != corpus_100_bool((v + 1), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_100_neq((v + 0), (v + 1), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_101(pbg_field* v, pbg_error* err);
+int corpus_101_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_101_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_101_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_101_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_101_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_101_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_101_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static char* corpus_101_names[] = {"0", NULL};
+static int corpus_101_lens[] = {1, 0};
+
+static int corpus_101_f1(pbg_field* v, pbg_error* err);
+
+int corpus_101(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_101_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_101_f1(v, err);
+}
+
+int corpus_101_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_101_names[i], corpus_101_lens[i]);
+	result = corpus_101(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_101_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_101_isbool((v + 0)->_type) && corpus_101_isbool((v + 0)->_type)) {
+		first = corpus_101_bool((v + 0), err);
+		return (first != corpus_101_bool((v + 0), err)) ? PBG_TRUE : PBG_FALSE;
+	}
+	return corpus_101_neq((v + 0), (v + 0), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_102(pbg_field* v, pbg_error* err);
+int corpus_102_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_102_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_102_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_102_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_102_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_102_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_102_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_102_order(err, op, corpus_102_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_102_n2 = {2.0};
+static pbg_lt_number corpus_102_n3 = {3.0};
+static pbg_field corpus_102_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_102_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_102_n3},
+};
+
+static char* corpus_102_names[] = {NULL};
+static int corpus_102_lens[] = {0};
+
+static int corpus_102_f1(pbg_field* v, pbg_error* err);
+
+int corpus_102(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_102_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_102_f1(v, err);
+}
+
+int corpus_102_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_102_names[i], corpus_102_lens[i]);
+	result = corpus_102(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_102_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_102_compare((&corpus_102_c[1]), (&corpus_102_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_103(pbg_field* v, pbg_error* err);
+int corpus_103_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_103_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_103_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_103_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_103_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_103_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_103_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_103_order(err, op, corpus_103_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_103_n2 = {3.0};
+static pbg_lt_number corpus_103_n3 = {3.0};
+static pbg_field corpus_103_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_103_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_103_n3},
+};
+
+static char* corpus_103_names[] = {NULL};
+static int corpus_103_lens[] = {0};
+
+static int corpus_103_f1(pbg_field* v, pbg_error* err);
+
+int corpus_103(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_103_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_103_f1(v, err);
+}
+
+int corpus_103_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_103_names[i], corpus_103_lens[i]);
+	result = corpus_103(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_103_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_103_compare((&corpus_103_c[1]), (&corpus_103_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_104(pbg_field* v, pbg_error* err);
+int corpus_104_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_104_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_104_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_104_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_104_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_104_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_104_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_104_order(err, op, corpus_104_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_104_n2 = {-3.0};
+static pbg_lt_number corpus_104_n3 = {3.0};
+static pbg_field corpus_104_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_104_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_104_n3},
+};
+
+static char* corpus_104_names[] = {NULL};
+static int corpus_104_lens[] = {0};
+
+static int corpus_104_f1(pbg_field* v, pbg_error* err);
+
+int corpus_104(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_104_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_104_f1(v, err);
+}
+
+int corpus_104_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_104_names[i], corpus_104_lens[i]);
+	result = corpus_104(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_104_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_104_compare((&corpus_104_c[1]), (&corpus_104_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_105(pbg_field* v, pbg_error* err);
+int corpus_105_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_105_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_105_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_105_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_105_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_105_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_105_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_105_order(err, op, corpus_105_cmp(c0, c1));
+}
+
+static char corpus_105_s2[] = "a";
+static char corpus_105_s3[] = "a";
+static pbg_field corpus_105_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_105_s2},
+	{PBG_LT_STRING, 1, corpus_105_s3},
+};
+
+static char* corpus_105_names[] = {NULL};
+static int corpus_105_lens[] = {0};
+
+static int corpus_105_f1(pbg_field* v, pbg_error* err);
+
+int corpus_105(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_105_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_105_f1(v, err);
+}
+
+int corpus_105_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_105_names[i], corpus_105_lens[i]);
+	result = corpus_105(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_105_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_105_compare((&corpus_105_c[1]), (&corpus_105_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_106(pbg_field* v, pbg_error* err);
+int corpus_106_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_106_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_106_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_106_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_106_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_106_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_106_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_106_order(err, op, corpus_106_cmp(c0, c1));
+}
+
+static char corpus_106_s2[] = "a";
+static char corpus_106_s3[] = "b";
+static pbg_field corpus_106_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_106_s2},
+	{PBG_LT_STRING, 1, corpus_106_s3},
+};
+
+static char* corpus_106_names[] = {NULL};
+static int corpus_106_lens[] = {0};
+
+static int corpus_106_f1(pbg_field* v, pbg_error* err);
+
+int corpus_106(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_106_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_106_f1(v, err);
+}
+
+int corpus_106_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_106_names[i], corpus_106_lens[i]);
+	result = corpus_106(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_106_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_106_compare((&corpus_106_c[1]), (&corpus_106_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_107(pbg_field* v, pbg_error* err);
+int corpus_107_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_107_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_107_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_107_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_107_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_107_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_107_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_107_order(err, op, corpus_107_cmp(c0, c1));
+}
+
+static char corpus_107_s2[] = "b";
+static char corpus_107_s3[] = "a";
+static pbg_field corpus_107_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_107_s2},
+	{PBG_LT_STRING, 1, corpus_107_s3},
+};
+
+static char* corpus_107_names[] = {NULL};
+static int corpus_107_lens[] = {0};
+
+static int corpus_107_f1(pbg_field* v, pbg_error* err);
+
+int corpus_107(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_107_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_107_f1(v, err);
+}
+
+int corpus_107_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_107_names[i], corpus_107_lens[i]);
+	result = corpus_107(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_107_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_107_compare((&corpus_107_c[1]), (&corpus_107_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_108(pbg_field* v, pbg_error* err);
+int corpus_108_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_108_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_108_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_108_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_108_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_108_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_108_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_108_order(err, op, corpus_108_cmp(c0, c1));
+}
+
+static char corpus_108_s2[] = "aaa";
+static char corpus_108_s3[] = "aab";
+static pbg_field corpus_108_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_108_s2},
+	{PBG_LT_STRING, 3, corpus_108_s3},
+};
+
+static char* corpus_108_names[] = {NULL};
+static int corpus_108_lens[] = {0};
+
+static int corpus_108_f1(pbg_field* v, pbg_error* err);
+
+int corpus_108(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_108_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_108_f1(v, err);
+}
+
+int corpus_108_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_108_names[i], corpus_108_lens[i]);
+	result = corpus_108(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_108_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_108_compare((&corpus_108_c[1]), (&corpus_108_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_109(pbg_field* v, pbg_error* err);
+int corpus_109_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_109_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_109_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_109_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_109_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_109_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_109_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_109_order(err, op, corpus_109_cmp(c0, c1));
+}
+
+static char corpus_109_s2[] = "ab";
+static char corpus_109_s3[] = "ab!";
+static pbg_field corpus_109_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_109_s2},
+	{PBG_LT_STRING, 3, corpus_109_s3},
+};
+
+static char* corpus_109_names[] = {NULL};
+static int corpus_109_lens[] = {0};
+
+static int corpus_109_f1(pbg_field* v, pbg_error* err);
+
+int corpus_109(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_109_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_109_f1(v, err);
+}
+
+int corpus_109_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_109_names[i], corpus_109_lens[i]);
+	result = corpus_109(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_109_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_109_compare((&corpus_109_c[1]), (&corpus_109_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_110(pbg_field* v, pbg_error* err);
+int corpus_110_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_110_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_110_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_110_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_110_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_110_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_110_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_110_order(err, op, corpus_110_cmp(c0, c1));
+}
+
+static char corpus_110_s2[] = "ab!";
+static char corpus_110_s3[] = "ab";
+static pbg_field corpus_110_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_110_s2},
+	{PBG_LT_STRING, 2, corpus_110_s3},
+};
+
+static char* corpus_110_names[] = {NULL};
+static int corpus_110_lens[] = {0};
+
+static int corpus_110_f1(pbg_field* v, pbg_error* err);
+
+int corpus_110(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_110_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_110_f1(v, err);
+}
+
+int corpus_110_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_110_names[i], corpus_110_lens[i]);
+	result = corpus_110(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_110_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_110_compare((&corpus_110_c[1]), (&corpus_110_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_111(pbg_field* v, pbg_error* err);
+int corpus_111_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_111_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_111_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_111_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_111_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_111_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_111_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_111_order(err, op, corpus_111_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_111_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_111_d3 = {2018, 10, 12};
+static pbg_field corpus_111_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_111_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_111_d3},
+};
+
+static char* corpus_111_names[] = {NULL};
+static int corpus_111_lens[] = {0};
+
+static int corpus_111_f1(pbg_field* v, pbg_error* err);
+
+int corpus_111(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_111_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_111_f1(v, err);
+}
+
+int corpus_111_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_111_names[i], corpus_111_lens[i]);
+	result = corpus_111(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_111_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_111_compare((&corpus_111_c[1]), (&corpus_111_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_112(pbg_field* v, pbg_error* err);
+int corpus_112_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_112_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_112_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_112_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_112_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_112_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_112_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_112_order(err, op, corpus_112_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_112_d2 = {2018, 10, 11};
+static pbg_lt_date corpus_112_d3 = {2018, 10, 12};
+static pbg_field corpus_112_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_112_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_112_d3},
+};
+
+static char* corpus_112_names[] = {NULL};
+static int corpus_112_lens[] = {0};
+
+static int corpus_112_f1(pbg_field* v, pbg_error* err);
+
+int corpus_112(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_112_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_112_f1(v, err);
+}
+
+int corpus_112_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_112_names[i], corpus_112_lens[i]);
+	result = corpus_112(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_112_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_112_compare((&corpus_112_c[1]), (&corpus_112_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_113(pbg_field* v, pbg_error* err);
+int corpus_113_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_113_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_113_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_113_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_113_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_113_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_113_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_113_order(err, op, corpus_113_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_113_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_113_d3 = {2018, 10, 11};
+static pbg_field corpus_113_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_113_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_113_d3},
+};
+
+static char* corpus_113_names[] = {NULL};
+static int corpus_113_lens[] = {0};
+
+static int corpus_113_f1(pbg_field* v, pbg_error* err);
+
+int corpus_113(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_113_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_113_f1(v, err);
+}
+
+int corpus_113_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_113_names[i], corpus_113_lens[i]);
+	result = corpus_113(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_113_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_113_compare((&corpus_113_c[1]), (&corpus_113_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_114(pbg_field* v, pbg_error* err);
+int corpus_114_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_114_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_114_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_114_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_114_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_114_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_114_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_114_order(err, op, corpus_114_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_114_d2 = {2018, 9, 12};
+static pbg_lt_date corpus_114_d3 = {2018, 10, 12};
+static pbg_field corpus_114_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_114_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_114_d3},
+};
+
+static char* corpus_114_names[] = {NULL};
+static int corpus_114_lens[] = {0};
+
+static int corpus_114_f1(pbg_field* v, pbg_error* err);
+
+int corpus_114(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_114_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_114_f1(v, err);
+}
+
+int corpus_114_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_114_names[i], corpus_114_lens[i]);
+	result = corpus_114(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_114_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_114_compare((&corpus_114_c[1]), (&corpus_114_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_115(pbg_field* v, pbg_error* err);
+int corpus_115_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_115_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_115_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_115_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_115_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_115_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_115_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_115_order(err, op, corpus_115_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_115_d2 = {2018, 9, 12};
+static pbg_lt_date corpus_115_d3 = {2018, 10, 12};
+static pbg_field corpus_115_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_115_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_115_d3},
+};
+
+static char* corpus_115_names[] = {NULL};
+static int corpus_115_lens[] = {0};
+
+static int corpus_115_f1(pbg_field* v, pbg_error* err);
+
+int corpus_115(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_115_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_115_f1(v, err);
+}
+
+int corpus_115_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_115_names[i], corpus_115_lens[i]);
+	result = corpus_115(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_115_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_115_compare((&corpus_115_c[1]), (&corpus_115_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_116(pbg_field* v, pbg_error* err);
+int corpus_116_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_116_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_116_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_116_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_116_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_116_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_116_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_116_order(err, op, corpus_116_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_116_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_116_d3 = {2018, 9, 12};
+static pbg_field corpus_116_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_116_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_116_d3},
+};
+
+static char* corpus_116_names[] = {NULL};
+static int corpus_116_lens[] = {0};
+
+static int corpus_116_f1(pbg_field* v, pbg_error* err);
+
+int corpus_116(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_116_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_116_f1(v, err);
+}
+
+int corpus_116_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_116_names[i], corpus_116_lens[i]);
+	result = corpus_116(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_116_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_116_compare((&corpus_116_c[1]), (&corpus_116_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_117(pbg_field* v, pbg_error* err);
+int corpus_117_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_117_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_117_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_117_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_117_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_117_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_117_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_117_order(err, op, corpus_117_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_117_d2 = {2017, 10, 12};
+static pbg_lt_date corpus_117_d3 = {2018, 10, 12};
+static pbg_field corpus_117_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_117_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_117_d3},
+};
+
+static char* corpus_117_names[] = {NULL};
+static int corpus_117_lens[] = {0};
+
+static int corpus_117_f1(pbg_field* v, pbg_error* err);
+
+int corpus_117(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_117_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_117_f1(v, err);
+}
+
+int corpus_117_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_117_names[i], corpus_117_lens[i]);
+	result = corpus_117(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_117_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_117_compare((&corpus_117_c[1]), (&corpus_117_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_118(pbg_field* v, pbg_error* err);
+int corpus_118_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_118_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_118_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_118_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_118_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_118_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_118_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_118_order(err, op, corpus_118_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_118_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_118_d3 = {2017, 10, 12};
+static pbg_field corpus_118_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_118_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_118_d3},
+};
+
+static char* corpus_118_names[] = {NULL};
+static int corpus_118_lens[] = {0};
+
+static int corpus_118_f1(pbg_field* v, pbg_error* err);
+
+int corpus_118(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_118_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_118_f1(v, err);
+}
+
+int corpus_118_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_118_names[i], corpus_118_lens[i]);
+	result = corpus_118(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_118_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_118_compare((&corpus_118_c[1]), (&corpus_118_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_119(pbg_field* v, pbg_error* err);
+int corpus_119_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_119_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_119_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_119_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_119_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_119_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_119_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_119_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_119_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_119_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_119_order(err, op, corpus_119_cmp(c0, c1));
+}
+
+static char* corpus_119_names[] = {"1", NULL};
+static int corpus_119_lens[] = {1, 0};
+
+static int corpus_119_f1(pbg_field* v, pbg_error* err);
+
+int corpus_119(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_119_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_119_f1(v, err);
+}
+
+int corpus_119_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_119_names[i], corpus_119_lens[i]);
+	result = corpus_119(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_119_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_119_isbool((v + 0)->_type) && corpus_119_isbool((v + 0)->_type)) {
+		first = corpus_119_bool((v + 0), err);
+		return corpus_119_order(err, PBG_OP_LT, first - corpus_119_bool((v + 0), err));
+	}
+	return corpus_119_compare((v + 0), (v + 0), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_120(pbg_field* v, pbg_error* err);
+int corpus_120_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_120_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_120_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_120_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_120_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_120_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_120_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_120_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_120_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_120_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_120_order(err, op, corpus_120_cmp(c0, c1));
+}
+
+static char* corpus_120_names[] = {"1", "0", NULL};
+static int corpus_120_lens[] = {1, 1, 0};
+
+static int corpus_120_f1(pbg_field* v, pbg_error* err);
+
+int corpus_120(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_120_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_120_f1(v, err);
+}
+
+int corpus_120_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_120_names[i], corpus_120_lens[i]);
+	result = corpus_120(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_120_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_120_isbool((v + 0)->_type) && corpus_120_isbool((v + 1)->_type)) {
+		first = corpus_120_bool((v + 0), err);
+		return corpus_120_order(err, PBG_OP_LT, first - corpus_120_bool((v + 1), err));
+	}
+	return corpus_120_compare((v + 0), (v + 1), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_121(pbg_field* v, pbg_error* err);
+int corpus_121_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_121_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_121_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_121_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_121_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_121_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_121_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_121_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_121_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_121_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_121_order(err, op, corpus_121_cmp(c0, c1));
+}
+
+static char* corpus_121_names[] = {"0", "1", NULL};
+static int corpus_121_lens[] = {1, 1, 0};
+
+static int corpus_121_f1(pbg_field* v, pbg_error* err);
+
+int corpus_121(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_121_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_121_f1(v, err);
+}
+
+int corpus_121_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_121_names[i], corpus_121_lens[i]);
+	result = corpus_121(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_121_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_121_isbool((v + 0)->_type) && corpus_121_isbool((v + 1)->_type)) {
+		first = corpus_121_bool((v + 0), err);
+		return corpus_121_order(err, PBG_OP_LT, first - corpus_121_bool((v + 1), err));
+	}
+	return corpus_121_compare((v + 0), (v + 1), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_122(pbg_field* v, pbg_error* err);
+int corpus_122_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_122_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_122_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_122_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_122_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_122_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_122_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_122_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_122_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_122_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_122_order(err, op, corpus_122_cmp(c0, c1));
+}
+
+static char* corpus_122_names[] = {"0", NULL};
+static int corpus_122_lens[] = {1, 0};
+
+static int corpus_122_f1(pbg_field* v, pbg_error* err);
+
+int corpus_122(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_122_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_122_f1(v, err);
+}
+
+int corpus_122_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_122_names[i], corpus_122_lens[i]);
+	result = corpus_122(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_122_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_122_isbool((v + 0)->_type) && corpus_122_isbool((v + 0)->_type)) {
+		first = corpus_122_bool((v + 0), err);
+		return corpus_122_order(err, PBG_OP_LT, first - corpus_122_bool((v + 0), err));
+	}
+	return corpus_122_compare((v + 0), (v + 0), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_123(pbg_field* v, pbg_error* err);
+int corpus_123_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_123_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_123_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_123_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_123_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_123_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_123_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_123_order(err, op, corpus_123_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_123_n2 = {3.0};
+static pbg_lt_number corpus_123_n3 = {2.0};
+static pbg_field corpus_123_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_123_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_123_n3},
+};
+
+static char* corpus_123_names[] = {NULL};
+static int corpus_123_lens[] = {0};
+
+static int corpus_123_f1(pbg_field* v, pbg_error* err);
+
+int corpus_123(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_123_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_123_f1(v, err);
+}
+
+int corpus_123_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_123_names[i], corpus_123_lens[i]);
+	result = corpus_123(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_123_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_123_compare((&corpus_123_c[1]), (&corpus_123_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_124(pbg_field* v, pbg_error* err);
+int corpus_124_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_124_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_124_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_124_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_124_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_124_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_124_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_124_order(err, op, corpus_124_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_124_n2 = {3.0};
+static pbg_lt_number corpus_124_n3 = {3.0};
+static pbg_field corpus_124_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_124_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_124_n3},
+};
+
+static char* corpus_124_names[] = {NULL};
+static int corpus_124_lens[] = {0};
+
+static int corpus_124_f1(pbg_field* v, pbg_error* err);
+
+int corpus_124(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_124_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_124_f1(v, err);
+}
+
+int corpus_124_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_124_names[i], corpus_124_lens[i]);
+	result = corpus_124(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_124_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_124_compare((&corpus_124_c[1]), (&corpus_124_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_125(pbg_field* v, pbg_error* err);
+int corpus_125_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_125_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_125_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_125_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_125_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_125_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_125_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_125_order(err, op, corpus_125_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_125_n2 = {3.0};
+static pbg_lt_number corpus_125_n3 = {-3.0};
+static pbg_field corpus_125_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_125_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_125_n3},
+};
+
+static char* corpus_125_names[] = {NULL};
+static int corpus_125_lens[] = {0};
+
+static int corpus_125_f1(pbg_field* v, pbg_error* err);
+
+int corpus_125(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_125_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_125_f1(v, err);
+}
+
+int corpus_125_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_125_names[i], corpus_125_lens[i]);
+	result = corpus_125(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_125_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_125_compare((&corpus_125_c[1]), (&corpus_125_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_126(pbg_field* v, pbg_error* err);
+int corpus_126_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_126_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_126_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_126_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_126_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_126_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_126_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_126_order(err, op, corpus_126_cmp(c0, c1));
+}
+
+static char corpus_126_s2[] = "a";
+static char corpus_126_s3[] = "a";
+static pbg_field corpus_126_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_126_s2},
+	{PBG_LT_STRING, 1, corpus_126_s3},
+};
+
+static char* corpus_126_names[] = {NULL};
+static int corpus_126_lens[] = {0};
+
+static int corpus_126_f1(pbg_field* v, pbg_error* err);
+
+int corpus_126(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_126_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_126_f1(v, err);
+}
+
+int corpus_126_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_126_names[i], corpus_126_lens[i]);
+	result = corpus_126(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_126_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_126_compare((&corpus_126_c[1]), (&corpus_126_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_127(pbg_field* v, pbg_error* err);
+int corpus_127_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_127_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_127_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_127_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_127_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_127_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_127_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_127_order(err, op, corpus_127_cmp(c0, c1));
+}
+
+static char corpus_127_s2[] = "a";
+static char corpus_127_s3[] = "b";
+static pbg_field corpus_127_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_127_s2},
+	{PBG_LT_STRING, 1, corpus_127_s3},
+};
+
+static char* corpus_127_names[] = {NULL};
+static int corpus_127_lens[] = {0};
+
+static int corpus_127_f1(pbg_field* v, pbg_error* err);
+
+int corpus_127(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_127_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_127_f1(v, err);
+}
+
+int corpus_127_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_127_names[i], corpus_127_lens[i]);
+	result = corpus_127(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_127_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_127_compare((&corpus_127_c[1]), (&corpus_127_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_128(pbg_field* v, pbg_error* err);
+int corpus_128_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_128_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_128_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_128_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_128_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_128_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_128_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_128_order(err, op, corpus_128_cmp(c0, c1));
+}
+
+static char corpus_128_s2[] = "b";
+static char corpus_128_s3[] = "a";
+static pbg_field corpus_128_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_128_s2},
+	{PBG_LT_STRING, 1, corpus_128_s3},
+};
+
+static char* corpus_128_names[] = {NULL};
+static int corpus_128_lens[] = {0};
+
+static int corpus_128_f1(pbg_field* v, pbg_error* err);
+
+int corpus_128(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_128_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_128_f1(v, err);
+}
+
+int corpus_128_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_128_names[i], corpus_128_lens[i]);
+	result = corpus_128(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_128_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_128_compare((&corpus_128_c[1]), (&corpus_128_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_129(pbg_field* v, pbg_error* err);
+int corpus_129_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_129_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_129_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_129_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_129_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_129_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_129_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_129_order(err, op, corpus_129_cmp(c0, c1));
+}
+
+static char corpus_129_s2[] = "aaa";
+static char corpus_129_s3[] = "aab";
+static pbg_field corpus_129_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_129_s2},
+	{PBG_LT_STRING, 3, corpus_129_s3},
+};
+
+static char* corpus_129_names[] = {NULL};
+static int corpus_129_lens[] = {0};
+
+static int corpus_129_f1(pbg_field* v, pbg_error* err);
+
+int corpus_129(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_129_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_129_f1(v, err);
+}
+
+int corpus_129_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_129_names[i], corpus_129_lens[i]);
+	result = corpus_129(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_129_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_129_compare((&corpus_129_c[1]), (&corpus_129_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_130(pbg_field* v, pbg_error* err);
+int corpus_130_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_130_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_130_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_130_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_130_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_130_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_130_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_130_order(err, op, corpus_130_cmp(c0, c1));
+}
+
+static char corpus_130_s2[] = "ab!";
+static char corpus_130_s3[] = "ab";
+static pbg_field corpus_130_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_130_s2},
+	{PBG_LT_STRING, 2, corpus_130_s3},
+};
+
+static char* corpus_130_names[] = {NULL};
+static int corpus_130_lens[] = {0};
+
+static int corpus_130_f1(pbg_field* v, pbg_error* err);
+
+int corpus_130(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_130_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_130_f1(v, err);
+}
+
+int corpus_130_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_130_names[i], corpus_130_lens[i]);
+	result = corpus_130(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_130_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_130_compare((&corpus_130_c[1]), (&corpus_130_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_131(pbg_field* v, pbg_error* err);
+int corpus_131_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_131_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_131_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_131_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_131_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_131_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_131_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_131_order(err, op, corpus_131_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_131_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_131_d3 = {2018, 10, 12};
+static pbg_field corpus_131_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_131_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_131_d3},
+};
+
+static char* corpus_131_names[] = {NULL};
+static int corpus_131_lens[] = {0};
+
+static int corpus_131_f1(pbg_field* v, pbg_error* err);
+
+int corpus_131(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_131_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_131_f1(v, err);
+}
+
+int corpus_131_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_131_names[i], corpus_131_lens[i]);
+	result = corpus_131(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_131_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_131_compare((&corpus_131_c[1]), (&corpus_131_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_132(pbg_field* v, pbg_error* err);
+int corpus_132_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_132_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_132_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_132_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_132_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_132_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_132_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_132_order(err, op, corpus_132_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_132_d2 = {2018, 10, 11};
+static pbg_lt_date corpus_132_d3 = {2018, 10, 12};
+static pbg_field corpus_132_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_132_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_132_d3},
+};
+
+static char* corpus_132_names[] = {NULL};
+static int corpus_132_lens[] = {0};
+
+static int corpus_132_f1(pbg_field* v, pbg_error* err);
+
+int corpus_132(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_132_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_132_f1(v, err);
+}
+
+int corpus_132_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_132_names[i], corpus_132_lens[i]);
+	result = corpus_132(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_132_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_132_compare((&corpus_132_c[1]), (&corpus_132_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_133(pbg_field* v, pbg_error* err);
+int corpus_133_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_133_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_133_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_133_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_133_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_133_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_133_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_133_order(err, op, corpus_133_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_133_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_133_d3 = {2018, 10, 11};
+static pbg_field corpus_133_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_133_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_133_d3},
+};
+
+static char* corpus_133_names[] = {NULL};
+static int corpus_133_lens[] = {0};
+
+static int corpus_133_f1(pbg_field* v, pbg_error* err);
+
+int corpus_133(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_133_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_133_f1(v, err);
+}
+
+int corpus_133_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_133_names[i], corpus_133_lens[i]);
+	result = corpus_133(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_133_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_133_compare((&corpus_133_c[1]), (&corpus_133_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_134(pbg_field* v, pbg_error* err);
+int corpus_134_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_134_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_134_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_134_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_134_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_134_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_134_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_134_order(err, op, corpus_134_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_134_d2 = {2018, 9, 12};
+static pbg_lt_date corpus_134_d3 = {2018, 10, 12};
+static pbg_field corpus_134_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_134_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_134_d3},
+};
+
+static char* corpus_134_names[] = {NULL};
+static int corpus_134_lens[] = {0};
+
+static int corpus_134_f1(pbg_field* v, pbg_error* err);
+
+int corpus_134(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_134_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_134_f1(v, err);
+}
+
+int corpus_134_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_134_names[i], corpus_134_lens[i]);
+	result = corpus_134(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_134_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_134_compare((&corpus_134_c[1]), (&corpus_134_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_135(pbg_field* v, pbg_error* err);
+int corpus_135_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_135_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_135_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_135_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_135_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_135_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_135_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_135_order(err, op, corpus_135_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_135_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_135_d3 = {2018, 9, 12};
+static pbg_field corpus_135_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_135_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_135_d3},
+};
+
+static char* corpus_135_names[] = {NULL};
+static int corpus_135_lens[] = {0};
+
+static int corpus_135_f1(pbg_field* v, pbg_error* err);
+
+int corpus_135(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_135_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_135_f1(v, err);
+}
+
+int corpus_135_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_135_names[i], corpus_135_lens[i]);
+	result = corpus_135(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_135_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_135_compare((&corpus_135_c[1]), (&corpus_135_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_136(pbg_field* v, pbg_error* err);
+int corpus_136_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_136_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_136_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_136_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_136_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_136_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_136_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_136_order(err, op, corpus_136_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_136_d2 = {2017, 10, 12};
+static pbg_lt_date corpus_136_d3 = {2018, 10, 12};
+static pbg_field corpus_136_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_136_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_136_d3},
+};
+
+static char* corpus_136_names[] = {NULL};
+static int corpus_136_lens[] = {0};
+
+static int corpus_136_f1(pbg_field* v, pbg_error* err);
+
+int corpus_136(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_136_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_136_f1(v, err);
+}
+
+int corpus_136_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_136_names[i], corpus_136_lens[i]);
+	result = corpus_136(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_136_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_136_compare((&corpus_136_c[1]), (&corpus_136_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_137(pbg_field* v, pbg_error* err);
+int corpus_137_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_137_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_137_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_137_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_137_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_137_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_137_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_137_order(err, op, corpus_137_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_137_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_137_d3 = {2017, 10, 12};
+static pbg_field corpus_137_c[] = {
+	{PBG_OP_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_137_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_137_d3},
+};
+
+static char* corpus_137_names[] = {NULL};
+static int corpus_137_lens[] = {0};
+
+static int corpus_137_f1(pbg_field* v, pbg_error* err);
+
+int corpus_137(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_137_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_137_f1(v, err);
+}
+
+int corpus_137_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_137_names[i], corpus_137_lens[i]);
+	result = corpus_137(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_137_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_137_compare((&corpus_137_c[1]), (&corpus_137_c[2]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_138(pbg_field* v, pbg_error* err);
+int corpus_138_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_138_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_138_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_138_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_138_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_138_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_138_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_138_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_138_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_138_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_138_order(err, op, corpus_138_cmp(c0, c1));
+}
+
+static char* corpus_138_names[] = {"1", NULL};
+static int corpus_138_lens[] = {1, 0};
+
+static int corpus_138_f1(pbg_field* v, pbg_error* err);
+
+int corpus_138(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_138_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_138_f1(v, err);
+}
+
+int corpus_138_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_138_names[i], corpus_138_lens[i]);
+	result = corpus_138(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_138_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_138_isbool((v + 0)->_type) && corpus_138_isbool((v + 0)->_type)) {
+		first = corpus_138_bool((v + 0), err);
+		return corpus_138_order(err, PBG_OP_GT, first - corpus_138_bool((v + 0), err));
+	}
+	return corpus_138_compare((v + 0), (v + 0), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_139(pbg_field* v, pbg_error* err);
+int corpus_139_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_139_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_139_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_139_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_139_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_139_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_139_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_139_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_139_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_139_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_139_order(err, op, corpus_139_cmp(c0, c1));
+}
+
+static char* corpus_139_names[] = {"1", "0", NULL};
+static int corpus_139_lens[] = {1, 1, 0};
+
+static int corpus_139_f1(pbg_field* v, pbg_error* err);
+
+int corpus_139(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_139_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_139_f1(v, err);
+}
+
+int corpus_139_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_139_names[i], corpus_139_lens[i]);
+	result = corpus_139(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_139_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_139_isbool((v + 0)->_type) && corpus_139_isbool((v + 1)->_type)) {
+		first = corpus_139_bool((v + 0), err);
+		return corpus_139_order(err, PBG_OP_GT, first - corpus_139_bool((v + 1), err));
+	}
+	return corpus_139_compare((v + 0), (v + 1), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_140(pbg_field* v, pbg_error* err);
+int corpus_140_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_140_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_140_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_140_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_140_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_140_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_140_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_140_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_140_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_140_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_140_order(err, op, corpus_140_cmp(c0, c1));
+}
+
+static char* corpus_140_names[] = {"0", "1", NULL};
+static int corpus_140_lens[] = {1, 1, 0};
+
+static int corpus_140_f1(pbg_field* v, pbg_error* err);
+
+int corpus_140(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_140_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_140_f1(v, err);
+}
+
+int corpus_140_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_140_names[i], corpus_140_lens[i]);
+	result = corpus_140(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_140_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_140_isbool((v + 0)->_type) && corpus_140_isbool((v + 1)->_type)) {
+		first = corpus_140_bool((v + 0), err);
+		return corpus_140_order(err, PBG_OP_GT, first - corpus_140_bool((v + 1), err));
+	}
+	return corpus_140_compare((v + 0), (v + 1), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_141(pbg_field* v, pbg_error* err);
+int corpus_141_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_141_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_141_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_141_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_141_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_141_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_141_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_141_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_141_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_141_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_141_order(err, op, corpus_141_cmp(c0, c1));
+}
+
+static char* corpus_141_names[] = {"0", NULL};
+static int corpus_141_lens[] = {1, 0};
+
+static int corpus_141_f1(pbg_field* v, pbg_error* err);
+
+int corpus_141(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_141_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_141_f1(v, err);
+}
+
+int corpus_141_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_141_names[i], corpus_141_lens[i]);
+	result = corpus_141(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_141_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_141_isbool((v + 0)->_type) && corpus_141_isbool((v + 0)->_type)) {
+		first = corpus_141_bool((v + 0), err);
+		return corpus_141_order(err, PBG_OP_GT, first - corpus_141_bool((v + 0), err));
+	}
+	return corpus_141_compare((v + 0), (v + 0), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_142(pbg_field* v, pbg_error* err);
+int corpus_142_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_142_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_142_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_142_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_142_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_142_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_142_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_142_order(err, op, corpus_142_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_142_n2 = {2.0};
+static pbg_lt_number corpus_142_n3 = {3.0};
+static pbg_field corpus_142_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_142_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_142_n3},
+};
+
+static char* corpus_142_names[] = {NULL};
+static int corpus_142_lens[] = {0};
+
+static int corpus_142_f1(pbg_field* v, pbg_error* err);
+
+int corpus_142(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_142_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_142_f1(v, err);
+}
+
+int corpus_142_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_142_names[i], corpus_142_lens[i]);
+	result = corpus_142(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_142_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_142_compare((&corpus_142_c[1]), (&corpus_142_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_143(pbg_field* v, pbg_error* err);
+int corpus_143_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_143_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_143_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_143_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_143_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_143_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_143_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_143_order(err, op, corpus_143_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_143_n2 = {3.0};
+static pbg_lt_number corpus_143_n3 = {3.0};
+static pbg_field corpus_143_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_143_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_143_n3},
+};
+
+static char* corpus_143_names[] = {NULL};
+static int corpus_143_lens[] = {0};
+
+static int corpus_143_f1(pbg_field* v, pbg_error* err);
+
+int corpus_143(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_143_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_143_f1(v, err);
+}
+
+int corpus_143_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_143_names[i], corpus_143_lens[i]);
+	result = corpus_143(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_143_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_143_compare((&corpus_143_c[1]), (&corpus_143_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_144(pbg_field* v, pbg_error* err);
+int corpus_144_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_144_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_144_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_144_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_144_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_144_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_144_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_144_order(err, op, corpus_144_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_144_n2 = {-3.0};
+static pbg_lt_number corpus_144_n3 = {3.0};
+static pbg_field corpus_144_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_144_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_144_n3},
+};
+
+static char* corpus_144_names[] = {NULL};
+static int corpus_144_lens[] = {0};
+
+static int corpus_144_f1(pbg_field* v, pbg_error* err);
+
+int corpus_144(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_144_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_144_f1(v, err);
+}
+
+int corpus_144_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_144_names[i], corpus_144_lens[i]);
+	result = corpus_144(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_144_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_144_compare((&corpus_144_c[1]), (&corpus_144_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_145(pbg_field* v, pbg_error* err);
+int corpus_145_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_145_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_145_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_145_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_145_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_145_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_145_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_145_order(err, op, corpus_145_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_145_n2 = {3.0};
+static pbg_lt_number corpus_145_n3 = {-3.0};
+static pbg_field corpus_145_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_145_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_145_n3},
+};
+
+static char* corpus_145_names[] = {NULL};
+static int corpus_145_lens[] = {0};
+
+static int corpus_145_f1(pbg_field* v, pbg_error* err);
+
+int corpus_145(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_145_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_145_f1(v, err);
+}
+
+int corpus_145_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_145_names[i], corpus_145_lens[i]);
+	result = corpus_145(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_145_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_145_compare((&corpus_145_c[1]), (&corpus_145_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_146(pbg_field* v, pbg_error* err);
+int corpus_146_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_146_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_146_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_146_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_146_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_146_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_146_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_146_order(err, op, corpus_146_cmp(c0, c1));
+}
+
+static char corpus_146_s2[] = "a";
+static char corpus_146_s3[] = "a";
+static pbg_field corpus_146_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_146_s2},
+	{PBG_LT_STRING, 1, corpus_146_s3},
+};
+
+static char* corpus_146_names[] = {NULL};
+static int corpus_146_lens[] = {0};
+
+static int corpus_146_f1(pbg_field* v, pbg_error* err);
+
+int corpus_146(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_146_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_146_f1(v, err);
+}
+
+int corpus_146_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_146_names[i], corpus_146_lens[i]);
+	result = corpus_146(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_146_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_146_compare((&corpus_146_c[1]), (&corpus_146_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_147(pbg_field* v, pbg_error* err);
+int corpus_147_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_147_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_147_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_147_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_147_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_147_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_147_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_147_order(err, op, corpus_147_cmp(c0, c1));
+}
+
+static char corpus_147_s2[] = "a";
+static char corpus_147_s3[] = "b";
+static pbg_field corpus_147_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_147_s2},
+	{PBG_LT_STRING, 1, corpus_147_s3},
+};
+
+static char* corpus_147_names[] = {NULL};
+static int corpus_147_lens[] = {0};
+
+static int corpus_147_f1(pbg_field* v, pbg_error* err);
+
+int corpus_147(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_147_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_147_f1(v, err);
+}
+
+int corpus_147_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_147_names[i], corpus_147_lens[i]);
+	result = corpus_147(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_147_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_147_compare((&corpus_147_c[1]), (&corpus_147_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_148(pbg_field* v, pbg_error* err);
+int corpus_148_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_148_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_148_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_148_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_148_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_148_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_148_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_148_order(err, op, corpus_148_cmp(c0, c1));
+}
+
+static char corpus_148_s2[] = "b";
+static char corpus_148_s3[] = "a";
+static pbg_field corpus_148_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_148_s2},
+	{PBG_LT_STRING, 1, corpus_148_s3},
+};
+
+static char* corpus_148_names[] = {NULL};
+static int corpus_148_lens[] = {0};
+
+static int corpus_148_f1(pbg_field* v, pbg_error* err);
+
+int corpus_148(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_148_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_148_f1(v, err);
+}
+
+int corpus_148_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_148_names[i], corpus_148_lens[i]);
+	result = corpus_148(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_148_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_148_compare((&corpus_148_c[1]), (&corpus_148_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_149(pbg_field* v, pbg_error* err);
+int corpus_149_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_149_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_149_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_149_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_149_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_149_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_149_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_149_order(err, op, corpus_149_cmp(c0, c1));
+}
+
+static char corpus_149_s2[] = "aaa";
+static char corpus_149_s3[] = "aab";
+static pbg_field corpus_149_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_149_s2},
+	{PBG_LT_STRING, 3, corpus_149_s3},
+};
+
+static char* corpus_149_names[] = {NULL};
+static int corpus_149_lens[] = {0};
+
+static int corpus_149_f1(pbg_field* v, pbg_error* err);
+
+int corpus_149(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_149_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_149_f1(v, err);
+}
+
+int corpus_149_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_149_names[i], corpus_149_lens[i]);
+	result = corpus_149(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_149_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_149_compare((&corpus_149_c[1]), (&corpus_149_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_150(pbg_field* v, pbg_error* err);
+int corpus_150_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_150_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_150_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_150_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_150_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_150_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_150_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_150_order(err, op, corpus_150_cmp(c0, c1));
+}
+
+static char corpus_150_s2[] = "ab!";
+static char corpus_150_s3[] = "ab";
+static pbg_field corpus_150_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_150_s2},
+	{PBG_LT_STRING, 2, corpus_150_s3},
+};
+
+static char* corpus_150_names[] = {NULL};
+static int corpus_150_lens[] = {0};
+
+static int corpus_150_f1(pbg_field* v, pbg_error* err);
+
+int corpus_150(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_150_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_150_f1(v, err);
+}
+
+int corpus_150_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_150_names[i], corpus_150_lens[i]);
+	result = corpus_150(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_150_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_150_compare((&corpus_150_c[1]), (&corpus_150_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_151(pbg_field* v, pbg_error* err);
+int corpus_151_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_151_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_151_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_151_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_151_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_151_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_151_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_151_order(err, op, corpus_151_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_151_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_151_d3 = {2018, 10, 12};
+static pbg_field corpus_151_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_151_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_151_d3},
+};
+
+static char* corpus_151_names[] = {NULL};
+static int corpus_151_lens[] = {0};
+
+static int corpus_151_f1(pbg_field* v, pbg_error* err);
+
+int corpus_151(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_151_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_151_f1(v, err);
+}
+
+int corpus_151_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_151_names[i], corpus_151_lens[i]);
+	result = corpus_151(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_151_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_151_compare((&corpus_151_c[1]), (&corpus_151_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_152(pbg_field* v, pbg_error* err);
+int corpus_152_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_152_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_152_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_152_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_152_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_152_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_152_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_152_order(err, op, corpus_152_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_152_d2 = {2018, 10, 11};
+static pbg_lt_date corpus_152_d3 = {2018, 10, 12};
+static pbg_field corpus_152_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_152_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_152_d3},
+};
+
+static char* corpus_152_names[] = {NULL};
+static int corpus_152_lens[] = {0};
+
+static int corpus_152_f1(pbg_field* v, pbg_error* err);
+
+int corpus_152(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_152_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_152_f1(v, err);
+}
+
+int corpus_152_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_152_names[i], corpus_152_lens[i]);
+	result = corpus_152(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_152_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_152_compare((&corpus_152_c[1]), (&corpus_152_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_153(pbg_field* v, pbg_error* err);
+int corpus_153_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_153_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_153_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_153_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_153_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_153_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_153_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_153_order(err, op, corpus_153_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_153_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_153_d3 = {2018, 10, 11};
+static pbg_field corpus_153_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_153_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_153_d3},
+};
+
+static char* corpus_153_names[] = {NULL};
+static int corpus_153_lens[] = {0};
+
+static int corpus_153_f1(pbg_field* v, pbg_error* err);
+
+int corpus_153(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_153_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_153_f1(v, err);
+}
+
+int corpus_153_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_153_names[i], corpus_153_lens[i]);
+	result = corpus_153(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_153_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_153_compare((&corpus_153_c[1]), (&corpus_153_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_154(pbg_field* v, pbg_error* err);
+int corpus_154_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_154_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_154_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_154_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_154_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_154_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_154_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_154_order(err, op, corpus_154_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_154_d2 = {2018, 9, 12};
+static pbg_lt_date corpus_154_d3 = {2018, 10, 12};
+static pbg_field corpus_154_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_154_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_154_d3},
+};
+
+static char* corpus_154_names[] = {NULL};
+static int corpus_154_lens[] = {0};
+
+static int corpus_154_f1(pbg_field* v, pbg_error* err);
+
+int corpus_154(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_154_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_154_f1(v, err);
+}
+
+int corpus_154_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_154_names[i], corpus_154_lens[i]);
+	result = corpus_154(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_154_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_154_compare((&corpus_154_c[1]), (&corpus_154_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_155(pbg_field* v, pbg_error* err);
+int corpus_155_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_155_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_155_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_155_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_155_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_155_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_155_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_155_order(err, op, corpus_155_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_155_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_155_d3 = {2018, 9, 12};
+static pbg_field corpus_155_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_155_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_155_d3},
+};
+
+static char* corpus_155_names[] = {NULL};
+static int corpus_155_lens[] = {0};
+
+static int corpus_155_f1(pbg_field* v, pbg_error* err);
+
+int corpus_155(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_155_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_155_f1(v, err);
+}
+
+int corpus_155_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_155_names[i], corpus_155_lens[i]);
+	result = corpus_155(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_155_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_155_compare((&corpus_155_c[1]), (&corpus_155_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_156(pbg_field* v, pbg_error* err);
+int corpus_156_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_156_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_156_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_156_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_156_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_156_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_156_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_156_order(err, op, corpus_156_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_156_d2 = {2017, 10, 12};
+static pbg_lt_date corpus_156_d3 = {2018, 10, 12};
+static pbg_field corpus_156_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_156_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_156_d3},
+};
+
+static char* corpus_156_names[] = {NULL};
+static int corpus_156_lens[] = {0};
+
+static int corpus_156_f1(pbg_field* v, pbg_error* err);
+
+int corpus_156(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_156_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_156_f1(v, err);
+}
+
+int corpus_156_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_156_names[i], corpus_156_lens[i]);
+	result = corpus_156(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_156_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_156_compare((&corpus_156_c[1]), (&corpus_156_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_157(pbg_field* v, pbg_error* err);
+int corpus_157_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_157_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_157_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_157_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_157_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_157_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_157_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_157_order(err, op, corpus_157_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_157_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_157_d3 = {2017, 10, 12};
+static pbg_field corpus_157_c[] = {
+	{PBG_OP_LTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_157_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_157_d3},
+};
+
+static char* corpus_157_names[] = {NULL};
+static int corpus_157_lens[] = {0};
+
+static int corpus_157_f1(pbg_field* v, pbg_error* err);
+
+int corpus_157(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_157_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_157_f1(v, err);
+}
+
+int corpus_157_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_157_names[i], corpus_157_lens[i]);
+	result = corpus_157(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_157_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_157_compare((&corpus_157_c[1]), (&corpus_157_c[2]), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_158(pbg_field* v, pbg_error* err);
+int corpus_158_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_158_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_158_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_158_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_158_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_158_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_158_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_158_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_158_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_158_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_158_order(err, op, corpus_158_cmp(c0, c1));
+}
+
+static char* corpus_158_names[] = {"1", NULL};
+static int corpus_158_lens[] = {1, 0};
+
+static int corpus_158_f1(pbg_field* v, pbg_error* err);
+
+int corpus_158(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_158_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_158_f1(v, err);
+}
+
+int corpus_158_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_158_names[i], corpus_158_lens[i]);
+	result = corpus_158(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_158_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_158_isbool((v + 0)->_type) && corpus_158_isbool((v + 0)->_type)) {
+		first = corpus_158_bool((v + 0), err);
+		return corpus_158_order(err, PBG_OP_LTE, first - corpus_158_bool((v + 0), err));
+	}
+	return corpus_158_compare((v + 0), (v + 0), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_159(pbg_field* v, pbg_error* err);
+int corpus_159_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_159_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_159_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_159_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_159_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_159_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_159_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_159_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_159_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_159_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_159_order(err, op, corpus_159_cmp(c0, c1));
+}
+
+static char* corpus_159_names[] = {"1", "0", NULL};
+static int corpus_159_lens[] = {1, 1, 0};
+
+static int corpus_159_f1(pbg_field* v, pbg_error* err);
+
+int corpus_159(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_159_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_159_f1(v, err);
+}
+
+int corpus_159_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_159_names[i], corpus_159_lens[i]);
+	result = corpus_159(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_159_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_159_isbool((v + 0)->_type) && corpus_159_isbool((v + 1)->_type)) {
+		first = corpus_159_bool((v + 0), err);
+		return corpus_159_order(err, PBG_OP_LTE, first - corpus_159_bool((v + 1), err));
+	}
+	return corpus_159_compare((v + 0), (v + 1), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_160(pbg_field* v, pbg_error* err);
+int corpus_160_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_160_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_160_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_160_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_160_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_160_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_160_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_160_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_160_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_160_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_160_order(err, op, corpus_160_cmp(c0, c1));
+}
+
+static char* corpus_160_names[] = {"0", "1", NULL};
+static int corpus_160_lens[] = {1, 1, 0};
+
+static int corpus_160_f1(pbg_field* v, pbg_error* err);
+
+int corpus_160(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_160_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_160_f1(v, err);
+}
+
+int corpus_160_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_160_names[i], corpus_160_lens[i]);
+	result = corpus_160(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_160_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_160_isbool((v + 0)->_type) && corpus_160_isbool((v + 1)->_type)) {
+		first = corpus_160_bool((v + 0), err);
+		return corpus_160_order(err, PBG_OP_LTE, first - corpus_160_bool((v + 1), err));
+	}
+	return corpus_160_compare((v + 0), (v + 1), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_161(pbg_field* v, pbg_error* err);
+int corpus_161_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_161_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_161_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_161_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_161_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_161_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_161_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_161_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_161_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_161_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_161_order(err, op, corpus_161_cmp(c0, c1));
+}
+
+static char* corpus_161_names[] = {"0", NULL};
+static int corpus_161_lens[] = {1, 0};
+
+static int corpus_161_f1(pbg_field* v, pbg_error* err);
+
+int corpus_161(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_161_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_161_f1(v, err);
+}
+
+int corpus_161_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_161_names[i], corpus_161_lens[i]);
+	result = corpus_161(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_161_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_161_isbool((v + 0)->_type) && corpus_161_isbool((v + 0)->_type)) {
+		first = corpus_161_bool((v + 0), err);
+		return corpus_161_order(err, PBG_OP_LTE, first - corpus_161_bool((v + 0), err));
+	}
+	return corpus_161_compare((v + 0), (v + 0), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_162(pbg_field* v, pbg_error* err);
+int corpus_162_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_162_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_162_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_162_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_162_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_162_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_162_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_162_order(err, op, corpus_162_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_162_n2 = {3.0};
+static pbg_lt_number corpus_162_n3 = {2.0};
+static pbg_field corpus_162_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_162_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_162_n3},
+};
+
+static char* corpus_162_names[] = {NULL};
+static int corpus_162_lens[] = {0};
+
+static int corpus_162_f1(pbg_field* v, pbg_error* err);
+
+int corpus_162(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_162_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_162_f1(v, err);
+}
+
+int corpus_162_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_162_names[i], corpus_162_lens[i]);
+	result = corpus_162(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_162_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_162_compare((&corpus_162_c[1]), (&corpus_162_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_163(pbg_field* v, pbg_error* err);
+int corpus_163_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_163_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_163_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_163_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_163_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_163_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_163_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_163_order(err, op, corpus_163_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_163_n2 = {3.0};
+static pbg_lt_number corpus_163_n3 = {3.0};
+static pbg_field corpus_163_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_163_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_163_n3},
+};
+
+static char* corpus_163_names[] = {NULL};
+static int corpus_163_lens[] = {0};
+
+static int corpus_163_f1(pbg_field* v, pbg_error* err);
+
+int corpus_163(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_163_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_163_f1(v, err);
+}
+
+int corpus_163_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_163_names[i], corpus_163_lens[i]);
+	result = corpus_163(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_163_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_163_compare((&corpus_163_c[1]), (&corpus_163_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_164(pbg_field* v, pbg_error* err);
+int corpus_164_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_164_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_164_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_164_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_164_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_164_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_164_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_164_order(err, op, corpus_164_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_164_n2 = {3.0};
+static pbg_lt_number corpus_164_n3 = {-3.0};
+static pbg_field corpus_164_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_164_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_164_n3},
+};
+
+static char* corpus_164_names[] = {NULL};
+static int corpus_164_lens[] = {0};
+
+static int corpus_164_f1(pbg_field* v, pbg_error* err);
+
+int corpus_164(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_164_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_164_f1(v, err);
+}
+
+int corpus_164_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_164_names[i], corpus_164_lens[i]);
+	result = corpus_164(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_164_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_164_compare((&corpus_164_c[1]), (&corpus_164_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_165(pbg_field* v, pbg_error* err);
+int corpus_165_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_165_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_165_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_165_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_165_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_165_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_165_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_165_order(err, op, corpus_165_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_165_n2 = {-3.0};
+static pbg_lt_number corpus_165_n3 = {3.0};
+static pbg_field corpus_165_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_165_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_165_n3},
+};
+
+static char* corpus_165_names[] = {NULL};
+static int corpus_165_lens[] = {0};
+
+static int corpus_165_f1(pbg_field* v, pbg_error* err);
+
+int corpus_165(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_165_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_165_f1(v, err);
+}
+
+int corpus_165_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_165_names[i], corpus_165_lens[i]);
+	result = corpus_165(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_165_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_165_compare((&corpus_165_c[1]), (&corpus_165_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_166(pbg_field* v, pbg_error* err);
+int corpus_166_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_166_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_166_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_166_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_166_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_166_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_166_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_166_order(err, op, corpus_166_cmp(c0, c1));
+}
+
+static char corpus_166_s2[] = "a";
+static char corpus_166_s3[] = "a";
+static pbg_field corpus_166_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_166_s2},
+	{PBG_LT_STRING, 1, corpus_166_s3},
+};
+
+static char* corpus_166_names[] = {NULL};
+static int corpus_166_lens[] = {0};
+
+static int corpus_166_f1(pbg_field* v, pbg_error* err);
+
+int corpus_166(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_166_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_166_f1(v, err);
+}
+
+int corpus_166_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_166_names[i], corpus_166_lens[i]);
+	result = corpus_166(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_166_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_166_compare((&corpus_166_c[1]), (&corpus_166_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_167(pbg_field* v, pbg_error* err);
+int corpus_167_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_167_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_167_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_167_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_167_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_167_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_167_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_167_order(err, op, corpus_167_cmp(c0, c1));
+}
+
+static char corpus_167_s2[] = "a";
+static char corpus_167_s3[] = "b";
+static pbg_field corpus_167_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_167_s2},
+	{PBG_LT_STRING, 1, corpus_167_s3},
+};
+
+static char* corpus_167_names[] = {NULL};
+static int corpus_167_lens[] = {0};
+
+static int corpus_167_f1(pbg_field* v, pbg_error* err);
+
+int corpus_167(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_167_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_167_f1(v, err);
+}
+
+int corpus_167_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_167_names[i], corpus_167_lens[i]);
+	result = corpus_167(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_167_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_167_compare((&corpus_167_c[1]), (&corpus_167_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_168(pbg_field* v, pbg_error* err);
+int corpus_168_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_168_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_168_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_168_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_168_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_168_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_168_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_168_order(err, op, corpus_168_cmp(c0, c1));
+}
+
+static char corpus_168_s2[] = "b";
+static char corpus_168_s3[] = "a";
+static pbg_field corpus_168_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_168_s2},
+	{PBG_LT_STRING, 1, corpus_168_s3},
+};
+
+static char* corpus_168_names[] = {NULL};
+static int corpus_168_lens[] = {0};
+
+static int corpus_168_f1(pbg_field* v, pbg_error* err);
+
+int corpus_168(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_168_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_168_f1(v, err);
+}
+
+int corpus_168_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_168_names[i], corpus_168_lens[i]);
+	result = corpus_168(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_168_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_168_compare((&corpus_168_c[1]), (&corpus_168_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_169(pbg_field* v, pbg_error* err);
+int corpus_169_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_169_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_169_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_169_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_169_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_169_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_169_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_169_order(err, op, corpus_169_cmp(c0, c1));
+}
+
+static char corpus_169_s2[] = "aaa";
+static char corpus_169_s3[] = "aab";
+static pbg_field corpus_169_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_169_s2},
+	{PBG_LT_STRING, 3, corpus_169_s3},
+};
+
+static char* corpus_169_names[] = {NULL};
+static int corpus_169_lens[] = {0};
+
+static int corpus_169_f1(pbg_field* v, pbg_error* err);
+
+int corpus_169(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_169_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_169_f1(v, err);
+}
+
+int corpus_169_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_169_names[i], corpus_169_lens[i]);
+	result = corpus_169(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_169_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_169_compare((&corpus_169_c[1]), (&corpus_169_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_170(pbg_field* v, pbg_error* err);
+int corpus_170_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_170_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_170_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_170_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_170_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_170_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_170_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_170_order(err, op, corpus_170_cmp(c0, c1));
+}
+
+static char corpus_170_s2[] = "ab";
+static char corpus_170_s3[] = "ab!";
+static pbg_field corpus_170_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_170_s2},
+	{PBG_LT_STRING, 3, corpus_170_s3},
+};
+
+static char* corpus_170_names[] = {NULL};
+static int corpus_170_lens[] = {0};
+
+static int corpus_170_f1(pbg_field* v, pbg_error* err);
+
+int corpus_170(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_170_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_170_f1(v, err);
+}
+
+int corpus_170_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_170_names[i], corpus_170_lens[i]);
+	result = corpus_170(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_170_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_170_compare((&corpus_170_c[1]), (&corpus_170_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_171(pbg_field* v, pbg_error* err);
+int corpus_171_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_171_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_171_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_171_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_171_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_171_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_171_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_171_order(err, op, corpus_171_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_171_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_171_d3 = {2018, 10, 12};
+static pbg_field corpus_171_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_171_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_171_d3},
+};
+
+static char* corpus_171_names[] = {NULL};
+static int corpus_171_lens[] = {0};
+
+static int corpus_171_f1(pbg_field* v, pbg_error* err);
+
+int corpus_171(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_171_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_171_f1(v, err);
+}
+
+int corpus_171_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_171_names[i], corpus_171_lens[i]);
+	result = corpus_171(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_171_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_171_compare((&corpus_171_c[1]), (&corpus_171_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_172(pbg_field* v, pbg_error* err);
+int corpus_172_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_172_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_172_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_172_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_172_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_172_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_172_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_172_order(err, op, corpus_172_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_172_d2 = {2018, 10, 11};
+static pbg_lt_date corpus_172_d3 = {2018, 10, 12};
+static pbg_field corpus_172_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_172_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_172_d3},
+};
+
+static char* corpus_172_names[] = {NULL};
+static int corpus_172_lens[] = {0};
+
+static int corpus_172_f1(pbg_field* v, pbg_error* err);
+
+int corpus_172(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_172_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_172_f1(v, err);
+}
+
+int corpus_172_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_172_names[i], corpus_172_lens[i]);
+	result = corpus_172(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_172_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_172_compare((&corpus_172_c[1]), (&corpus_172_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_173(pbg_field* v, pbg_error* err);
+int corpus_173_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_173_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_173_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_173_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_173_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_173_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_173_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_173_order(err, op, corpus_173_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_173_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_173_d3 = {2018, 10, 11};
+static pbg_field corpus_173_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_173_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_173_d3},
+};
+
+static char* corpus_173_names[] = {NULL};
+static int corpus_173_lens[] = {0};
+
+static int corpus_173_f1(pbg_field* v, pbg_error* err);
+
+int corpus_173(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_173_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_173_f1(v, err);
+}
+
+int corpus_173_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_173_names[i], corpus_173_lens[i]);
+	result = corpus_173(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_173_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_173_compare((&corpus_173_c[1]), (&corpus_173_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_174(pbg_field* v, pbg_error* err);
+int corpus_174_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_174_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_174_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_174_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_174_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_174_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_174_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_174_order(err, op, corpus_174_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_174_d2 = {2018, 9, 12};
+static pbg_lt_date corpus_174_d3 = {2018, 10, 12};
+static pbg_field corpus_174_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_174_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_174_d3},
+};
+
+static char* corpus_174_names[] = {NULL};
+static int corpus_174_lens[] = {0};
+
+static int corpus_174_f1(pbg_field* v, pbg_error* err);
+
+int corpus_174(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_174_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_174_f1(v, err);
+}
+
+int corpus_174_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_174_names[i], corpus_174_lens[i]);
+	result = corpus_174(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_174_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_174_compare((&corpus_174_c[1]), (&corpus_174_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_175(pbg_field* v, pbg_error* err);
+int corpus_175_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_175_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_175_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_175_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_175_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_175_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_175_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_175_order(err, op, corpus_175_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_175_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_175_d3 = {2018, 9, 12};
+static pbg_field corpus_175_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_175_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_175_d3},
+};
+
+static char* corpus_175_names[] = {NULL};
+static int corpus_175_lens[] = {0};
+
+static int corpus_175_f1(pbg_field* v, pbg_error* err);
+
+int corpus_175(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_175_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_175_f1(v, err);
+}
+
+int corpus_175_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_175_names[i], corpus_175_lens[i]);
+	result = corpus_175(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_175_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_175_compare((&corpus_175_c[1]), (&corpus_175_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_176(pbg_field* v, pbg_error* err);
+int corpus_176_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_176_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_176_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_176_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_176_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_176_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_176_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_176_order(err, op, corpus_176_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_176_d2 = {2017, 10, 12};
+static pbg_lt_date corpus_176_d3 = {2018, 10, 12};
+static pbg_field corpus_176_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_176_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_176_d3},
+};
+
+static char* corpus_176_names[] = {NULL};
+static int corpus_176_lens[] = {0};
+
+static int corpus_176_f1(pbg_field* v, pbg_error* err);
+
+int corpus_176(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_176_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_176_f1(v, err);
+}
+
+int corpus_176_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_176_names[i], corpus_176_lens[i]);
+	result = corpus_176(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_176_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_176_compare((&corpus_176_c[1]), (&corpus_176_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_177(pbg_field* v, pbg_error* err);
+int corpus_177_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_177_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_177_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_177_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_177_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_177_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_177_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_177_order(err, op, corpus_177_cmp(c0, c1));
+}
+
+static pbg_lt_date corpus_177_d2 = {2018, 10, 12};
+static pbg_lt_date corpus_177_d3 = {2017, 10, 12};
+static pbg_field corpus_177_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_177_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_177_d3},
+};
+
+static char* corpus_177_names[] = {NULL};
+static int corpus_177_lens[] = {0};
+
+static int corpus_177_f1(pbg_field* v, pbg_error* err);
+
+int corpus_177(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_177_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_177_f1(v, err);
+}
+
+int corpus_177_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_177_names[i], corpus_177_lens[i]);
+	result = corpus_177(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_177_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_177_compare((&corpus_177_c[1]), (&corpus_177_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_178(pbg_field* v, pbg_error* err);
+int corpus_178_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_178_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_178_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_178_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_178_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_178_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_178_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_178_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_178_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_178_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_178_order(err, op, corpus_178_cmp(c0, c1));
+}
+
+static char* corpus_178_names[] = {"1", NULL};
+static int corpus_178_lens[] = {1, 0};
+
+static int corpus_178_f1(pbg_field* v, pbg_error* err);
+
+int corpus_178(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_178_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_178_f1(v, err);
+}
+
+int corpus_178_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_178_names[i], corpus_178_lens[i]);
+	result = corpus_178(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_178_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_178_isbool((v + 0)->_type) && corpus_178_isbool((v + 0)->_type)) {
+		first = corpus_178_bool((v + 0), err);
+		return corpus_178_order(err, PBG_OP_GTE, first - corpus_178_bool((v + 0), err));
+	}
+	return corpus_178_compare((v + 0), (v + 0), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_179(pbg_field* v, pbg_error* err);
+int corpus_179_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_179_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_179_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_179_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_179_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_179_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_179_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_179_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_179_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_179_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_179_order(err, op, corpus_179_cmp(c0, c1));
+}
+
+static char* corpus_179_names[] = {"1", "0", NULL};
+static int corpus_179_lens[] = {1, 1, 0};
+
+static int corpus_179_f1(pbg_field* v, pbg_error* err);
+
+int corpus_179(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_179_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_179_f1(v, err);
+}
+
+int corpus_179_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_179_names[i], corpus_179_lens[i]);
+	result = corpus_179(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_179_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_179_isbool((v + 0)->_type) && corpus_179_isbool((v + 1)->_type)) {
+		first = corpus_179_bool((v + 0), err);
+		return corpus_179_order(err, PBG_OP_GTE, first - corpus_179_bool((v + 1), err));
+	}
+	return corpus_179_compare((v + 0), (v + 1), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_180(pbg_field* v, pbg_error* err);
+int corpus_180_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_180_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_180_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_180_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_180_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_180_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_180_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_180_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_180_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_180_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_180_order(err, op, corpus_180_cmp(c0, c1));
+}
+
+static char* corpus_180_names[] = {"0", "1", NULL};
+static int corpus_180_lens[] = {1, 1, 0};
+
+static int corpus_180_f1(pbg_field* v, pbg_error* err);
+
+int corpus_180(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_180_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_180_f1(v, err);
+}
+
+int corpus_180_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_180_names[i], corpus_180_lens[i]);
+	result = corpus_180(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_180_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_180_isbool((v + 0)->_type) && corpus_180_isbool((v + 1)->_type)) {
+		first = corpus_180_bool((v + 0), err);
+		return corpus_180_order(err, PBG_OP_GTE, first - corpus_180_bool((v + 1), err));
+	}
+	return corpus_180_compare((v + 0), (v + 1), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_181(pbg_field* v, pbg_error* err);
+int corpus_181_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_181_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_181_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_181_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_181_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_181_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_181_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_181_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_181_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_181_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_181_order(err, op, corpus_181_cmp(c0, c1));
+}
+
+static char* corpus_181_names[] = {"0", NULL};
+static int corpus_181_lens[] = {1, 0};
+
+static int corpus_181_f1(pbg_field* v, pbg_error* err);
+
+int corpus_181(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_181_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_181_f1(v, err);
+}
+
+int corpus_181_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_181_names[i], corpus_181_lens[i]);
+	result = corpus_181(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_181_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_181_isbool((v + 0)->_type) && corpus_181_isbool((v + 0)->_type)) {
+		first = corpus_181_bool((v + 0), err);
+		return corpus_181_order(err, PBG_OP_GTE, first - corpus_181_bool((v + 0), err));
+	}
+	return corpus_181_compare((v + 0), (v + 0), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_182(pbg_field* v, pbg_error* err);
+int corpus_182_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_182_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_182_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_182_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_182_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_182_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_182_d3 = {2018, 10, 12};
+static pbg_field corpus_182_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_DATE, 0, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_182_d3},
+};
+
+static char* corpus_182_names[] = {NULL};
+static int corpus_182_lens[] = {0};
+
+static int corpus_182_f1(pbg_field* v, pbg_error* err);
+
+int corpus_182(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_182_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_182_f1(v, err);
+}
+
+int corpus_182_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_182_names[i], corpus_182_lens[i]);
+	result = corpus_182(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_182_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_182_c[1]);
+	c[1] = (&corpus_182_c[2]);
+	return corpus_182_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_183(pbg_field* v, pbg_error* err);
+int corpus_183_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_183_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_183_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_183_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_183_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_183_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_183_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_DATE, 0, NULL},
+};
+
+static char* corpus_183_names[] = {"a", NULL};
+static int corpus_183_lens[] = {1, 0};
+
+static int corpus_183_f1(pbg_field* v, pbg_error* err);
+
+int corpus_183(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_183_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_183_f1(v, err);
+}
+
+int corpus_183_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_183_names[i], corpus_183_lens[i]);
+	result = corpus_183(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_183_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_183_c[1]);
+	c[1] = (v + 0);
+	return corpus_183_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_184(pbg_field* v, pbg_error* err);
+int corpus_184_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_184_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_184_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_184_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_184_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_184_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_184_d3 = {2018, 10, 12};
+static pbg_lt_date corpus_184_d4 = {2017, 10, 12};
+static pbg_field corpus_184_c[] = {
+	{PBG_OP_TYPE, 3, NULL},
+	{PBG_LT_TP_DATE, 0, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_184_d3},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_184_d4},
+};
+
+static char* corpus_184_names[] = {NULL};
+static int corpus_184_lens[] = {0};
+
+static int corpus_184_f1(pbg_field* v, pbg_error* err);
+
+int corpus_184(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_184_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_184_f1(v, err);
+}
+
+int corpus_184_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_184_names[i], corpus_184_lens[i]);
+	result = corpus_184(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_184_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_184_c[1]);
+	c[1] = (&corpus_184_c[2]);
+	c[2] = (&corpus_184_c[3]);
+	return corpus_184_type(c, 3, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_185(pbg_field* v, pbg_error* err);
+int corpus_185_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_185_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_185_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_185_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_185_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_185_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_date corpus_185_d3 = {2018, 10, 12};
+static pbg_lt_number corpus_185_n4 = {10.0};
+static pbg_field corpus_185_c[] = {
+	{PBG_OP_TYPE, 3, NULL},
+	{PBG_LT_TP_DATE, 0, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_185_d3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_185_n4},
+};
+
+static char* corpus_185_names[] = {NULL};
+static int corpus_185_lens[] = {0};
+
+static int corpus_185_f1(pbg_field* v, pbg_error* err);
+
+int corpus_185(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_185_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_185_f1(v, err);
+}
+
+int corpus_185_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_185_names[i], corpus_185_lens[i]);
+	result = corpus_185(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_185_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_185_c[1]);
+	c[1] = (&corpus_185_c[2]);
+	c[2] = (&corpus_185_c[3]);
+	return corpus_185_type(c, 3, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_186(pbg_field* v, pbg_error* err);
+int corpus_186_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_186_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_186_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_186_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_186_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_186_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_186_n3 = {10.0};
+static pbg_field corpus_186_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_NUMBER, 0, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_186_n3},
+};
+
+static char* corpus_186_names[] = {NULL};
+static int corpus_186_lens[] = {0};
+
+static int corpus_186_f1(pbg_field* v, pbg_error* err);
+
+int corpus_186(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_186_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_186_f1(v, err);
+}
+
+int corpus_186_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_186_names[i], corpus_186_lens[i]);
+	result = corpus_186(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_186_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_186_c[1]);
+	c[1] = (&corpus_186_c[2]);
+	return corpus_186_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_187(pbg_field* v, pbg_error* err);
+int corpus_187_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_187_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_187_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_187_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_187_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_187_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_187_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_NUMBER, 0, NULL},
+};
+
+static char* corpus_187_names[] = {"a", NULL};
+static int corpus_187_lens[] = {1, 0};
+
+static int corpus_187_f1(pbg_field* v, pbg_error* err);
+
+int corpus_187(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_187_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_187_f1(v, err);
+}
+
+int corpus_187_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_187_names[i], corpus_187_lens[i]);
+	result = corpus_187(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_187_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_187_c[1]);
+	c[1] = (v + 0);
+	return corpus_187_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_188(pbg_field* v, pbg_error* err);
+int corpus_188_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_188_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_188_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_188_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_188_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_188_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_188_n3 = {10.0};
+static pbg_lt_number corpus_188_n4 = {12.0};
+static pbg_lt_number corpus_188_n5 = {13.0};
+static pbg_field corpus_188_c[] = {
+	{PBG_OP_TYPE, 4, NULL},
+	{PBG_LT_TP_NUMBER, 0, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_188_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_188_n4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_188_n5},
+};
+
+static char* corpus_188_names[] = {NULL};
+static int corpus_188_lens[] = {0};
+
+static int corpus_188_f1(pbg_field* v, pbg_error* err);
+
+int corpus_188(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_188_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_188_f1(v, err);
+}
+
+int corpus_188_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_188_names[i], corpus_188_lens[i]);
+	result = corpus_188(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_188_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[4];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_188_c[1]);
+	c[1] = (&corpus_188_c[2]);
+	c[2] = (&corpus_188_c[3]);
+	c[3] = (&corpus_188_c[4]);
+	return corpus_188_type(c, 4, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_189(pbg_field* v, pbg_error* err);
+int corpus_189_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_189_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_189_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_189_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_189_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_189_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_189_n3 = {10.0};
+static pbg_lt_number corpus_189_n4 = {12.0};
+static char corpus_189_s5[] = "hi";
+static pbg_lt_number corpus_189_n6 = {13.0};
+static pbg_field corpus_189_c[] = {
+	{PBG_OP_TYPE, 5, NULL},
+	{PBG_LT_TP_NUMBER, 0, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_189_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_189_n4},
+	{PBG_LT_STRING, 2, corpus_189_s5},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_189_n6},
+};
+
+static char* corpus_189_names[] = {NULL};
+static int corpus_189_lens[] = {0};
+
+static int corpus_189_f1(pbg_field* v, pbg_error* err);
+
+int corpus_189(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_189_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_189_f1(v, err);
+}
+
+int corpus_189_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_189_names[i], corpus_189_lens[i]);
+	result = corpus_189(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_189_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_189_c[1]);
+	c[1] = (&corpus_189_c[2]);
+	c[2] = (&corpus_189_c[3]);
+	c[3] = (&corpus_189_c[4]);
+	c[4] = (&corpus_189_c[5]);
+	return corpus_189_type(c, 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_190(pbg_field* v, pbg_error* err);
+int corpus_190_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_190_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_190_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_190_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_190_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_190_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char corpus_190_s3[] = "hi";
+static pbg_field corpus_190_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_STRING, 0, NULL},
+	{PBG_LT_STRING, 2, corpus_190_s3},
+};
+
+static char* corpus_190_names[] = {NULL};
+static int corpus_190_lens[] = {0};
+
+static int corpus_190_f1(pbg_field* v, pbg_error* err);
+
+int corpus_190(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_190_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_190_f1(v, err);
+}
+
+int corpus_190_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_190_names[i], corpus_190_lens[i]);
+	result = corpus_190(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_190_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_190_c[1]);
+	c[1] = (&corpus_190_c[2]);
+	return corpus_190_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_191(pbg_field* v, pbg_error* err);
+int corpus_191_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_191_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_191_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_191_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_191_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_191_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_191_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_STRING, 0, NULL},
+};
+
+static char* corpus_191_names[] = {"a", NULL};
+static int corpus_191_lens[] = {1, 0};
+
+static int corpus_191_f1(pbg_field* v, pbg_error* err);
+
+int corpus_191(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_191_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_191_f1(v, err);
+}
+
+int corpus_191_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_191_names[i], corpus_191_lens[i]);
+	result = corpus_191(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_191_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_191_c[1]);
+	c[1] = (v + 0);
+	return corpus_191_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_192(pbg_field* v, pbg_error* err);
+int corpus_192_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_192_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_192_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_192_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_192_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_192_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char corpus_192_s3[] = "hi";
+static char corpus_192_s4[] = "a";
+static char corpus_192_s5[] = "b";
+static pbg_field corpus_192_c[] = {
+	{PBG_OP_TYPE, 4, NULL},
+	{PBG_LT_TP_STRING, 0, NULL},
+	{PBG_LT_STRING, 2, corpus_192_s3},
+	{PBG_LT_STRING, 1, corpus_192_s4},
+	{PBG_LT_STRING, 1, corpus_192_s5},
+};
+
+static char* corpus_192_names[] = {NULL};
+static int corpus_192_lens[] = {0};
+
+static int corpus_192_f1(pbg_field* v, pbg_error* err);
+
+int corpus_192(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_192_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_192_f1(v, err);
+}
+
+int corpus_192_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_192_names[i], corpus_192_lens[i]);
+	result = corpus_192(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_192_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[4];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_192_c[1]);
+	c[1] = (&corpus_192_c[2]);
+	c[2] = (&corpus_192_c[3]);
+	c[3] = (&corpus_192_c[4]);
+	return corpus_192_type(c, 4, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_193(pbg_field* v, pbg_error* err);
+int corpus_193_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_193_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_193_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_193_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_193_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_193_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char corpus_193_s3[] = "a";
+static pbg_lt_number corpus_193_n4 = {12.0};
+static char corpus_193_s5[] = "hi";
+static char corpus_193_s6[] = "b";
+static pbg_field corpus_193_c[] = {
+	{PBG_OP_TYPE, 5, NULL},
+	{PBG_LT_TP_STRING, 0, NULL},
+	{PBG_LT_STRING, 1, corpus_193_s3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_193_n4},
+	{PBG_LT_STRING, 2, corpus_193_s5},
+	{PBG_LT_STRING, 1, corpus_193_s6},
+};
+
+static char* corpus_193_names[] = {NULL};
+static int corpus_193_lens[] = {0};
+
+static int corpus_193_f1(pbg_field* v, pbg_error* err);
+
+int corpus_193(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_193_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_193_f1(v, err);
+}
+
+int corpus_193_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_193_names[i], corpus_193_lens[i]);
+	result = corpus_193(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_193_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_193_c[1]);
+	c[1] = (&corpus_193_c[2]);
+	c[2] = (&corpus_193_c[3]);
+	c[3] = (&corpus_193_c[4]);
+	c[4] = (&corpus_193_c[5]);
+	return corpus_193_type(c, 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_194(pbg_field* v, pbg_error* err);
+int corpus_194_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_194_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_194_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_194_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_194_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_194_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_194_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+};
+
+static char* corpus_194_names[] = {NULL};
+static int corpus_194_lens[] = {0};
+
+static int corpus_194_f1(pbg_field* v, pbg_error* err);
+
+int corpus_194(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_194_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_194_f1(v, err);
+}
+
+int corpus_194_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_194_names[i], corpus_194_lens[i]);
+	result = corpus_194(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_194_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_194_c[1]);
+	c[1] = (&corpus_194_c[2]);
+	return corpus_194_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_195(pbg_field* v, pbg_error* err);
+int corpus_195_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_195_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_195_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_195_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_195_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_195_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_195_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+};
+
+static char* corpus_195_names[] = {NULL};
+static int corpus_195_lens[] = {0};
+
+static int corpus_195_f1(pbg_field* v, pbg_error* err);
+
+int corpus_195(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_195_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_195_f1(v, err);
+}
+
+int corpus_195_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_195_names[i], corpus_195_lens[i]);
+	result = corpus_195(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_195_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_195_c[1]);
+	c[1] = (&corpus_195_c[2]);
+	return corpus_195_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_196(pbg_field* v, pbg_error* err);
+int corpus_196_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_196_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_196_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_196_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_196_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_196_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_196_c[] = {
+	{PBG_OP_TYPE, 6, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+};
+
+static char* corpus_196_names[] = {NULL};
+static int corpus_196_lens[] = {0};
+
+static int corpus_196_f1(pbg_field* v, pbg_error* err);
+
+int corpus_196(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_196_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_196_f1(v, err);
+}
+
+int corpus_196_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_196_names[i], corpus_196_lens[i]);
+	result = corpus_196(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_196_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[6];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_196_c[1]);
+	c[1] = (&corpus_196_c[2]);
+	c[2] = (&corpus_196_c[3]);
+	c[3] = (&corpus_196_c[4]);
+	c[4] = (&corpus_196_c[5]);
+	c[5] = (&corpus_196_c[6]);
+	return corpus_196_type(c, 6, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_197(pbg_field* v, pbg_error* err);
+int corpus_197_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_197_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_197_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_197_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_197_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_197_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_197_n5 = {10.0};
+static pbg_field corpus_197_c[] = {
+	{PBG_OP_TYPE, 6, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_197_n5},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+};
+
+static char* corpus_197_names[] = {NULL};
+static int corpus_197_lens[] = {0};
+
+static int corpus_197_f1(pbg_field* v, pbg_error* err);
+
+int corpus_197(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_197_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_197_f1(v, err);
+}
+
+int corpus_197_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_197_names[i], corpus_197_lens[i]);
+	result = corpus_197(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_197_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[6];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_197_c[1]);
+	c[1] = (&corpus_197_c[2]);
+	c[2] = (&corpus_197_c[3]);
+	c[3] = (&corpus_197_c[4]);
+	c[4] = (&corpus_197_c[5]);
+	c[5] = (&corpus_197_c[6]);
+	return corpus_197_type(c, 6, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_198(pbg_field* v, pbg_error* err);
+int corpus_198_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_198_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_198_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_198_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_198_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_198_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_198_n3 = {10.0};
+static pbg_field corpus_198_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_198_n3},
+};
+
+static char* corpus_198_names[] = {NULL};
+static int corpus_198_lens[] = {0};
+
+static int corpus_198_f1(pbg_field* v, pbg_error* err);
+
+int corpus_198(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_198_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_198_f1(v, err);
+}
+
+int corpus_198_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_198_names[i], corpus_198_lens[i]);
+	result = corpus_198(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_198_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_198_c[1]);
+	c[1] = (&corpus_198_c[2]);
+	return corpus_198_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_199(pbg_field* v, pbg_error* err);
+int corpus_199_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_199_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_199_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_199_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_199_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_199_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char corpus_199_s3[] = "hi";
+static pbg_field corpus_199_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_LT_STRING, 2, corpus_199_s3},
+};
+
+static char* corpus_199_names[] = {NULL};
+static int corpus_199_lens[] = {0};
+
+static int corpus_199_f1(pbg_field* v, pbg_error* err);
+
+int corpus_199(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_199_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_199_f1(v, err);
+}
+
+int corpus_199_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_199_names[i], corpus_199_lens[i]);
+	result = corpus_199(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_199_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_199_c[1]);
+	c[1] = (&corpus_199_c[2]);
+	return corpus_199_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_200(pbg_field* v, pbg_error* err);
+int corpus_200_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_200_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_200_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_200_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_200_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_200_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_200_n4 = {10.0};
+static pbg_lt_number corpus_200_n5 = {10.0};
+static pbg_field corpus_200_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_OP_AND, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_200_n4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_200_n5},
+};
+
+static char* corpus_200_names[] = {NULL};
+static int corpus_200_lens[] = {0};
+
+static int corpus_200_f1(pbg_field* v, pbg_error* err);
+
+int corpus_200(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_200_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_200_f1(v, err);
+}
+
+int corpus_200_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_200_names[i], corpus_200_lens[i]);
+	result = corpus_200(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_200_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_200_c[1]);
+	c[1] = (&corpus_200_c[2]);
+	return corpus_200_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_201(pbg_field* v, pbg_error* err);
+int corpus_201_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_201_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_201_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_201_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_201_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_201_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_201_n4 = {10.0};
+static pbg_lt_number corpus_201_n5 = {10.0};
+static char corpus_201_s6[] = "hi";
+static pbg_field corpus_201_c[] = {
+	{PBG_OP_TYPE, 5, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_OP_AND, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_201_n4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_201_n5},
+	{PBG_LT_STRING, 2, corpus_201_s6},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+};
+
+static char* corpus_201_names[] = {NULL};
+static int corpus_201_lens[] = {0};
+
+static int corpus_201_f1(pbg_field* v, pbg_error* err);
+
+int corpus_201(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_201_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_201_f1(v, err);
+}
+
+int corpus_201_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_201_names[i], corpus_201_lens[i]);
+	result = corpus_201(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_201_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_201_c[1]);
+	c[1] = (&corpus_201_c[2]);
+	c[2] = (&corpus_201_c[5]);
+	c[3] = (&corpus_201_c[6]);
+	c[4] = (&corpus_201_c[7]);
+	return corpus_201_type(c, 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_202(pbg_field* v, pbg_error* err);
+int corpus_202_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_202_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_202_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_202_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_202_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_202_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_202_c[] = {
+	{PBG_OP_TYPE, 5, NULL},
+	{PBG_LT_TP_BOOL, 0, NULL},
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_OP_EXST, 1, NULL},
+	{PBG_OP_AND, 2, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_OP_AND, 2, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+};
+
+static char* corpus_202_names[] = {"a", NULL};
+static int corpus_202_lens[] = {1, 0};
+
+static int corpus_202_f1(pbg_field* v, pbg_error* err);
+
+int corpus_202(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_202_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_202_f1(v, err);
+}
+
+int corpus_202_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_202_names[i], corpus_202_lens[i]);
+	result = corpus_202(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_202_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_202_c[1]);
+	c[1] = (&corpus_202_c[2]);
+	c[2] = (&corpus_202_c[4]);
+	c[3] = (&corpus_202_c[5]);
+	c[4] = (&corpus_202_c[8]);
+	return corpus_202_type(c, 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_203(pbg_field* v, pbg_error* err);
+int corpus_203_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_203_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_203_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_203_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_203_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_203_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_203_n2 = {10.0};
+static pbg_lt_number corpus_203_n3 = {10.0};
+static pbg_field corpus_203_c[] = {
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_203_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_203_n3},
+};
+
+static char* corpus_203_names[] = {NULL};
+static int corpus_203_lens[] = {0};
+
+static int corpus_203_f1(pbg_field* v, pbg_error* err);
+
+int corpus_203(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_203_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_203_f1(v, err);
+}
+
+int corpus_203_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_203_names[i], corpus_203_lens[i]);
+	result = corpus_203(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_203_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_203_c[1]);
+	c[1] = (&corpus_203_c[2]);
+	return corpus_203_type(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_204(pbg_field* v, pbg_error* err);
+int corpus_204_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_204_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_204_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_204_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_204_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_204_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_204_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_204_order(err, op, corpus_204_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_204_n2 = {3.0};
+static pbg_lt_number corpus_204_n3 = {2.0};
+static pbg_field corpus_204_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_204_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_204_n3},
+};
+
+static char* corpus_204_names[] = {NULL};
+static int corpus_204_lens[] = {0};
+
+static int corpus_204_f1(pbg_field* v, pbg_error* err);
+
+int corpus_204(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_204_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_204_f1(v, err);
+}
+
+int corpus_204_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_204_names[i], corpus_204_lens[i]);
+	result = corpus_204(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_204_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_204_compare((&corpus_204_c[1]), (&corpus_204_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_205(pbg_field* v, pbg_error* err);
+int corpus_205_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_205_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_205_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_205_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_205_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_205_n2 = {2.0};
+static pbg_lt_number corpus_205_n3 = {2.0};
+static pbg_field corpus_205_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_205_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_205_n3},
+};
+
+static char* corpus_205_names[] = {NULL};
+static int corpus_205_lens[] = {0};
+
+static int corpus_205_f1(pbg_field* v, pbg_error* err);
+
+int corpus_205(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_205_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_205_f1(v, err);
+}
+
+int corpus_205_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_205_names[i], corpus_205_lens[i]);
+	result = corpus_205(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_205_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_205_c[1]);
+	c[1] = (&corpus_205_c[2]);
+	return corpus_205_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_206(pbg_field* v, pbg_error* err);
+int corpus_206_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_206_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_206_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_206_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_206_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_206_n2 = {2.0};
+static pbg_lt_number corpus_206_n3 = {2.0};
+static pbg_field corpus_206_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_206_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_206_n3},
+};
+
+static char* corpus_206_names[] = {NULL};
+static int corpus_206_lens[] = {0};
+
+static int corpus_206_f1(pbg_field* v, pbg_error* err);
+
+int corpus_206(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_206_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_206_f1(v, err);
+}
+
+int corpus_206_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_206_names[i], corpus_206_lens[i]);
+	result = corpus_206(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_206_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_206_c[1]);
+	c[1] = (&corpus_206_c[2]);
+	return corpus_206_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_207(pbg_field* v, pbg_error* err);
+int corpus_207_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_207_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_207_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_207_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_207_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_207_s2[] = " hi ";
+static char corpus_207_s3[] = " hi";
+static pbg_field corpus_207_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 4, corpus_207_s2},
+	{PBG_LT_STRING, 3, corpus_207_s3},
+};
+
+static char* corpus_207_names[] = {NULL};
+static int corpus_207_lens[] = {0};
+
+static int corpus_207_f1(pbg_field* v, pbg_error* err);
+
+int corpus_207(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_207_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_207_f1(v, err);
+}
+
+int corpus_207_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_207_names[i], corpus_207_lens[i]);
+	result = corpus_207(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_207_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_207_c[1]);
+	c[1] = (&corpus_207_c[2]);
+	return corpus_207_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_208(pbg_field* v, pbg_error* err);
+int corpus_208_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_208_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_208_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_208_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_208_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_208_n2 = {2.0};
+static pbg_lt_number corpus_208_n3 = {2.0};
+static pbg_field corpus_208_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_208_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_208_n3},
+};
+
+static char* corpus_208_names[] = {NULL};
+static int corpus_208_lens[] = {0};
+
+static int corpus_208_f1(pbg_field* v, pbg_error* err);
+
+int corpus_208(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_208_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_208_f1(v, err);
+}
+
+int corpus_208_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_208_names[i], corpus_208_lens[i]);
+	result = corpus_208(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_208_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_208_c[1]);
+	c[1] = (&corpus_208_c[2]);
+	return corpus_208_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_209(pbg_field* v, pbg_error* err);
+int corpus_209_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_209_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_209_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_209_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_209_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_209_n2 = {2.0};
+static pbg_lt_number corpus_209_n3 = {2.0};
+static pbg_field corpus_209_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_209_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_209_n3},
+};
+
+static char* corpus_209_names[] = {NULL};
+static int corpus_209_lens[] = {0};
+
+static int corpus_209_f1(pbg_field* v, pbg_error* err);
+
+int corpus_209(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_209_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_209_f1(v, err);
+}
+
+int corpus_209_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_209_names[i], corpus_209_lens[i]);
+	result = corpus_209(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_209_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_209_c[1]);
+	c[1] = (&corpus_209_c[2]);
+	return corpus_209_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_210(pbg_field* v, pbg_error* err);
+int corpus_210_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_210_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_210_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_210_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_210_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_210_n2 = {2.0};
+static pbg_lt_number corpus_210_n3 = {2.0};
+static pbg_field corpus_210_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_210_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_210_n3},
+};
+
+static char* corpus_210_names[] = {NULL};
+static int corpus_210_lens[] = {0};
+
+static int corpus_210_f1(pbg_field* v, pbg_error* err);
+
+int corpus_210(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_210_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_210_f1(v, err);
+}
+
+int corpus_210_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_210_names[i], corpus_210_lens[i]);
+	result = corpus_210(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_210_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_210_c[1]);
+	c[1] = (&corpus_210_c[2]);
+	return corpus_210_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_211(pbg_field* v, pbg_error* err);
+int corpus_211_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_211_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_211_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_211_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_211_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_211_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_211_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_211_order(err, op, corpus_211_cmp(c0, c1));
+}
+
+static char corpus_211_s2[] = "hi";
+static pbg_lt_number corpus_211_n3 = {2.0};
+static pbg_field corpus_211_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_211_s2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_211_n3},
+};
+
+static char* corpus_211_names[] = {NULL};
+static int corpus_211_lens[] = {0};
+
+static int corpus_211_f1(pbg_field* v, pbg_error* err);
+
+int corpus_211(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_211_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_211_f1(v, err);
+}
+
+int corpus_211_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_211_names[i], corpus_211_lens[i]);
+	result = corpus_211(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_211_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_211_compare((&corpus_211_c[1]), (&corpus_211_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_212(pbg_field* v, pbg_error* err);
+int corpus_212_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_212_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_212_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_212_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_212_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_212_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_212_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_212_order(err, op, corpus_212_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_212_n2 = {2.0};
+static char corpus_212_s3[] = "hi";
+static pbg_field corpus_212_c[] = {
+	{PBG_OP_GTE, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_212_n2},
+	{PBG_LT_STRING, 2, corpus_212_s3},
+};
+
+static char* corpus_212_names[] = {NULL};
+static int corpus_212_lens[] = {0};
+
+static int corpus_212_f1(pbg_field* v, pbg_error* err);
+
+int corpus_212(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_212_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_212_f1(v, err);
+}
+
+int corpus_212_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_212_names[i], corpus_212_lens[i]);
+	result = corpus_212(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_212_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_212_compare((&corpus_212_c[1]), (&corpus_212_c[2]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_213(pbg_field* v, pbg_error* err);
+int corpus_213_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_213_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_213_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_213_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_213_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char corpus_213_s2[] = "a";
+static pbg_lt_number corpus_213_n3 = {97.0};
+static pbg_field corpus_213_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_213_s2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_213_n3},
+};
+
+static char* corpus_213_names[] = {NULL};
+static int corpus_213_lens[] = {0};
+
+static int corpus_213_f1(pbg_field* v, pbg_error* err);
+
+int corpus_213(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_213_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_213_f1(v, err);
+}
+
+int corpus_213_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_213_names[i], corpus_213_lens[i]);
+	result = corpus_213(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_213_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_213_c[1]);
+	c[1] = (&corpus_213_c[2]);
+	return corpus_213_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_214(pbg_field* v, pbg_error* err);
+int corpus_214_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_214_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_214_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_214_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static char corpus_214_s1[] = "test";
+static pbg_field corpus_214_c[] = {
+	{PBG_LT_STRING, 4, corpus_214_s1},
+};
+
+static char* corpus_214_names[] = {NULL};
+static int corpus_214_lens[] = {0};
+
+
+int corpus_214(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_214_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_214_bool((&corpus_214_c[0]), err);
+}
+
+int corpus_214_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_214_names[i], corpus_214_lens[i]);
+	result = corpus_214(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_215(pbg_field* v, pbg_error* err);
+int corpus_215_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_215_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_215_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_215_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_215_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_215_n3 = {10.0};
+static pbg_lt_number corpus_215_n4 = {10.0};
+static pbg_field corpus_215_c[] = {
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_215_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_215_n4},
+};
+
+static char* corpus_215_names[] = {NULL};
+static int corpus_215_lens[] = {0};
+
+static int corpus_215_f1(pbg_field* v, pbg_error* err);
+static int corpus_215_f2(pbg_field* v, pbg_error* err);
+
+int corpus_215(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_215_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_215_f1(v, err);
+}
+
+int corpus_215_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_215_names[i], corpus_215_lens[i]);
+	result = corpus_215(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_215_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_215_f2(v, err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+static int corpus_215_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_215_c[2]);
+	c[1] = (&corpus_215_c[3]);
+	return corpus_215_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_216(pbg_field* v, pbg_error* err);
+int corpus_216_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_216_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_216_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_216_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_216_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_216_n3 = {10.0};
+static pbg_lt_number corpus_216_n4 = {10.0};
+static pbg_lt_number corpus_216_n6 = {20.0};
+static pbg_lt_number corpus_216_n7 = {20.0};
+static pbg_field corpus_216_c[] = {
+	{PBG_OP_AND, 2, NULL},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_216_n3},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_216_n4},
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_216_n6},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_216_n7},
+};
+
+static char* corpus_216_names[] = {NULL};
+static int corpus_216_lens[] = {0};
+
+static int corpus_216_f1(pbg_field* v, pbg_error* err);
+static int corpus_216_f2(pbg_field* v, pbg_error* err);
+static int corpus_216_f5(pbg_field* v, pbg_error* err);
+
+int corpus_216(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_216_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_216_f1(v, err);
+}
+
+int corpus_216_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_216_names[i], corpus_216_lens[i]);
+	result = corpus_216(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_216_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_216_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_216_f5(v, err);
+	return r;
+}
+
+static int corpus_216_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_216_c[2]);
+	c[1] = (&corpus_216_c[3]);
+	return corpus_216_eq(c, 2, err);
+}
+
+static int corpus_216_f5(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_216_c[5]);
+	c[1] = (&corpus_216_c[6]);
+	return corpus_216_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_217(pbg_field* v, pbg_error* err);
+int corpus_217_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_217_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_217_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_217_names[] = {"a", "b", NULL};
+static int corpus_217_lens[] = {1, 1, 0};
+
+static int corpus_217_f1(pbg_field* v, pbg_error* err);
+static int corpus_217_f2(pbg_field* v, pbg_error* err);
+static int corpus_217_f3(pbg_field* v, pbg_error* err);
+
+int corpus_217(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_217_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_217_f1(v, err);
+}
+
+int corpus_217_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_217_names[i], corpus_217_lens[i]);
+	result = corpus_217(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_217_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_217_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_217_f3(v, err);
+	return r;
+}
+
+static int corpus_217_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_217_exst(c, 1);
+}
+
+static int corpus_217_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_217_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_218(pbg_field* v, pbg_error* err);
+int corpus_218_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_218_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_218_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_218_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_218_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_218_names[] = {"1", NULL};
+static int corpus_218_lens[] = {1, 0};
+
+static int corpus_218_f1(pbg_field* v, pbg_error* err);
+static int corpus_218_f2(pbg_field* v, pbg_error* err);
+static int corpus_218_f3(pbg_field* v, pbg_error* err);
+
+int corpus_218(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_218_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_218_f1(v, err);
+}
+
+int corpus_218_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_218_names[i], corpus_218_lens[i]);
+	result = corpus_218(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_218_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_218_f2(v, err);
+	return corpus_218_order(err, PBG_OP_LT, first - corpus_218_f3(v, err));
+}
+
+static int corpus_218_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_218_exst(c, 1);
+}
+
+static int corpus_218_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_218_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_219(pbg_field* v, pbg_error* err);
+int corpus_219_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_219_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_219_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_219_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_219_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_219_names[] = {"0", "1", NULL};
+static int corpus_219_lens[] = {1, 1, 0};
+
+static int corpus_219_f1(pbg_field* v, pbg_error* err);
+static int corpus_219_f2(pbg_field* v, pbg_error* err);
+static int corpus_219_f3(pbg_field* v, pbg_error* err);
+
+int corpus_219(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_219_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_219_f1(v, err);
+}
+
+int corpus_219_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_219_names[i], corpus_219_lens[i]);
+	result = corpus_219(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_219_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_219_f2(v, err);
+	return corpus_219_order(err, PBG_OP_LT, first - corpus_219_f3(v, err));
+}
+
+static int corpus_219_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_219_exst(c, 1);
+}
+
+static int corpus_219_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_219_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_220(pbg_field* v, pbg_error* err);
+int corpus_220_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_220_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_220_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_220_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_220_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_220_names[] = {"1", "0", NULL};
+static int corpus_220_lens[] = {1, 1, 0};
+
+static int corpus_220_f1(pbg_field* v, pbg_error* err);
+static int corpus_220_f2(pbg_field* v, pbg_error* err);
+static int corpus_220_f3(pbg_field* v, pbg_error* err);
+
+int corpus_220(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_220_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_220_f1(v, err);
+}
+
+int corpus_220_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_220_names[i], corpus_220_lens[i]);
+	result = corpus_220(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_220_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_220_f2(v, err);
+	return corpus_220_order(err, PBG_OP_LT, first - corpus_220_f3(v, err));
+}
+
+static int corpus_220_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_220_exst(c, 1);
+}
+
+static int corpus_220_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_220_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_221(pbg_field* v, pbg_error* err);
+int corpus_221_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_221_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_221_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_221_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_221_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_221_names[] = {"0", NULL};
+static int corpus_221_lens[] = {1, 0};
+
+static int corpus_221_f1(pbg_field* v, pbg_error* err);
+static int corpus_221_f2(pbg_field* v, pbg_error* err);
+static int corpus_221_f3(pbg_field* v, pbg_error* err);
+
+int corpus_221(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_221_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_221_f1(v, err);
+}
+
+int corpus_221_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_221_names[i], corpus_221_lens[i]);
+	result = corpus_221(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_221_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_221_f2(v, err);
+	return corpus_221_order(err, PBG_OP_LT, first - corpus_221_f3(v, err));
+}
+
+static int corpus_221_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_221_exst(c, 1);
+}
+
+static int corpus_221_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_221_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_222(pbg_field* v, pbg_error* err);
+int corpus_222_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_222_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_222_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_222_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_222_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_222_names[] = {"1", NULL};
+static int corpus_222_lens[] = {1, 0};
+
+static int corpus_222_f1(pbg_field* v, pbg_error* err);
+static int corpus_222_f2(pbg_field* v, pbg_error* err);
+static int corpus_222_f3(pbg_field* v, pbg_error* err);
+
+int corpus_222(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_222_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_222_f1(v, err);
+}
+
+int corpus_222_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_222_names[i], corpus_222_lens[i]);
+	result = corpus_222(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_222_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_222_f2(v, err);
+	return corpus_222_order(err, PBG_OP_LTE, first - corpus_222_f3(v, err));
+}
+
+static int corpus_222_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_222_exst(c, 1);
+}
+
+static int corpus_222_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_222_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_223(pbg_field* v, pbg_error* err);
+int corpus_223_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_223_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_223_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_223_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_223_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_223_names[] = {"0", "1", NULL};
+static int corpus_223_lens[] = {1, 1, 0};
+
+static int corpus_223_f1(pbg_field* v, pbg_error* err);
+static int corpus_223_f2(pbg_field* v, pbg_error* err);
+static int corpus_223_f3(pbg_field* v, pbg_error* err);
+
+int corpus_223(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_223_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_223_f1(v, err);
+}
+
+int corpus_223_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_223_names[i], corpus_223_lens[i]);
+	result = corpus_223(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_223_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_223_f2(v, err);
+	return corpus_223_order(err, PBG_OP_LTE, first - corpus_223_f3(v, err));
+}
+
+static int corpus_223_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_223_exst(c, 1);
+}
+
+static int corpus_223_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_223_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_224(pbg_field* v, pbg_error* err);
+int corpus_224_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_224_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_224_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_224_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_224_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_224_names[] = {"1", "0", NULL};
+static int corpus_224_lens[] = {1, 1, 0};
+
+static int corpus_224_f1(pbg_field* v, pbg_error* err);
+static int corpus_224_f2(pbg_field* v, pbg_error* err);
+static int corpus_224_f3(pbg_field* v, pbg_error* err);
+
+int corpus_224(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_224_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_224_f1(v, err);
+}
+
+int corpus_224_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_224_names[i], corpus_224_lens[i]);
+	result = corpus_224(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_224_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_224_f2(v, err);
+	return corpus_224_order(err, PBG_OP_LTE, first - corpus_224_f3(v, err));
+}
+
+static int corpus_224_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_224_exst(c, 1);
+}
+
+static int corpus_224_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_224_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_225(pbg_field* v, pbg_error* err);
+int corpus_225_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_225_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_225_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_225_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_225_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_225_names[] = {"0", NULL};
+static int corpus_225_lens[] = {1, 0};
+
+static int corpus_225_f1(pbg_field* v, pbg_error* err);
+static int corpus_225_f2(pbg_field* v, pbg_error* err);
+static int corpus_225_f3(pbg_field* v, pbg_error* err);
+
+int corpus_225(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_225_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_225_f1(v, err);
+}
+
+int corpus_225_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_225_names[i], corpus_225_lens[i]);
+	result = corpus_225(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_225_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_225_f2(v, err);
+	return corpus_225_order(err, PBG_OP_LTE, first - corpus_225_f3(v, err));
+}
+
+static int corpus_225_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_225_exst(c, 1);
+}
+
+static int corpus_225_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_225_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_226(pbg_field* v, pbg_error* err);
+int corpus_226_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_226_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_226_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_226_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_226_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_226_names[] = {"1", NULL};
+static int corpus_226_lens[] = {1, 0};
+
+static int corpus_226_f1(pbg_field* v, pbg_error* err);
+static int corpus_226_f2(pbg_field* v, pbg_error* err);
+static int corpus_226_f3(pbg_field* v, pbg_error* err);
+
+int corpus_226(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_226_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_226_f1(v, err);
+}
+
+int corpus_226_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_226_names[i], corpus_226_lens[i]);
+	result = corpus_226(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_226_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_226_f2(v, err);
+	return corpus_226_order(err, PBG_OP_GT, first - corpus_226_f3(v, err));
+}
+
+static int corpus_226_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_226_exst(c, 1);
+}
+
+static int corpus_226_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_226_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_227(pbg_field* v, pbg_error* err);
+int corpus_227_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_227_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_227_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_227_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_227_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_227_names[] = {"0", "1", NULL};
+static int corpus_227_lens[] = {1, 1, 0};
+
+static int corpus_227_f1(pbg_field* v, pbg_error* err);
+static int corpus_227_f2(pbg_field* v, pbg_error* err);
+static int corpus_227_f3(pbg_field* v, pbg_error* err);
+
+int corpus_227(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_227_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_227_f1(v, err);
+}
+
+int corpus_227_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_227_names[i], corpus_227_lens[i]);
+	result = corpus_227(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_227_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_227_f2(v, err);
+	return corpus_227_order(err, PBG_OP_GT, first - corpus_227_f3(v, err));
+}
+
+static int corpus_227_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_227_exst(c, 1);
+}
+
+static int corpus_227_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_227_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_228(pbg_field* v, pbg_error* err);
+int corpus_228_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_228_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_228_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_228_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_228_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_228_names[] = {"1", "0", NULL};
+static int corpus_228_lens[] = {1, 1, 0};
+
+static int corpus_228_f1(pbg_field* v, pbg_error* err);
+static int corpus_228_f2(pbg_field* v, pbg_error* err);
+static int corpus_228_f3(pbg_field* v, pbg_error* err);
+
+int corpus_228(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_228_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_228_f1(v, err);
+}
+
+int corpus_228_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_228_names[i], corpus_228_lens[i]);
+	result = corpus_228(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_228_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_228_f2(v, err);
+	return corpus_228_order(err, PBG_OP_GT, first - corpus_228_f3(v, err));
+}
+
+static int corpus_228_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_228_exst(c, 1);
+}
+
+static int corpus_228_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_228_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_229(pbg_field* v, pbg_error* err);
+int corpus_229_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_229_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_229_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_229_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_229_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_229_names[] = {"0", NULL};
+static int corpus_229_lens[] = {1, 0};
+
+static int corpus_229_f1(pbg_field* v, pbg_error* err);
+static int corpus_229_f2(pbg_field* v, pbg_error* err);
+static int corpus_229_f3(pbg_field* v, pbg_error* err);
+
+int corpus_229(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_229_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_229_f1(v, err);
+}
+
+int corpus_229_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_229_names[i], corpus_229_lens[i]);
+	result = corpus_229(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_229_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_229_f2(v, err);
+	return corpus_229_order(err, PBG_OP_GT, first - corpus_229_f3(v, err));
+}
+
+static int corpus_229_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_229_exst(c, 1);
+}
+
+static int corpus_229_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_229_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_230(pbg_field* v, pbg_error* err);
+int corpus_230_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_230_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_230_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_230_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_230_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_230_names[] = {"1", NULL};
+static int corpus_230_lens[] = {1, 0};
+
+static int corpus_230_f1(pbg_field* v, pbg_error* err);
+static int corpus_230_f2(pbg_field* v, pbg_error* err);
+static int corpus_230_f3(pbg_field* v, pbg_error* err);
+
+int corpus_230(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_230_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_230_f1(v, err);
+}
+
+int corpus_230_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_230_names[i], corpus_230_lens[i]);
+	result = corpus_230(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_230_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_230_f2(v, err);
+	return corpus_230_order(err, PBG_OP_GTE, first - corpus_230_f3(v, err));
+}
+
+static int corpus_230_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_230_exst(c, 1);
+}
+
+static int corpus_230_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_230_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_231(pbg_field* v, pbg_error* err);
+int corpus_231_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_231_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_231_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_231_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_231_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_231_names[] = {"0", "1", NULL};
+static int corpus_231_lens[] = {1, 1, 0};
+
+static int corpus_231_f1(pbg_field* v, pbg_error* err);
+static int corpus_231_f2(pbg_field* v, pbg_error* err);
+static int corpus_231_f3(pbg_field* v, pbg_error* err);
+
+int corpus_231(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_231_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_231_f1(v, err);
+}
+
+int corpus_231_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_231_names[i], corpus_231_lens[i]);
+	result = corpus_231(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_231_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_231_f2(v, err);
+	return corpus_231_order(err, PBG_OP_GTE, first - corpus_231_f3(v, err));
+}
+
+static int corpus_231_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_231_exst(c, 1);
+}
+
+static int corpus_231_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_231_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_232(pbg_field* v, pbg_error* err);
+int corpus_232_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_232_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_232_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_232_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_232_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_232_names[] = {"1", "0", NULL};
+static int corpus_232_lens[] = {1, 1, 0};
+
+static int corpus_232_f1(pbg_field* v, pbg_error* err);
+static int corpus_232_f2(pbg_field* v, pbg_error* err);
+static int corpus_232_f3(pbg_field* v, pbg_error* err);
+
+int corpus_232(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_232_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_232_f1(v, err);
+}
+
+int corpus_232_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_232_names[i], corpus_232_lens[i]);
+	result = corpus_232(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_232_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_232_f2(v, err);
+	return corpus_232_order(err, PBG_OP_GTE, first - corpus_232_f3(v, err));
+}
+
+static int corpus_232_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_232_exst(c, 1);
+}
+
+static int corpus_232_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_232_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_233(pbg_field* v, pbg_error* err);
+int corpus_233_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_233_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_233_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_233_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_233_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_233_names[] = {"0", NULL};
+static int corpus_233_lens[] = {1, 0};
+
+static int corpus_233_f1(pbg_field* v, pbg_error* err);
+static int corpus_233_f2(pbg_field* v, pbg_error* err);
+static int corpus_233_f3(pbg_field* v, pbg_error* err);
+
+int corpus_233(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_233_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_233_f1(v, err);
+}
+
+int corpus_233_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_233_names[i], corpus_233_lens[i]);
+	result = corpus_233(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_233_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_233_f2(v, err);
+	return corpus_233_order(err, PBG_OP_GTE, first - corpus_233_f3(v, err));
+}
+
+static int corpus_233_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_233_exst(c, 1);
+}
+
+static int corpus_233_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_233_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_234(pbg_field* v, pbg_error* err);
+int corpus_234_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_234_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_234_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_234_names[] = {"1", NULL};
+static int corpus_234_lens[] = {1, 0};
+
+static int corpus_234_f1(pbg_field* v, pbg_error* err);
+static int corpus_234_f2(pbg_field* v, pbg_error* err);
+static int corpus_234_f3(pbg_field* v, pbg_error* err);
+
+int corpus_234(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_234_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_234_f1(v, err);
+}
+
+int corpus_234_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_234_names[i], corpus_234_lens[i]);
+	result = corpus_234(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_234_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_234_f2(v, err);
+	if(corpus_234_f3(v, err) != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static int corpus_234_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_234_exst(c, 1);
+}
+
+static int corpus_234_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_234_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_235(pbg_field* v, pbg_error* err);
+int corpus_235_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_235_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_235_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_235_names[] = {"0", "1", NULL};
+static int corpus_235_lens[] = {1, 1, 0};
+
+static int corpus_235_f1(pbg_field* v, pbg_error* err);
+static int corpus_235_f2(pbg_field* v, pbg_error* err);
+static int corpus_235_f3(pbg_field* v, pbg_error* err);
+
+int corpus_235(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_235_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_235_f1(v, err);
+}
+
+int corpus_235_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_235_names[i], corpus_235_lens[i]);
+	result = corpus_235(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_235_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_235_f2(v, err);
+	if(corpus_235_f3(v, err) != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static int corpus_235_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_235_exst(c, 1);
+}
+
+static int corpus_235_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_235_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_236(pbg_field* v, pbg_error* err);
+int corpus_236_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_236_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_236_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_236_names[] = {"1", "0", NULL};
+static int corpus_236_lens[] = {1, 1, 0};
+
+static int corpus_236_f1(pbg_field* v, pbg_error* err);
+static int corpus_236_f2(pbg_field* v, pbg_error* err);
+static int corpus_236_f3(pbg_field* v, pbg_error* err);
+
+int corpus_236(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_236_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_236_f1(v, err);
+}
+
+int corpus_236_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_236_names[i], corpus_236_lens[i]);
+	result = corpus_236(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_236_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_236_f2(v, err);
+	if(corpus_236_f3(v, err) != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static int corpus_236_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_236_exst(c, 1);
+}
+
+static int corpus_236_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_236_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_237(pbg_field* v, pbg_error* err);
+int corpus_237_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_237_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_237_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_237_names[] = {"0", NULL};
+static int corpus_237_lens[] = {1, 0};
+
+static int corpus_237_f1(pbg_field* v, pbg_error* err);
+static int corpus_237_f2(pbg_field* v, pbg_error* err);
+static int corpus_237_f3(pbg_field* v, pbg_error* err);
+
+int corpus_237(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_237_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_237_f1(v, err);
+}
+
+int corpus_237_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_237_names[i], corpus_237_lens[i]);
+	result = corpus_237(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_237_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_237_f2(v, err);
+	if(corpus_237_f3(v, err) != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static int corpus_237_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_237_exst(c, 1);
+}
+
+static int corpus_237_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_237_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_238(pbg_field* v, pbg_error* err);
+int corpus_238_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_238_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_238_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_238_names[] = {"1", NULL};
+static int corpus_238_lens[] = {1, 0};
+
+static int corpus_238_f1(pbg_field* v, pbg_error* err);
+static int corpus_238_f2(pbg_field* v, pbg_error* err);
+static int corpus_238_f3(pbg_field* v, pbg_error* err);
+
+int corpus_238(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_238_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_238_f1(v, err);
+}
+
+int corpus_238_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_238_names[i], corpus_238_lens[i]);
+	result = corpus_238(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_238_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_238_f2(v, err);
+	return (first != corpus_238_f3(v, err)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_238_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_238_exst(c, 1);
+}
+
+static int corpus_238_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_238_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_239(pbg_field* v, pbg_error* err);
+int corpus_239_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_239_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_239_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_239_names[] = {"0", "1", NULL};
+static int corpus_239_lens[] = {1, 1, 0};
+
+static int corpus_239_f1(pbg_field* v, pbg_error* err);
+static int corpus_239_f2(pbg_field* v, pbg_error* err);
+static int corpus_239_f3(pbg_field* v, pbg_error* err);
+
+int corpus_239(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_239_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_239_f1(v, err);
+}
+
+int corpus_239_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_239_names[i], corpus_239_lens[i]);
+	result = corpus_239(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_239_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_239_f2(v, err);
+	return (first != corpus_239_f3(v, err)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_239_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_239_exst(c, 1);
+}
+
+static int corpus_239_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_239_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_240(pbg_field* v, pbg_error* err);
+int corpus_240_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_240_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_240_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_240_names[] = {"1", "0", NULL};
+static int corpus_240_lens[] = {1, 1, 0};
+
+static int corpus_240_f1(pbg_field* v, pbg_error* err);
+static int corpus_240_f2(pbg_field* v, pbg_error* err);
+static int corpus_240_f3(pbg_field* v, pbg_error* err);
+
+int corpus_240(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_240_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_240_f1(v, err);
+}
+
+int corpus_240_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_240_names[i], corpus_240_lens[i]);
+	result = corpus_240(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_240_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_240_f2(v, err);
+	return (first != corpus_240_f3(v, err)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_240_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_240_exst(c, 1);
+}
+
+static int corpus_240_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 1);
+	return corpus_240_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_241(pbg_field* v, pbg_error* err);
+int corpus_241_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_241_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_241_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_241_names[] = {"0", NULL};
+static int corpus_241_lens[] = {1, 0};
+
+static int corpus_241_f1(pbg_field* v, pbg_error* err);
+static int corpus_241_f2(pbg_field* v, pbg_error* err);
+static int corpus_241_f3(pbg_field* v, pbg_error* err);
+
+int corpus_241(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_241_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_241_f1(v, err);
+}
+
+int corpus_241_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_241_names[i], corpus_241_lens[i]);
+	result = corpus_241(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_241_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_241_f2(v, err);
+	return (first != corpus_241_f3(v, err)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_241_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_241_exst(c, 1);
+}
+
+static int corpus_241_f3(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[1];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	return corpus_241_exst(c, 1);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_242(pbg_field* v, pbg_error* err);
+int corpus_242_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_242_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_242_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_242_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_242_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_242_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_242_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_242_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_242_names[] = {"a", "b", NULL};
+static int corpus_242_lens[] = {1, 1, 0};
+
+static int corpus_242_f1(pbg_field* v, pbg_error* err);
+
+int corpus_242(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_242_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_242_f1(v, err);
+}
+
+int corpus_242_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_242_names[i], corpus_242_lens[i]);
+	result = corpus_242(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_242_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_242_isbool((v + 0)->_type)) {
+		first = corpus_242_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_242_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_242_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_242_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_243(pbg_field* v, pbg_error* err);
+int corpus_243_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_243_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_243_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_243_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_243_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_243_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_243_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_243_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_243_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_243_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_243_order(err, op, corpus_243_cmp(c0, c1));
+}
+
+static char* corpus_243_names[] = {"a", "c", NULL};
+static int corpus_243_lens[] = {1, 1, 0};
+
+static int corpus_243_f1(pbg_field* v, pbg_error* err);
+
+int corpus_243(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_243_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_243_f1(v, err);
+}
+
+int corpus_243_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_243_names[i], corpus_243_lens[i]);
+	result = corpus_243(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_243_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_243_isbool((v + 0)->_type) && corpus_243_isbool((v + 1)->_type)) {
+		first = corpus_243_bool((v + 0), err);
+		return corpus_243_order(err, PBG_OP_LT, first - corpus_243_bool((v + 1), err));
+	}
+	return corpus_243_compare((v + 0), (v + 1), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_244(pbg_field* v, pbg_error* err);
+int corpus_244_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_244_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_244_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_244_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_244_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_244_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_244_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_244_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_244_names[] = {"a", "b", "c", NULL};
+static int corpus_244_lens[] = {1, 1, 1, 0};
+
+static int corpus_244_f1(pbg_field* v, pbg_error* err);
+
+int corpus_244(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_244_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_244_f1(v, err);
+}
+
+int corpus_244_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_244_names[i], corpus_244_lens[i]);
+	result = corpus_244(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_244_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[4];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_244_isbool((v + 0)->_type)) {
+		first = corpus_244_bool((v + 0), err);
+		if((v + 0)->_type == PBG_NULL) return corpus_244_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_244_bool((v + 0), err) != first) return PBG_FALSE;
+		if((v + 1)->_type == PBG_NULL) return corpus_244_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_244_bool((v + 1), err) != first) return PBG_FALSE;
+		if((v + 2)->_type == PBG_NULL) return corpus_244_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_244_bool((v + 2), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 0);
+	c[2] = (v + 1);
+	c[3] = (v + 2);
+	return corpus_244_eq(c, 4, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_245(pbg_field* v, pbg_error* err);
+int corpus_245_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_245_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_245_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_245_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_245_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_245_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_245_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_245_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_245_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_245_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_245_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_245_s3[] = "hi";
+static pbg_lt_date corpus_245_d5 = {2018, 10, 12};
+static pbg_field corpus_245_c[] = {
+	{PBG_OP_AND, 2, NULL},
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_245_s3},
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_245_d5},
+};
+
+static char* corpus_245_names[] = {"s", "d", NULL};
+static int corpus_245_lens[] = {1, 1, 0};
+
+static int corpus_245_f1(pbg_field* v, pbg_error* err);
+static int corpus_245_f2(pbg_field* v, pbg_error* err);
+static int corpus_245_f4(pbg_field* v, pbg_error* err);
+
+int corpus_245(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_245_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_245_f1(v, err);
+}
+
+int corpus_245_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_245_names[i], corpus_245_lens[i]);
+	result = corpus_245(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_245_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_245_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_245_f4(v, err);
+	return r;
+}
+
+static int corpus_245_f2(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_245_fused((v + 0), (&corpus_245_c[2]), PBG_OP_EQ);
+	if(corpus_245_isbool((v + 0)->_type)) {
+		first = corpus_245_bool((v + 0), err);
+		if(corpus_245_bool((&corpus_245_c[2]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_245_c[2]);
+	return corpus_245_eq(c, 2, err);
+}
+
+static int corpus_245_f4(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 1)->_type == PBG_LT_DATE)
+		return corpus_245_fused((v + 1), (&corpus_245_c[4]), PBG_OP_EQ);
+	if(corpus_245_isbool((v + 1)->_type)) {
+		first = corpus_245_bool((v + 1), err);
+		if(corpus_245_bool((&corpus_245_c[4]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 1);
+	c[1] = (&corpus_245_c[4]);
+	return corpus_245_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_246(pbg_field* v, pbg_error* err);
+int corpus_246_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_246_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_246_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_246_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_246_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_246_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_246_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_246_order(err, op, corpus_246_cmp(c0, c1));
+}
+
+static int corpus_246_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_246_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_246_s3[] = "hj";
+static pbg_lt_date corpus_246_d5 = {2018, 10, 11};
+static pbg_field corpus_246_c[] = {
+	{PBG_OP_AND, 2, NULL},
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_246_s3},
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_246_d5},
+};
+
+static char* corpus_246_names[] = {"s", "d", NULL};
+static int corpus_246_lens[] = {1, 1, 0};
+
+static int corpus_246_f1(pbg_field* v, pbg_error* err);
+static int corpus_246_f2(pbg_field* v, pbg_error* err);
+static int corpus_246_f4(pbg_field* v, pbg_error* err);
+
+int corpus_246(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_246_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_246_f1(v, err);
+}
+
+int corpus_246_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_246_names[i], corpus_246_lens[i]);
+	result = corpus_246(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_246_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_246_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_246_f4(v, err);
+	return r;
+}
+
+static int corpus_246_f2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_246_fused((v + 0), (&corpus_246_c[2]), PBG_OP_LT);
+	return corpus_246_compare((v + 0), (&corpus_246_c[2]), PBG_OP_LT, err);
+}
+
+static int corpus_246_f4(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 1)->_type == PBG_LT_DATE)
+		return corpus_246_fused((v + 1), (&corpus_246_c[4]), PBG_OP_GT);
+	return corpus_246_compare((v + 1), (&corpus_246_c[4]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_247(pbg_field* v, pbg_error* err);
+int corpus_247_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_247_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_247_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_247_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_247_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_247_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_247_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_247_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_247_c[] = {
+	{PBG_OP_AND, 3, NULL},
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_STRING, 0, NULL},
+	{PBG_OP_TYPE, 2, NULL},
+	{PBG_LT_TP_DATE, 0, NULL},
+	{PBG_OP_NOT, 1, NULL},
+};
+
+static char* corpus_247_names[] = {"s", "d", "t", NULL};
+static int corpus_247_lens[] = {1, 1, 1, 0};
+
+static int corpus_247_f1(pbg_field* v, pbg_error* err);
+static int corpus_247_f2(pbg_field* v, pbg_error* err);
+static int corpus_247_f4(pbg_field* v, pbg_error* err);
+static int corpus_247_f6(pbg_field* v, pbg_error* err);
+
+int corpus_247(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_247_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_247_f1(v, err);
+}
+
+int corpus_247_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_247_names[i], corpus_247_lens[i]);
+	result = corpus_247(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_247_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_247_f2(v, err)) != PBG_TRUE) return r;
+	if((r = corpus_247_f4(v, err)) != PBG_TRUE) return r;
+	r = corpus_247_f6(v, err);
+	return r;
+}
+
+static int corpus_247_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_247_c[2]);
+	c[1] = (v + 0);
+	return corpus_247_type(c, 2, err);
+}
+
+static int corpus_247_f4(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_247_c[4]);
+	c[1] = (v + 1);
+	return corpus_247_type(c, 2, err);
+}
+
+static int corpus_247_f6(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	r = corpus_247_bool((v + 2), err);
+	if(r == PBG_ERROR) return PBG_ERROR;
+	return (r == PBG_TRUE) ? PBG_FALSE : PBG_TRUE;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_248(pbg_field* v, pbg_error* err);
+int corpus_248_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_248_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_248_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_248_names[] = {"a", "x", NULL};
+static int corpus_248_lens[] = {1, 1, 0};
+
+static int corpus_248_f1(pbg_field* v, pbg_error* err);
+
+int corpus_248(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_248_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_248_f1(v, err);
+}
+
+int corpus_248_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_248_names[i], corpus_248_lens[i]);
+	result = corpus_248(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_248_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_248_exst(c, 2);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_249(pbg_field* v, pbg_error* err);
+int corpus_249_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_249_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_249_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_249_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_249_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_249_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_249_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_249_order(err, op, corpus_249_cmp(c0, c1));
+}
+
+static int corpus_249_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_249_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_249_n2 = {1.0};
+static pbg_field corpus_249_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_249_n2},
+};
+
+static char* corpus_249_names[] = {"x", NULL};
+static int corpus_249_lens[] = {1, 0};
+
+static int corpus_249_f1(pbg_field* v, pbg_error* err);
+
+int corpus_249(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_249_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_249_f1(v, err);
+}
+
+int corpus_249_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_249_names[i], corpus_249_lens[i]);
+	result = corpus_249(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_249_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_249_fused((v + 0), (&corpus_249_c[1]), PBG_OP_LT);
+	return corpus_249_compare((v + 0), (&corpus_249_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_250(pbg_field* v, pbg_error* err);
+int corpus_250_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_250_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_250_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_250_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_250_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_250_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static char* corpus_250_names[] = {"a", "c", NULL};
+static int corpus_250_lens[] = {1, 1, 0};
+
+static int corpus_250_f1(pbg_field* v, pbg_error* err);
+
+int corpus_250(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_250_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_250_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_250_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_250_f1(v, err);
+}
+
+int corpus_250_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_250_names[i], corpus_250_lens[i]);
+	result = corpus_250(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_250_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_250_sp((v + 0), (v + 1), 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_251(pbg_field* v, pbg_error* err);
+int corpus_251_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_251_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_251_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_251_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_251_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_251_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static char* corpus_251_names[] = {"a", "c", "b", NULL};
+static int corpus_251_lens[] = {1, 1, 1, 0};
+
+static int corpus_251_f1(pbg_field* v, pbg_error* err);
+static int corpus_251_f2(pbg_field* v, pbg_error* err);
+static int corpus_251_f3(pbg_field* v, pbg_error* err);
+
+int corpus_251(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_251_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_251_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_251_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[2]._type != PBG_LT_NUMBER)
+		return corpus_251_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_251_f1(v, err);
+}
+
+int corpus_251_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_251_names[i], corpus_251_lens[i]);
+	result = corpus_251(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_251_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_251_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_251_f3(v, err);
+	return r;
+}
+
+static int corpus_251_f2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_251_sp((v + 0), (v + 1), 2, err);
+}
+
+static int corpus_251_f3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_251_sp((v + 1), (v + 2), 5, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_252(pbg_field* v, pbg_error* err);
+int corpus_252_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_252_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_252_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_252_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_252_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_252_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static char* corpus_252_names[] = {"a", "b", "c", NULL};
+static int corpus_252_lens[] = {1, 1, 1, 0};
+
+static int corpus_252_f1(pbg_field* v, pbg_error* err);
+static int corpus_252_f2(pbg_field* v, pbg_error* err);
+static int corpus_252_f3(pbg_field* v, pbg_error* err);
+
+int corpus_252(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_252_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_252_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_252_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[2]._type != PBG_LT_NUMBER)
+		return corpus_252_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_252_f1(v, err);
+}
+
+int corpus_252_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_252_names[i], corpus_252_lens[i]);
+	result = corpus_252(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_252_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_252_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_252_f3(v, err);
+	return r;
+}
+
+static int corpus_252_f2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_252_sp((v + 0), (v + 1), 0, err);
+}
+
+static int corpus_252_f3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_252_sp((v + 2), (v + 1), 1, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_253(pbg_field* v, pbg_error* err);
+int corpus_253_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_253_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_253_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_253_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_253_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_253_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static char corpus_253_s2[] = "abc";
+static char corpus_253_s3[] = "abd";
+static pbg_field corpus_253_c[] = {
+	{PBG_SP_STRING_LTE, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_253_s2},
+	{PBG_LT_STRING, 3, corpus_253_s3},
+};
+
+static char* corpus_253_names[] = {NULL};
+static int corpus_253_lens[] = {0};
+
+static int corpus_253_f1(pbg_field* v, pbg_error* err);
+
+int corpus_253(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_253_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_253_f1(v, err);
+}
+
+int corpus_253_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_253_names[i], corpus_253_lens[i]);
+	result = corpus_253(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_253_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_253_sp((&corpus_253_c[1]), (&corpus_253_c[2]), 16, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_254(pbg_field* v, pbg_error* err);
+int corpus_254_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_254_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_254_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_254_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_254_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_254_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static pbg_lt_date corpus_254_d2 = {2018, 10, 13};
+static pbg_lt_date corpus_254_d3 = {2018, 10, 12};
+static pbg_field corpus_254_c[] = {
+	{PBG_SP_DATE_GT, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_254_d2},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_254_d3},
+};
+
+static char* corpus_254_names[] = {NULL};
+static int corpus_254_lens[] = {0};
+
+static int corpus_254_f1(pbg_field* v, pbg_error* err);
+
+int corpus_254(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_254_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_254_f1(v, err);
+}
+
+int corpus_254_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_254_names[i], corpus_254_lens[i]);
+	result = corpus_254(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_254_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_254_sp((&corpus_254_c[1]), (&corpus_254_c[2]), 9, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_255(pbg_field* v, pbg_error* err);
+int corpus_255_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_255_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_255_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_255_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_255_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_255_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_255_names[] = {"a", "b", "c", NULL};
+static int corpus_255_lens[] = {1, 1, 1, 0};
+
+static int corpus_255_f1(pbg_field* v, pbg_error* err);
+
+int corpus_255(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_255_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[2]._type != PBG_LT_NUMBER)
+		return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_255_f1(v, err);
+}
+
+int corpus_255_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_255_names[i], corpus_255_lens[i]);
+	result = corpus_255(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_255_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_255_isbool((v + 0)->_type)) {
+		first = corpus_255_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_255_bool((v + 1), err) != first) return PBG_FALSE;
+		if((v + 2)->_type == PBG_NULL) return corpus_255_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_255_bool((v + 2), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	c[2] = (v + 2);
+	return corpus_255_eq(c, 3, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_256(pbg_field* v, pbg_error* err);
+int corpus_256_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_256_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_256_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_256_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_256_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_256_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static char* corpus_256_names[] = {"a", "c", NULL};
+static int corpus_256_lens[] = {1, 1, 0};
+
+static int corpus_256_f1(pbg_field* v, pbg_error* err);
+static int corpus_256_f2(pbg_field* v, pbg_error* err);
+
+int corpus_256(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_256_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_256_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_256_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_256_f1(v, err);
+}
+
+int corpus_256_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_256_names[i], corpus_256_lens[i]);
+	result = corpus_256(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_256_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	first = corpus_256_f2(v, err);
+	if(PBG_TRUE != first) return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static int corpus_256_f2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_256_sp((v + 0), (v + 1), 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_257(pbg_field* v, pbg_error* err);
+int corpus_257_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_257_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_257_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_257_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_257_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_257_n2 = {6.0};
+static pbg_field corpus_257_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_257_n2},
+};
+
+static char* corpus_257_names[] = {"a", NULL};
+static int corpus_257_lens[] = {1, 0};
+
+static int corpus_257_f1(pbg_field* v, pbg_error* err);
+
+int corpus_257(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_257_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_257_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_257_f1(v, err);
+}
+
+int corpus_257_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_257_names[i], corpus_257_lens[i]);
+	result = corpus_257(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_257_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_257_fused((v + 0), (&corpus_257_c[1]), PBG_OP_LT);
+	return corpus_257_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_258(pbg_field* v, pbg_error* err);
+int corpus_258_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_258_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_258_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_258_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_258_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_258_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static int corpus_258_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_258_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_258_n4 = {5.0};
+static pbg_field corpus_258_c[] = {
+	{PBG_OP_AND, 2, NULL},
+	{PBG_SP_NUMBER_EQ, 2, NULL},
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_258_n4},
+};
+
+static char* corpus_258_names[] = {"a", "b", NULL};
+static int corpus_258_lens[] = {1, 1, 0};
+
+static int corpus_258_f1(pbg_field* v, pbg_error* err);
+static int corpus_258_f2(pbg_field* v, pbg_error* err);
+static int corpus_258_f3(pbg_field* v, pbg_error* err);
+
+int corpus_258(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_258_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_258_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_258_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_258_f1(v, err);
+}
+
+int corpus_258_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_258_names[i], corpus_258_lens[i]);
+	result = corpus_258(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_258_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_258_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_258_f3(v, err);
+	return r;
+}
+
+static int corpus_258_f2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_258_sp((v + 0), (v + 1), 0, err);
+}
+
+static int corpus_258_f3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_258_fused((v + 0), (&corpus_258_c[3]), PBG_OP_NEQ);
+	return corpus_258_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_259(pbg_field* v, pbg_error* err);
+int corpus_259_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_259_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_259_names[] = {"a", "b", NULL};
+static int corpus_259_lens[] = {1, 1, 0};
+
+
+int corpus_259(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_259_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_259_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_259_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return PBG_TRUE;
+}
+
+int corpus_259_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_259_names[i], corpus_259_lens[i]);
+	result = corpus_259(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_260(pbg_field* v, pbg_error* err);
+int corpus_260_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_260_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_260_names[] = {"a", "x", NULL};
+static int corpus_260_lens[] = {1, 1, 0};
+
+
+int corpus_260(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_260_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_260_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return PBG_FALSE;
+}
+
+int corpus_260_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_260_names[i], corpus_260_lens[i]);
+	result = corpus_260(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_261(pbg_field* v, pbg_error* err);
+int corpus_261_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_261_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_261_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_261_type(pbg_field** c, int n, pbg_error* err)
+{
+	pbg_field_type type;
+	int i;
+	type = c[0]->_type;
+	if(type < PBG_MIN_LT_TP || type > PBG_MAX_LT_TP)
+		return corpus_261_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "First input to TYPE operator must be a type literal.");
+	for(i = 1; i < n; i++)
+		if((type == PBG_LT_TP_BOOL && !corpus_261_isbool(c[i]->_type)) || 
+				(type == PBG_LT_TP_DATE && c[i]->_type != PBG_LT_DATE) || 
+				(type == PBG_LT_TP_NUMBER && c[i]->_type != PBG_LT_NUMBER) || 
+				(type == PBG_LT_TP_STRING && c[i]->_type != PBG_LT_STRING))
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_261_c[] = {
+	{PBG_OP_TYPE, 3, NULL},
+	{PBG_LT_TP_NUMBER, 0, NULL},
+};
+
+static char* corpus_261_names[] = {"a", "x", NULL};
+static int corpus_261_lens[] = {1, 1, 0};
+
+static int corpus_261_f1(pbg_field* v, pbg_error* err);
+
+int corpus_261(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_261_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_261_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_261_f1(v, err);
+}
+
+int corpus_261_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_261_names[i], corpus_261_lens[i]);
+	result = corpus_261(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_261_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_261_c[1]);
+	c[1] = (v + 0);
+	c[2] = (v + 1);
+	return corpus_261_type(c, 3, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_262(pbg_field* v, pbg_error* err);
+int corpus_262_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_262_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_262_names[] = {"a", "c", NULL};
+static int corpus_262_lens[] = {1, 1, 0};
+
+
+int corpus_262(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_262_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_262_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_262_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return PBG_TRUE;
+}
+
+int corpus_262_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_262_names[i], corpus_262_lens[i]);
+	result = corpus_262(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_263(pbg_field* v, pbg_error* err);
+int corpus_263_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_263_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_263_exst(pbg_field** c, int n)
+{
+	int i;
+	for(i = 0; i < n; i++)
+		if(c[i]->_type == PBG_NULL)
+			return PBG_FALSE;
+	return PBG_TRUE;
+}
+
+static char* corpus_263_names[] = {"a", "x", NULL};
+static int corpus_263_lens[] = {1, 1, 0};
+
+static int corpus_263_f1(pbg_field* v, pbg_error* err);
+
+int corpus_263(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_263_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_263_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_263_f1(v, err);
+}
+
+int corpus_263_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_263_names[i], corpus_263_lens[i]);
+	result = corpus_263(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_263_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_263_exst(c, 2);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_264(pbg_field* v, pbg_error* err);
+int corpus_264_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_264_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static char* corpus_264_names[] = {"a", "b", NULL};
+static int corpus_264_lens[] = {1, 1, 0};
+
+static int corpus_264_f1(pbg_field* v, pbg_error* err);
+
+int corpus_264(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_264_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_NUMBER)
+		return corpus_264_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(v[1]._type != PBG_LT_NUMBER)
+		return corpus_264_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_264_f1(v, err);
+}
+
+int corpus_264_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_264_names[i], corpus_264_lens[i]);
+	result = corpus_264(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_264_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = PBG_TRUE;
+	return r;
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_265(pbg_field* v, pbg_error* err);
+int corpus_265_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_265_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_265_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_265_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_265_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_265_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_265_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_265_order(err, op, corpus_265_cmp(c0, c1));
+}
+
+static int corpus_265_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_265_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_265_n2 = {6.0};
+static pbg_field corpus_265_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_265_n2},
+};
+
+static char* corpus_265_names[] = {"x", NULL};
+static int corpus_265_lens[] = {1, 0};
+
+static int corpus_265_f1(pbg_field* v, pbg_error* err);
+
+int corpus_265(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_265_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_265_f1(v, err);
+}
+
+int corpus_265_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_265_names[i], corpus_265_lens[i]);
+	result = corpus_265(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_265_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_265_fused((v + 0), (&corpus_265_c[1]), PBG_OP_LT);
+	return corpus_265_compare((v + 0), (&corpus_265_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_266(pbg_field* v, pbg_error* err);
+int corpus_266_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_266_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_266_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_266_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_266_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_266_d4 = {2018, 10, 13};
+static pbg_field corpus_266_c[] = {
+	{PBG_OP_OR, 2, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_266_d4},
+};
+
+static char* corpus_266_names[] = {"d", NULL};
+static int corpus_266_lens[] = {1, 0};
+
+static int corpus_266_f1(pbg_field* v, pbg_error* err);
+static int corpus_266_f3(pbg_field* v, pbg_error* err);
+
+int corpus_266(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_266_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_DATE)
+		return corpus_266_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_266_f1(v, err);
+}
+
+int corpus_266_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_266_names[i], corpus_266_lens[i]);
+	result = corpus_266(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_266_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_TRUE) != PBG_FALSE) return r;
+	r = corpus_266_f3(v, err);
+	return r;
+}
+
+static int corpus_266_f3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_DATE)
+		return corpus_266_fused((v + 0), (&corpus_266_c[3]), PBG_OP_LT);
+	return corpus_266_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_267(pbg_field* v, pbg_error* err);
+int corpus_267_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_267_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_267_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_267_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_267_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_267_s4[] = "abc";
+static pbg_field corpus_267_c[] = {
+	{PBG_OP_OR, 2, NULL},
+	{PBG_LT_FALSE, 0, NULL},
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_267_s4},
+};
+
+static char* corpus_267_names[] = {"s", NULL};
+static int corpus_267_lens[] = {1, 0};
+
+static int corpus_267_f1(pbg_field* v, pbg_error* err);
+static int corpus_267_f3(pbg_field* v, pbg_error* err);
+
+int corpus_267(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_267_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_STRING)
+		return corpus_267_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_267_f1(v, err);
+}
+
+int corpus_267_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_267_names[i], corpus_267_lens[i]);
+	result = corpus_267(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_267_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = corpus_267_f3(v, err);
+	return r;
+}
+
+static int corpus_267_f3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_267_fused((v + 0), (&corpus_267_c[3]), PBG_OP_EQ);
+	return corpus_267_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_268(pbg_field* v, pbg_error* err);
+int corpus_268_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_268_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_268_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_268_sp(pbg_field* c0, pbg_field* c1, int sp, pbg_error* err)
+{
+	pbg_field_type type;
+	int result;
+	type = (sp < 6) ? PBG_LT_NUMBER : (sp < 12) ? PBG_LT_DATE : PBG_LT_STRING;
+	if(c0->_type != type || c1->_type != type)
+		return corpus_268_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	if(sp % 6 < 2) {
+		result = (c0->_int == c1->_int && memcmp(c0->_data, c1->_data, c0->_int) == 0);
+		return (result == (sp % 6 == 0)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_268_cmp(c0, c1);
+	switch(sp % 6) {
+		case 2:  return result < 0 ? PBG_TRUE : PBG_FALSE;
+		case 3:  return result > 0 ? PBG_TRUE : PBG_FALSE;
+		case 4:  return result <= 0 ? PBG_TRUE : PBG_FALSE;
+		default: return result >= 0 ? PBG_TRUE : PBG_FALSE;
+	}
+}
+
+static char* corpus_268_names[] = {"s", NULL};
+static int corpus_268_lens[] = {1, 0};
+
+static int corpus_268_f1(pbg_field* v, pbg_error* err);
+static int corpus_268_f3(pbg_field* v, pbg_error* err);
+
+int corpus_268(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_268_fail(err, PBG_ERR_NONE, 0, NULL);
+	if(v[0]._type != PBG_LT_STRING)
+		return corpus_268_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Input does not match its declared type.");
+	return corpus_268_f1(v, err);
+}
+
+int corpus_268_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_268_names[i], corpus_268_lens[i]);
+	result = corpus_268(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_268_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = PBG_FALSE) != PBG_FALSE) return r;
+	r = corpus_268_f3(v, err);
+	return r;
+}
+
+static int corpus_268_f3(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_268_sp((v + 0), (v + 0), 12, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_269(pbg_field* v, pbg_error* err);
+int corpus_269_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_269_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_269_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_269_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_269_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_269_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_269_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_269_order(err, op, corpus_269_cmp(c0, c1));
+}
+
+static int corpus_269_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_269_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_269_n2 = {6.0};
+static pbg_field corpus_269_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_269_n2},
+};
+
+static char* corpus_269_names[] = {"a", NULL};
+static int corpus_269_lens[] = {1, 0};
+
+static int corpus_269_f1(pbg_field* v, pbg_error* err);
+
+int corpus_269(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_269_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_269_f1(v, err);
+}
+
+int corpus_269_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_269_names[i], corpus_269_lens[i]);
+	result = corpus_269(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_269_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_269_fused((v + 0), (&corpus_269_c[1]), PBG_OP_LT);
+	return corpus_269_compare((v + 0), (&corpus_269_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_270(pbg_field* v, pbg_error* err);
+int corpus_270_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_270_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_270_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_270_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_270_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_270_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_270_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_270_order(err, op, corpus_270_cmp(c0, c1));
+}
+
+static int corpus_270_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_270_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_270_n2 = {6.0};
+static pbg_field corpus_270_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_270_n2},
+};
+
+static char* corpus_270_names[] = {"a", NULL};
+static int corpus_270_lens[] = {1, 0};
+
+static int corpus_270_f1(pbg_field* v, pbg_error* err);
+
+int corpus_270(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_270_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_270_f1(v, err);
+}
+
+int corpus_270_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_270_names[i], corpus_270_lens[i]);
+	result = corpus_270(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_270_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_270_fused((v + 0), (&corpus_270_c[1]), PBG_OP_GT);
+	return corpus_270_compare((&corpus_270_c[1]), (v + 0), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_271(pbg_field* v, pbg_error* err);
+int corpus_271_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_271_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_271_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_271_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_271_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_271_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_271_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_271_order(err, op, corpus_271_cmp(c0, c1));
+}
+
+static int corpus_271_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_271_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_271_n2 = {6.0};
+static pbg_field corpus_271_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_271_n2},
+};
+
+static char* corpus_271_names[] = {"c", NULL};
+static int corpus_271_lens[] = {1, 0};
+
+static int corpus_271_f1(pbg_field* v, pbg_error* err);
+
+int corpus_271(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_271_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_271_f1(v, err);
+}
+
+int corpus_271_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_271_names[i], corpus_271_lens[i]);
+	result = corpus_271(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_271_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_271_fused((v + 0), (&corpus_271_c[1]), PBG_OP_GTE);
+	return corpus_271_compare((v + 0), (&corpus_271_c[1]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_272(pbg_field* v, pbg_error* err);
+int corpus_272_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_272_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_272_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_272_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_272_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_272_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_272_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_272_order(err, op, corpus_272_cmp(c0, c1));
+}
+
+static int corpus_272_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_272_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_272_n2 = {7.0};
+static pbg_field corpus_272_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_272_n2},
+};
+
+static char* corpus_272_names[] = {"c", NULL};
+static int corpus_272_lens[] = {1, 0};
+
+static int corpus_272_f1(pbg_field* v, pbg_error* err);
+
+int corpus_272(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_272_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_272_f1(v, err);
+}
+
+int corpus_272_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_272_names[i], corpus_272_lens[i]);
+	result = corpus_272(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_272_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_272_fused((v + 0), (&corpus_272_c[1]), PBG_OP_GTE);
+	return corpus_272_compare((&corpus_272_c[1]), (v + 0), PBG_OP_LTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_273(pbg_field* v, pbg_error* err);
+int corpus_273_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_273_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_273_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_273_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_273_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_273_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_273_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_273_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_273_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_273_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_273_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_273_n2 = {5.0};
+static pbg_field corpus_273_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_273_n2},
+};
+
+static char* corpus_273_names[] = {"a", NULL};
+static int corpus_273_lens[] = {1, 0};
+
+static int corpus_273_f1(pbg_field* v, pbg_error* err);
+
+int corpus_273(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_273_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_273_f1(v, err);
+}
+
+int corpus_273_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_273_names[i], corpus_273_lens[i]);
+	result = corpus_273(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_273_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_273_fused((v + 0), (&corpus_273_c[1]), PBG_OP_EQ);
+	if(corpus_273_isbool((v + 0)->_type)) {
+		first = corpus_273_bool((v + 0), err);
+		if(corpus_273_bool((&corpus_273_c[1]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_273_c[1]);
+	return corpus_273_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_274(pbg_field* v, pbg_error* err);
+int corpus_274_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_274_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_274_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_274_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_274_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_274_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_274_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_274_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_274_n2 = {5.0};
+static pbg_field corpus_274_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_274_n2},
+};
+
+static char* corpus_274_names[] = {"a", NULL};
+static int corpus_274_lens[] = {1, 0};
+
+static int corpus_274_f1(pbg_field* v, pbg_error* err);
+
+int corpus_274(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_274_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_274_f1(v, err);
+}
+
+int corpus_274_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_274_names[i], corpus_274_lens[i]);
+	result = corpus_274(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_274_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_274_fused((v + 0), (&corpus_274_c[1]), PBG_OP_EQ);
+	c[0] = (&corpus_274_c[1]);
+	c[1] = (v + 0);
+	return corpus_274_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_275(pbg_field* v, pbg_error* err);
+int corpus_275_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_275_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_275_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_275_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_275_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_275_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_275_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_275_n2 = {5.0};
+static pbg_field corpus_275_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_275_n2},
+};
+
+static char* corpus_275_names[] = {"a", NULL};
+static int corpus_275_lens[] = {1, 0};
+
+static int corpus_275_f1(pbg_field* v, pbg_error* err);
+
+int corpus_275(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_275_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_275_f1(v, err);
+}
+
+int corpus_275_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_275_names[i], corpus_275_lens[i]);
+	result = corpus_275(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_275_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_275_fused((v + 0), (&corpus_275_c[1]), PBG_OP_NEQ);
+	return corpus_275_neq((v + 0), (&corpus_275_c[1]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_276(pbg_field* v, pbg_error* err);
+int corpus_276_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_276_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_276_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_276_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_276_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_276_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_276_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_276_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_276_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_276_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_276_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_276_s2[] = "hi";
+static pbg_field corpus_276_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_276_s2},
+};
+
+static char* corpus_276_names[] = {"s", NULL};
+static int corpus_276_lens[] = {1, 0};
+
+static int corpus_276_f1(pbg_field* v, pbg_error* err);
+
+int corpus_276(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_276_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_276_f1(v, err);
+}
+
+int corpus_276_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_276_names[i], corpus_276_lens[i]);
+	result = corpus_276(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_276_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_276_fused((v + 0), (&corpus_276_c[1]), PBG_OP_EQ);
+	if(corpus_276_isbool((v + 0)->_type)) {
+		first = corpus_276_bool((v + 0), err);
+		if(corpus_276_bool((&corpus_276_c[1]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_276_c[1]);
+	return corpus_276_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_277(pbg_field* v, pbg_error* err);
+int corpus_277_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_277_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_277_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_277_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_277_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_277_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_277_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_277_s2[] = "hi";
+static pbg_field corpus_277_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_277_s2},
+};
+
+static char* corpus_277_names[] = {"s", NULL};
+static int corpus_277_lens[] = {1, 0};
+
+static int corpus_277_f1(pbg_field* v, pbg_error* err);
+
+int corpus_277(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_277_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_277_f1(v, err);
+}
+
+int corpus_277_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_277_names[i], corpus_277_lens[i]);
+	result = corpus_277(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_277_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_277_fused((v + 0), (&corpus_277_c[1]), PBG_OP_NEQ);
+	return corpus_277_neq((&corpus_277_c[1]), (v + 0), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_278(pbg_field* v, pbg_error* err);
+int corpus_278_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_278_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_278_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_278_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_278_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_278_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_278_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_278_order(err, op, corpus_278_cmp(c0, c1));
+}
+
+static int corpus_278_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_278_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_278_s2[] = "hello";
+static pbg_field corpus_278_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 5, corpus_278_s2},
+};
+
+static char* corpus_278_names[] = {"s", NULL};
+static int corpus_278_lens[] = {1, 0};
+
+static int corpus_278_f1(pbg_field* v, pbg_error* err);
+
+int corpus_278(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_278_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_278_f1(v, err);
+}
+
+int corpus_278_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_278_names[i], corpus_278_lens[i]);
+	result = corpus_278(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_278_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_278_fused((v + 0), (&corpus_278_c[1]), PBG_OP_LT);
+	return corpus_278_compare((v + 0), (&corpus_278_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_279(pbg_field* v, pbg_error* err);
+int corpus_279_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_279_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_279_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_279_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_279_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_279_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_279_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_279_order(err, op, corpus_279_cmp(c0, c1));
+}
+
+static int corpus_279_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_279_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_279_s2[] = "hj";
+static pbg_field corpus_279_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_279_s2},
+};
+
+static char* corpus_279_names[] = {"s", NULL};
+static int corpus_279_lens[] = {1, 0};
+
+static int corpus_279_f1(pbg_field* v, pbg_error* err);
+
+int corpus_279(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_279_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_279_f1(v, err);
+}
+
+int corpus_279_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_279_names[i], corpus_279_lens[i]);
+	result = corpus_279(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_279_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_279_fused((v + 0), (&corpus_279_c[1]), PBG_OP_LT);
+	return corpus_279_compare((&corpus_279_c[1]), (v + 0), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_280(pbg_field* v, pbg_error* err);
+int corpus_280_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_280_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_280_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_280_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_280_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_280_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_280_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_280_order(err, op, corpus_280_cmp(c0, c1));
+}
+
+static int corpus_280_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_280_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_280_s2[] = "h";
+static pbg_field corpus_280_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 1, corpus_280_s2},
+};
+
+static char* corpus_280_names[] = {"s", NULL};
+static int corpus_280_lens[] = {1, 0};
+
+static int corpus_280_f1(pbg_field* v, pbg_error* err);
+
+int corpus_280(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_280_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_280_f1(v, err);
+}
+
+int corpus_280_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_280_names[i], corpus_280_lens[i]);
+	result = corpus_280(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_280_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_280_fused((v + 0), (&corpus_280_c[1]), PBG_OP_GT);
+	return corpus_280_compare((&corpus_280_c[1]), (v + 0), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_281(pbg_field* v, pbg_error* err);
+int corpus_281_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_281_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_281_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_281_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_281_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_281_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_281_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_281_order(err, op, corpus_281_cmp(c0, c1));
+}
+
+static int corpus_281_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_281_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_281_s2[] = "hi!";
+static pbg_field corpus_281_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_281_s2},
+};
+
+static char* corpus_281_names[] = {"s", NULL};
+static int corpus_281_lens[] = {1, 0};
+
+static int corpus_281_f1(pbg_field* v, pbg_error* err);
+
+int corpus_281(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_281_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_281_f1(v, err);
+}
+
+int corpus_281_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_281_names[i], corpus_281_lens[i]);
+	result = corpus_281(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_281_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_281_fused((v + 0), (&corpus_281_c[1]), PBG_OP_GTE);
+	return corpus_281_compare((v + 0), (&corpus_281_c[1]), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_282(pbg_field* v, pbg_error* err);
+int corpus_282_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_282_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_282_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_282_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_282_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_282_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_282_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_282_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_282_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_282_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_282_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_282_d2 = {2018, 10, 12};
+static pbg_field corpus_282_c[] = {
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_282_d2},
+};
+
+static char* corpus_282_names[] = {"d", NULL};
+static int corpus_282_lens[] = {1, 0};
+
+static int corpus_282_f1(pbg_field* v, pbg_error* err);
+
+int corpus_282(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_282_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_282_f1(v, err);
+}
+
+int corpus_282_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_282_names[i], corpus_282_lens[i]);
+	result = corpus_282(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_282_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_DATE)
+		return corpus_282_fused((v + 0), (&corpus_282_c[1]), PBG_OP_EQ);
+	if(corpus_282_isbool((v + 0)->_type)) {
+		first = corpus_282_bool((v + 0), err);
+		if(corpus_282_bool((&corpus_282_c[1]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_282_c[1]);
+	return corpus_282_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_283(pbg_field* v, pbg_error* err);
+int corpus_283_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_283_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_283_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_283_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_283_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_283_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_283_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_283_order(err, op, corpus_283_cmp(c0, c1));
+}
+
+static int corpus_283_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_283_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_283_d2 = {2018, 10, 13};
+static pbg_field corpus_283_c[] = {
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_283_d2},
+};
+
+static char* corpus_283_names[] = {"d", NULL};
+static int corpus_283_lens[] = {1, 0};
+
+static int corpus_283_f1(pbg_field* v, pbg_error* err);
+
+int corpus_283(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_283_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_283_f1(v, err);
+}
+
+int corpus_283_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_283_names[i], corpus_283_lens[i]);
+	result = corpus_283(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_283_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_DATE)
+		return corpus_283_fused((v + 0), (&corpus_283_c[1]), PBG_OP_LT);
+	return corpus_283_compare((v + 0), (&corpus_283_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_284(pbg_field* v, pbg_error* err);
+int corpus_284_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_284_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_284_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_284_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_284_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_284_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_284_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_284_order(err, op, corpus_284_cmp(c0, c1));
+}
+
+static int corpus_284_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_284_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_date corpus_284_d2 = {2018, 10, 11};
+static pbg_field corpus_284_c[] = {
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_284_d2},
+};
+
+static char* corpus_284_names[] = {"d", NULL};
+static int corpus_284_lens[] = {1, 0};
+
+static int corpus_284_f1(pbg_field* v, pbg_error* err);
+
+int corpus_284(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_284_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_284_f1(v, err);
+}
+
+int corpus_284_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_284_names[i], corpus_284_lens[i]);
+	result = corpus_284(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_284_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_DATE)
+		return corpus_284_fused((v + 0), (&corpus_284_c[1]), PBG_OP_LTE);
+	return corpus_284_compare((&corpus_284_c[1]), (v + 0), PBG_OP_GTE, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_285(pbg_field* v, pbg_error* err);
+int corpus_285_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_285_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_285_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_285_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_285_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_285_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_285_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_285_order(err, op, corpus_285_cmp(c0, c1));
+}
+
+static int corpus_285_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_285_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_285_n2 = {6.0};
+static pbg_field corpus_285_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_285_n2},
+};
+
+static char* corpus_285_names[] = {"x", NULL};
+static int corpus_285_lens[] = {1, 0};
+
+static int corpus_285_f1(pbg_field* v, pbg_error* err);
+
+int corpus_285(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_285_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_285_f1(v, err);
+}
+
+int corpus_285_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_285_names[i], corpus_285_lens[i]);
+	result = corpus_285(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_285_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_285_fused((v + 0), (&corpus_285_c[1]), PBG_OP_LT);
+	return corpus_285_compare((v + 0), (&corpus_285_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_286(pbg_field* v, pbg_error* err);
+int corpus_286_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_286_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_286_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_286_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_286_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_286_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_286_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_286_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_286_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_286_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_286_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_286_n2 = {6.0};
+static pbg_field corpus_286_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_286_n2},
+};
+
+static char* corpus_286_names[] = {"x", NULL};
+static int corpus_286_lens[] = {1, 0};
+
+static int corpus_286_f1(pbg_field* v, pbg_error* err);
+
+int corpus_286(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_286_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_286_f1(v, err);
+}
+
+int corpus_286_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_286_names[i], corpus_286_lens[i]);
+	result = corpus_286(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_286_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_286_fused((v + 0), (&corpus_286_c[1]), PBG_OP_EQ);
+	if(corpus_286_isbool((v + 0)->_type)) {
+		first = corpus_286_bool((v + 0), err);
+		if(corpus_286_bool((&corpus_286_c[1]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_286_c[1]);
+	return corpus_286_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_287(pbg_field* v, pbg_error* err);
+int corpus_287_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_287_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_287_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_287_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_287_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_287_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_287_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_287_n2 = {6.0};
+static pbg_field corpus_287_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_287_n2},
+};
+
+static char* corpus_287_names[] = {"x", NULL};
+static int corpus_287_lens[] = {1, 0};
+
+static int corpus_287_f1(pbg_field* v, pbg_error* err);
+
+int corpus_287(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_287_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_287_f1(v, err);
+}
+
+int corpus_287_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_287_names[i], corpus_287_lens[i]);
+	result = corpus_287(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_287_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_287_fused((v + 0), (&corpus_287_c[1]), PBG_OP_NEQ);
+	return corpus_287_neq((&corpus_287_c[1]), (v + 0), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_288(pbg_field* v, pbg_error* err);
+int corpus_288_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_288_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_288_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_288_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_288_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_288_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_288_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_288_order(err, op, corpus_288_cmp(c0, c1));
+}
+
+static int corpus_288_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_288_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_288_n2 = {6.0};
+static pbg_field corpus_288_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_288_n2},
+};
+
+static char* corpus_288_names[] = {"s", NULL};
+static int corpus_288_lens[] = {1, 0};
+
+static int corpus_288_f1(pbg_field* v, pbg_error* err);
+
+int corpus_288(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_288_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_288_f1(v, err);
+}
+
+int corpus_288_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_288_names[i], corpus_288_lens[i]);
+	result = corpus_288(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_288_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_288_fused((v + 0), (&corpus_288_c[1]), PBG_OP_LT);
+	return corpus_288_compare((v + 0), (&corpus_288_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_289(pbg_field* v, pbg_error* err);
+int corpus_289_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_289_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_289_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_289_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_289_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_289_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_289_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_289_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_289_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_289_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_289_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_289_n2 = {6.0};
+static pbg_field corpus_289_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_289_n2},
+};
+
+static char* corpus_289_names[] = {"s", NULL};
+static int corpus_289_lens[] = {1, 0};
+
+static int corpus_289_f1(pbg_field* v, pbg_error* err);
+
+int corpus_289(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_289_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_289_f1(v, err);
+}
+
+int corpus_289_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_289_names[i], corpus_289_lens[i]);
+	result = corpus_289(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_289_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_289_fused((v + 0), (&corpus_289_c[1]), PBG_OP_EQ);
+	if(corpus_289_isbool((v + 0)->_type)) {
+		first = corpus_289_bool((v + 0), err);
+		if(corpus_289_bool((&corpus_289_c[1]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_289_c[1]);
+	return corpus_289_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_290(pbg_field* v, pbg_error* err);
+int corpus_290_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_290_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_290_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_290_neq(pbg_field* c0, pbg_field* c1, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_290_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to NEQ operator.");
+	return (c1->_type != c0->_type || c1->_int != c0->_int || 
+			memcmp(c1->_data, c0->_data, c0->_int)) ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_290_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_290_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static char corpus_290_s2[] = "hi";
+static pbg_field corpus_290_c[] = {
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_290_s2},
+};
+
+static char* corpus_290_names[] = {"d", NULL};
+static int corpus_290_lens[] = {1, 0};
+
+static int corpus_290_f1(pbg_field* v, pbg_error* err);
+
+int corpus_290(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_290_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_290_f1(v, err);
+}
+
+int corpus_290_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_290_names[i], corpus_290_lens[i]);
+	result = corpus_290(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_290_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_STRING)
+		return corpus_290_fused((v + 0), (&corpus_290_c[1]), PBG_OP_NEQ);
+	return corpus_290_neq((v + 0), (&corpus_290_c[1]), err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_291(pbg_field* v, pbg_error* err);
+int corpus_291_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_291_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_291_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_291_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_291_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_291_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_291_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_291_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_291_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_291_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_291_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_291_n2 = {5.0};
+static pbg_field corpus_291_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_291_n2},
+};
+
+static char* corpus_291_names[] = {"t", NULL};
+static int corpus_291_lens[] = {1, 0};
+
+static int corpus_291_f1(pbg_field* v, pbg_error* err);
+
+int corpus_291(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_291_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_291_f1(v, err);
+}
+
+int corpus_291_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_291_names[i], corpus_291_lens[i]);
+	result = corpus_291(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_291_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_291_fused((v + 0), (&corpus_291_c[1]), PBG_OP_EQ);
+	if(corpus_291_isbool((v + 0)->_type)) {
+		first = corpus_291_bool((v + 0), err);
+		if(corpus_291_bool((&corpus_291_c[1]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_291_c[1]);
+	return corpus_291_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_292(pbg_field* v, pbg_error* err);
+int corpus_292_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_292_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_292_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_292_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_292_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_292_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_292_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_292_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_292_n2 = {5.0};
+static pbg_field corpus_292_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_292_n2},
+};
+
+static char* corpus_292_names[] = {"t", NULL};
+static int corpus_292_lens[] = {1, 0};
+
+static int corpus_292_f1(pbg_field* v, pbg_error* err);
+
+int corpus_292(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_292_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_292_f1(v, err);
+}
+
+int corpus_292_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_292_names[i], corpus_292_lens[i]);
+	result = corpus_292(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_292_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_292_fused((v + 0), (&corpus_292_c[1]), PBG_OP_EQ);
+	c[0] = (&corpus_292_c[1]);
+	c[1] = (v + 0);
+	return corpus_292_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_293(pbg_field* v, pbg_error* err);
+int corpus_293_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_293_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_293_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_293_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_293_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_293_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_293_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_293_order(err, op, corpus_293_cmp(c0, c1));
+}
+
+static int corpus_293_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_293_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_293_n2 = {5.0};
+static pbg_field corpus_293_c[] = {
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_293_n2},
+};
+
+static char* corpus_293_names[] = {"t", NULL};
+static int corpus_293_lens[] = {1, 0};
+
+static int corpus_293_f1(pbg_field* v, pbg_error* err);
+
+int corpus_293(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_293_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_293_f1(v, err);
+}
+
+int corpus_293_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_293_names[i], corpus_293_lens[i]);
+	result = corpus_293(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_293_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_293_fused((v + 0), (&corpus_293_c[1]), PBG_OP_LT);
+	return corpus_293_compare((v + 0), (&corpus_293_c[1]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_294(pbg_field* v, pbg_error* err);
+int corpus_294_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_294_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_294_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_294_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_294_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_294_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_294_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_294_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_294_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_294_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_294_order(err, op, corpus_294_cmp(c0, c1));
+}
+
+static int corpus_294_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_294_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_294_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static int corpus_294_fused(pbg_field* var, pbg_field* k, pbg_field_type cmp)
+{
+	int result;
+	if(cmp == PBG_OP_EQ || cmp == PBG_OP_NEQ) {
+		result = (var->_int == k->_int && memcmp(var->_data, k->_data, var->_int) == 0);
+		return (result == (cmp == PBG_OP_EQ)) ? PBG_TRUE : PBG_FALSE;
+	}
+	result = corpus_294_cmp(var, k);
+	if(cmp == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(cmp == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static pbg_lt_number corpus_294_n3 = {6.0};
+static char corpus_294_s5[] = "hi";
+static pbg_lt_date corpus_294_d7 = {2018, 1, 1};
+static pbg_field corpus_294_c[] = {
+	{PBG_OP_AND, 3, NULL},
+	{PBG_FU_NUMBER, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_294_n3},
+	{PBG_FU_STRING, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_294_s5},
+	{PBG_FU_DATE, 2, NULL},
+	{PBG_LT_DATE, sizeof(pbg_lt_date), &corpus_294_d7},
+};
+
+static char* corpus_294_names[] = {"a", "s", "d", NULL};
+static int corpus_294_lens[] = {1, 1, 1, 0};
+
+static int corpus_294_f1(pbg_field* v, pbg_error* err);
+static int corpus_294_f2(pbg_field* v, pbg_error* err);
+static int corpus_294_f4(pbg_field* v, pbg_error* err);
+static int corpus_294_f6(pbg_field* v, pbg_error* err);
+
+int corpus_294(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_294_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_294_f1(v, err);
+}
+
+int corpus_294_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[3];
+	int i, result;
+	for(i = 0; i < 3; i++)
+		v[i] = dict(corpus_294_names[i], corpus_294_lens[i]);
+	result = corpus_294(v, err);
+	for(i = 0; i < 3; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_294_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_294_f2(v, err)) != PBG_TRUE) return r;
+	if((r = corpus_294_f4(v, err)) != PBG_TRUE) return r;
+	r = corpus_294_f6(v, err);
+	return r;
+}
+
+static int corpus_294_f2(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 0)->_type == PBG_LT_NUMBER)
+		return corpus_294_fused((v + 0), (&corpus_294_c[2]), PBG_OP_LT);
+	return corpus_294_compare((v + 0), (&corpus_294_c[2]), PBG_OP_LT, err);
+}
+
+static int corpus_294_f4(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 1)->_type == PBG_LT_STRING)
+		return corpus_294_fused((v + 1), (&corpus_294_c[4]), PBG_OP_EQ);
+	if(corpus_294_isbool((v + 1)->_type)) {
+		first = corpus_294_bool((v + 1), err);
+		if(corpus_294_bool((&corpus_294_c[4]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 1);
+	c[1] = (&corpus_294_c[4]);
+	return corpus_294_eq(c, 2, err);
+}
+
+static int corpus_294_f6(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((v + 2)->_type == PBG_LT_DATE)
+		return corpus_294_fused((v + 2), (&corpus_294_c[6]), PBG_OP_GT);
+	return corpus_294_compare((v + 2), (&corpus_294_c[6]), PBG_OP_GT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_295(pbg_field* v, pbg_error* err);
+int corpus_295_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_295_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_295_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_295_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_295_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_295_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_295_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_295_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static char* corpus_295_names[] = {"a", "b", NULL};
+static int corpus_295_lens[] = {1, 1, 0};
+
+static int corpus_295_f1(pbg_field* v, pbg_error* err);
+
+int corpus_295(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_295_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_295_f1(v, err);
+}
+
+int corpus_295_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_295_names[i], corpus_295_lens[i]);
+	result = corpus_295(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_295_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_295_isbool((v + 0)->_type)) {
+		first = corpus_295_bool((v + 0), err);
+		if((v + 1)->_type == PBG_NULL) return corpus_295_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(corpus_295_bool((v + 1), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (v + 1);
+	return corpus_295_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_296(pbg_field* v, pbg_error* err);
+int corpus_296_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_296_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_296_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_296_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_296_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_296_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_296_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_296_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_lt_number corpus_296_n2 = {5.0};
+static pbg_lt_number corpus_296_n3 = {5.0};
+static pbg_field corpus_296_c[] = {
+	{PBG_OP_EQ, 3, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_296_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_296_n3},
+};
+
+static char* corpus_296_names[] = {"a", NULL};
+static int corpus_296_lens[] = {1, 0};
+
+static int corpus_296_f1(pbg_field* v, pbg_error* err);
+
+int corpus_296(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_296_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_296_f1(v, err);
+}
+
+int corpus_296_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_296_names[i], corpus_296_lens[i]);
+	result = corpus_296(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_296_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_296_isbool((v + 0)->_type)) {
+		first = corpus_296_bool((v + 0), err);
+		if(corpus_296_bool((&corpus_296_c[1]), err) != first) return PBG_FALSE;
+		if(corpus_296_bool((&corpus_296_c[2]), err) != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_296_c[1]);
+	c[2] = (&corpus_296_c[2]);
+	return corpus_296_eq(c, 3, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_297(pbg_field* v, pbg_error* err);
+int corpus_297_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_297_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_297_cmp(pbg_field* c0, pbg_field* c1)
+{
+	pbg_lt_number* n0, *n1;
+	pbg_lt_date* d0, *d1;
+	int n;
+	if(c0->_type == PBG_LT_NUMBER && c1->_type == PBG_LT_NUMBER) {
+		n0 = (pbg_lt_number*) c0->_data, n1 = (pbg_lt_number*) c1->_data;
+		return (n0->_val < n1->_val) ? -1 : (n0->_val > n1->_val) ? 1 : 0;
+	}
+	if(c0->_type == PBG_LT_DATE && c1->_type == PBG_LT_DATE) {
+		d0 = (pbg_lt_date*) c0->_data, d1 = (pbg_lt_date*) c1->_data;
+		if(d0->_YYYY != d1->_YYYY) return (d0->_YYYY < d1->_YYYY) ? -1 : 1;
+		if(d0->_MM != d1->_MM) return (d0->_MM < d1->_MM) ? -1 : 1;
+		if(d0->_DD != d1->_DD) return (d0->_DD < d1->_DD) ? -1 : 1;
+		return 0;
+	}
+	if(c0->_type == PBG_LT_STRING && c1->_type == PBG_LT_STRING) {
+		n = memcmp(c0->_data, c1->_data, (c0->_int < c1->_int) ? c0->_int : c1->_int);
+		if(n != 0) return (n < 0) ? -1 : 1;
+		return (c0->_int < c1->_int) ? -1 : (c0->_int > c1->_int) ? 1 : 0;
+	}
+	return -2;
+}
+
+static int corpus_297_order(pbg_error* err, pbg_field_type op, int result)
+{
+	if(result == -2)
+		return corpus_297_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Unknown input type to comparison operator");
+	if(op == PBG_OP_LT) return result < 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_GT) return result > 0 ? PBG_TRUE : PBG_FALSE;
+	if(op == PBG_OP_LTE) return result <= 0 ? PBG_TRUE : PBG_FALSE;
+	return result >= 0 ? PBG_TRUE : PBG_FALSE;
+}
+
+static int corpus_297_compare(pbg_field* c0, pbg_field* c1, pbg_field_type op, pbg_error* err)
+{
+	if(c0->_type == PBG_NULL || c1->_type == PBG_NULL)
+		return corpus_297_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to comparison operator.");
+	return corpus_297_order(err, op, corpus_297_cmp(c0, c1));
+}
+
+static pbg_lt_number corpus_297_n2 = {5.0};
+static pbg_lt_number corpus_297_n3 = {6.0};
+static pbg_field corpus_297_c[] = {
+	{PBG_OP_LT, 2, NULL},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_297_n2},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_297_n3},
+};
+
+static char* corpus_297_names[] = {NULL};
+static int corpus_297_lens[] = {0};
+
+static int corpus_297_f1(pbg_field* v, pbg_error* err);
+
+int corpus_297(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_297_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_297_f1(v, err);
+}
+
+int corpus_297_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_297_names[i], corpus_297_lens[i]);
+	result = corpus_297(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_297_f1(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	return corpus_297_compare((&corpus_297_c[1]), (&corpus_297_c[2]), PBG_OP_LT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_298(pbg_field* v, pbg_error* err);
+int corpus_298_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_298_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_298_isbool(pbg_field_type type)
+{
+	return type == PBG_LT_TRUE || type == PBG_LT_FALSE || 
+			(type < PBG_MAX_OP && type > PBG_MIN_OP);
+}
+
+static int corpus_298_bool(pbg_field* f, pbg_error* err)
+{
+	if(f->_type == PBG_LT_TRUE) return PBG_TRUE;
+	if(f->_type == PBG_LT_FALSE) return PBG_FALSE;
+	return corpus_298_fail(err, PBG_ERR_STATE, __LINE__, "Cannot evaluate a non-BOOL value.");
+}
+
+static int corpus_298_eq(pbg_field** c, int n, pbg_error* err)
+{
+	int i;
+	if(c[0]->_type == PBG_NULL)
+		return corpus_298_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+	for(i = 1; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_298_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to EQ operator.");
+		if(c[i]->_int != c[0]->_int || c[i]->_type != c[0]->_type || 
+				memcmp(c[i]->_data, c[0]->_data, c[0]->_int) != 0)
+			return PBG_FALSE;
+	}
+	return PBG_TRUE;
+}
+
+static pbg_field corpus_298_c[] = {
+	{PBG_OP_EQ, 2, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+};
+
+static char* corpus_298_names[] = {"t", NULL};
+static int corpus_298_lens[] = {1, 0};
+
+static int corpus_298_f1(pbg_field* v, pbg_error* err);
+
+int corpus_298(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_298_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_298_f1(v, err);
+}
+
+int corpus_298_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_298_names[i], corpus_298_lens[i]);
+	result = corpus_298(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_298_f1(pbg_field* v, pbg_error* err)
+{
+	int first;
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if(corpus_298_isbool((v + 0)->_type)) {
+		first = corpus_298_bool((v + 0), err);
+		if(PBG_TRUE != first) return PBG_FALSE;
+		return PBG_TRUE;
+	}
+	c[0] = (v + 0);
+	c[1] = (&corpus_298_c[1]);
+	return corpus_298_eq(c, 2, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_299(pbg_field* v, pbg_error* err);
+int corpus_299_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_299_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_299_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_299_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_299_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_299_s2[] = "he";
+static pbg_field corpus_299_c[] = {
+	{PBG_OP_PFX, 2, NULL},
+	{PBG_LT_STRING, 2, corpus_299_s2},
+};
+
+static char* corpus_299_names[] = {"s", NULL};
+static int corpus_299_lens[] = {1, 0};
+
+static int corpus_299_f1(pbg_field* v, pbg_error* err);
+
+int corpus_299(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_299_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_299_f1(v, err);
+}
+
+int corpus_299_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_299_names[i], corpus_299_lens[i]);
+	result = corpus_299(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_299_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_299_c[1]);
+	return corpus_299_match(c, 2, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_300(pbg_field* v, pbg_error* err);
+int corpus_300_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_300_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_300_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_300_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_300_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_300_s2[] = "el";
+static char corpus_300_s3[] = "lo";
+static pbg_field corpus_300_c[] = {
+	{PBG_OP_PFX, 3, NULL},
+	{PBG_LT_STRING, 2, corpus_300_s2},
+	{PBG_LT_STRING, 2, corpus_300_s3},
+};
+
+static char* corpus_300_names[] = {"s", NULL};
+static int corpus_300_lens[] = {1, 0};
+
+static int corpus_300_f1(pbg_field* v, pbg_error* err);
+
+int corpus_300(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_300_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_300_f1(v, err);
+}
+
+int corpus_300_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_300_names[i], corpus_300_lens[i]);
+	result = corpus_300(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_300_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_300_c[1]);
+	c[2] = (&corpus_300_c[2]);
+	return corpus_300_match(c, 3, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_301(pbg_field* v, pbg_error* err);
+int corpus_301_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_301_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_301_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_301_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_301_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_301_s2[] = "el";
+static char corpus_301_s3[] = "lo";
+static pbg_field corpus_301_c[] = {
+	{PBG_OP_SFX, 3, NULL},
+	{PBG_LT_STRING, 2, corpus_301_s2},
+	{PBG_LT_STRING, 2, corpus_301_s3},
+};
+
+static char* corpus_301_names[] = {"s", NULL};
+static int corpus_301_lens[] = {1, 0};
+
+static int corpus_301_f1(pbg_field* v, pbg_error* err);
+
+int corpus_301(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_301_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_301_f1(v, err);
+}
+
+int corpus_301_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_301_names[i], corpus_301_lens[i]);
+	result = corpus_301(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_301_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_301_c[1]);
+	c[2] = (&corpus_301_c[2]);
+	return corpus_301_match(c, 3, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_302(pbg_field* v, pbg_error* err);
+int corpus_302_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_302_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_302_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_302_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_302_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_302_s2[] = "hello!";
+static pbg_field corpus_302_c[] = {
+	{PBG_OP_SFX, 2, NULL},
+	{PBG_LT_STRING, 6, corpus_302_s2},
+};
+
+static char* corpus_302_names[] = {"s", NULL};
+static int corpus_302_lens[] = {1, 0};
+
+static int corpus_302_f1(pbg_field* v, pbg_error* err);
+
+int corpus_302(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_302_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_302_f1(v, err);
+}
+
+int corpus_302_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_302_names[i], corpus_302_lens[i]);
+	result = corpus_302(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_302_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_302_c[1]);
+	return corpus_302_match(c, 2, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_303(pbg_field* v, pbg_error* err);
+int corpus_303_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_303_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_303_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_303_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_303_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_303_s2[] = "ell";
+static pbg_field corpus_303_c[] = {
+	{PBG_OP_CONT, 2, NULL},
+	{PBG_LT_STRING, 3, corpus_303_s2},
+};
+
+static char* corpus_303_names[] = {"s", NULL};
+static int corpus_303_lens[] = {1, 0};
+
+static int corpus_303_f1(pbg_field* v, pbg_error* err);
+
+int corpus_303(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_303_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_303_f1(v, err);
+}
+
+int corpus_303_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_303_names[i], corpus_303_lens[i]);
+	result = corpus_303(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_303_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_303_c[1]);
+	return corpus_303_match(c, 2, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_304(pbg_field* v, pbg_error* err);
+int corpus_304_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_304_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_304_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_304_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_304_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_304_s2[] = "elo";
+static char corpus_304_s3[] = "lol";
+static pbg_field corpus_304_c[] = {
+	{PBG_OP_CONT, 3, NULL},
+	{PBG_LT_STRING, 3, corpus_304_s2},
+	{PBG_LT_STRING, 3, corpus_304_s3},
+};
+
+static char* corpus_304_names[] = {"s", NULL};
+static int corpus_304_lens[] = {1, 0};
+
+static int corpus_304_f1(pbg_field* v, pbg_error* err);
+
+int corpus_304(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_304_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_304_f1(v, err);
+}
+
+int corpus_304_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_304_names[i], corpus_304_lens[i]);
+	result = corpus_304(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_304_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_304_c[1]);
+	c[2] = (&corpus_304_c[2]);
+	return corpus_304_match(c, 3, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_305(pbg_field* v, pbg_error* err);
+int corpus_305_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_305_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_305_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_305_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_305_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_305_s2[] = "";
+static pbg_field corpus_305_c[] = {
+	{PBG_OP_CONT, 2, NULL},
+	{PBG_LT_STRING, 0, corpus_305_s2},
+};
+
+static char* corpus_305_names[] = {"s", NULL};
+static int corpus_305_lens[] = {1, 0};
+
+static int corpus_305_f1(pbg_field* v, pbg_error* err);
+
+int corpus_305(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_305_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_305_f1(v, err);
+}
+
+int corpus_305_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_305_names[i], corpus_305_lens[i]);
+	result = corpus_305(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_305_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_305_c[1]);
+	return corpus_305_match(c, 2, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_306(pbg_field* v, pbg_error* err);
+int corpus_306_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_306_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_306_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_306_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_306_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_306_s2[] = "hello";
+static pbg_field corpus_306_c[] = {
+	{PBG_OP_CONT, 2, NULL},
+	{PBG_LT_STRING, 5, corpus_306_s2},
+};
+
+static char* corpus_306_names[] = {"s", NULL};
+static int corpus_306_lens[] = {1, 0};
+
+static int corpus_306_f1(pbg_field* v, pbg_error* err);
+
+int corpus_306(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_306_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_306_f1(v, err);
+}
+
+int corpus_306_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_306_names[i], corpus_306_lens[i]);
+	result = corpus_306(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_306_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_306_c[1]);
+	c[1] = (v + 0);
+	return corpus_306_match(c, 2, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_307(pbg_field* v, pbg_error* err);
+int corpus_307_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_307_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_307_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_307_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_307_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_307_s2[] = "hex";
+static char corpus_307_s3[] = "help";
+static char corpus_307_s4[] = "hello";
+static char corpus_307_s5[] = "h";
+static pbg_field corpus_307_c[] = {
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 3, corpus_307_s2},
+	{PBG_LT_STRING, 4, corpus_307_s3},
+	{PBG_LT_STRING, 5, corpus_307_s4},
+	{PBG_LT_STRING, 1, corpus_307_s5},
+};
+
+static char* corpus_307_names[] = {"s", NULL};
+static int corpus_307_lens[] = {1, 0};
+
+static int corpus_307_f1(pbg_field* v, pbg_error* err);
+
+int corpus_307(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_307_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_307_f1(v, err);
+}
+
+int corpus_307_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_307_names[i], corpus_307_lens[i]);
+	result = corpus_307(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_307_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_307_c[1]);
+	c[2] = (&corpus_307_c[2]);
+	c[3] = (&corpus_307_c[3]);
+	c[4] = (&corpus_307_c[4]);
+	return corpus_307_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_308(pbg_field* v, pbg_error* err);
+int corpus_308_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_308_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_308_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_308_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_308_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_308_s2[] = "hex";
+static char corpus_308_s3[] = "help";
+static char corpus_308_s4[] = "hellos";
+static char corpus_308_s5[] = "e";
+static pbg_field corpus_308_c[] = {
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 3, corpus_308_s2},
+	{PBG_LT_STRING, 4, corpus_308_s3},
+	{PBG_LT_STRING, 6, corpus_308_s4},
+	{PBG_LT_STRING, 1, corpus_308_s5},
+};
+
+static char* corpus_308_names[] = {"s", NULL};
+static int corpus_308_lens[] = {1, 0};
+
+static int corpus_308_f1(pbg_field* v, pbg_error* err);
+
+int corpus_308(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_308_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_308_f1(v, err);
+}
+
+int corpus_308_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_308_names[i], corpus_308_lens[i]);
+	result = corpus_308(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_308_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_308_c[1]);
+	c[2] = (&corpus_308_c[2]);
+	c[3] = (&corpus_308_c[3]);
+	c[4] = (&corpus_308_c[4]);
+	return corpus_308_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_309(pbg_field* v, pbg_error* err);
+int corpus_309_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_309_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_309_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_309_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_309_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_309_s2[] = "hex";
+static char corpus_309_s3[] = "help";
+static char corpus_309_s4[] = "hellos";
+static char corpus_309_s5[] = "ell";
+static pbg_field corpus_309_c[] = {
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 3, corpus_309_s2},
+	{PBG_LT_STRING, 4, corpus_309_s3},
+	{PBG_LT_STRING, 6, corpus_309_s4},
+	{PBG_LT_STRING, 3, corpus_309_s5},
+};
+
+static char* corpus_309_names[] = {"s", NULL};
+static int corpus_309_lens[] = {1, 0};
+
+static int corpus_309_f1(pbg_field* v, pbg_error* err);
+
+int corpus_309(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_309_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_309_f1(v, err);
+}
+
+int corpus_309_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_309_names[i], corpus_309_lens[i]);
+	result = corpus_309(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_309_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_309_c[1]);
+	c[2] = (&corpus_309_c[2]);
+	c[3] = (&corpus_309_c[3]);
+	c[4] = (&corpus_309_c[4]);
+	return corpus_309_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_310(pbg_field* v, pbg_error* err);
+int corpus_310_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_310_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_310_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_310_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_310_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_310_s2[] = "ello";
+static char corpus_310_s3[] = "o!";
+static char corpus_310_s4[] = "x";
+static char corpus_310_s5[] = "y";
+static pbg_field corpus_310_c[] = {
+	{PBG_AC_SFX, 5, NULL},
+	{PBG_LT_STRING, 4, corpus_310_s2},
+	{PBG_LT_STRING, 2, corpus_310_s3},
+	{PBG_LT_STRING, 1, corpus_310_s4},
+	{PBG_LT_STRING, 1, corpus_310_s5},
+};
+
+static char* corpus_310_names[] = {"s", NULL};
+static int corpus_310_lens[] = {1, 0};
+
+static int corpus_310_f1(pbg_field* v, pbg_error* err);
+
+int corpus_310(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_310_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_310_f1(v, err);
+}
+
+int corpus_310_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_310_names[i], corpus_310_lens[i]);
+	result = corpus_310(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_310_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_310_c[1]);
+	c[2] = (&corpus_310_c[2]);
+	c[3] = (&corpus_310_c[3]);
+	c[4] = (&corpus_310_c[4]);
+	return corpus_310_match(c, 5, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_311(pbg_field* v, pbg_error* err);
+int corpus_311_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_311_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_311_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_311_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_311_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_311_s2[] = "hell";
+static char corpus_311_s3[] = "lo!";
+static char corpus_311_s4[] = "x";
+static char corpus_311_s5[] = "y";
+static pbg_field corpus_311_c[] = {
+	{PBG_AC_SFX, 5, NULL},
+	{PBG_LT_STRING, 4, corpus_311_s2},
+	{PBG_LT_STRING, 3, corpus_311_s3},
+	{PBG_LT_STRING, 1, corpus_311_s4},
+	{PBG_LT_STRING, 1, corpus_311_s5},
+};
+
+static char* corpus_311_names[] = {"s", NULL};
+static int corpus_311_lens[] = {1, 0};
+
+static int corpus_311_f1(pbg_field* v, pbg_error* err);
+
+int corpus_311(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_311_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_311_f1(v, err);
+}
+
+int corpus_311_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_311_names[i], corpus_311_lens[i]);
+	result = corpus_311(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_311_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_311_c[1]);
+	c[2] = (&corpus_311_c[2]);
+	c[3] = (&corpus_311_c[3]);
+	c[4] = (&corpus_311_c[4]);
+	return corpus_311_match(c, 5, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_312(pbg_field* v, pbg_error* err);
+int corpus_312_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_312_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_312_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_312_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_312_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_312_s2[] = "hell";
+static char corpus_312_s3[] = "lo!";
+static char corpus_312_s4[] = "x";
+static char corpus_312_s5[] = "y";
+static pbg_field corpus_312_c[] = {
+	{PBG_AC_SFX, 5, NULL},
+	{PBG_LT_STRING, 4, corpus_312_s2},
+	{PBG_LT_STRING, 3, corpus_312_s3},
+	{PBG_LT_STRING, 1, corpus_312_s4},
+	{PBG_LT_STRING, 1, corpus_312_s5},
+};
+
+static char* corpus_312_names[] = {"s", NULL};
+static int corpus_312_lens[] = {1, 0};
+
+static int corpus_312_f1(pbg_field* v, pbg_error* err);
+
+int corpus_312(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_312_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_312_f1(v, err);
+}
+
+int corpus_312_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_312_names[i], corpus_312_lens[i]);
+	result = corpus_312(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_312_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_312_c[1]);
+	c[2] = (&corpus_312_c[2]);
+	c[3] = (&corpus_312_c[3]);
+	c[4] = (&corpus_312_c[4]);
+	return corpus_312_match(c, 5, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_313(pbg_field* v, pbg_error* err);
+int corpus_313_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_313_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_313_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_313_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_313_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_313_s2[] = "he";
+static char corpus_313_s3[] = "she";
+static char corpus_313_s4[] = "his";
+static char corpus_313_s5[] = "hers";
+static pbg_field corpus_313_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 2, corpus_313_s2},
+	{PBG_LT_STRING, 3, corpus_313_s3},
+	{PBG_LT_STRING, 3, corpus_313_s4},
+	{PBG_LT_STRING, 4, corpus_313_s5},
+};
+
+static char* corpus_313_names[] = {"s", NULL};
+static int corpus_313_lens[] = {1, 0};
+
+static int corpus_313_f1(pbg_field* v, pbg_error* err);
+
+int corpus_313(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_313_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_313_f1(v, err);
+}
+
+int corpus_313_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_313_names[i], corpus_313_lens[i]);
+	result = corpus_313(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_313_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_313_c[1]);
+	c[2] = (&corpus_313_c[2]);
+	c[3] = (&corpus_313_c[3]);
+	c[4] = (&corpus_313_c[4]);
+	return corpus_313_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_314(pbg_field* v, pbg_error* err);
+int corpus_314_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_314_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_314_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_314_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_314_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_314_s2[] = "hex";
+static char corpus_314_s3[] = "shy";
+static char corpus_314_s4[] = "his";
+static char corpus_314_s5[] = "hers";
+static pbg_field corpus_314_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 3, corpus_314_s2},
+	{PBG_LT_STRING, 3, corpus_314_s3},
+	{PBG_LT_STRING, 3, corpus_314_s4},
+	{PBG_LT_STRING, 4, corpus_314_s5},
+};
+
+static char* corpus_314_names[] = {"s", NULL};
+static int corpus_314_lens[] = {1, 0};
+
+static int corpus_314_f1(pbg_field* v, pbg_error* err);
+
+int corpus_314(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_314_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_314_f1(v, err);
+}
+
+int corpus_314_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_314_names[i], corpus_314_lens[i]);
+	result = corpus_314(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_314_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_314_c[1]);
+	c[2] = (&corpus_314_c[2]);
+	c[3] = (&corpus_314_c[3]);
+	c[4] = (&corpus_314_c[4]);
+	return corpus_314_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_315(pbg_field* v, pbg_error* err);
+int corpus_315_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_315_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_315_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_315_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_315_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_315_s2[] = "hex";
+static char corpus_315_s3[] = "shy";
+static char corpus_315_s4[] = "his";
+static char corpus_315_s5[] = "herd";
+static pbg_field corpus_315_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 3, corpus_315_s2},
+	{PBG_LT_STRING, 3, corpus_315_s3},
+	{PBG_LT_STRING, 3, corpus_315_s4},
+	{PBG_LT_STRING, 4, corpus_315_s5},
+};
+
+static char* corpus_315_names[] = {"s", NULL};
+static int corpus_315_lens[] = {1, 0};
+
+static int corpus_315_f1(pbg_field* v, pbg_error* err);
+
+int corpus_315(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_315_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_315_f1(v, err);
+}
+
+int corpus_315_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_315_names[i], corpus_315_lens[i]);
+	result = corpus_315(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_315_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_315_c[1]);
+	c[2] = (&corpus_315_c[2]);
+	c[3] = (&corpus_315_c[3]);
+	c[4] = (&corpus_315_c[4]);
+	return corpus_315_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_316(pbg_field* v, pbg_error* err);
+int corpus_316_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_316_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_316_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_316_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_316_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_316_s2[] = "hex";
+static char corpus_316_s3[] = "shy";
+static char corpus_316_s4[] = "his";
+static char corpus_316_s5[] = "herd";
+static pbg_field corpus_316_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 3, corpus_316_s2},
+	{PBG_LT_STRING, 3, corpus_316_s3},
+	{PBG_LT_STRING, 3, corpus_316_s4},
+	{PBG_LT_STRING, 4, corpus_316_s5},
+};
+
+static char* corpus_316_names[] = {"s", NULL};
+static int corpus_316_lens[] = {1, 0};
+
+static int corpus_316_f1(pbg_field* v, pbg_error* err);
+
+int corpus_316(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_316_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_316_f1(v, err);
+}
+
+int corpus_316_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_316_names[i], corpus_316_lens[i]);
+	result = corpus_316(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_316_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_316_c[1]);
+	c[2] = (&corpus_316_c[2]);
+	c[3] = (&corpus_316_c[3]);
+	c[4] = (&corpus_316_c[4]);
+	return corpus_316_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_317(pbg_field* v, pbg_error* err);
+int corpus_317_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_317_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_317_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_317_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_317_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_317_s2[] = "x";
+static char corpus_317_s3[] = "xx";
+static char corpus_317_s4[] = "xxx";
+static char corpus_317_s5[] = "xxxx";
+static pbg_field corpus_317_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_317_s2},
+	{PBG_LT_STRING, 2, corpus_317_s3},
+	{PBG_LT_STRING, 3, corpus_317_s4},
+	{PBG_LT_STRING, 4, corpus_317_s5},
+};
+
+static char* corpus_317_names[] = {"s", NULL};
+static int corpus_317_lens[] = {1, 0};
+
+static int corpus_317_f1(pbg_field* v, pbg_error* err);
+
+int corpus_317(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_317_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_317_f1(v, err);
+}
+
+int corpus_317_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_317_names[i], corpus_317_lens[i]);
+	result = corpus_317(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_317_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_317_c[1]);
+	c[2] = (&corpus_317_c[2]);
+	c[3] = (&corpus_317_c[3]);
+	c[4] = (&corpus_317_c[4]);
+	return corpus_317_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_318(pbg_field* v, pbg_error* err);
+int corpus_318_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_318_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_318_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_318_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_318_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_318_s2[] = "x";
+static char corpus_318_s3[] = "xx";
+static char corpus_318_s4[] = "xxx";
+static char corpus_318_s5[] = "xxxx";
+static pbg_field corpus_318_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_318_s2},
+	{PBG_LT_STRING, 2, corpus_318_s3},
+	{PBG_LT_STRING, 3, corpus_318_s4},
+	{PBG_LT_STRING, 4, corpus_318_s5},
+};
+
+static char* corpus_318_names[] = {"s", NULL};
+static int corpus_318_lens[] = {1, 0};
+
+static int corpus_318_f1(pbg_field* v, pbg_error* err);
+
+int corpus_318(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_318_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_318_f1(v, err);
+}
+
+int corpus_318_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_318_names[i], corpus_318_lens[i]);
+	result = corpus_318(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_318_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_318_c[1]);
+	c[2] = (&corpus_318_c[2]);
+	c[3] = (&corpus_318_c[3]);
+	c[4] = (&corpus_318_c[4]);
+	return corpus_318_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_319(pbg_field* v, pbg_error* err);
+int corpus_319_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_319_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_319_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_319_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_319_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_319_s2[] = "a";
+static char corpus_319_s3[] = "b";
+static char corpus_319_s4[] = "c";
+static char corpus_319_s5[] = "";
+static pbg_field corpus_319_c[] = {
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_319_s2},
+	{PBG_LT_STRING, 1, corpus_319_s3},
+	{PBG_LT_STRING, 1, corpus_319_s4},
+	{PBG_LT_STRING, 0, corpus_319_s5},
+};
+
+static char* corpus_319_names[] = {"s", NULL};
+static int corpus_319_lens[] = {1, 0};
+
+static int corpus_319_f1(pbg_field* v, pbg_error* err);
+
+int corpus_319(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_319_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_319_f1(v, err);
+}
+
+int corpus_319_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_319_names[i], corpus_319_lens[i]);
+	result = corpus_319(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_319_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_319_c[1]);
+	c[2] = (&corpus_319_c[2]);
+	c[3] = (&corpus_319_c[3]);
+	c[4] = (&corpus_319_c[4]);
+	return corpus_319_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_320(pbg_field* v, pbg_error* err);
+int corpus_320_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_320_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_320_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_320_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_320_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_320_s2[] = "a";
+static char corpus_320_s3[] = "b";
+static char corpus_320_s4[] = "c";
+static char corpus_320_s5[] = "";
+static pbg_field corpus_320_c[] = {
+	{PBG_AC_SFX, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_320_s2},
+	{PBG_LT_STRING, 1, corpus_320_s3},
+	{PBG_LT_STRING, 1, corpus_320_s4},
+	{PBG_LT_STRING, 0, corpus_320_s5},
+};
+
+static char* corpus_320_names[] = {"s", NULL};
+static int corpus_320_lens[] = {1, 0};
+
+static int corpus_320_f1(pbg_field* v, pbg_error* err);
+
+int corpus_320(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_320_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_320_f1(v, err);
+}
+
+int corpus_320_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_320_names[i], corpus_320_lens[i]);
+	result = corpus_320(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_320_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_320_c[1]);
+	c[2] = (&corpus_320_c[2]);
+	c[3] = (&corpus_320_c[3]);
+	c[4] = (&corpus_320_c[4]);
+	return corpus_320_match(c, 5, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_321(pbg_field* v, pbg_error* err);
+int corpus_321_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_321_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_321_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_321_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_321_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_321_s2[] = "a";
+static char corpus_321_s3[] = "b";
+static char corpus_321_s4[] = "c";
+static char corpus_321_s5[] = "";
+static pbg_field corpus_321_c[] = {
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_321_s2},
+	{PBG_LT_STRING, 1, corpus_321_s3},
+	{PBG_LT_STRING, 1, corpus_321_s4},
+	{PBG_LT_STRING, 0, corpus_321_s5},
+};
+
+static char* corpus_321_names[] = {"s", NULL};
+static int corpus_321_lens[] = {1, 0};
+
+static int corpus_321_f1(pbg_field* v, pbg_error* err);
+
+int corpus_321(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_321_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_321_f1(v, err);
+}
+
+int corpus_321_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_321_names[i], corpus_321_lens[i]);
+	result = corpus_321(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_321_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_321_c[1]);
+	c[2] = (&corpus_321_c[2]);
+	c[3] = (&corpus_321_c[3]);
+	c[4] = (&corpus_321_c[4]);
+	return corpus_321_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_322(pbg_field* v, pbg_error* err);
+int corpus_322_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_322_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_322_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_322_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_322_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_322_s2[] = "a";
+static char corpus_322_s3[] = "b";
+static char corpus_322_s4[] = "c";
+static char corpus_322_s5[] = "d";
+static pbg_field corpus_322_c[] = {
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_322_s2},
+	{PBG_LT_STRING, 1, corpus_322_s3},
+	{PBG_LT_STRING, 1, corpus_322_s4},
+	{PBG_LT_STRING, 1, corpus_322_s5},
+};
+
+static char* corpus_322_names[] = {"s", NULL};
+static int corpus_322_lens[] = {1, 0};
+
+static int corpus_322_f1(pbg_field* v, pbg_error* err);
+
+int corpus_322(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_322_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_322_f1(v, err);
+}
+
+int corpus_322_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_322_names[i], corpus_322_lens[i]);
+	result = corpus_322(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_322_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_322_c[1]);
+	c[2] = (&corpus_322_c[2]);
+	c[3] = (&corpus_322_c[3]);
+	c[4] = (&corpus_322_c[4]);
+	return corpus_322_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_323(pbg_field* v, pbg_error* err);
+int corpus_323_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_323_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_323_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_323_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_323_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_323_s2[] = "a";
+static char corpus_323_s3[] = "b";
+static char corpus_323_s4[] = "c";
+static char corpus_323_s5[] = "d";
+static pbg_field corpus_323_c[] = {
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_323_s2},
+	{PBG_LT_STRING, 1, corpus_323_s3},
+	{PBG_LT_STRING, 1, corpus_323_s4},
+	{PBG_LT_STRING, 1, corpus_323_s5},
+};
+
+static char* corpus_323_names[] = {"a", NULL};
+static int corpus_323_lens[] = {1, 0};
+
+static int corpus_323_f1(pbg_field* v, pbg_error* err);
+
+int corpus_323(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_323_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_323_f1(v, err);
+}
+
+int corpus_323_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_323_names[i], corpus_323_lens[i]);
+	result = corpus_323(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_323_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_323_c[1]);
+	c[2] = (&corpus_323_c[2]);
+	c[3] = (&corpus_323_c[3]);
+	c[4] = (&corpus_323_c[4]);
+	return corpus_323_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_324(pbg_field* v, pbg_error* err);
+int corpus_324_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_324_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_324_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_324_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_324_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_324_s2[] = "a";
+static char corpus_324_s3[] = "b";
+static char corpus_324_s4[] = "c";
+static pbg_lt_number corpus_324_n5 = {5.0};
+static pbg_field corpus_324_c[] = {
+	{PBG_OP_CONT, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_324_s2},
+	{PBG_LT_STRING, 1, corpus_324_s3},
+	{PBG_LT_STRING, 1, corpus_324_s4},
+	{PBG_LT_NUMBER, sizeof(pbg_lt_number), &corpus_324_n5},
+};
+
+static char* corpus_324_names[] = {"s", NULL};
+static int corpus_324_lens[] = {1, 0};
+
+static int corpus_324_f1(pbg_field* v, pbg_error* err);
+
+int corpus_324(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_324_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_324_f1(v, err);
+}
+
+int corpus_324_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_324_names[i], corpus_324_lens[i]);
+	result = corpus_324(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_324_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_324_c[1]);
+	c[2] = (&corpus_324_c[2]);
+	c[3] = (&corpus_324_c[3]);
+	c[4] = (&corpus_324_c[4]);
+	return corpus_324_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_325(pbg_field* v, pbg_error* err);
+int corpus_325_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_325_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_325_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_325_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_325_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_325_s2[] = "a";
+static char corpus_325_s3[] = "b";
+static char corpus_325_s4[] = "c";
+static pbg_field corpus_325_c[] = {
+	{PBG_OP_CONT, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_325_s2},
+	{PBG_LT_STRING, 1, corpus_325_s3},
+	{PBG_LT_STRING, 1, corpus_325_s4},
+};
+
+static char* corpus_325_names[] = {"s", "t", NULL};
+static int corpus_325_lens[] = {1, 1, 0};
+
+static int corpus_325_f1(pbg_field* v, pbg_error* err);
+
+int corpus_325(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_325_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_325_f1(v, err);
+}
+
+int corpus_325_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_325_names[i], corpus_325_lens[i]);
+	result = corpus_325(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_325_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_325_c[1]);
+	c[2] = (&corpus_325_c[2]);
+	c[3] = (&corpus_325_c[3]);
+	c[4] = (v + 1);
+	return corpus_325_match(c, 5, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_326(pbg_field* v, pbg_error* err);
+int corpus_326_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_326_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_326_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_326_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_326_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_326_s2[] = "x";
+static pbg_field corpus_326_c[] = {
+	{PBG_OP_CONT, 3, NULL},
+	{PBG_LT_STRING, 1, corpus_326_s2},
+};
+
+static char* corpus_326_names[] = {"s", "t", NULL};
+static int corpus_326_lens[] = {1, 1, 0};
+
+static int corpus_326_f1(pbg_field* v, pbg_error* err);
+
+int corpus_326(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_326_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_326_f1(v, err);
+}
+
+int corpus_326_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[2];
+	int i, result;
+	for(i = 0; i < 2; i++)
+		v[i] = dict(corpus_326_names[i], corpus_326_lens[i]);
+	result = corpus_326(v, err);
+	for(i = 0; i < 2; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_326_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_326_c[1]);
+	c[2] = (v + 1);
+	return corpus_326_match(c, 3, PBG_OP_CONT, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_327(pbg_field* v, pbg_error* err);
+int corpus_327_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_327_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_327_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_327_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_327_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_327_s4[] = "a";
+static pbg_field corpus_327_c[] = {
+	{PBG_OP_SFX, 2, NULL},
+	{PBG_OP_NOT, 1, NULL},
+	{PBG_LT_TRUE, 0, NULL},
+	{PBG_LT_STRING, 1, corpus_327_s4},
+};
+
+static char* corpus_327_names[] = {NULL};
+static int corpus_327_lens[] = {0};
+
+static int corpus_327_f1(pbg_field* v, pbg_error* err);
+
+int corpus_327(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_327_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_327_f1(v, err);
+}
+
+int corpus_327_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 0; i++)
+		v[i] = dict(corpus_327_names[i], corpus_327_lens[i]);
+	result = corpus_327(v, err);
+	for(i = 0; i < 0; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_327_f1(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[2];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (&corpus_327_c[1]);
+	c[1] = (&corpus_327_c[3]);
+	return corpus_327_match(c, 2, PBG_OP_SFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_328(pbg_field* v, pbg_error* err);
+int corpus_328_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_328_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_328_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_328_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_328_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_328_s3[] = "a";
+static char corpus_328_s4[] = "b";
+static char corpus_328_s5[] = "c";
+static char corpus_328_s6[] = "d";
+static char corpus_328_s8[] = "xa";
+static char corpus_328_s9[] = "xb";
+static char corpus_328_s10[] = "xc";
+static char corpus_328_s11[] = "xd";
+static pbg_field corpus_328_c[] = {
+	{PBG_OP_AND, 2, NULL},
+	{PBG_AC_CONT, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_328_s3},
+	{PBG_LT_STRING, 1, corpus_328_s4},
+	{PBG_LT_STRING, 1, corpus_328_s5},
+	{PBG_LT_STRING, 1, corpus_328_s6},
+	{PBG_AC_PFX, 5, NULL},
+	{PBG_LT_STRING, 2, corpus_328_s8},
+	{PBG_LT_STRING, 2, corpus_328_s9},
+	{PBG_LT_STRING, 2, corpus_328_s10},
+	{PBG_LT_STRING, 2, corpus_328_s11},
+};
+
+static char* corpus_328_names[] = {"s", NULL};
+static int corpus_328_lens[] = {1, 0};
+
+static int corpus_328_f1(pbg_field* v, pbg_error* err);
+static int corpus_328_f2(pbg_field* v, pbg_error* err);
+static int corpus_328_f7(pbg_field* v, pbg_error* err);
+
+int corpus_328(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_328_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_328_f1(v, err);
+}
+
+int corpus_328_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_328_names[i], corpus_328_lens[i]);
+	result = corpus_328(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_328_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_328_f2(v, err)) != PBG_TRUE) return r;
+	r = corpus_328_f7(v, err);
+	return r;
+}
+
+static int corpus_328_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_328_c[2]);
+	c[2] = (&corpus_328_c[3]);
+	c[3] = (&corpus_328_c[4]);
+	c[4] = (&corpus_328_c[5]);
+	return corpus_328_match(c, 5, PBG_OP_CONT, err);
+}
+
+static int corpus_328_f7(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_328_c[7]);
+	c[2] = (&corpus_328_c[8]);
+	c[3] = (&corpus_328_c[9]);
+	c[4] = (&corpus_328_c[10]);
+	return corpus_328_match(c, 5, PBG_OP_PFX, err);
+}
+
+/* Generated by pbg_compile. */
+#include "pbg.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int corpus_329(pbg_field* v, pbg_error* err);
+int corpus_329_dict(pbg_field (*dict)(char*, int), pbg_error* err);
+
+static int corpus_329_fail(pbg_error* err, pbg_error_type type, int line, char* msg)
+{
+	err->_type = type;
+	err->_line = line;
+	err->_file = __FILE__;
+	err->_msg = msg;
+	err->_str = NULL;
+	err->_i = 0;
+	err->_int = 0;
+	return PBG_ERROR;
+}
+
+static int corpus_329_match(pbg_field** c, int n, pbg_field_type op, pbg_error* err)
+{
+	char* s, *p;
+	int i, j, len;
+	for(i = 0; i < n; i++) {
+		if(c[i]->_type == PBG_NULL)
+			return corpus_329_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "NULL input given to string operator.");
+		if(c[i]->_type != PBG_LT_STRING)
+			return corpus_329_fail(err, PBG_ERR_OP_ARG_TYPE, __LINE__, "Non-STRING input given to string operator.");
+	}
+	s = (char*) c[0]->_data;
+	for(i = 1; i < n; i++) {
+		p = (char*) c[i]->_data, len = c[i]->_int;
+		if(len > c[0]->_int) continue;
+		if(op == PBG_OP_PFX && memcmp(s, p, len) == 0) return PBG_TRUE;
+		if(op == PBG_OP_SFX && memcmp(s + c[0]->_int-len, p, len) == 0) return PBG_TRUE;
+		for(j = 0; op == PBG_OP_CONT && j <= c[0]->_int-len; j++)
+			if(memcmp(s + j, p, len) == 0) return PBG_TRUE;
+	}
+	return PBG_FALSE;
+}
+
+static char corpus_329_s3[] = "x";
+static char corpus_329_s4[] = "y";
+static char corpus_329_s6[] = "a";
+static char corpus_329_s7[] = "b";
+static char corpus_329_s8[] = "c";
+static char corpus_329_s9[] = "d";
+static pbg_field corpus_329_c[] = {
+	{PBG_OP_OR, 2, NULL},
+	{PBG_OP_CONT, 3, NULL},
+	{PBG_LT_STRING, 1, corpus_329_s3},
+	{PBG_LT_STRING, 1, corpus_329_s4},
+	{PBG_AC_SFX, 5, NULL},
+	{PBG_LT_STRING, 1, corpus_329_s6},
+	{PBG_LT_STRING, 1, corpus_329_s7},
+	{PBG_LT_STRING, 1, corpus_329_s8},
+	{PBG_LT_STRING, 1, corpus_329_s9},
+};
+
+static char* corpus_329_names[] = {"s", NULL};
+static int corpus_329_lens[] = {1, 0};
+
+static int corpus_329_f1(pbg_field* v, pbg_error* err);
+static int corpus_329_f2(pbg_field* v, pbg_error* err);
+static int corpus_329_f5(pbg_field* v, pbg_error* err);
+
+int corpus_329(pbg_field* v, pbg_error* err)
+{
+	PBG_UNUSED(v);
+	corpus_329_fail(err, PBG_ERR_NONE, 0, NULL);
+	return corpus_329_f1(v, err);
+}
+
+int corpus_329_dict(pbg_field (*dict)(char*, int), pbg_error* err)
+{
+	pbg_field v[1];
+	int i, result;
+	for(i = 0; i < 1; i++)
+		v[i] = dict(corpus_329_names[i], corpus_329_lens[i]);
+	result = corpus_329(v, err);
+	for(i = 0; i < 1; i++)
+		if(v[i]._data != NULL)
+			free(v[i]._data);
+	return result;
+}
+
+static int corpus_329_f1(pbg_field* v, pbg_error* err)
+{
+	int r;
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	if((r = corpus_329_f2(v, err)) != PBG_FALSE) return r;
+	r = corpus_329_f5(v, err);
+	return r;
+}
+
+static int corpus_329_f2(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[3];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_329_c[2]);
+	c[2] = (&corpus_329_c[3]);
+	return corpus_329_match(c, 3, PBG_OP_CONT, err);
+}
+
+static int corpus_329_f5(pbg_field* v, pbg_error* err)
+{
+	pbg_field* c[5];
+	PBG_UNUSED(v);
+	PBG_UNUSED(err);
+	c[0] = (v + 0);
+	c[1] = (&corpus_329_c[5]);
+	c[2] = (&corpus_329_c[6]);
+	c[3] = (&corpus_329_c[7]);
+	c[4] = (&corpus_329_c[8]);
+	return corpus_329_match(c, 5, PBG_OP_SFX, err);
+}
+
+struct {
+	char* _str;
+	int _specialized;
+	int (*_vars)(pbg_field*, pbg_error*);
+	int (*_dict)(pbg_field (*)(char*, int), pbg_error*);
+} compiled[] = {
+	{"TRUE", 0, corpus_0, corpus_0_dict},
+	{"  TRUE", 0, corpus_1, corpus_1_dict},
+	{"TRUE  ", 0, corpus_2, corpus_2_dict},
+	{"FALSE", 0, corpus_3, corpus_3_dict},
+	{"  FALSE", 0, corpus_4, corpus_4_dict},
+	{"FALSE  ", 0, corpus_5, corpus_5_dict},
+	{"(! FALSE)", 0, corpus_6, corpus_6_dict},
+	{"(! TRUE)", 0, corpus_7, corpus_7_dict},
+	{"(! (= 10 10))", 0, corpus_8, corpus_8_dict},
+	{"(! (= 10 10))", 0, corpus_9, corpus_9_dict},
+	{"(! (= 9 10))", 0, corpus_10, corpus_10_dict},
+	{"(! (! (= 9 10)))", 0, corpus_11, corpus_11_dict},
+	{"(! [1])", 0, corpus_12, corpus_12_dict},
+	{"(! [0])", 0, corpus_13, corpus_13_dict},
+	{"(& TRUE TRUE)", 0, corpus_14, corpus_14_dict},
+	{"(& TRUE FALSE)", 0, corpus_15, corpus_15_dict},
+	{"(& FALSE TRUE)", 0, corpus_16, corpus_16_dict},
+	{"(& FALSE FALSE)", 0, corpus_17, corpus_17_dict},
+	{"(& TRUE TRUE TRUE TRUE TRUE)", 0, corpus_18, corpus_18_dict},
+	{"(& TRUE TRUE TRUE FALSE TRUE)", 0, corpus_19, corpus_19_dict},
+	{"(& (& FALSE TRUE) TRUE)", 0, corpus_20, corpus_20_dict},
+	{"(& [1] [1])", 0, corpus_21, corpus_21_dict},
+	{"(& [0] [1])", 0, corpus_22, corpus_22_dict},
+	{"(& [1] [0])", 0, corpus_23, corpus_23_dict},
+	{"(& [0] [0])", 0, corpus_24, corpus_24_dict},
+	{"(| TRUE TRUE)", 0, corpus_25, corpus_25_dict},
+	{"(| TRUE TRUE)", 0, corpus_26, corpus_26_dict},
+	{"(| TRUE FALSE)", 0, corpus_27, corpus_27_dict},
+	{"(| FALSE TRUE)", 0, corpus_28, corpus_28_dict},
+	{"(| FALSE FALSE)", 0, corpus_29, corpus_29_dict},
+	{"(| FALSE FALSE FALSE FALSE FALSE)", 0, corpus_30, corpus_30_dict},
+	{"(| FALSE TRUE FALSE FALSE FALSE)", 0, corpus_31, corpus_31_dict},
+	{"(| [1] [1])", 0, corpus_32, corpus_32_dict},
+	{"(| [0] [1])", 0, corpus_33, corpus_33_dict},
+	{"(| [1] [0])", 0, corpus_34, corpus_34_dict},
+	{"(| [0] [0])", 0, corpus_35, corpus_35_dict},
+	{"(\077 [c])", 0, corpus_36, corpus_36_dict},
+	{"(\077 [d])", 0, corpus_37, corpus_37_dict},
+	{"(\077 [c] [c])", 0, corpus_38, corpus_38_dict},
+	{"(\077 [a] [c] [c])", 0, corpus_39, corpus_39_dict},
+	{"(\077 [a] [c] [d])", 0, corpus_40, corpus_40_dict},
+	{"(\077 [a] [d] [c])", 0, corpus_41, corpus_41_dict},
+	{"(= 10 10)", 0, corpus_42, corpus_42_dict},
+	{"(= 10 10 10 10 10)", 0, corpus_43, corpus_43_dict},
+	{"(= 10 10 10 9 10)", 0, corpus_44, corpus_44_dict},
+	{"(= 9 10)", 0, corpus_45, corpus_45_dict},
+	{"(= 10 9)", 0, corpus_46, corpus_46_dict},
+	{"(= 'hi' 9)", 0, corpus_47, corpus_47_dict},
+	{"(= -10 'hi')", 0, corpus_48, corpus_48_dict},
+	{"(= -10 -10)", 0, corpus_49, corpus_49_dict},
+	{"(= 'hi' 'hi')", 0, corpus_50, corpus_50_dict},
+	{"(= 'a, b\134'c' 'a, b\134'c')", 0, corpus_51, corpus_51_dict},
+	{"(= 'ab\134'c' 'ab\134'd')", 0, corpus_52, corpus_52_dict},
+	{"(= 'hia' 'hi')", 0, corpus_53, corpus_53_dict},
+	{"(= 'hi' 'h ')", 0, corpus_54, corpus_54_dict},
+	{"(= 2018-10-12 'h ')", 0, corpus_55, corpus_55_dict},
+	{"(= 2018-10-12 2018-10-12)", 0, corpus_56, corpus_56_dict},
+	{"(= 2018-10-12 2018-10-13)", 0, corpus_57, corpus_57_dict},
+	{"(= 2018-10-13 2018-10-12)", 0, corpus_58, corpus_58_dict},
+	{"(= 2018-10-13 2017-10-13)", 0, corpus_59, corpus_59_dict},
+	{"(= 2018-10-13 2018-11-13)", 0, corpus_60, corpus_60_dict},
+	{"(= [a] [a])", 0, corpus_61, corpus_61_dict},
+	{"(= [a] [b])", 0, corpus_62, corpus_62_dict},
+	{"(= [a] [c])", 0, corpus_63, corpus_63_dict},
+	{"(= [c] [b])", 0, corpus_64, corpus_64_dict},
+	{"(= TRUE TRUE)", 0, corpus_65, corpus_65_dict},
+	{"(= TRUE FALSE)", 0, corpus_66, corpus_66_dict},
+	{"(= FALSE TRUE)", 0, corpus_67, corpus_67_dict},
+	{"(= FALSE FALSE)", 0, corpus_68, corpus_68_dict},
+	{"(= [1] [1])", 0, corpus_69, corpus_69_dict},
+	{"(= [1] [0])", 0, corpus_70, corpus_70_dict},
+	{"(= [0] [1])", 0, corpus_71, corpus_71_dict},
+	{"(= [0] [0])", 0, corpus_72, corpus_72_dict},
+	{"(!= 10 10)", 0, corpus_73, corpus_73_dict},
+	{"(!= 9 10)", 0, corpus_74, corpus_74_dict},
+	{"(!= 10 9)", 0, corpus_75, corpus_75_dict},
+	{"(!= 'hi' 9)", 0, corpus_76, corpus_76_dict},
+	{"(!= -10 'hi')", 0, corpus_77, corpus_77_dict},
+	{"(!= -10 -10)", 0, corpus_78, corpus_78_dict},
+	{"(!= 'hi' 'hi')", 0, corpus_79, corpus_79_dict},
+	{"(!= 'a,b\134'c' 'a,b\134'c')", 0, corpus_80, corpus_80_dict},
+	{"(!= 'ab\134'c' 'ab\134'd')", 0, corpus_81, corpus_81_dict},
+	{"(!= 'hia' 'hi')", 0, corpus_82, corpus_82_dict},
+	{"(!= 'hi' 'h ')", 0, corpus_83, corpus_83_dict},
+	{"(!= 2018-10-12 'h ')", 0, corpus_84, corpus_84_dict},
+	{"(!= 2018-10-12 2018-10-12)", 0, corpus_85, corpus_85_dict},
+	{"(!= 2018-10-12 2018-10-13)", 0, corpus_86, corpus_86_dict},
+	{"(!= 2018-10-13 2018-10-12)", 0, corpus_87, corpus_87_dict},
+	{"(!= 2018-10-13 2017-10-13)", 0, corpus_88, corpus_88_dict},
+	{"(!= 2018-10-13 2018-11-13)", 0, corpus_89, corpus_89_dict},
+	{"(!= [a] [a])", 0, corpus_90, corpus_90_dict},
+	{"(!= [a] [b])", 0, corpus_91, corpus_91_dict},
+	{"(!= [a] [c])", 0, corpus_92, corpus_92_dict},
+	{"(!= [c] [b])", 0, corpus_93, corpus_93_dict},
+	{"(!= TRUE TRUE)", 0, corpus_94, corpus_94_dict},
+	{"(!= TRUE FALSE)", 0, corpus_95, corpus_95_dict},
+	{"(!= FALSE TRUE)", 0, corpus_96, corpus_96_dict},
+	{"(!= FALSE FALSE)", 0, corpus_97, corpus_97_dict},
+	{"(!= [1] [1])", 0, corpus_98, corpus_98_dict},
+	{"(!= [1] [0])", 0, corpus_99, corpus_99_dict},
+	{"(!= [0] [1])", 0, corpus_100, corpus_100_dict},
+	{"(!= [0] [0])", 0, corpus_101, corpus_101_dict},
+	{"(< 2 3)", 0, corpus_102, corpus_102_dict},
+	{"(< 3 3)", 0, corpus_103, corpus_103_dict},
+	{"(< -3 3)", 0, corpus_104, corpus_104_dict},
+	{"(< 'a' 'a')", 0, corpus_105, corpus_105_dict},
+	{"(< 'a' 'b')", 0, corpus_106, corpus_106_dict},
+	{"(< 'b' 'a')", 0, corpus_107, corpus_107_dict},
+	{"(< 'aaa' 'aab')", 0, corpus_108, corpus_108_dict},
+	{"(< 'ab' 'ab!')", 0, corpus_109, corpus_109_dict},
+	{"(< 'ab!' 'ab')", 0, corpus_110, corpus_110_dict},
+	{"(< 2018-10-12 2018-10-12)", 0, corpus_111, corpus_111_dict},
+	{"(< 2018-10-11 2018-10-12)", 0, corpus_112, corpus_112_dict},
+	{"(< 2018-10-12 2018-10-11)", 0, corpus_113, corpus_113_dict},
+	{"(< 2018-09-12 2018-10-12)", 0, corpus_114, corpus_114_dict},
+	{"(< 2018-09-12 2018-10-12)", 0, corpus_115, corpus_115_dict},
+	{"(< 2018-10-12 2018-09-12)", 0, corpus_116, corpus_116_dict},
+	{"(< 2017-10-12 2018-10-12)", 0, corpus_117, corpus_117_dict},
+	{"(< 2018-10-12 2017-10-12)", 0, corpus_118, corpus_118_dict},
+	{"(< [1] [1])", 0, corpus_119, corpus_119_dict},
+	{"(< [1] [0])", 0, corpus_120, corpus_120_dict},
+	{"(< [0] [1])", 0, corpus_121, corpus_121_dict},
+	{"(< [0] [0])", 0, corpus_122, corpus_122_dict},
+	{"(> 3 2)", 0, corpus_123, corpus_123_dict},
+	{"(> 3 3)", 0, corpus_124, corpus_124_dict},
+	{"(> 3 -3)", 0, corpus_125, corpus_125_dict},
+	{"(> 'a' 'a')", 0, corpus_126, corpus_126_dict},
+	{"(> 'a' 'b')", 0, corpus_127, corpus_127_dict},
+	{"(> 'b' 'a')", 0, corpus_128, corpus_128_dict},
+	{"(> 'aaa' 'aab')", 0, corpus_129, corpus_129_dict},
+	{"(> 'ab!' 'ab')", 0, corpus_130, corpus_130_dict},
+	{"(> 2018-10-12 2018-10-12)", 0, corpus_131, corpus_131_dict},
+	{"(> 2018-10-11 2018-10-12)", 0, corpus_132, corpus_132_dict},
+	{"(> 2018-10-12 2018-10-11)", 0, corpus_133, corpus_133_dict},
+	{"(> 2018-09-12 2018-10-12)", 0, corpus_134, corpus_134_dict},
+	{"(> 2018-10-12 2018-09-12)", 0, corpus_135, corpus_135_dict},
+	{"(> 2017-10-12 2018-10-12)", 0, corpus_136, corpus_136_dict},
+	{"(> 2018-10-12 2017-10-12)", 0, corpus_137, corpus_137_dict},
+	{"(> [1] [1])", 0, corpus_138, corpus_138_dict},
+	{"(> [1] [0])", 0, corpus_139, corpus_139_dict},
+	{"(> [0] [1])", 0, corpus_140, corpus_140_dict},
+	{"(> [0] [0])", 0, corpus_141, corpus_141_dict},
+	{"(<= 2 3)", 0, corpus_142, corpus_142_dict},
+	{"(<= 3 3)", 0, corpus_143, corpus_143_dict},
+	{"(<= -3 3)", 0, corpus_144, corpus_144_dict},
+	{"(<= 3 -3)", 0, corpus_145, corpus_145_dict},
+	{"(<= 'a' 'a')", 0, corpus_146, corpus_146_dict},
+	{"(<= 'a' 'b')", 0, corpus_147, corpus_147_dict},
+	{"(<= 'b' 'a')", 0, corpus_148, corpus_148_dict},
+	{"(<= 'aaa' 'aab')", 0, corpus_149, corpus_149_dict},
+	{"(<= 'ab!' 'ab')", 0, corpus_150, corpus_150_dict},
+	{"(<= 2018-10-12 2018-10-12)", 0, corpus_151, corpus_151_dict},
+	{"(<= 2018-10-11 2018-10-12)", 0, corpus_152, corpus_152_dict},
+	{"(<= 2018-10-12 2018-10-11)", 0, corpus_153, corpus_153_dict},
+	{"(<= 2018-09-12 2018-10-12)", 0, corpus_154, corpus_154_dict},
+	{"(<= 2018-10-12 2018-09-12)", 0, corpus_155, corpus_155_dict},
+	{"(<= 2017-10-12 2018-10-12)", 0, corpus_156, corpus_156_dict},
+	{"(<= 2018-10-12 2017-10-12)", 0, corpus_157, corpus_157_dict},
+	{"(<= [1] [1])", 0, corpus_158, corpus_158_dict},
+	{"(<= [1] [0])", 0, corpus_159, corpus_159_dict},
+	{"(<= [0] [1])", 0, corpus_160, corpus_160_dict},
+	{"(<= [0] [0])", 0, corpus_161, corpus_161_dict},
+	{"(>= 3 2)", 0, corpus_162, corpus_162_dict},
+	{"(>= 3 3)", 0, corpus_163, corpus_163_dict},
+	{"(>= 3 -3)", 0, corpus_164, corpus_164_dict},
+	{"(>= -3 3)", 0, corpus_165, corpus_165_dict},
+	{"(>= 'a' 'a')", 0, corpus_166, corpus_166_dict},
+	{"(>= 'a' 'b')", 0, corpus_167, corpus_167_dict},
+	{"(>= 'b' 'a')", 0, corpus_168, corpus_168_dict},
+	{"(>= 'aaa' 'aab')", 0, corpus_169, corpus_169_dict},
+	{"(>= 'ab' 'ab!')", 0, corpus_170, corpus_170_dict},
+	{"(>= 2018-10-12 2018-10-12)", 0, corpus_171, corpus_171_dict},
+	{"(>= 2018-10-11 2018-10-12)", 0, corpus_172, corpus_172_dict},
+	{"(>= 2018-10-12 2018-10-11)", 0, corpus_173, corpus_173_dict},
+	{"(>= 2018-09-12 2018-10-12)", 0, corpus_174, corpus_174_dict},
+	{"(>= 2018-10-12 2018-09-12)", 0, corpus_175, corpus_175_dict},
+	{"(>= 2017-10-12 2018-10-12)", 0, corpus_176, corpus_176_dict},
+	{"(>= 2018-10-12 2017-10-12)", 0, corpus_177, corpus_177_dict},
+	{"(>= [1] [1])", 0, corpus_178, corpus_178_dict},
+	{"(>= [1] [0])", 0, corpus_179, corpus_179_dict},
+	{"(>= [0] [1])", 0, corpus_180, corpus_180_dict},
+	{"(>= [0] [0])", 0, corpus_181, corpus_181_dict},
+	{"(@ DATE 2018-10-12)", 0, corpus_182, corpus_182_dict},
+	{"(@ DATE [a])", 0, corpus_183, corpus_183_dict},
+	{"(@ DATE 2018-10-12 2017-10-12)", 0, corpus_184, corpus_184_dict},
+	{"(@ DATE 2018-10-12 10)", 0, corpus_185, corpus_185_dict},
+	{"(@ NUMBER 10)", 0, corpus_186, corpus_186_dict},
+	{"(@ NUMBER [a])", 0, corpus_187, corpus_187_dict},
+	{"(@ NUMBER 10 12 13)", 0, corpus_188, corpus_188_dict},
+	{"(@ NUMBER 10 12 'hi' 13)", 0, corpus_189, corpus_189_dict},
+	{"(@ STRING 'hi')", 0, corpus_190, corpus_190_dict},
+	{"(@ STRING [a])", 0, corpus_191, corpus_191_dict},
+	{"(@ STRING 'hi' 'a' 'b')", 0, corpus_192, corpus_192_dict},
+	{"(@ STRING 'a' 12 'hi' 'b')", 0, corpus_193, corpus_193_dict},
+	{"(@ BOOL TRUE)", 0, corpus_194, corpus_194_dict},
+	{"(@ BOOL FALSE)", 0, corpus_195, corpus_195_dict},
+	{"(@ BOOL TRUE FALSE TRUE TRUE FALSE)", 0, corpus_196, corpus_196_dict},
+	{"(@ BOOL TRUE FALSE 10 TRUE FALSE)", 0, corpus_197, corpus_197_dict},
+	{"(@ BOOL 10)", 0, corpus_198, corpus_198_dict},
+	{"(@ BOOL 'hi')", 0, corpus_199, corpus_199_dict},
+	{"(@ BOOL (& 10 10))", 0, corpus_200, corpus_200_dict},
+	{"(@ BOOL (& 10 10) 'hi' TRUE (! FALSE))", 0, corpus_201, corpus_201_dict},
+	{"(@ BOOL (! FALSE) (\077 [a]) (& FALSE FALSE) (& FALSE TRUE))", 0, corpus_202, corpus_202_dict},
+	{"(@ 10 10)", 0, corpus_203, corpus_203_dict},
+	{"(>=  3  2)", 0, corpus_204, corpus_204_dict},
+	{"(=  2  2 )", 0, corpus_205, corpus_205_dict},
+	{"( = 2 2)", 0, corpus_206, corpus_206_dict},
+	{"(= ' hi ' ' hi')", 0, corpus_207, corpus_207_dict},
+	{"(= 2 2)  ", 0, corpus_208, corpus_208_dict},
+	{"(=\012\0112\012\0112\012)  ", 0, corpus_209, corpus_209_dict},
+	{"    (   =    \0112     2)  ", 0, corpus_210, corpus_210_dict},
+	{"(>= 'hi' 2)", 0, corpus_211, corpus_211_dict},
+	{"(>= 2 'hi')", 0, corpus_212, corpus_212_dict},
+	{"(= 'a' 97)", 0, corpus_213, corpus_213_dict},
+	{"'test'", 0, corpus_214, corpus_214_dict},
+	{"(!(= 10 10))", 0, corpus_215, corpus_215_dict},
+	{"(&(= 10 10)(= 20 20))", 0, corpus_216, corpus_216_dict},
+	{"(&(\077[a])(\077[b]))", 0, corpus_217, corpus_217_dict},
+	{"(< (\077[1])(\077[1]))", 0, corpus_218, corpus_218_dict},
+	{"(< (\077[0])(\077[1]))", 0, corpus_219, corpus_219_dict},
+	{"(< (\077[1])(\077[0]))", 0, corpus_220, corpus_220_dict},
+	{"(< (\077[0])(\077[0]))", 0, corpus_221, corpus_221_dict},
+	{"(<= (\077[1])(\077[1]))", 0, corpus_222, corpus_222_dict},
+	{"(<= (\077[0])(\077[1]))", 0, corpus_223, corpus_223_dict},
+	{"(<= (\077[1])(\077[0]))", 0, corpus_224, corpus_224_dict},
+	{"(<= (\077[0])(\077[0]))", 0, corpus_225, corpus_225_dict},
+	{"(> (\077[1])(\077[1]))", 0, corpus_226, corpus_226_dict},
+	{"(> (\077[0])(\077[1]))", 0, corpus_227, corpus_227_dict},
+	{"(> (\077[1])(\077[0]))", 0, corpus_228, corpus_228_dict},
+	{"(> (\077[0])(\077[0]))", 0, corpus_229, corpus_229_dict},
+	{"(>= (\077[1])(\077[1]))", 0, corpus_230, corpus_230_dict},
+	{"(>= (\077[0])(\077[1]))", 0, corpus_231, corpus_231_dict},
+	{"(>= (\077[1])(\077[0]))", 0, corpus_232, corpus_232_dict},
+	{"(>= (\077[0])(\077[0]))", 0, corpus_233, corpus_233_dict},
+	{"(= (\077[1])(\077[1]))", 0, corpus_234, corpus_234_dict},
+	{"(= (\077[0])(\077[1]))", 0, corpus_235, corpus_235_dict},
+	{"(= (\077[1])(\077[0]))", 0, corpus_236, corpus_236_dict},
+	{"(= (\077[0])(\077[0]))", 0, corpus_237, corpus_237_dict},
+	{"(!= (\077[1])(\077[1]))", 0, corpus_238, corpus_238_dict},
+	{"(!= (\077[0])(\077[1]))", 0, corpus_239, corpus_239_dict},
+	{"(!= (\077[1])(\077[0]))", 0, corpus_240, corpus_240_dict},
+	{"(!= (\077[0])(\077[0]))", 0, corpus_241, corpus_241_dict},
+	{"(= [a] [b])", 0, corpus_242, corpus_242_dict},
+	{"(< [a] [c])", 0, corpus_243, corpus_243_dict},
+	{"(= [a] [a] [b] [c])", 0, corpus_244, corpus_244_dict},
+	{"(& (= [s] 'hi') (= [d] 2018-10-12))", 0, corpus_245, corpus_245_dict},
+	{"(& (< [s] 'hj') (> [d] 2018-10-11))", 0, corpus_246, corpus_246_dict},
+	{"(& (@ STRING [s]) (@ DATE [d]) (! [t]))", 0, corpus_247, corpus_247_dict},
+	{"(\077 [a] [x])", 0, corpus_248, corpus_248_dict},
+	{"(< [x] 1)", 0, corpus_249, corpus_249_dict},
+	{"(< [a] [c])", 1, corpus_250, corpus_250_dict},
+	{"(& (< [a] [c]) (>= [c] [b]))", 1, corpus_251, corpus_251_dict},
+	{"(& (= [a] [b]) (!= [c] [b]))", 1, corpus_252, corpus_252_dict},
+	{"(<= 'abc' 'abd')", 1, corpus_253, corpus_253_dict},
+	{"(> 2018-10-13 2018-10-12)", 1, corpus_254, corpus_254_dict},
+	{"(= [a] [b] [c])", 1, corpus_255, corpus_255_dict},
+	{"(= (< [a] [c]) TRUE)", 1, corpus_256, corpus_256_dict},
+	{"(< [a] 6)", 1, corpus_257, corpus_257_dict},
+	{"(& (= [a] [b]) (!= [a] 5))", 1, corpus_258, corpus_258_dict},
+	{"(@ NUMBER [a] [b] 12)", 1, corpus_259, corpus_259_dict},
+	{"(@ DATE [a] [x])", 1, corpus_260, corpus_260_dict},
+	{"(@ NUMBER [a] [x])", 1, corpus_261, corpus_261_dict},
+	{"(\077 [a] [c] (! FALSE))", 1, corpus_262, corpus_262_dict},
+	{"(\077 [a] [x])", 1, corpus_263, corpus_263_dict},
+	{"(| (= [a] 'five') (!= [b] 2018-01-01))", 1, corpus_264, corpus_264_dict},
+	{"(< [x] 6)", 1, corpus_265, corpus_265_dict},
+	{"(| TRUE (< [d] 2018-10-13))", 1, corpus_266, corpus_266_dict},
+	{"(| FALSE (= [s] 'abc'))", 1, corpus_267, corpus_267_dict},
+	{"(| FALSE (= [s] [s]))", 1, corpus_268, corpus_268_dict},
+	{"(< [a] 6)", 0, corpus_269, corpus_269_dict},
+	{"(< 6 [a])", 0, corpus_270, corpus_270_dict},
+	{"(>= [c] 6)", 0, corpus_271, corpus_271_dict},
+	{"(<= 7 [c])", 0, corpus_272, corpus_272_dict},
+	{"(= [a] 5)", 0, corpus_273, corpus_273_dict},
+	{"(= 5 [a])", 0, corpus_274, corpus_274_dict},
+	{"(!= [a] 5)", 0, corpus_275, corpus_275_dict},
+	{"(= [s] 'hi')", 0, corpus_276, corpus_276_dict},
+	{"(!= 'hi' [s])", 0, corpus_277, corpus_277_dict},
+	{"(< [s] 'hello')", 0, corpus_278, corpus_278_dict},
+	{"(> 'hj' [s])", 0, corpus_279, corpus_279_dict},
+	{"(< 'h' [s])", 0, corpus_280, corpus_280_dict},
+	{"(>= [s] 'hi!')", 0, corpus_281, corpus_281_dict},
+	{"(= [d] 2018-10-12)", 0, corpus_282, corpus_282_dict},
+	{"(< [d] 2018-10-13)", 0, corpus_283, corpus_283_dict},
+	{"(>= 2018-10-11 [d])", 0, corpus_284, corpus_284_dict},
+	{"(< [x] 6)", 0, corpus_285, corpus_285_dict},
+	{"(= [x] 6)", 0, corpus_286, corpus_286_dict},
+	{"(!= 6 [x])", 0, corpus_287, corpus_287_dict},
+	{"(< [s] 6)", 0, corpus_288, corpus_288_dict},
+	{"(= [s] 6)", 0, corpus_289, corpus_289_dict},
+	{"(!= [d] 'hi')", 0, corpus_290, corpus_290_dict},
+	{"(= [t] 5)", 0, corpus_291, corpus_291_dict},
+	{"(= 5 [t])", 0, corpus_292, corpus_292_dict},
+	{"(< [t] 5)", 0, corpus_293, corpus_293_dict},
+	{"(& (< [a] 6) (= [s] 'hi') (> [d] 2018-01-01))", 0, corpus_294, corpus_294_dict},
+	{"(= [a] [b])", 0, corpus_295, corpus_295_dict},
+	{"(= [a] 5 5)", 0, corpus_296, corpus_296_dict},
+	{"(< 5 6)", 0, corpus_297, corpus_297_dict},
+	{"(= [t] TRUE)", 0, corpus_298, corpus_298_dict},
+	{"(^= [s] 'he')", 0, corpus_299, corpus_299_dict},
+	{"(^= [s] 'el' 'lo')", 0, corpus_300, corpus_300_dict},
+	{"($= [s] 'el' 'lo')", 0, corpus_301, corpus_301_dict},
+	{"($= [s] 'hello!')", 0, corpus_302, corpus_302_dict},
+	{"(*= [s] 'ell')", 0, corpus_303, corpus_303_dict},
+	{"(*= [s] 'elo' 'lol')", 0, corpus_304, corpus_304_dict},
+	{"(*= [s] '')", 0, corpus_305, corpus_305_dict},
+	{"(*= 'hello' [s])", 0, corpus_306, corpus_306_dict},
+	{"(^= [s] 'hex' 'help' 'hello' 'h')", 0, corpus_307, corpus_307_dict},
+	{"(^= [s] 'hex' 'help' 'hellos' 'e')", 0, corpus_308, corpus_308_dict},
+	{"(^= [s] 'hex' 'help' 'hellos' 'ell')", 0, corpus_309, corpus_309_dict},
+	{"($= [s] 'ello' 'o!' 'x' 'y')", 0, corpus_310, corpus_310_dict},
+	{"($= [s] 'hell' 'lo!' 'x' 'y')", 0, corpus_311, corpus_311_dict},
+	{"($= [s] 'hell' 'lo!' 'x' 'y')", 0, corpus_312, corpus_312_dict},
+	{"(*= [s] 'he' 'she' 'his' 'hers')", 0, corpus_313, corpus_313_dict},
+	{"(*= [s] 'hex' 'shy' 'his' 'hers')", 0, corpus_314, corpus_314_dict},
+	{"(*= [s] 'hex' 'shy' 'his' 'herd')", 0, corpus_315, corpus_315_dict},
+	{"(*= [s] 'hex' 'shy' 'his' 'herd')", 0, corpus_316, corpus_316_dict},
+	{"(*= [s] 'x' 'xx' 'xxx' 'xxxx')", 0, corpus_317, corpus_317_dict},
+	{"(*= [s] 'x' 'xx' 'xxx' 'xxxx')", 0, corpus_318, corpus_318_dict},
+	{"(^= [s] 'a' 'b' 'c' '')", 0, corpus_319, corpus_319_dict},
+	{"($= [s] 'a' 'b' 'c' '')", 0, corpus_320, corpus_320_dict},
+	{"(*= [s] 'a' 'b' 'c' '')", 0, corpus_321, corpus_321_dict},
+	{"(^= [s] 'a' 'b' 'c' 'd')", 0, corpus_322, corpus_322_dict},
+	{"(^= [a] 'a' 'b' 'c' 'd')", 0, corpus_323, corpus_323_dict},
+	{"(*= [s] 'a' 'b' 'c' 5)", 0, corpus_324, corpus_324_dict},
+	{"(*= [s] 'a' 'b' 'c' [t])", 0, corpus_325, corpus_325_dict},
+	{"(*= [s] 'x' [t])", 0, corpus_326, corpus_326_dict},
+	{"($= (! TRUE) 'a')", 0, corpus_327, corpus_327_dict},
+	{"(& (*= [s] 'a' 'b' 'c' 'd') (^= [s] 'xa' 'xb' 'xc' 'xd'))", 0, corpus_328, corpus_328_dict},
+	{"(| (*= [s] 'x' 'y') ($= [s] 'a' 'b' 'c' 'd'))", 0, corpus_329, corpus_329_dict},
+	{NULL, 0, NULL, NULL}
+};
@@ -3,18 +3,137 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#ifdef PBG_THREADS
+#include <pthread.h>
+#endif
+
+#ifdef PBG_COMPILED
+/* Expressions tested by the corpus build, compiled by pbg_compile. */
+#include "compiled.c"
+#endif
 
 /* Test suites in this file. */
 pbg_field dict(char* key, int n);
 int suite_evaluate(void);
 int suite_gettype(void);
+int suite_evaluate_vars(void);
+int suite_evaluate_lazy(void);
+int suite_multiget(void);
+int suite_eval(void);
+int suite_ruleset(void);
+int suite_budget(void);
+int suite_csv(void);
+int suite_arrow(void);
+int suite_incr(void);
+int suite_parser(void);
+int suite_deep(void);
+int suite_error(void);
+int suite_specialize(void);
+int suite_fuse(void);
+int suite_bits(void);
+int suite_canonical(void);
+int suite_zone(void);
+int suite_partial(void);
+int suite_bdd(void);
+int suite_match(void);
+int suite_number(void);
+pbg_field_type schema(char* key, int n);
+pbg_field resolve(void* ctx, int var);
+void multiget(void* ctx, char** names, int* lens, int numnames, 
+		long numrecords, pbg_field* vars);
+void bind_vars(pbg_expr* e, pbg_field* vars, pbg_lt_number* numbers, 
+		pbg_lt_date* dates);
+int zone_less(pbg_field* a, pbg_field* b);
+pbg_field partial_dict(char* key, int n);
+void partial_vars(pbg_expr* e, pbg_field* vars, pbg_lt_number* numbers, 
+		int round);
+#ifdef PBG_PROFILE
+int suite_profile(void);
+#endif
+#ifdef PBG_THREADS
+int suite_parallel(void);
+int suite_reload(void);
+long reload_publish(pbg_reload* r, pbg_error* err, long n);
+void* reload_reader(void* arg);
+pbg_field resolve_record(void* ctx, int thread, long record, int var);
+pbg_field resolve_single(void* ctx, int var);
+void emit_record(void* ctx, int thread, long record, int result);
+#endif
+#ifdef PBG_CORPUS
+/* Expressions compiled by test_compile, in the order they were tested. */
+#define PBG_CORPUS_MAX 1024
+struct {
+	char*  _str;
+	int    _specialized;
+} corpus[PBG_CORPUS_MAX];
+int numcorpus = 0;
+#endif
 
+#ifdef PBG_CORPUS
+/* Print the source of every expression tested through test_compile, and a 
+ * table of them, as test/compiled.c. */
+int main(void)
+{
+	char* str;
+	int i;
+	printf("/* Generated by test/corpus, see test_compile. */\n");
+	suite_evaluate();
+	suite_evaluate_vars();
+	suite_specialize();
+	suite_fuse();
+	suite_match();
+	printf("\nstruct {\n\tchar* _str;\n\tint _specialized;\n"
+			"\tint (*_vars)(pbg_field*, pbg_error*);\n"
+			"\tint (*_dict)(pbg_field (*)(char*, int), pbg_error*);\n"
+			"} compiled[] = {\n");
+	for(i = 0; i < numcorpus; i++) {
+		printf("\t{\"");
+		for(str = corpus[i]._str; *str != '\0'; str++)
+			if(*str < ' ' || *str > '~' || strchr("\"\\?", *str) != NULL)
+				printf("\\%03o", (unsigned char) *str);
+			else
+				putchar(*str);
+		printf("\", %d, corpus_%d, corpus_%d_dict},\n", corpus[i]._specialized, i, i);
+	}
+	printf("\t{NULL, 0, NULL, NULL}\n};\n");
+	return 0;
+}
+#else
 /* Run and summarize test suites. */
 int main(void)
 {
 	summ_test("pbg_evaluate", suite_evaluate());
+	summ_test("pbg_evaluate_vars", suite_evaluate_vars());
+	summ_test("pbg_evaluate_lazy", suite_evaluate_lazy());
+	summ_test("pbg_evaluate_multiget", suite_multiget());
+	summ_test("pbg_eval_step", suite_eval());
+	summ_test("pbg_ruleset_evaluate", suite_ruleset());
+	summ_test("pbg_evaluate_budget", suite_budget());
+	summ_test("pbg_csv", suite_csv());
+	summ_test("pbg_arrow", suite_arrow());
+	summ_test("pbg_incr", suite_incr());
+	summ_test("pbg_parser", suite_parser());
+	summ_test("deep expressions", suite_deep());
+	summ_test("pbg_error_format", suite_error());
+	summ_test("pbg_specialize", suite_specialize());
+	summ_test("fused comparisons", suite_fuse());
+	summ_test("pbg_bits", suite_bits());
+	summ_test("pbg_canonicalize", suite_canonical());
+	summ_test("pbg_evaluate_zone", suite_zone());
+	summ_test("pbg_partial_evaluate", suite_partial());
+	summ_test("pbg_bdd_evaluate", suite_bdd());
+	summ_test("string matching", suite_match());
+	summ_test("pbg_read_number", suite_number());
+#ifdef PBG_PROFILE
+	summ_test("pbg_expr_stats", suite_profile());
+#endif
+#ifdef PBG_THREADS
+	summ_test("pbg_evaluate_parallel", suite_parallel());
+	summ_test("pbg_reload_publish", suite_reload());
+#endif
 	return 0;
 }
+#endif
 
 
 /***************
@@ -183,6 +302,8 @@ int suite_evaluate()
 	check(test_evaluate(&err, "(< 'a' 'b')", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(< 'b' 'a')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(< 'aaa' 'aab')", dict, PBG_TRUE));
+	check(test_evaluate(&err, "(< 'ab' 'ab!')", dict, PBG_TRUE));
+	check(test_evaluate(&err, "(< 'ab!' 'ab')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(< 2018-10-12 2018-10-12)", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(< 2018-10-11 2018-10-12)", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(< 2018-10-12 2018-10-11)", dict, PBG_FALSE));
@@ -203,6 +324,7 @@ int suite_evaluate()
 	check(test_evaluate(&err, "(> 'a' 'b')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(> 'b' 'a')", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(> 'aaa' 'aab')", dict, PBG_FALSE));
+	check(test_evaluate(&err, "(> 'ab!' 'ab')", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(> 2018-10-12 2018-10-12)", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(> 2018-10-11 2018-10-12)", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(> 2018-10-12 2018-10-11)", dict, PBG_TRUE));
@@ -223,6 +345,7 @@ int suite_evaluate()
 	check(test_evaluate(&err, "(<= 'a' 'b')", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(<= 'b' 'a')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(<= 'aaa' 'aab')", dict, PBG_TRUE));
+	check(test_evaluate(&err, "(<= 'ab!' 'ab')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(<= 2018-10-12 2018-10-12)", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(<= 2018-10-11 2018-10-12)", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(<= 2018-10-12 2018-10-11)", dict, PBG_FALSE));
@@ -243,6 +366,7 @@ int suite_evaluate()
 	check(test_evaluate(&err, "(>= 'a' 'b')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(>= 'b' 'a')", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(>= 'aaa' 'aab')", dict, PBG_FALSE));
+	check(test_evaluate(&err, "(>= 'ab' 'ab!')", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(>= 2018-10-12 2018-10-12)", dict, PBG_TRUE));
 	check(test_evaluate(&err, "(>= 2018-10-11 2018-10-12)", dict, PBG_FALSE));
 	check(test_evaluate(&err, "(>= 2018-10-12 2018-10-11)", dict, PBG_TRUE));
@@ -335,6 +459,1065 @@ int suite_evaluate()
 }
 
 
+/* Tests for pbg_evaluate_vars and variable introspection. */
+int suite_evaluate_vars()
+{
+	init_test();
+	
+	check(test_numvars(&err, "TRUE", 0));
+	check(test_numvars(&err, "(= [a] [b])", 2));
+	check(test_numvars(&err, "(& (= [a] [a]) (< [a] [b]) (? [b]))", 2));
+	check(test_numvars(&err, "(& (= [ab] [a]) (= [a] [abc]))", 3));
+	check(test_evaluate_vars(&err, "(= [a] [b])", PBG_TRUE));
+	check(test_evaluate_vars(&err, "(< [a] [c])", PBG_TRUE));
+	check(test_evaluate_vars(&err, "(= [a] [a] [b] [c])", PBG_FALSE));
+	check(test_evaluate_vars(&err, "(& (= [s] 'hi') (= [d] 2018-10-12))", PBG_TRUE));
+	check(test_evaluate_vars(&err, "(& (< [s] 'hj') (> [d] 2018-10-11))", PBG_TRUE));
+	check(test_evaluate_vars(&err, "(& (@ STRING [s]) (@ DATE [d]) (! [t]))", PBG_FALSE));
+	check(test_evaluate_vars(&err, "(? [a] [x])", PBG_FALSE));
+	check(test_evaluate_vars(&err, "(< [x] 1)", PBG_ERROR));
+	
+	end_test();
+}
+
+/* This is a resolver used for testing pbg_evaluate_lazy. It resolves every
+ * variable to the NUMBER 5 and counts how often it is called. */
+pbg_field resolve(void* ctx, int var)
+{
+	static pbg_lt_number five;
+	PBG_UNUSED(var);
+	(*(int*)ctx)++;
+	return pbg_init_number(&five, 5.0);
+}
+
+/* Tests for pbg_evaluate_lazy. */
+int suite_evaluate_lazy()
+{
+	init_test();
+	
+	check(test_evaluate_lazy(&err, "TRUE", PBG_TRUE, 0));
+	check(test_evaluate_lazy(&err, "(= [a] 5)", PBG_TRUE, 1));
+	check(test_evaluate_lazy(&err, "(= [a] [a] [a])", PBG_TRUE, 1));
+	check(test_evaluate_lazy(&err, "(& (= [a] 5) (= [b] 5))", PBG_TRUE, 2));
+	check(test_evaluate_lazy(&err, "(| (= [a] 5) (= [b] 5))", PBG_TRUE, 1));
+	check(test_evaluate_lazy(&err, "(& (= [a] 4) (= [b] 5) (= [c] 5))", PBG_FALSE, 1));
+	check(test_evaluate_lazy(&err, "(| (< [a] 4) (= [b] 5) (= [c] 5))", PBG_TRUE, 2));
+	check(test_evaluate_lazy(&err, "(@ NUMBER [a] [b] [c])", PBG_TRUE, 3));
+	check(test_evaluate_lazy(&err, "(| TRUE (! [a]))", PBG_TRUE, 0));
+	check(test_evaluate_lazy(&err, "(! [a])", PBG_ERROR, 1));
+	
+	end_test();
+}
+
+/* Resolves the variables of a batch for pbg_evaluate_multiget, counting the
+ * calls in ctx. Record r has [a]=r, [b]=5, and [s]='hi'; everything else is
+ * NULL. Repeated names are counted as failed calls. */
+void multiget(void* ctx, char** names, int* lens, int numnames, 
+		long numrecords, pbg_field* vars)
+{
+	static pbg_lt_number numbers[64], five;
+	int i, j;
+	long r;
+	(*(int*)ctx)++;
+	for(i = 0; i < numnames; i++)
+		for(j = 0; j < i; j++)
+			if(lens[i] == lens[j] && strcmp(names[i], names[j]) == 0)
+				(*(int*)ctx) += 1000;
+	for(r = 0; r < numrecords; r++)
+		for(i = 0; i < numnames; i++) {
+			if(strcmp(names[i], "a") == 0 && r < 64)
+				vars[r*numnames + i] = pbg_init_number(numbers+r, (double) r);
+			else if(strcmp(names[i], "b") == 0)
+				vars[r*numnames + i] = pbg_init_number(&five, 5.0);
+			else if(strcmp(names[i], "s") == 0)
+				vars[r*numnames + i] = pbg_init_string("hi", 2);
+			else
+				vars[r*numnames + i] = pbg_make_null();
+		}
+}
+
+/* Tests for pbg_evaluate_multiget. */
+int suite_multiget()
+{
+	init_test();
+	
+	check(test_multiget(&err, "TRUE", 3, 3, 0, 0));
+	check(test_multiget(&err, "(< [a] [b])", 0, 0, 0, 0));
+	check(test_multiget(&err, "(< [a] [b])", 1, 1, 0, 1));
+	check(test_multiget(&err, "(< [a] [b])", 10, 5, 0, 1));
+	check(test_multiget(&err, "(& (< [a] [b]) (> [a] 2) (= [b] 5))", 10, 2, 0, 1));
+	check(test_multiget(&err, "(| (= [s] 'hi') (= [a] [x] [y]))", 4, 4, 0, 1));
+	check(test_multiget(&err, "(< [a] [x])", 4, 0, 4, 1));
+	check(test_multiget(&err, "(| (= [a] 1) (< [a] [x]))", 4, 1, 3, 1));
+	check(test_multiget(&err, "(& (? [x]) (< [a] [x]))", 4, 0, 0, 1));
+	
+	end_test();
+}
+
+/* Tests for pbg_eval_begin, pbg_eval_step, and pbg_eval_resume. */
+int suite_eval()
+{
+	init_test();
+	
+	/* Variables are asked for as the evaluation reaches them... */
+	check(test_eval(&err, "TRUE", 0, "", PBG_TRUE));
+	check(test_eval(&err, "(= [a] 5)", 0, "a", PBG_TRUE));
+	check(test_eval(&err, "(= [a] [a] [b])", 0, "ab", PBG_TRUE));
+	check(test_eval(&err, "(& (= [a] 5) (< [b] [c]) (@ STRING [s]))", 0, "abcs", PBG_TRUE));
+	check(test_eval(&err, "(! (& [t] (= [d] 2018-10-12)))", 0, "td", PBG_FALSE));
+	check(test_eval(&err, "(= (< [a] [c]) [t])", 0, "tac", PBG_TRUE));
+	check(test_eval(&err, "(!= [t] (> [a] [c]))", 0, "tac", PBG_TRUE));
+	check(test_eval(&err, "(< [a] 6)", 0, "a", PBG_TRUE));
+	check(test_eval(&err, "(*= [s] 'a' 'b' 'c' 'h')", 0, "s", PBG_TRUE));
+	/* ...and only if the result depends on them. */
+	check(test_eval(&err, "(| (= [a] 5) (= [b] 5))", 0, "a", PBG_TRUE));
+	check(test_eval(&err, "(& (> [a] [c]) (= [b] 5))", 0, "ac", PBG_FALSE));
+	check(test_eval(&err, "(| (? [x]) (? [y]) (= [b] 5))", 0, "xyb", PBG_TRUE));
+	check(test_eval(&err, "(& (? [x]) (< [x] [y]))", 0, "x", PBG_FALSE));
+	/* Errors are those of the evaluation. */
+	check(test_eval(&err, "(< [a] [x])", 0, "ax", PBG_ERROR));
+	check(test_eval(&err, "(& [t] [a])", 0, "ta", PBG_ERROR));
+	check(test_eval(&err, "(| [x] (= [b] 5))", 0, "x", PBG_ERROR));
+	/* Specialized and fused comparisons need their variables too. */
+	check(test_eval(&err, "(& (< [a] [c]) (= [s] 'hi'))", 1, "acs", PBG_TRUE));
+	check(test_eval(&err, "(| (> [a] 6) (= [d] 2018-10-12))", 1, "ad", PBG_TRUE));
+	check(test_eval(&err, "(| (> [a] 6) (= [d] 2018-10-12))", 0, "ad", PBG_TRUE));
+	/* Deep expressions grow their frames. */
+	check(test_eval(&err, "(! (! (! (! (! (! (! (! (! (! (! (! (! (! (! (! (! (! (! (! [t]))))))))))))))))))))", 0, "t", PBG_TRUE));
+	
+	/* Evaluations may be interleaved. */
+	check(test_eval_many(&err, "(& (= [a] 5) (< [b] [c]) (@ STRING [s]))", 100));
+	check(test_eval_many(&err, "(| (< [c] [a]) (= [x] [y]) [t])", 100));
+	check(test_eval_many(&err, "(< [a] [x])", 10));
+	
+	end_test();
+}
+
+/* Tests for pbg_ruleset_evaluate. */
+int suite_ruleset()
+{
+	int rising[] = {1, 2, 3, 4}, falling[] = {4, 3, 2, 1}, tied[] = {1, 2, 2, 1};
+	init_test();
+	
+	/* The first TRUE rule by priority matches... */
+	check(test_ruleset(&err, "(= [a] 5); (= [b] 5); TRUE", NULL, 0, 0, 2, 0));
+	check(test_ruleset(&err, "(= [a] 6); (= [b] 5); TRUE", NULL, 0, 1, 2, 0));
+	check(test_ruleset(&err, "(= [a] 6); (= [b] 6); FALSE", NULL, 0, -1, 2, 0));
+	check(test_ruleset(&err, "(= [a] 5); (= [b] 5); TRUE; (= [t] TRUE)", rising, 0, 3, 3, 0));
+	check(test_ruleset(&err, "(= [a] 5); (= [b] 5); TRUE; (= [t] TRUE)", falling, 0, 0, 3, 0));
+	check(test_ruleset(&err, "(= [a] 6); (= [b] 5); TRUE; (= [t] TRUE)", tied, 0, 1, 3, 0));
+	/* ...and failing rules do not. */
+	check(test_ruleset(&err, "(< [a] [x]); (= [c] 6)", NULL, 0, 1, 0, 1));
+	check(test_ruleset(&err, "(< [a] [x]); (= [c] 7)", NULL, 0, -1, 1, 1));
+	/* Rules keyed on a value the record lacks are skipped. */
+	check(test_ruleset(&err, "(= [a] 1); (= [a] 2); (= [a] 5); (= [a] 4)", NULL, 0, 2, 3, 0));
+	check(test_ruleset(&err, "(= [s] 'a'); (& (= [s] 'hi') (= [c] 7)); (= 'hi' [s])", NULL, 0, 2, 1, 0));
+	check(test_ruleset(&err, "(& (< [a] [c]) (= [d] 2018-10-11)); (= [d] 2018-10-12)", NULL, 0, 1, 1, 0));
+	check(test_ruleset(&err, "(= [x] 1); (= [y] 1); (= [t] TRUE); (= [a] 1)", NULL, 0, 2, 3, 0));
+	check(test_ruleset(&err, "(= [a] 5); (| (= [a] 1) (= [a] 5)); (! (= [a] 5))", rising, 0, 1, 1, 0));
+	check(test_ruleset(&err, "(= [a] 1); (= [a] 2); (= [a] 3)", NULL, 0, -1, 3, 0));
+	check(test_ruleset(&err, "(= [a] 1); (= [a] 2); (= [s] 'a'); (= [a] 5)", NULL, 1, 3, 3, 0));
+	check(test_ruleset(&err, "(& (= [s] 'a') (< [a] 6)); (& (< [a] 6) (= [s] 'hi'))", NULL, 1, 1, 1, 0));
+	check(test_ruleset(&err, "(& [t] (= [a] 6)); (& [t] (= [a] 5))", NULL, 0, 1, 1, 0));
+	check(test_ruleset(&err, "(& [t] (= [a] 6)); (& [t] (= [a] 5))", NULL, 1, 1, 1, 0));
+	
+	/* Many rules are indexed by one variable. */
+	check(test_ruleset_many(&err, 1, 0));
+	check(test_ruleset_many(&err, 100, 37));
+	check(test_ruleset_many(&err, 1000, 999));
+	check(test_ruleset_many(&err, 1000, 1000));
+	
+	end_test();
+}
+
+/* Tests for pbg_evaluate_budget and pbg_cost. */
+int suite_budget()
+{
+	init_test();
+	
+	/* Each operator and each BOOL argument is a field to begin... */
+	check(test_budget(&err, "(& (= [a] 5) (< [b] [c]))", 3, 0, PBG_TRUE, 0));
+	check(test_budget(&err, "(& (= [a] 5) (< [b] [c]))", 2, 0, PBG_ERROR, 1));
+	check(test_budget(&err, "(& (= [a] 5) (< [b] [c]))", 0, 0, PBG_ERROR, 1));
+	check(test_budget(&err, "(& [t] (! [t]))", 4, 0, PBG_FALSE, 0));
+	check(test_budget(&err, "(& [t] (! [t]))", 3, 0, PBG_ERROR, 1));
+	check(test_budget(&err, "(= (< [a] [c]) [t])", 3, 0, PBG_TRUE, 0));
+	check(test_budget(&err, "(= (< [a] [c]) [t])", 2, 0, PBG_ERROR, 1));
+	check(test_budget(&err, "TRUE", 1, 0, PBG_TRUE, 0));
+	/* ...so short-circuiting saves budget. */
+	check(test_budget(&err, "(| (= [a] 5) (< [b] [c]))", 2, 0, PBG_TRUE, 0));
+	check(test_budget(&err, "(& (> [a] 5) (< [b] [c]))", 2, 0, PBG_FALSE, 0));
+	/* Errors are those of the evaluation while the budget lasts. */
+	check(test_budget(&err, "(& (< [a] [x]) TRUE)", 2, 0, PBG_ERROR, 0));
+	check(test_budget(&err, "(& (< [a] [x]) TRUE)", -1, 1000000000L, PBG_ERROR, 0));
+	check(test_budget(&err, "(| (= [a] 6) (< [b] [c]))", -1, 1000000000L, PBG_TRUE, 0));
+	/* Time is checked every few hundred fields. */
+	check(test_budget_deep(&err, 100000, -1, 1, 1));
+	check(test_budget_deep(&err, 100000, -1, 0, 0));
+	check(test_budget_deep(&err, 100000, 100000, 0, 1));
+	check(test_budget_deep(&err, 100000, 100001, 0, 0));
+	
+	/* Costs bound every evaluation. */
+	check(test_cost(&err, "TRUE", 1));
+	check(test_cost(&err, "(= [a] 5)", 1));
+	check(test_cost(&err, "(< [a] [b])", 3));
+	check(test_cost(&err, "(< 5 [b])", 1));
+	check(test_cost(&err, "(& [t] (! [t]))", 4));
+	check(test_cost(&err, "(| (& (= [a] 1) (= [b] 2)) (& (= [a] 3) (? [c])))", 7));
+	check(test_cost(&err, "(= (< [a] [c]) [t] (! FALSE))", 7));
+	check(test_cost(&err, "(*= [s] 'a' 'b')", 1));
+	
+	end_test();
+}
+
+/* Binds [a]=5, [b]=5, [c]=6, [s]='hi', [d]=2018-10-12, and [t]=TRUE without
+ * allocating, as for test_evaluate_vars. Everything else is NULL. */
+void bind_vars(pbg_expr* e, pbg_field* vars, pbg_lt_number* numbers, 
+		pbg_lt_date* dates)
+{
+	char* name;
+	int i;
+	for(i = 0; i < pbg_numvars(e) && i < 8; i++) {
+		name = pbg_var_name(e, i, NULL);
+		if(strcmp(name, "a") == 0 || strcmp(name, "b") == 0)
+			vars[i] = pbg_init_number(numbers+i, 5.0);
+		else if(strcmp(name, "c") == 0)
+			vars[i] = pbg_init_number(numbers+i, 6.0);
+		else if(strcmp(name, "s") == 0)
+			vars[i] = pbg_init_string("hi", 2);
+		else if(strcmp(name, "d") == 0)
+			vars[i] = pbg_init_date(dates+i, 2018, 10, 12);
+		else if(strcmp(name, "t") == 0)
+			vars[i] = pbg_make_bool(1);
+		else
+			vars[i] = pbg_make_null();
+	}
+}
+
+/* Tests for pbg_csv_bind and pbg_csv_evaluate. */
+int suite_csv()
+{
+	init_test();
+	
+	/* Types are inferred from the literal each field spells. */
+	check(test_csv(&err, "a,b,c", "5,hi,2018-10-12", "(& (= [a] 5) (= [b] 'hi') (= [c] 2018-10-12))", PBG_TRUE));
+	check(test_csv(&err, "a,b,c", "5,hi,2018-10-12", "(@ STRING [b] [a])", PBG_FALSE));
+	check(test_csv(&err, "a,b", "TRUE,FALSE", "(& [a] (! [b]))", PBG_TRUE));
+	check(test_csv(&err, "a,b", "-3.5e2,007", "(& (< [a] -300) (@ STRING [b]))", PBG_TRUE));
+	/* Empty and missing fields as well as unknown columns are NULL. */
+	check(test_csv(&err, "a,b,c", "1,,3", "(? [b])", PBG_FALSE));
+	check(test_csv(&err, "a,b,c", "1,2", "(& (? [a] [b]) (! (? [c])))", PBG_TRUE));
+	check(test_csv(&err, "a,b,c", "1,2,3", "(? [d])", PBG_FALSE));
+	check(test_csv(&err, "a,b,c", "1,,3", "(< [b] 2)", PBG_ERROR));
+	/* Quoted fields. */
+	check(test_csv(&err, "\"a\",\"b,c\"", "\"x,y\",2", "(& (= [a] 'x,y') (= [b,c] 2))", PBG_TRUE));
+	check(test_csv(&err, "a,b", "\"say \"\"hi\"\"\",\"4\"", "(& (= [a] 'say \"hi\"') (= [b] 4))", PBG_TRUE));
+	check(test_csv(&err, "a,b", "\"\",\"\"", "(? [a] [b])", PBG_FALSE));
+	/* Columns are bound by name, whatever their order. */
+	check(test_csv(&err, "z,y,x,a", "1,2,3,4", "(& (= [a] 4) (= [x] 3) (= [z] 1))", PBG_TRUE));
+	check(test_csv(&err, "a;b", "1;2", "(< [a] [b])", PBG_TRUE));
+	/* Fields are ordered by their own length, not the record's. */
+	check(test_csv(&err, "c,b", "ab,ab!", "(< [c] [b])", PBG_TRUE));
+	check(test_csv(&err, "c,b", "ab,ab!", "(< [b] [c])", PBG_FALSE));
+	check(test_csv(&err, "c,b", "ab!,ab", "(> [c] [b])", PBG_TRUE));
+	
+	end_test();
+}
+
+/* Tests for pbg_arrow_bind and pbg_arrow_evaluate. The batch has columns 
+ * [n] float64, [i] int64, [d] date32, [s] utf8, [t] bool, [x] binary, and
+ * [u] utf8, [s] and [u] sharing their data, and its last row is null:
+ *   [n]  1.5   NULL        -2    10          3
+ *   [i]  5     6           NULL  -7          3
+ *   [d]  17816 0           NULL  -1          3
+ *   [s]  'hi'  ''          NULL  'yo'        'z'
+ *   [t]  TRUE  FALSE       NULL  TRUE        TRUE
+ *   [u]  'h'   'i'         ''    'yo'        'z' */
+int suite_arrow()
+{
+	init_test();
+	
+	/* Each column is read as its type, and unset entries as NULL. */
+	check(test_arrow(&err, "(? [n])", 0, "TFTTF"));
+	check(test_arrow(&err, "(< [n] 2)", 0, "T.TF."));
+	check(test_arrow(&err, "(< [i] 6)", 0, "TF.T."));
+	check(test_arrow(&err, "(= [d] 2018-10-12)", 0, "TF.F."));
+	check(test_arrow(&err, "(< [d] 1970-01-01)", 0, "FF.T."));
+	check(test_arrow(&err, "(& (@ STRING [s]) (= [s] 'hi'))", 0, "TFFFF"));
+	check(test_arrow(&err, "(@ BOOL [t])", 0, "TTFTF"));
+	check(test_arrow(&err, "(& (@ NUMBER [n] [i]) (@ DATE [d]))", 0, "TFFTF"));
+	/* STRINGs end where their offsets say, whatever follows them. */
+	check(test_arrow(&err, "(<= [s] [u])", 0, "FT.T."));
+	check(test_arrow(&err, "(< [u] [s])", 0, "TF.F."));
+	/* Variables the schema does not name are NULL. */
+	check(test_arrow(&err, "(? [q])", 0, "FFFFF"));
+	/* Batches may be slices of their columns. */
+	check(test_arrow(&err, "(? [n])", 2, "TTF"));
+	check(test_arrow(&err, "(< [n] 2)", 3, "F."));
+	check(test_arrow(&err, "(? [n])", 5, ""));
+	/* Columns of other formats cannot be bound. */
+	check(test_arrow(&err, "(? [x])", 0, NULL));
+	
+	end_test();
+}
+
+/* Tests for pbg_incr_evaluate. Every variable starts out as 5. */
+int suite_incr()
+{
+	init_test();
+	
+	/* Only the paths from the updated variable to the root are evaluated. */
+	check(test_incr(&err, "(& (< [a] 6) (< [b] 6) (< [c] 6))", "c", 7, PBG_FALSE, 2));
+	check(test_incr(&err, "(& (< [a] 6) (< [b] 6) (< [c] 6))", "a", 7, PBG_FALSE, 2));
+	check(test_incr(&err, "(& (< [a] 6) (< [b] 6) (< [c] 6))", "b", 5, PBG_TRUE, 2));
+	check(test_incr(&err, "(! (= [a] [b]))", "b", 4, PBG_TRUE, 2));
+	/* Operators skipped by short-circuiting stay stale until needed. */
+	check(test_incr(&err, "(| (& (= [a] 5) (= [b] 5)) (& (= [c] 1) (= [d] 1)))", "d", 1, PBG_TRUE, 0));
+	check(test_incr(&err, "(| (& (= [a] 5) (= [b] 5)) (& (= [c] 1) (= [d] 1)))", "b", 1, PBG_FALSE, 5));
+	/* Errors are cached along with results. */
+	check(test_incr(&err, "(| (< [a] 6) (< [b] 'x'))", "a", 7, PBG_ERROR, 3));
+	check(test_incr(&err, "(& (< [b] 'x') (< [a] 6))", "a", 7, PBG_ERROR, 0));
+	/* Unreferenced variables change nothing. */
+	check(test_incr(&err, "(& (< [a] 6) (? [b]))", "z", 7, PBG_TRUE, 0));
+	
+	end_test();
+}
+
+/* Tests for the streaming parser. Each expression is fed in chunks of the 
+ * given size, so tokens are split across chunks. */
+int suite_parser()
+{
+	init_test();
+	
+	check(test_parser(&err, "TRUE", 1, PBG_TRUE));
+	check(test_parser(&err, "  FALSE  ", 2, PBG_FALSE));
+	check(test_parser(&err, "(& (= [a] [b]) (< [b] [c]))", 1, PBG_TRUE));
+	check(test_parser(&err, "(& (= [a] [b]) (< [b] [c]))", 3, PBG_TRUE));
+	check(test_parser(&err, "(&(=[a][b])(<[b][c])(! (? [d])))", 5, PBG_TRUE));
+	check(test_parser(&err, "(| (= 'a b' 'a c') (> 2018-10-13 2018-10-12))", 1, PBG_TRUE));
+	check(test_parser(&err, "(= 'it\\'s' 'it\\'s')", 2, PBG_TRUE));
+	check(test_parser(&err, "(@ NUMBER [a] [c] 12.5e3)", 4, PBG_TRUE));
+	check(test_parser(&err, "(! (! (! (! (! (! (< -1.5 [a])))))))", 1, PBG_TRUE));
+	/* Malformed input is reported by pbg_parser_finish. */
+	check(test_parser(&err, "(& TRUE", 1, PBG_ERROR));
+	check(test_parser(&err, "(& TRUE))", 1, PBG_ERROR));
+	check(test_parser(&err, "(& TRUE) (| TRUE)", 4, PBG_ERROR));
+	check(test_parser(&err, "TRUE FALSE", 1, PBG_ERROR));
+	check(test_parser(&err, "(= 'abc [a])", 1, PBG_ERROR));
+	check(test_parser(&err, "(? [a)", 1, PBG_ERROR));
+	check(test_parser(&err, "(TRUE)", 1, PBG_ERROR));
+	check(test_parser(&err, "(& TRUE &)", 1, PBG_ERROR));
+	check(test_parser(&err, "(! TRUE FALSE)", 3, PBG_ERROR));
+	check(test_parser(&err, "(& TRUE TRU)", 3, PBG_ERROR));
+	check(test_parser(&err, "", 1, PBG_ERROR));
+	check(test_parser(&err, "()", 1, PBG_ERROR));
+	
+	end_test();
+}
+
+/* Tests for expressions too deep for recursion and with many variables. */
+int suite_deep()
+{
+	init_test();
+	
+	check(test_deep(&err, "(! ", "TRUE", ")", 200000, PBG_TRUE));
+	check(test_deep(&err, "(! ", "TRUE", ")", 200001, PBG_FALSE));
+	check(test_deep(&err, "(| FALSE ", "(< [a] 6)", ")", 200000, PBG_TRUE));
+	check(test_deep(&err, "(& (< [a] 6) ", "(= [c] 5)", ")", 200000, PBG_FALSE));
+	check(test_deep(&err, "(= (< [b] 6) ", "TRUE", ")", 100000, PBG_TRUE));
+	check(test_deep(&err, "(& TRUE ", "(< [a] 'x')", ")", 100000, PBG_ERROR));
+	check(test_wide(&err, 100000));
+	
+	end_test();
+}
+
+/* Tests for pbg_error_format. */
+int suite_error()
+{
+	init_test();
+	
+	check(test_error(&err, "(& TRUE", ": Too few closing parentheses. -> (& TRUE"));
+	check(test_error(&err, "(& TRUE) FALSE", ": Too many fields yield multiple expressions. -> FALSE"));
+	check(test_error(&err, "(! TRUE FALSE)", ": operator PBG_OP_NOT cannot take 2 arguments!"));
+	check(test_error(&err, "(& TRUE TRU)", ": failed to recognize TRU (3 bytes)"));
+	check(test_error(&err, "(< [x] 1)", ": NULL input given to comparison operator."));
+	check(test_error(&err, "(= [x] 1)", ": NULL input given to EQ operator."));
+	/* Only the start of the remaining input is shown. */
+	check(test_error(&err, "(& TRUE) (| TRUE FALSE FALSE FALSE FALSE FALSE)", 
+			"-> ) (| TRUE FALSE FALSE FALSE FALS"));
+	
+	end_test();
+}
+
+/* This is a schema used for testing purposes. It declares [a], [b], and [c]
+ * as NUMBERs like dict, and [d] as a DATE and [s] as a STRING, though dict
+ * does not define them. */
+pbg_field_type schema(char* key, int n)
+{
+	PBG_UNUSED(n);
+	if(key[0] == 'a' || key[0] == 'b' || key[0] == 'c')
+		return PBG_LT_NUMBER;
+	if(key[0] == 'd')
+		return PBG_LT_DATE;
+	if(key[0] == 's')
+		return PBG_LT_STRING;
+	return PBG_NULL;
+}
+
+/* Tests for pbg_specialize. */
+int suite_specialize()
+{
+	init_test();
+	
+	/* Comparisons of declared types are lowered. */
+	check(test_specialize(&err, "(< [a] [c])", 1, PBG_TRUE, PBG_FALSE));
+	check(test_specialize(&err, "(& (< [a] [c]) (>= [c] [b]))", 2, PBG_TRUE, PBG_FALSE));
+	check(test_specialize(&err, "(& (= [a] [b]) (!= [c] [b]))", 2, PBG_TRUE, PBG_FALSE));
+	check(test_specialize(&err, "(<= 'abc' 'abd')", 1, PBG_TRUE, PBG_TRUE));
+	check(test_specialize(&err, "(> 2018-10-13 2018-10-12)", 1, PBG_TRUE, PBG_TRUE));
+	check(test_specialize(&err, "(= [a] [b] [c])", 0, PBG_FALSE, PBG_TRUE));
+	check(test_specialize(&err, "(= (< [a] [c]) TRUE)", 1, PBG_TRUE, PBG_FALSE));
+	/* Comparisons to constants are already fused, and only checked. */
+	check(test_specialize(&err, "(< [a] 6)", 0, PBG_TRUE, PBG_TRUE));
+	check(test_specialize(&err, "(& (= [a] [b]) (!= [a] 5))", 1, PBG_FALSE, PBG_FALSE));
+	/* Checks of declared types are folded. */
+	check(test_specialize(&err, "(@ NUMBER [a] [b] 12)", 1, PBG_TRUE, PBG_TRUE));
+	check(test_specialize(&err, "(@ DATE [a] [x])", 1, PBG_FALSE, PBG_FALSE));
+	check(test_specialize(&err, "(@ NUMBER [a] [x])", 0, PBG_FALSE, PBG_TRUE));
+	check(test_specialize(&err, "(? [a] [c] (! FALSE))", 1, PBG_TRUE, PBG_TRUE));
+	check(test_specialize(&err, "(? [a] [x])", 0, PBG_FALSE, PBG_TRUE));
+	check(test_specialize(&err, "(| (= [a] 'five') (!= [b] 2018-01-01))", 2, PBG_TRUE, PBG_TRUE));
+	/* Type errors are caught when specializing. */
+	check(test_specialize(&err, "(< [a] 'x')", -1, PBG_ERROR, PBG_ERROR));
+	check(test_specialize(&err, "(| TRUE (>= [d] [c]))", -1, PBG_ERROR, PBG_ERROR));
+	check(test_specialize(&err, "(< NUMBER 5)", -1, PBG_ERROR, PBG_ERROR));
+	/* Undeclared variables behave as before. */
+	check(test_specialize(&err, "(< [x] 6)", 0, PBG_ERROR, PBG_TRUE));
+	/* Values violating the schema are errors. */
+	check(test_specialize(&err, "(| TRUE (< [d] 2018-10-13))", 0, PBG_ERROR, PBG_TRUE));
+	check(test_specialize(&err, "(| FALSE (= [s] 'abc'))", 0, PBG_ERROR, PBG_ERROR));
+	check(test_specialize(&err, "(| FALSE (= [s] [s]))", 1, PBG_ERROR, PBG_ERROR));
+	
+	end_test();
+}
+
+/* Tests for comparisons of variables to constants, which are fused when 
+ * parsed. Variables are bound as by test_evaluate_vars. */
+int suite_fuse()
+{
+	init_test();
+	
+	check(test_fuse(&err, "(< [a] 6)", 1, PBG_TRUE));
+	check(test_fuse(&err, "(< 6 [a])", 1, PBG_FALSE));
+	check(test_fuse(&err, "(>= [c] 6)", 1, PBG_TRUE));
+	check(test_fuse(&err, "(<= 7 [c])", 1, PBG_FALSE));
+	check(test_fuse(&err, "(= [a] 5)", 1, PBG_TRUE));
+	check(test_fuse(&err, "(= 5 [a])", 1, PBG_TRUE));
+	check(test_fuse(&err, "(!= [a] 5)", 1, PBG_FALSE));
+	check(test_fuse(&err, "(= [s] 'hi')", 1, PBG_TRUE));
+	check(test_fuse(&err, "(!= 'hi' [s])", 1, PBG_FALSE));
+	check(test_fuse(&err, "(< [s] 'hello')", 1, PBG_FALSE));
+	check(test_fuse(&err, "(> 'hj' [s])", 1, PBG_TRUE));
+	check(test_fuse(&err, "(< 'h' [s])", 1, PBG_TRUE));
+	check(test_fuse(&err, "(>= [s] 'hi!')", 1, PBG_FALSE));
+	check(test_fuse(&err, "(= [d] 2018-10-12)", 1, PBG_TRUE));
+	check(test_fuse(&err, "(< [d] 2018-10-13)", 1, PBG_TRUE));
+	check(test_fuse(&err, "(>= 2018-10-11 [d])", 1, PBG_FALSE));
+	/* Variables of other types are compared as parsed. */
+	check(test_fuse(&err, "(< [x] 6)", 1, PBG_ERROR));
+	check(test_fuse(&err, "(= [x] 6)", 1, PBG_ERROR));
+	check(test_fuse(&err, "(!= 6 [x])", 1, PBG_ERROR));
+	check(test_fuse(&err, "(< [s] 6)", 1, PBG_ERROR));
+	check(test_fuse(&err, "(= [s] 6)", 1, PBG_FALSE));
+	check(test_fuse(&err, "(!= [d] 'hi')", 1, PBG_TRUE));
+	check(test_fuse(&err, "(= [t] 5)", 1, PBG_ERROR));
+	check(test_fuse(&err, "(= 5 [t])", 1, PBG_FALSE));
+	check(test_fuse(&err, "(< [t] 5)", 1, PBG_ERROR));
+	check(test_fuse(&err, "(& (< [a] 6) (= [s] 'hi') (> [d] 2018-01-01))", 3, PBG_TRUE));
+	/* Other comparisons are not fused. */
+	check(test_fuse(&err, "(= [a] [b])", 0, PBG_TRUE));
+	check(test_fuse(&err, "(= [a] 5 5)", 0, PBG_TRUE));
+	check(test_fuse(&err, "(< 5 6)", 0, PBG_TRUE));
+	check(test_fuse(&err, "(= [t] TRUE)", 0, PBG_TRUE));
+	
+	end_test();
+}
+
+/* Tests for pbg_canonicalize, pbg_hash, and pbg_equal. */
+int suite_canonical()
+{
+	init_test();
+	
+	/* Arguments of commutative operators are sorted. */
+	check(test_canonical(&err, "(& [a] [b])", "(&  [b]  [a])", 1));
+	check(test_canonical(&err, "(| [a] [b] [c] [d] [e])", "(| [e] [d] [c] [b] [a])", 1));
+	check(test_canonical(&err, "(= [a] 3 [b])", "(= [b] [a] 3.0)", 1));
+	check(test_canonical(&err, "(!= [a] 1)", "(!= 1.000 [a])", 1));
+	check(test_canonical(&err, "(? [x] [y])", "(? [y] [x])", 1));
+	check(test_canonical(&err, "(& TRUE FALSE)", "(& FALSE TRUE)", 1));
+	check(test_canonical(&err, "(& (& [a] [b]) [c])", "(& [c] (& [b] [a]))", 1));
+	check(test_canonical(&err, "(= 'ab' [s])", "(= [s] 'ab')", 1));
+	check(test_canonical(&err, "(= 2018-10-12 [d])", "(= [d] 2018-10-12)", 1));
+	check(test_canonical(&err, "(| (< [a] 1) (= [s] 'x'))", "(| (= 'x' [s]) (< [a] 1))", 1));
+	check(test_canonical(&err, "(! (& [a] [b] (? [c])))", "(! (& (? [c]) [b] [a]))", 1));
+	/* Other differences remain. */
+	check(test_canonical(&err, "(< [a] [b])", "(< [b] [a])", 0));
+	check(test_canonical(&err, "(@ NUMBER [a] [b])", "(@ NUMBER [b] [a])", 0));
+	check(test_canonical(&err, "(& [a] [b])", "(| [a] [b])", 0));
+	check(test_canonical(&err, "(& [a] [b])", "(& [a] [c])", 0));
+	check(test_canonical(&err, "(& [a] [b])", "(& [a] [b] [b])", 0));
+	check(test_canonical(&err, "(= 3 [a])", "(= 3.5 [a])", 0));
+	check(test_canonical(&err, "(= 'ab' [s])", "(= 'abc' [s])", 0));
+	check(test_canonical(&err, "(= 2018-10-12 [d])", "(= 2018-10-13 [d])", 0));
+	check(test_canonical(&err, "(& (| [a] [b]) [c])", "(& (| [a] [c]) [b])", 0));
+	
+	end_test();
+}
+
+/* Tests for pbg_evaluate_zone. Each block is written as columns of values,
+ * one per record; variables without a column are NULL. */
+int suite_zone()
+{
+	init_test();
+	
+	/* Comparisons to constants. */
+	check(test_zone(&err, "(< [a] 5)", "[a] 1 2 3", PBG_ALWAYS));
+	check(test_zone(&err, "(< [a] 5)", "[a] 6 7", PBG_NEVER));
+	check(test_zone(&err, "(< [a] 5)", "[a] 4 6", PBG_MAYBE));
+	check(test_zone(&err, "(< [a] 5)", "[a] 5 7", PBG_NEVER));
+	check(test_zone(&err, "(<= [a] 5)", "[a] 5", PBG_ALWAYS));
+	check(test_zone(&err, "(> 5 [a])", "[a] 1 2", PBG_ALWAYS));
+	check(test_zone(&err, "(>= 5 [a])", "[a] 6 9", PBG_NEVER));
+	check(test_zone(&err, "(= [a] 5)", "[a] 1 4", PBG_NEVER));
+	check(test_zone(&err, "(= [a] 5)", "[a] 5 5", PBG_ALWAYS));
+	check(test_zone(&err, "(!= [a] 5)", "[a] 5", PBG_NEVER));
+	check(test_zone(&err, "(!= 5 [a])", "[a] 6 7", PBG_ALWAYS));
+	check(test_zone(&err, "(= [a] 0)", "[a] 0", PBG_MAYBE));
+	check(test_zone(&err, "(>= [d] 2018-01-01)", "[d] 2018-02-01 2019-01-01", PBG_ALWAYS));
+	check(test_zone(&err, "(>= [d] 2018-01-01)", "[d] 2017-01-01 2017-12-31", PBG_NEVER));
+	check(test_zone(&err, "(= [d] 2018-01-01)", "[d] 2017-01-01 2019-12-31", PBG_MAYBE));
+	check(test_zone(&err, "(< [a] [b])", "[a] 1 2; [b] 3 4", PBG_ALWAYS));
+	check(test_zone(&err, "(> [a] [b])", "[a] 1 2; [b] 3 4", PBG_NEVER));
+	/* STRINGs are ordered byte by byte, a prefix before its extensions. */
+	check(test_zone(&err, "(= [s] 'm')", "[s] 'a' 'k'", PBG_NEVER));
+	check(test_zone(&err, "(< [s] 'm')", "[s] 'a' 'k'", PBG_ALWAYS));
+	check(test_zone(&err, "(< [s] 'm')", "[s] 'n' 'z'", PBG_NEVER));
+	check(test_zone(&err, "(> [s] 'm')", "[s] 'n' 'z'", PBG_ALWAYS));
+	check(test_zone(&err, "(> 'm' [s])", "[s] 'n' 'z'", PBG_NEVER));
+	check(test_zone(&err, "(< [s] 'mo')", "[s] 'a' 'm'", PBG_ALWAYS));
+	check(test_zone(&err, "(< [s] 'm')", "[s] 'm' 'ma'", PBG_NEVER));
+	check(test_zone(&err, "(> [s] 'm')", "[s] 'ma' 'mz'", PBG_ALWAYS));
+	check(test_zone(&err, "(> [s] 'm')", "[s] 'm' 'mz'", PBG_MAYBE));
+	/* NULLs and mismatched types fail to compare. */
+	check(test_zone(&err, "(< [a] 5)", "[a] 1 NULL", PBG_MAYBE));
+	check(test_zone(&err, "(< [a] 5)", "[a] NULL NULL", PBG_NEVER));
+	check(test_zone(&err, "(< [z] 5)", "[a] 1 2", PBG_NEVER));
+	check(test_zone(&err, "(< [a] 'x')", "[a] 1 2", PBG_NEVER));
+	check(test_zone(&err, "(= [a] 'x')", "[a] 1 2", PBG_NEVER));
+	check(test_zone(&err, "(!= [a] 'x')", "[a] 1 2", PBG_ALWAYS));
+	check(test_zone(&err, "(< [a] 5)", "[a] 1 'x'", PBG_MAYBE));
+	/* EXST and TYPE. */
+	check(test_zone(&err, "(? [a])", "[a] NULL NULL", PBG_NEVER));
+	check(test_zone(&err, "(? [a])", "[a] 1 2", PBG_ALWAYS));
+	check(test_zone(&err, "(? [a])", "[a] 1 NULL", PBG_MAYBE));
+	check(test_zone(&err, "(? [a] [b])", "[a] 1 2; [b] 'x' 'y'", PBG_ALWAYS));
+	check(test_zone(&err, "(@ NUMBER [a])", "[a] 1 2", PBG_ALWAYS));
+	check(test_zone(&err, "(@ NUMBER [a])", "[a] 'x' 'y'", PBG_NEVER));
+	check(test_zone(&err, "(@ NUMBER [a])", "[a] 1 NULL", PBG_MAYBE));
+	/* AND, OR, and NOT, which stop at the first deciding argument. */
+	check(test_zone(&err, "(& (> [a] 0) (< [a] 10))", "[a] 1 9", PBG_ALWAYS));
+	check(test_zone(&err, "(| (< [a] 0) (> [a] 10))", "[a] 1 9", PBG_NEVER));
+	check(test_zone(&err, "(! (< [a] 5))", "[a] 6 7", PBG_ALWAYS));
+	check(test_zone(&err, "(& (< [a] 0) (< [b] 'x'))", "[a] 1 2; [b] 1 1", PBG_NEVER));
+	check(test_zone(&err, "(| (< [a] 5) (< [b] 'x'))", "[a] 1 2; [b] 1 1", PBG_ALWAYS));
+	check(test_zone(&err, "(| (< [b] 'x') (< [a] 5))", "[a] 1 2; [b] 1 1", PBG_NEVER));
+	check(test_zone(&err, "(& [t] (> [a] 0))", "[t] TRUE TRUE; [a] 1 2", PBG_ALWAYS));
+	check(test_zone(&err, "(& [t] (> [a] 0))", "[t] FALSE TRUE; [a] 1 2", PBG_MAYBE));
+	check(test_zone(&err, "(| [t] FALSE)", "[t] FALSE FALSE", PBG_NEVER));
+	check(test_zone(&err, "(= [t] (< [a] 5))", "[t] TRUE; [a] 1", PBG_MAYBE));
+	
+	end_test();
+}
+
+/* Tests for pbg_partial_evaluate. [x], [y], [z], and [s] are unknown; the
+ * rest are as in dict, so [a]=5, [c]=6, and [n] is NULL. */
+int suite_partial()
+{
+	init_test();
+	
+	/* Expressions without unknown variables are decided. */
+	check(test_partial(&err, "(< [a] [c])", 0, "TRUE", PBG_TRUE));
+	check(test_partial(&err, "(= [a] [c])", 0, "FALSE", PBG_FALSE));
+	check(test_partial(&err, "TRUE", 0, "TRUE", PBG_TRUE));
+	check(test_partial(&err, "(@ [a] NUMBER)", 0, NULL, PBG_ERROR));
+	/* Comparisons keep known variables as literals. */
+	check(test_partial(&err, "(< [x] 5)", 0, "(< [x] 5)", PBG_MAYBE));
+	check(test_partial(&err, "(< [a] [x])", 0, "(< 5 [x])", PBG_MAYBE));
+	check(test_partial(&err, "(= [x] [y] [a])", 0, "(= [x] [y] 5)", PBG_MAYBE));
+	check(test_partial(&err, "(= [x] [x])", 0, "(= [x] [x])", PBG_MAYBE));
+	/* AND and OR drop arguments which cannot decide them. */
+	check(test_partial(&err, "(& (< [a] [c]) (< [x] 5))", 0, "(< [x] 5)", PBG_MAYBE));
+	check(test_partial(&err, "(& (> [a] [c]) (< [x] 5))", 0, "FALSE", PBG_FALSE));
+	check(test_partial(&err, "(| (> [a] [c]) (< [x] 5))", 0, "(< [x] 5)", PBG_MAYBE));
+	check(test_partial(&err, "(| (< [x] 5) (< [a] [c]))", 0, "(| (< [x] 5) TRUE)", PBG_MAYBE));
+	check(test_partial(&err, "(| (< [a] [c]) (< [x] 5))", 0, "TRUE", PBG_TRUE));
+	check(test_partial(&err, "(& (< [x] 5) (< [a] [c]) (= [y] 1))", 0, "(& (< [x] 5) (= [y] 1))", PBG_MAYBE));
+	check(test_partial(&err, "(& (< [x] 5) (> [a] [c]) (= [y] 1))", 0, "(& (< [x] 5) FALSE)", PBG_MAYBE));
+	check(test_partial(&err, "(& [x] (< [a] [c]))", 0, "(& [x] TRUE)", PBG_MAYBE));
+	check(test_partial(&err, "(! (& (< [a] [c]) [x]))", 0, "(! (& [x] TRUE))", PBG_MAYBE));
+	check(test_partial(&err, "(! (| (< [a] [c]) [x]))", 0, "FALSE", PBG_FALSE));
+	/* Known operators which fail are kept unless skipped. */
+	check(test_partial(&err, "(& (@ [a] NUMBER) [x])", 0, NULL, PBG_ERROR));
+	check(test_partial(&err, "(& [x] (@ [a] NUMBER))", 0, "(& [x] (@ 5 NUMBER))", PBG_MAYBE));
+	check(test_partial(&err, "(| [x] (& [y] (= [a] 'x')))", 0, "(| [x] (& [y] FALSE))", PBG_MAYBE));
+	/* EXST and TYPE decide on known variables. */
+	check(test_partial(&err, "(? [a] [x])", 0, "(? [x])", PBG_MAYBE));
+	check(test_partial(&err, "(? [n] [x])", 0, "FALSE", PBG_FALSE));
+	check(test_partial(&err, "(@ NUMBER [a] [x])", 0, "(@ NUMBER [x])", PBG_MAYBE));
+	check(test_partial(&err, "(@ STRING [a] [x])", 0, "FALSE", PBG_FALSE));
+	check(test_partial(&err, "(@ [x] [a])", 0, "(@ [x] 5)", PBG_MAYBE));
+	check(test_partial(&err, "(@ [a] [x])", 0, NULL, PBG_ERROR));
+	/* Specialized expressions keep the declared types of unknown variables. */
+	check(test_partial(&err, "(& (< [a] [c]) (< [s] 'm'))", 1, "(< [s] 'm')", PBG_MAYBE));
+	check(test_partial(&err, "(& (< [b] [x]) (= [s] 'm'))", 1, "(& (< 5 [x]) (= [s] 'm'))", PBG_MAYBE));
+	check(test_partial(&err, "(| (= [a] 5) (< [x] 3))", 1, "TRUE", PBG_TRUE));
+	check(test_partial(&err, "(| (= [a] 5) (< [d] 2018-01-01))", 1, NULL, PBG_ERROR));
+	/* EQ of a BOOL and another type stores an error, yet decides as for 
+	 * pbg_evaluate. */
+	check(test_partial(&err, "(= TRUE [a])", 0, "FALSE", PBG_FALSE));
+	check(test_partial(&err, "(! (= TRUE [a]))", 0, "TRUE", PBG_TRUE));
+	check(test_partial(&err, "(!= TRUE [a])", 0, "TRUE", PBG_TRUE));
+	check(test_partial(&err, "(& (= TRUE [a]) [x])", 0, "FALSE", PBG_FALSE));
+	check(test_partial(&err, "(| (= FALSE [a]) [x])", 0, "(| [x] FALSE)", PBG_MAYBE));
+	check(test_partial(&err, "(= TRUE [x])", 0, "(= TRUE [x])", PBG_MAYBE));
+	check(test_partial(&err, "(!= TRUE [x])", 0, "(!= TRUE [x])", PBG_MAYBE));
+	check(test_partial(&err, "(! (= TRUE [x]))", 0, "(! (= TRUE [x]))", PBG_MAYBE));
+	
+	end_test();
+}
+
+/* Tests for pbg_bdd_compile and pbg_bdd_evaluate. Node counts include the 
+ * three sinks. */
+int suite_bdd()
+{
+	init_test();
+	
+	/* Leaves which are alike are tested once. */
+	check(test_bdd(&err, "(& [t] [u])", 64, 5));
+	check(test_bdd(&err, "(& [t] [t])", 64, 4));
+	check(test_bdd(&err, "(| (& [t] [u]) (& [t] [v]))", 64, 6));
+	check(test_bdd(&err, "(& (< [a] 5) (| [t] (< [a] 5)))", 64, 5));
+	check(test_bdd(&err, "(& (< [a] 5) (| (< [a] 5) [t]))", 64, 4));
+	check(test_bdd(&err, "(! (& [t] (! [t])))", 64, 4));
+	check(test_bdd(&err, "(| (= [a] [b]) (! (= [a] [b])))", 64, 4));
+	/* Literals, and roots which are leaves. */
+	check(test_bdd(&err, "(& TRUE [t])", 64, 4));
+	check(test_bdd(&err, "(| FALSE (! TRUE))", 64, 3));
+	check(test_bdd(&err, "(| 5 [t])", 64, 3));
+	check(test_bdd(&err, "(& [t] 5)", 64, 4));
+	check(test_bdd(&err, "(< [a] [b])", 64, 4));
+	check(test_bdd(&err, "TRUE", 64, 3));
+	/* Failures are short-circuited as by the tree evaluator. */
+	check(test_bdd(&err, "(| [t] (@ [a] NUMBER))", 64, 5));
+	check(test_bdd(&err, "(& (? [a]) (< [a] 5) (| [t] [u]))", 64, 7));
+	/* Leaves may be ordered by how often they occur instead... */
+	check(test_bdd(&err, "(| (& (& [t] [v] [v]) [w]) (& (& [x] [u]) (& [u] [u]) (& [w] [x] [v])))", 34, 16));
+	check(test_bdd(&err, "(| (& (& [t] [v] [v]) [w]) (& (& [x] [u]) (& [u] [u]) (& [w] [x] [v])))", 32, 18));
+	/* ...and diagrams which are too large fall back to the tree. */
+	check(test_bdd(&err, "(| (& (& [t] [v] [v]) [w]) (& (& [x] [u]) (& [u] [u]) (& [w] [x] [v])))", 31, 0));
+	check(test_bdd(&err, "(| (& [t] [u]) (& [t] [v]))", 2, 0));
+	check(test_bdd(&err, "(| (& [t] [u]) (& [t] [v]))", 0, 0));
+	
+	end_test();
+}
+
+/* Tests for the string operators, and the automata their patterns are
+ * compiled into when there are enough of them. */
+int suite_match()
+{
+	init_test();
+	
+	/* Patterns tested in turn. */
+	check(test_match(&err, "(^= [s] 'he')", "hello", 0, PBG_TRUE));
+	check(test_match(&err, "(^= [s] 'el' 'lo')", "hello", 0, PBG_FALSE));
+	check(test_match(&err, "($= [s] 'el' 'lo')", "hello", 0, PBG_TRUE));
+	check(test_match(&err, "($= [s] 'hello!')", "hello", 0, PBG_FALSE));
+	check(test_match(&err, "(*= [s] 'ell')", "hello", 0, PBG_TRUE));
+	check(test_match(&err, "(*= [s] 'elo' 'lol')", "hello", 0, PBG_FALSE));
+	check(test_match(&err, "(*= [s] '')", "", 0, PBG_TRUE));
+	check(test_match(&err, "(*= 'hello' [s])", "ll", 0, PBG_TRUE));
+	/* Patterns compiled into an automaton. */
+	check(test_match(&err, "(^= [s] 'hex' 'help' 'hello' 'h')", "hello", 1, PBG_TRUE));
+	check(test_match(&err, "(^= [s] 'hex' 'help' 'hellos' 'e')", "hello", 1, PBG_FALSE));
+	check(test_match(&err, "(^= [s] 'hex' 'help' 'hellos' 'ell')", "hel", 1, PBG_FALSE));
+	check(test_match(&err, "($= [s] 'ello' 'o!' 'x' 'y')", "hello", 1, PBG_TRUE));
+	check(test_match(&err, "($= [s] 'hell' 'lo!' 'x' 'y')", "hello", 1, PBG_FALSE));
+	check(test_match(&err, "($= [s] 'hell' 'lo!' 'x' 'y')", "", 1, PBG_FALSE));
+	check(test_match(&err, "(*= [s] 'he' 'she' 'his' 'hers')", "ushers", 1, PBG_TRUE));
+	check(test_match(&err, "(*= [s] 'hex' 'shy' 'his' 'hers')", "ushers", 1, PBG_TRUE));
+	check(test_match(&err, "(*= [s] 'hex' 'shy' 'his' 'herd')", "ushers", 1, PBG_FALSE));
+	check(test_match(&err, "(*= [s] 'hex' 'shy' 'his' 'herd')", "", 1, PBG_FALSE));
+	check(test_match(&err, "(*= [s] 'x' 'xx' 'xxx' 'xxxx')", "abcx", 1, PBG_TRUE));
+	check(test_match(&err, "(*= [s] 'x' 'xx' 'xxx' 'xxxx')", "abcd", 1, PBG_FALSE));
+	/* Patterns which are empty always match. */
+	check(test_match(&err, "(^= [s] 'a' 'b' 'c' '')", "x", 1, PBG_TRUE));
+	check(test_match(&err, "($= [s] 'a' 'b' 'c' '')", "", 1, PBG_TRUE));
+	check(test_match(&err, "(*= [s] 'a' 'b' 'c' '')", "x", 1, PBG_TRUE));
+	/* Every argument must be a STRING. */
+	check(test_match(&err, "(^= [s] 'a' 'b' 'c' 'd')", NULL, 1, PBG_ERROR));
+	check(test_match(&err, "(^= [a] 'a' 'b' 'c' 'd')", "x", 1, PBG_ERROR));
+	check(test_match(&err, "(*= [s] 'a' 'b' 'c' 5)", "x", 0, PBG_ERROR));
+	check(test_match(&err, "(*= [s] 'a' 'b' 'c' [t])", "x", 0, PBG_ERROR));
+	check(test_match(&err, "(*= [s] 'x' [t])", "x", 0, PBG_ERROR));
+	check(test_match(&err, "($= (! TRUE) 'a')", "x", 0, PBG_ERROR));
+	/* Operators are compiled wherever they are. */
+	check(test_match(&err, "(& (*= [s] 'a' 'b' 'c' 'd') (^= [s] 'xa' 'xb' 'xc' 'xd'))", "xd", 2, PBG_TRUE));
+	check(test_match(&err, "(| (*= [s] 'x' 'y') ($= [s] 'a' 'b' 'c' 'd'))", "xd", 1, PBG_TRUE));
+	
+	/* Patterns are unordered, but the subject is not. */
+	check(test_canonical(&err, "(*= [s] 'a' 'b' 'c' 'd')", "(*= [s] 'd' 'c' 'b' 'a')", 1));
+	check(test_canonical(&err, "(^= [s] 'a' 'b')", "(^= [s] 'b' 'a')", 1));
+	check(test_canonical(&err, "(^= [s] 'a')", "(^= 'a' [s])", 0));
+	check(test_canonical(&err, "(^= [s] 'a' 'b' 'c' 'd')", "($= [s] 'a' 'b' 'c' 'd')", 0));
+	
+	/* Arguments known not to be STRING are found when specialized. */
+	check(test_specialize(&err, "(*= [a] 'a' 'b' 'c' 'd')", -1, PBG_ERROR, PBG_ERROR));
+	check(test_specialize(&err, "($= [s] 'a' [d])", -1, PBG_ERROR, PBG_ERROR));
+	
+	/* Unknown subjects are left in the residual. */
+	check(test_partial(&err, "(*= [s] 'a' 'b' 'c' 'x')", 0, "(*= [s] 'a' 'b' 'c' 'x')", PBG_MAYBE));
+	check(test_partial(&err, "(& (< [a] [c]) (^= [s] 'm' 'n' 'o' 'p'))", 0, "(^= [s] 'm' 'n' 'o' 'p')", PBG_MAYBE));
+	check(test_partial(&err, "(| (> [a] [c]) ($= [s] 'x'))", 1, "($= [s] 'x')", PBG_MAYBE));
+	
+	/* Automata agree with patterns tested in turn. */
+	check(test_match_random(&err, "^=", 500));
+	check(test_match_random(&err, "$=", 500));
+	check(test_match_random(&err, "*=", 500));
+	
+	/* Many patterns are scanned at once. */
+	check(test_match_many(&err, 5000, "a,4999,b", PBG_TRUE));
+	check(test_match_many(&err, 5000, "a,5000,b", PBG_FALSE));
+	check(test_match_many(&err, 5000, ",0,", PBG_TRUE));
+	
+	end_test();
+}
+
+/* Tests for pbg_read_number, whose values must be those strtod gives. */
+int suite_number()
+{
+	init_test();
+	
+	/* NUMBERs are written as JSON numbers, or with a leading '+'. */
+	check(test_number("0", 1));
+	check(test_number("-0", 1));
+	check(test_number("+7", 1));
+	check(test_number("3.14", 1));
+	check(test_number("314e-2", 1));
+	check(test_number("0.314E+1", 1));
+	check(test_number("0e5", 1));
+	check(test_number("-0.0", 1));
+	check(test_number("", 0));
+	check(test_number("-", 0));
+	check(test_number("+-1", 0));
+	check(test_number(".314", 0));
+	check(test_number("0.", 0));
+	check(test_number("007", 0));
+	check(test_number("1e", 0));
+	check(test_number("1e+", 0));
+	check(test_number("1.e5", 0));
+	check(test_number("1e5.0", 0));
+	check(test_number("1x", 0));
+	check(test_number("'1'", 0));
+	/* Short significands and small exponents are converted exactly... */
+	check(test_number("0.1", 1));
+	check(test_number("123456789012345", 1));
+	check(test_number("-0.000000000000000000000123", 1));
+	check(test_number("1e22", 1));
+	check(test_number("1e-22", 1));
+	check(test_number("12e30", 1));
+	/* ...and the rest are left to strtod. */
+	check(test_number("1e23", 1));
+	check(test_number("9007199254740993", 1));
+	check(test_number("1234567890123456.5", 1));
+	check(test_number("2.2250738585072011e-308", 1));
+	check(test_number("1.7976931348623157e308", 1));
+	check(test_number("4.9e-324", 1));
+	check(test_number("1e-400", 1));
+	check(test_number("1e400", 1));
+	check(test_number("1e99999999999", 1));
+	check(test_number("0.10000000000000000555111512312578270211815834045410156250000000000000001", 1));
+	check(test_number("100000000000000000000000000000000000000000000000000000000000000000000", 1));
+	check(test_number_random(20000));
+	
+	/* NUMBERs are bounded by their length wherever they are read. */
+	check(test_csv(&err, "a,b", "1e5,12.5e1", "(& (= [a] 100000) (< [b] 126))", PBG_TRUE));
+	check(test_csv(&err, "a,b", "1e5x,12.5e", "(@ STRING [a] [b])", PBG_TRUE));
+	check(test_parser(&err, "(= 1e5 100000.0 10E4)", 1, PBG_TRUE));
+	
+	end_test();
+}
+
+/* Tests for pbg_bits_and, pbg_bits_or, pbg_bits_andnot, and pbg_bits_count.
+ * Bitsets of over a machine word exercise both loops. */
+int suite_bits()
+{
+	init_test();
+	
+	check(test_bits('&', "1100", "1010", "1000"));
+	check(test_bits('|', "1100", "1010", "1110"));
+	check(test_bits('-', "1100", "1010", "0100"));
+	check(test_bits('&', "", "", ""));
+	check(test_bits('|', "101100111", "010000001", "111100111"));
+	check(test_bits('&', 
+			"1010001000011000100001000011001000100001111111000011111001010110011111001100111110110010010011100111", 
+			"0111110000000010110011100111110110000100100000100010111100111110001110001001011010100010011001110111", 
+			"0010000000000000100001000011000000000000100000000010111000010110001110001000011010100010010001100111"));
+	check(test_bits('|', 
+			"1010001000011000100001000011001000100001111111000011111001010110011111001100111110110010010011100111", 
+			"0111110000000010110011100111110110000100100000100010111100111110001110001001011010100010011001110111", 
+			"1111111000011010110011100111111110100101111111100011111101111110011111001101111110110010011011110111"));
+	check(test_bits('-', 
+			"1010001000011000100001000011001000100001111111000011111001010110011111001100111110110010010011100111", 
+			"0111110000000010110011100111110110000100100000100010111100111110001110001001011010100010011001110111", 
+			"1000001000011000000000000000001000100001011111000001000001000000010001000100100100010000000010000000"));
+	
+	end_test();
+}
+
+#ifdef PBG_PROFILE
+/* Tests for the statistics gathered by pbg_evaluate with PBG_PROFILE. */
+int suite_profile()
+{
+	init_test();
+	
+	check(test_profile(&err, "(& (< [a] 6) (= [c] 6))", 2, 1, 1, 0, 0, "(< [a] 6)"));
+	check(test_profile(&err, "(& (< [a] 6) (= [c] 6))", 4, 1, 1, 0, 0, "(= [c] 6)"));
+	check(test_profile(&err, "(| (< [a] 6) (= [c] 6))", 4, 0, 0, 0, 0, "(= [c] 6)"));
+	check(test_profile(&err, "(| (< [d] 6) (= [c] 6))", 1, 1, 0, 0, 1, "(| (< [d] 6) (= [c] 6))"));
+	check(test_profile(&err, "(! (! FALSE))", 3, 1, 0, 1, 0, "FALSE"));
+	check(test_profile(&err, "  TRUE ", 1, 1, 1, 0, 0, "TRUE"));
+	
+	end_test();
+}
+#endif
+
+#ifdef PBG_THREADS
+/* Tests for pbg_evaluate_parallel. Record i binds [n]=i and [m]=i%3. */
+int suite_parallel()
+{
+	init_test();
+	
+	check(test_parallel(&err, "(< [n] 100)", 10000, 1, 100));
+	check(test_parallel(&err, "(< [n] 100)", 10000, 4, 100));
+	check(test_parallel(&err, "(= [m] 0)", 10000, 3, 3334));
+	check(test_parallel(&err, "(= [m] 0)", 5, 8, 2));
+	check(test_parallel(&err, "(| (= [m] 1) (> [n] 9000))", 100003, 7, 94002));
+	check(test_parallel(&err, "TRUE", 0, 4, 0));
+	check(test_parallel(&err, "(< [x] 3)", 1000, 4, -1));
+	check(test_parallel(&err, "(& (! (< [n] 10)) (| (= [m] 1) (< [n] 500)))", 10000, 4, 3656));
+	
+	/* Later children of AND and OR only see the records left undecided. */
+	check(test_select(&err, "(& (< [n] 10) (= [m] 0))", 1000, 4, 1010));
+	check(test_select(&err, "(| (> [n] 10) (= [m] 0))", 1000, 993, 1011));
+	check(test_select(&err, "(& (>= [n] 100) (= [m] 0))", 1000, 300, 1900));
+	check(test_select(&err, "(& (< [n] 10) (| (= [m] 0) (= [m] 1)))", 10000, 7, 10016));
+	check(test_select(&err, "(& (< [n] 500) (< [x] 3))", 1000, -1, 1500));
+	check(test_select(&err, "(! (& TRUE (! (< [n] 10))))", 1000, 10, 1000));
+	/* Variables are resolved again by each child which needs them. */
+	check(test_select(&err, "(& (> [n] 5) (< [n] 100))", 1000, 94, 1994));
+	/* Fields nested deeper than the selections are evaluated by record. */
+	check(test_select(&err, "(! (! (! (! (! (! (! (! (! (< [n] 10))))))))))", 1000, 990, 1000));
+	
+	/* Records left out by a filter are neither resolved nor emitted. */
+	check(test_filter(&err, "(= [m] 0)", "(< [n] 100)", 1000, 1, 34, 100));
+	check(test_filter(&err, "(< [x] 3)", "(= [m] 1)", 1000, 1, -1, 333));
+	check(test_filter(&err, "TRUE", "(> [n] 9000)", 100003, 4, 91002, -1));
+	check(test_filter(&err, "(| (= [m] 0) (< [n] 5))", "(& (> [n] 1000) (< [n] 1010))", 5000, 3, 3, -1));
+	check(test_filter(&err, "TRUE", "FALSE", 1000, 2, 0, 0));
+	
+	/* Rule sets report the matched rule of each record. */
+	check(test_ruleset_parallel(&err, "(< [n] 10);(= [m] 0);(> [n] 9000)", NULL, 10000, 1, 4006, 0));
+	check(test_ruleset_parallel(&err, "(< [n] 10);(= [m] 0);(> [n] 9000)", NULL, 10000, 4, 4006, 0));
+	check(test_ruleset_parallel(&err, "(= [m] 1);(= [m] 2)", NULL, 5, 8, 3, 0));
+	check(test_ruleset_parallel(&err, "(< [n] 10);(< [x] 3);(= [m] 1)", NULL, 1000, 3, 340, 1));
+	check(test_ruleset_parallel(&err, "(= [m] 0);(> [n] 500)", "(< [n] 1000)", 5000, 4, 666, 0));
+	check(test_ruleset_parallel(&err, "TRUE", "FALSE", 1000, 2, 0, 0));
+	
+	end_test();
+}
+
+/* Resolves the variables of the records of suite_parallel. The context holds
+ * the expression or rule set and two numbers per thread, one for each 
+ * variable. */
+pbg_field resolve_record(void* ctx, int thread, long record, int var)
+{
+	test_parallel_ctx* par;
+	char* name;
+	par = (test_parallel_ctx*) ctx;
+	par->_resolved[thread]++;
+	name = (par->_ruleset != NULL) ? pbg_ruleset_var_name(par->_ruleset, var, 
+			NULL) : pbg_var_name(par->_expr, var, NULL);
+	if(strcmp(name, "n") == 0)
+		return pbg_init_number(par->_numbers + 2*thread, record);
+	if(strcmp(name, "m") == 0)
+		return pbg_init_number(par->_numbers + 2*thread+1, record % 3);
+	return pbg_make_null();
+}
+
+/* Resolves the variables of the record of suite_parallel given in its 
+ * context, for pbg_evaluate_lazy. */
+pbg_field resolve_single(void* ctx, int var)
+{
+	test_parallel_ctx* par;
+	par = (test_parallel_ctx*) ctx;
+	return resolve_record(ctx, 0, par->_record, var);
+}
+
+/* Records the result of each record of suite_parallel. */
+void emit_record(void* ctx, int thread, long record, int result)
+{
+	test_parallel_ctx* par;
+	PBG_UNUSED(thread);
+	par = (test_parallel_ctx*) ctx;
+	par->_results[record] = (char) result;
+	par->_emitted[record]++;
+}
+
+/* Tests for pbg_reload_publish, pbg_reload_enter, and pbg_reload_exit. */
+int suite_reload()
+{
+	init_test();
+	
+	/* Versions are freed once no reader holds them. */
+	check(test_reload_hold(&err));
+	
+	/* Readers always see a whole version, and never an older one. */
+	check(test_reload(&err, 1, 100));
+	check(test_reload(&err, 4, 300));
+	check(test_reload(&err, 8, 100));
+	
+	end_test();
+}
+
+/* Publishes version n of the rule sets of suite_reload: n%4+1 rules, where
+ * rule i is (= [v] n*10+i), so only the last matches [v]=n*10+n%4. */
+long reload_publish(pbg_reload* r, pbg_error* err, long n)
+{
+	pbg_expr* rules;
+	char str[64];
+	int i, numrules;
+	numrules = n%4 + 1;
+	if((rules = malloc(numrules * sizeof(pbg_expr))) == NULL)
+		return -1;
+	for(i = 0; i < numrules; i++) {
+		sprintf(str, "(= [v] %ld)", n*10 + i);
+		pbg_parse(rules + i, err, str);
+		if(err->_type != PBG_ERR_NONE) {
+			while(i-- > 0) pbg_free(rules + i);
+			free(rules);
+			return -1;
+		}
+	}
+	return pbg_reload_publish(r, err, rules, NULL, numrules);
+}
+
+/* Evaluates the latest version of the rule sets of suite_reload until the 
+ * test is done, counting mismatches as failures. */
+void* reload_reader(void* arg)
+{
+	test_reload_ctx* ctx;
+	pbg_ruleset* rs;
+	pbg_error err;
+	pbg_field vars[1];
+	pbg_lt_number number;
+	long version, last;
+	int skipped;
+	ctx = (test_reload_ctx*) arg;
+	last = 0;
+	while(!*ctx->_done) {
+		rs = pbg_reload_enter(ctx->_reload, ctx->_reader, &version);
+		if(rs != NULL) {
+			vars[0] = pbg_init_number(&number, (double) (version*10 + version%4));
+			if(version < last || pbg_ruleset_numvars(rs) != 1 || 
+					pbg_ruleset_evaluate(rs, &err, vars, &skipped) != version%4
+					|| skipped != version%4)
+				ctx->_failed++;
+			last = version;
+			ctx->_reads++;
+		}
+		pbg_reload_exit(ctx->_reload, ctx->_reader);
+	}
+	return NULL;
+}
+
+int test_reload_hold(pbg_error* err)
+{
+	pbg_reload r;
+	long version;
+	int pass;
+	pbg_reload_init(&r, err, 2);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	pass = pbg_reload_enter(&r, 0, &version) == NULL && version == 0;
+	pbg_reload_exit(&r, 0);
+	
+	/* A reader holding the first version keeps it and those after it. */
+	pass = pass && reload_publish(&r, err, 1) == 1;
+	pass = pass && pbg_reload_enter(&r, 0, &version) != NULL && version == 1;
+	pass = pass && reload_publish(&r, err, 2) == 2;
+	pass = pass && reload_publish(&r, err, 3) == 3;
+	pass = pass && pbg_reload_reclaim(&r) == 2;
+	/* Another reader sees the latest, and holds nothing older. */
+	pass = pass && pbg_reload_enter(&r, 1, &version) != NULL && version == 3;
+	pbg_reload_exit(&r, 0);
+	pass = pass && pbg_reload_reclaim(&r) == 0;
+	pass = pass && reload_publish(&r, err, 4) == 4;
+	pass = pass && pbg_reload_reclaim(&r) == 1;
+	pbg_reload_exit(&r, 1);
+	pass = pass && pbg_reload_reclaim(&r) == 0;
+	pbg_reload_free(&r);
+	return pass ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_reload(pbg_error* err, int numreaders, long numversions)
+{
+	pbg_reload r;
+	test_reload_ctx ctx[8];
+	pthread_t threads[8];
+	volatile int done;
+	long n;
+	int i, started, pass;
+	pbg_reload_init(&r, err, numreaders);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	done = 0;
+	for(started = 0; started < numreaders && started < 8; started++) {
+		ctx[started]._reload = &r;
+		ctx[started]._reader = started;
+		ctx[started]._done = &done;
+		ctx[started]._reads = 0;
+		ctx[started]._failed = 0;
+		if(pthread_create(threads + started, NULL, reload_reader, 
+				ctx + started) != 0)
+			break;
+	}
+	
+	/* Publish while the readers read. */
+	pass = (started == numreaders);
+	for(n = 1; pass && n <= numversions; n++)
+		pass = (reload_publish(&r, err, n) == n);
+	done = 1;
+	for(i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+		pass = pass && ctx[i]._failed == 0;
+	}
+	pass = pass && pbg_reload_reclaim(&r) == 0;
+	pbg_reload_free(&r);
+	return pass ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+#endif
+
+
 /**************************
  *                        *
  * UNIT TESTING FUNCTIONS *
@@ -352,6 +1535,11 @@ int test_evaluate(pbg_error* err, char* str, pbg_field (*dict)(char*,int), int e
 		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
 	/* Evaluate the expression with the given dictionary. */
 	output = pbg_evaluate(&e, err, dict);
+	/* Compiling it must not change the result. */
+	if(test_compile(&e, str, NULL, dict, output, err->_type) != PBG_TEST_PASS) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
 	/* Clean up. */
 	pbg_free(&e);
 	/* Return if there's an error. */
@@ -362,6 +1550,1474 @@ int test_evaluate(pbg_error* err, char* str, pbg_field (*dict)(char*,int), int e
 }
 
 
+int test_numvars(pbg_error* err, char* str, int expect)
+{
+	pbg_expr e;
+	int numvars;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	numvars = pbg_numvars(&e);
+	pbg_free(&e);
+	return (numvars == expect) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_evaluate_vars(pbg_error* err, char* str, int expect)
+{
+	pbg_expr e;
+	pbg_field vars[8];
+	pbg_lt_number numbers[8];
+	pbg_lt_date dates[8];
+	char* name;
+	int i, output;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	/* Bind [a]=5, [b]=5, [c]=6, [s]='hi', [d]=2018-10-12, and [t]=TRUE
+	 * without allocating. Everything else is NULL. */
+	for(i = 0; i < pbg_numvars(&e) && i < 8; i++) {
+		name = pbg_var_name(&e, i, NULL);
+		if(strcmp(name, "a") == 0 || strcmp(name, "b") == 0)
+			vars[i] = pbg_init_number(numbers+i, 5.0);
+		else if(strcmp(name, "c") == 0)
+			vars[i] = pbg_init_number(numbers+i, 6.0);
+		else if(strcmp(name, "s") == 0)
+			vars[i] = pbg_init_string("hi", 2);
+		else if(strcmp(name, "d") == 0)
+			vars[i] = pbg_init_date(dates+i, 2018, 10, 12);
+		else if(strcmp(name, "t") == 0)
+			vars[i] = pbg_make_bool(1);
+		else
+			vars[i] = pbg_make_null();
+	}
+	output = pbg_evaluate_vars(&e, err, vars);
+	if(test_compile(&e, str, vars, NULL, output, err->_type) != PBG_TEST_PASS) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	pbg_free(&e);
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_eval(pbg_error* err, char* str, int specialize, char* asks, 
+		int expect)
+{
+	pbg_expr e;
+	pbg_eval ev;
+	pbg_error referr;
+	pbg_field vars[8], supplied[8];
+	pbg_lt_number numbers[8];
+	pbg_lt_date dates[8];
+	char asked[16];
+	int n, var, output, reference;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	if(specialize)
+		pbg_specialize(&e, err, schema);
+	if(err->_type != PBG_ERR_NONE || pbg_numvars(&e) > 8) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	bind_vars(&e, vars, numbers, dates);
+	reference = pbg_evaluate_vars(&e, &referr, vars);
+	if(referr._type != PBG_ERR_NONE)
+		reference = PBG_ERROR;
+	
+	/* Supply each variable as it is asked for. */
+	pbg_eval_begin(&ev, err, &e, supplied);
+	n = 0;
+	while((output = pbg_eval_step(&ev, err, &var)) == PBG_NEED && n < 15) {
+		asked[n++] = pbg_var_name(&e, var, NULL)[0];
+		pbg_eval_resume(&ev, var, vars[var]);
+	}
+	asked[n] = '\0';
+	/* Stepping again must give the same result. */
+	if(pbg_eval_step(&ev, &referr, &var) != output || 
+			referr._type != err->_type)
+		output = PBG_NEED;
+	pbg_eval_free(&ev);
+	pbg_free(&e);
+	if(output != reference || strcmp(asked, asks) != 0)
+		return PBG_TEST_FAIL;
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_eval_many(pbg_error* err, char* str, int numevals)
+{
+	pbg_expr e;
+	pbg_eval evs[100];
+	pbg_field vars[8], supplied[100][8];
+	pbg_lt_number numbers[8];
+	pbg_lt_date dates[8];
+	int i, var, pending[100], results[100], reference, left, pass;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	bind_vars(&e, vars, numbers, dates);
+	reference = pbg_evaluate_vars(&e, err, vars);
+	if(err->_type != PBG_ERR_NONE)
+		reference = PBG_ERROR;
+	
+	/* Step every evaluation in turn. A variable asked for is only supplied 
+	 * on the next round, as if it came from elsewhere. Every other 
+	 * evaluation is given its first variable before it is asked for. */
+	for(i = 0; i < numevals; i++) {
+		pbg_eval_begin(evs+i, err, &e, supplied[i]);
+		if(i % 2 == 1 && pbg_numvars(&e) > 0)
+			pbg_eval_resume(evs+i, 0, vars[0]);
+		pending[i] = -1;
+		results[i] = PBG_NEED;
+	}
+	for(left = numevals; left > 0; ) {
+		for(i = 0; i < numevals; i++) {
+			if(results[i] != PBG_NEED)
+				continue;
+			if(pending[i] >= 0)
+				pbg_eval_resume(evs+i, pending[i], vars[pending[i]]);
+			results[i] = pbg_eval_step(evs+i, err, &var);
+			pending[i] = (results[i] == PBG_NEED) ? var : -1;
+			left -= (results[i] != PBG_NEED);
+		}
+	}
+	for(i = 0, pass = 1; i < numevals; i++) {
+		pass = pass && results[i] == reference;
+		pbg_eval_free(evs+i);
+	}
+	pbg_free(&e);
+	return pass ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_evaluate_lazy(pbg_error* err, char* str, int expect, int calls)
+{
+	pbg_expr e;
+	pbg_field vars[8];
+	int output, count;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	count = 0;
+	output = pbg_evaluate_lazy(&e, err, vars, resolve, &count);
+	pbg_free(&e);
+	if(count != calls)
+		return PBG_TEST_FAIL;
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_multiget(pbg_error* err, char* str, long numrecords, long numtrue, 
+		long numerrors, int calls)
+{
+	pbg_expr e;
+	pbg_field vars[64*8];
+	int results[64];
+	int count, pass;
+	long r, output, errors;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	count = 0;
+	output = pbg_evaluate_multiget(&e, err, numrecords, vars, results, 
+			multiget, &count);
+	pass = (count == calls && output == numtrue && pbg_numvars(&e) <= 8);
+	/* Each result must be that of evaluating the record on its own. */
+	for(r = errors = 0; pass && r < numrecords; r++) {
+		errors += (results[r] == PBG_ERROR);
+		pass = (results[r] == pbg_evaluate_vars(&e, err, vars + r*e._numvars) ||
+				(results[r] == PBG_ERROR && err->_type != PBG_ERR_NONE));
+	}
+	pbg_evaluate_multiget(&e, err, numrecords, vars, NULL, multiget, &count);
+	pbg_free(&e);
+	if(!pass || errors != numerrors)
+		return PBG_TEST_FAIL;
+	return ((err->_type != PBG_ERR_NONE) == (numerrors > 0)) ? 
+			PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_ruleset(pbg_error* err, char* strs, int* priorities, int specialize,
+		int expect, int skipped, int fails)
+{
+	pbg_ruleset rs;
+	pbg_expr rules[8];
+	pbg_error referr;
+	pbg_field vars[16], rulevars[8];
+	pbg_lt_number numbers[16];
+	pbg_lt_date dates[16];
+	char buf[256], *str, *end, *name;
+	int i, j, n, numrules, output, reference, best, pass;
+	
+	/* Parse each rule of the ';' separated list. */
+	strcpy(buf, strs);
+	for(str = buf, numrules = 0; str != NULL && numrules < 8; numrules++) {
+		if((end = strchr(str, ';')) != NULL)
+			*end++ = '\0';
+		pbg_parse(rules + numrules, err, str);
+		if(err->_type == PBG_ERR_NONE && specialize)
+			pbg_specialize(rules + numrules, err, schema);
+		if(err->_type != PBG_ERR_NONE) {
+			for(i = 0; i < numrules; i++) pbg_free(rules + i);
+			return PBG_TEST_FAIL;
+		}
+		str = end;
+	}
+	
+	/* Bind the variables of the rule set as for test_evaluate_vars. */
+	pbg_ruleset_init(&rs, err, rules, priorities, numrules);
+	pass = err->_type == PBG_ERR_NONE && pbg_ruleset_numvars(&rs) <= 16;
+	for(i = 0; pass && i < pbg_ruleset_numvars(&rs); i++) {
+		name = pbg_ruleset_var_name(&rs, i, &n);
+		if(strcmp(name, "a") == 0 || strcmp(name, "b") == 0)
+			vars[i] = pbg_init_number(numbers+i, 5.0);
+		else if(strcmp(name, "c") == 0)
+			vars[i] = pbg_init_number(numbers+i, 6.0);
+		else if(strcmp(name, "s") == 0)
+			vars[i] = pbg_init_string("hi", 2);
+		else if(strcmp(name, "d") == 0)
+			vars[i] = pbg_init_date(dates+i, 2018, 10, 12);
+		else if(strcmp(name, "t") == 0)
+			vars[i] = pbg_make_bool(1);
+		else
+			vars[i] = pbg_make_null();
+	}
+	
+	/* The match must be the first TRUE rule by priority, ties going to the
+	 * earlier rule. */
+	reference = -1;
+	for(i = 0; pass && i < numrules; i++) {
+		for(j = 0; j < pbg_numvars(rules + i); j++)
+			for(n = 0; n < pbg_ruleset_numvars(&rs); n++)
+				if(strcmp(pbg_var_name(rules + i, j, NULL), 
+						pbg_ruleset_var_name(&rs, n, NULL)) == 0)
+					rulevars[j] = vars[n];
+		best = (reference < 0 || (priorities != NULL && 
+				priorities[i] > priorities[reference]));
+		if(best && pbg_evaluate_vars(rules + i, &referr, rulevars) == PBG_TRUE
+				&& referr._type == PBG_ERR_NONE)
+			reference = i;
+	}
+	output = pass ? pbg_ruleset_evaluate(&rs, err, vars, &n) : -2;
+	pbg_ruleset_free(&rs);
+	for(i = 0; i < numrules; i++)
+		pbg_free(rules + i);
+	if(output != reference || output != expect || n != skipped)
+		return PBG_TEST_FAIL;
+	return ((err->_type != PBG_ERR_NONE) == fails) ? 
+			PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_ruleset_many(pbg_error* err, int numrules, int value)
+{
+	pbg_ruleset rs;
+	pbg_expr* rules;
+	pbg_field vars[2];
+	pbg_lt_number numbers[2];
+	char str[64];
+	int i, output, skipped, pass;
+	rules = malloc(numrules * sizeof(pbg_expr));
+	if(rules == NULL)
+		return PBG_TEST_FAIL;
+	
+	/* Rule i is keyed on [k]=i, and the last rule matches anything. */
+	for(i = 0; i < numrules; i++) {
+		if(i < numrules-1)
+			sprintf(str, "(& (= [k] %d) (< [n] %d))", i, i+1);
+		else
+			sprintf(str, "(> [n] -1)");
+		pbg_parse(rules + i, err, str);
+		if(err->_type != PBG_ERR_NONE) {
+			while(i-- > 0) pbg_free(rules + i);
+			free(rules);
+			return PBG_TEST_FAIL;
+		}
+	}
+	pbg_ruleset_init(&rs, err, rules, NULL, numrules);
+	pass = (err->_type == PBG_ERR_NONE && pbg_ruleset_numvars(&rs) <= 2);
+	for(i = 0; pass && i < 2; i++)
+		vars[i] = pbg_init_number(numbers+i, (double) value);
+	
+	/* Only the rule keyed on the value, or else the last, is evaluated. */
+	output = pass ? pbg_ruleset_evaluate(&rs, err, vars, &skipped) : -2;
+	pbg_ruleset_free(&rs);
+	for(i = 0; i < numrules; i++)
+		pbg_free(rules + i);
+	free(rules);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	if(output != ((value < numrules-1) ? value : numrules-1))
+		return PBG_TEST_FAIL;
+	return (skipped == numrules-1) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_budget(pbg_error* err, char* str, long visits, long nsec, 
+		int expect, int spent)
+{
+	pbg_expr e;
+	pbg_error referr;
+	pbg_field vars[8];
+	pbg_lt_number numbers[8];
+	pbg_lt_date dates[8];
+	int i, output, reference, pass;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE || pbg_numvars(&e) > 8)
+		return PBG_TEST_FAIL;
+	bind_vars(&e, vars, numbers, dates);
+	output = pbg_evaluate_budget(&e, err, vars, visits, nsec);
+	pass = (err->_type == PBG_ERR_BUDGET) == spent;
+#ifdef PBG_PROFILE
+	/* Nothing is left behind. */
+	for(i = 0; i < e._numconst; i++)
+		pass = pass && e._stats[i]._evals == 0;
+#endif
+	/* An evaluation within its budget is any other evaluation, and one which
+	 * costs as much as the expression is always within its budget. */
+	reference = pbg_evaluate_vars(&e, &referr, vars);
+	if(!spent)
+		pass = pass && output == reference && 
+				(err->_type == PBG_ERR_NONE) == (referr._type == PBG_ERR_NONE);
+	i = pbg_evaluate_budget(&e, &referr, vars, pbg_cost(&e), 0);
+	pass = pass && i == reference && referr._type != PBG_ERR_BUDGET;
+	pbg_free(&e);
+	return (pass && output == expect) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_budget_deep(pbg_error* err, int depth, long visits, long nsec, 
+		int spent)
+{
+	pbg_expr e;
+	pbg_field var;
+	char* str, *end;
+	int i, output;
+	if((str = malloc(4*depth + 8)) == NULL)
+		return PBG_TEST_FAIL;
+	for(end = str, i = 0; i < depth; i++)
+		end += sprintf(end, "(! ");
+	end += sprintf(end, "[t]");
+	for(i = 0; i < depth; i++)
+		*end++ = ')';
+	*end = '\0';
+	pbg_parse(&e, err, str);
+	free(str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	var = pbg_make_bool(1);
+	output = pbg_evaluate_budget(&e, err, &var, visits, nsec);
+	if(pbg_cost(&e) != depth+1)
+		output = PBG_ERROR + 10;
+	pbg_free(&e);
+	if(spent)
+		return (output == PBG_ERROR && err->_type == PBG_ERR_BUDGET) ? 
+				PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (err->_type == PBG_ERR_NONE && output == (depth%2 ? PBG_FALSE : 
+			PBG_TRUE)) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_cost(pbg_error* err, char* str, long cost)
+{
+	pbg_expr e;
+	long output;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	output = pbg_cost(&e);
+	pbg_free(&e);
+	return (output == cost) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_csv(pbg_error* err, char* header, char* record, char* str, int expect)
+{
+	pbg_expr e;
+	pbg_csv csv;
+	int output;
+	char delim, *copy;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	delim = (strchr(header, ';') != NULL) ? ';' : ',';
+	pbg_csv_bind(&csv, err, &e, header, strlen(header), delim);
+	if(err->_type != PBG_ERR_NONE) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	/* Records need not be terminated, so evaluate a copy of exact size. */
+	copy = malloc(strlen(record) + (record[0] == '\0'));
+	memcpy(copy, record, strlen(record));
+	output = pbg_csv_evaluate(&csv, err, copy, strlen(record));
+	free(copy);
+	pbg_csv_free(&csv);
+	pbg_free(&e);
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_arrow(pbg_error* err, char* str, int offset, char* expect)
+{
+	static double n[5] = {1.5, 0, -2, 10, 3};
+	static int64_t i[5] = {5, 6, 0, -7, 3};
+	static int32_t d[5] = {17816, 0, 0, -1, 3};
+	static int32_t so[6] = {0, 2, 2, 2, 4, 5}, uo[6] = {0, 1, 2, 2, 4, 5};
+	static unsigned char bits[7][1] = {{0x0F}, {0x1D}, {0x1B}, {0x1B}, 
+			{0x1B}, {0x1B}, {0x19}};
+	static const char* names[7] = {"n", "i", "d", "s", "t", "x", "u"};
+	static const char* formats[7] = {"g", "l", "tdD", "u", "b", "z", "u"};
+	const void* buffers[7][3], *batchbuffers[1];
+	struct ArrowSchema schemas[7], schema, outschema;
+	struct ArrowSchema* schemaptrs[7];
+	struct ArrowArray columns[7], batch, out;
+	struct ArrowArray* columnptrs[7];
+	const unsigned char* valid, *values;
+	pbg_expr e;
+	pbg_arrow a;
+	long output;
+	int c, r, ok;
+	
+	/* Build the batch of the suite. */
+	buffers[0][1] = n;
+	buffers[1][1] = i;
+	buffers[2][1] = d;
+	buffers[3][1] = so;
+	buffers[3][2] = "hiyoz";
+	buffers[4][1] = bits[6];
+	buffers[5][1] = so;
+	buffers[5][2] = "hiyoz";
+	buffers[6][1] = uo;
+	buffers[6][2] = "hiyoz";
+	memset(schemas, 0, sizeof(schemas));
+	memset(columns, 0, sizeof(columns));
+	for(c = 0; c < 7; c++) {
+		buffers[c][0] = (c < 6) ? bits[c+1] : NULL;
+		schemas[c].format = formats[c];
+		schemas[c].name = names[c];
+		schemaptrs[c] = &schemas[c];
+		columns[c].length = 5;
+		columns[c].n_buffers = (c == 3 || c >= 5) ? 3 : 2;
+		columns[c].buffers = buffers[c];
+		columnptrs[c] = &columns[c];
+	}
+	memset(&schema, 0, sizeof(schema));
+	schema.format = "+s";
+	schema.n_children = 7;
+	schema.children = schemaptrs;
+	memset(&batch, 0, sizeof(batch));
+	batch.length = 5 - offset;
+	batch.offset = offset;
+	batch.n_buffers = 1;
+	batchbuffers[0] = bits[0];
+	batch.buffers = batchbuffers;
+	batch.n_children = 7;
+	batch.children = columnptrs;
+	
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	pbg_arrow_bind(&a, err, &e, &schema);
+	if(err->_type != PBG_ERR_NONE) {
+		pbg_free(&e);
+		return (expect == NULL) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	}
+	output = pbg_arrow_evaluate(&a, err, &batch, &out, &outschema);
+	pbg_arrow_free(&a);
+	pbg_free(&e);
+	if(expect == NULL || output < 0)
+		return PBG_TEST_FAIL;
+	
+	/* Compare each row of the result, which needs a validity bitmap only if
+	 * some row is null. */
+	valid = (const unsigned char*) out.buffers[0];
+	values = (const unsigned char*) out.buffers[1];
+	ok = (out.length == (int64_t) strlen(expect)) && 
+			strcmp(outschema.format, "b") == 0 &&
+			(valid == NULL) == (strchr(expect, '.') == NULL);
+	for(r = 0; ok && expect[r] != '\0'; r++) {
+		if(valid != NULL && !(valid[r >> 3] & (1 << (r & 7))))
+			ok = (expect[r] == '.');
+		else
+			ok = (expect[r] == ((values[r >> 3] & (1 << (r & 7))) ? 'T' : 'F'));
+		output -= (expect[r] == 'T');
+	}
+	out.release(&out);
+	outschema.release(&outschema);
+	if(out.release != NULL || outschema.release != NULL)
+		ok = 0;
+	return (ok && output == 0) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_parser(pbg_error* err, char* str, int chunk, int expect)
+{
+	pbg_parser* p;
+	pbg_expr e, ref;
+	pbg_error referr;
+	int i, n, output, same;
+	p = pbg_parser_new();
+	if(p == NULL)
+		return PBG_TEST_FAIL;
+	n = strlen(str);
+	for(i = 0; i < n; i += chunk)
+		pbg_parser_feed(p, str+i, (n-i < chunk) ? n-i : chunk);
+	pbg_parser_finish(p, &e, err);
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	/* The tree must match the one built by pbg_parse. */
+	pbg_parse(&ref, &referr, str);
+	same = referr._type == PBG_ERR_NONE && ref._numconst == e._numconst && 
+			ref._numvars == e._numvars;
+	for(i = 0; same && i < e._numconst; i++)
+		same = ref._constants[i]._type == e._constants[i]._type && 
+				ref._constants[i]._int == e._constants[i]._int;
+	if(referr._type == PBG_ERR_NONE) pbg_free(&ref);
+	pbg_error_free(&referr);
+	output = pbg_evaluate(&e, err, dict);
+	pbg_free(&e);
+	if(!same)
+		return PBG_TEST_FAIL;
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_deep(pbg_error* err, char* open, char* leaf, char* close, int depth, 
+		int expect)
+{
+	pbg_parser* p;
+	pbg_expr e;
+	char* str, *end;
+	size_t n;
+	int i, output, streamed;
+	n = depth * (strlen(open) + strlen(close)) + strlen(leaf);
+	if((str = malloc(n+1)) == NULL)
+		return PBG_TEST_FAIL;
+	for(end = str, i = 0; i < depth; i++)
+		end += sprintf(end, "%s", open);
+	end += sprintf(end, "%s", leaf);
+	for(i = 0; i < depth; i++)
+		end += sprintf(end, "%s", close);
+	/* Both parsers must build the same result. */
+	pbg_parse_n(&e, err, str, n);
+	if(err->_type != PBG_ERR_NONE) {
+		free(str);
+		return PBG_TEST_FAIL;
+	}
+	output = pbg_evaluate(&e, err, dict);
+	pbg_free(&e);
+	if(err->_type != PBG_ERR_NONE)
+		output = PBG_ERROR;
+	pbg_error_free(err);
+	p = pbg_parser_new();
+	for(i = 0; p != NULL && (size_t) i < n; i += 4096)
+		pbg_parser_feed(p, str+i, (n-i < 4096) ? n-i : 4096);
+	free(str);
+	if(p == NULL)
+		return PBG_TEST_FAIL;
+	pbg_parser_finish(p, &e, err);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	streamed = pbg_evaluate(&e, err, dict);
+	pbg_free(&e);
+	if(err->_type != PBG_ERR_NONE)
+		streamed = PBG_ERROR;
+	return (expect == output && expect == streamed) ? 
+			PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_wide(pbg_error* err, int numvars)
+{
+	pbg_expr e;
+	char* str, *end;
+	int i, output, same;
+	if((str = malloc(2 * numvars * 24 + 16)) == NULL)
+		return PBG_TEST_FAIL;
+	/* Each variable appears twice. */
+	end = str + sprintf(str, "(|");
+	for(i = 0; i < 2 * numvars; i++)
+		end += sprintf(end, " (! (? [v%d]))", i % numvars);
+	sprintf(end, ")");
+	pbg_parse(&e, err, str);
+	free(str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	same = pbg_numvars(&e) == numvars;
+	for(i = 0; same && i < numvars; i += numvars / 7 + 1)
+		same = atoi(pbg_var_name(&e, i, NULL) + 1) == i;
+	output = pbg_evaluate(&e, err, dict);
+	pbg_free(&e);
+	if(!same || err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	return (output == PBG_TRUE) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_error(pbg_error* err, char* str, char* suffix)
+{
+	pbg_expr e;
+	char full[256], part[256];
+	size_t len, n, size;
+	pbg_parse(&e, err, str);
+	if(err->_type == PBG_ERR_NONE) {
+		pbg_evaluate(&e, err, dict);
+		pbg_free(&e);
+	}
+	if(err->_type == PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	len = pbg_error_format(err, full, sizeof(full));
+	n = strlen(suffix);
+	if(len != strlen(full) || len < n || strcmp(full+len-n, suffix) != 0)
+		return PBG_TEST_FAIL;
+	/* Truncated text must be a terminated prefix of the full text. */
+	for(size = 0; size <= len+1; size++) {
+		memset(part, 'x', sizeof(part));
+		if(pbg_error_format(err, part, size) != len)
+			return PBG_TEST_FAIL;
+		if(size == 0 && part[0] != 'x')
+			return PBG_TEST_FAIL;
+		if(size > 0 && (strlen(part) != ((size <= len) ? size-1 : len) || 
+				strncmp(part, full, strlen(part)) != 0))
+			return PBG_TEST_FAIL;
+	}
+	return PBG_TEST_PASS;
+}
+
+int test_specialize(pbg_error* err, char* str, int changed, int expect, 
+		int lazy)
+{
+	pbg_expr e;
+	pbg_field_type* types;
+	pbg_field vars[8];
+	int i, n, calls, output, generic;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	generic = pbg_evaluate(&e, err, dict);
+	pbg_error_free(err);
+	types = malloc(e._numconst * sizeof(pbg_field_type));
+	for(i = 0; i < e._numconst; i++)
+		types[i] = e._constants[i]._type;
+	pbg_specialize(&e, err, schema);
+	/* Count the operators which were changed, if any. */
+	for(i = n = 0; i < e._numconst; i++)
+		n += (types[i] != e._constants[i]._type);
+	free(types);
+	if(err->_type != PBG_ERR_NONE) {
+		pbg_free(&e);
+		return (changed == -1 && n == 0) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	}
+	if(n != changed) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	/* Evaluate with every variable 5, resolving them lazily. */
+	output = pbg_evaluate_lazy(&e, err, vars, resolve, &calls);
+	if(err->_type != PBG_ERR_NONE)
+		output = PBG_ERROR;
+	pbg_error_free(err);
+	if(output != lazy) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	output = pbg_evaluate(&e, err, dict);
+	if(test_compile(&e, str, NULL, dict, output, err->_type) != PBG_TEST_PASS) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	pbg_free(&e);
+	if(err->_type != PBG_ERR_NONE)
+		output = PBG_ERROR;
+	/* Without violations, specializing must not change the result. */
+	if(expect != PBG_ERROR && output != generic)
+		return PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_fuse(pbg_error* err, char* str, int fused, int expect)
+{
+	pbg_expr e;
+	int i, n;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	for(i = n = 0; i < e._numconst; i++)
+		n += (e._constants[i]._type == PBG_FU_NUMBER || 
+				e._constants[i]._type == PBG_FU_DATE || 
+				e._constants[i]._type == PBG_FU_STRING);
+	pbg_free(&e);
+	if(n != fused)
+		return PBG_TEST_FAIL;
+	return test_evaluate_vars(err, str, expect);
+}
+
+int test_compile(pbg_expr* e, char* str, pbg_field* vars, 
+		pbg_field (*dict)(char*, int), int output, pbg_error_type type)
+{
+	char name[32];
+	char* buf;
+	size_t len;
+#ifdef PBG_COMPILED
+	pbg_error err;
+	int i;
+#endif
+	strcpy(name, "compiled");
+#ifdef PBG_CORPUS
+	if(numcorpus == PBG_CORPUS_MAX)
+		return PBG_TEST_FAIL;
+	sprintf(name, "corpus_%d", numcorpus);
+	corpus[numcorpus]._str = str;
+	corpus[numcorpus++]._specialized = (e->_schema != NULL);
+#endif
+	/* Writing the source must agree with measuring it, as for snprintf. */
+	len = pbg_compile(e, name, NULL, 0);
+	if(len == 0 || (buf = malloc(len+1)) == NULL)
+		return PBG_TEST_FAIL;
+	if(pbg_compile(e, name, buf, 8) != len || strlen(buf) != 7 || 
+			pbg_compile(e, name, buf, len+1) != len || strlen(buf) != len) {
+		free(buf);
+		return PBG_TEST_FAIL;
+	}
+#ifdef PBG_CORPUS
+	printf("\n%s", buf);
+#endif
+	free(buf);
+#ifdef PBG_COMPILED
+	/* Compiled expressions must yield the same results and errors. */
+	for(i = 0; compiled[i]._str != NULL; i++)
+		if(strcmp(compiled[i]._str, str) == 0 && 
+				compiled[i]._specialized == (e->_schema != NULL))
+			break;
+	if(compiled[i]._str == NULL)
+		return PBG_TEST_FAIL;
+	if(vars != NULL)
+		i = compiled[i]._vars(vars, &err);
+	else
+		i = compiled[i]._dict(dict, &err);
+	return (i == output && err._type == type) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+#else
+	PBG_UNUSED(str);
+	PBG_UNUSED(vars);
+	PBG_UNUSED(dict);
+	PBG_UNUSED(output);
+	PBG_UNUSED(type);
+	return PBG_TEST_PASS;
+#endif
+}
+
+int test_incr(pbg_error* err, char* str, char* var, double value, 
+		int expect, long evals)
+{
+	pbg_expr e;
+	pbg_incr incr;
+	pbg_field vars[8];
+	pbg_lt_number numbers[8], update;
+	pbg_error verr;
+	int i, output, reference;
+	long before;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	for(i = 0; i < pbg_numvars(&e) && i < 8; i++)
+		vars[i] = pbg_init_number(numbers+i, 5.0);
+	pbg_incr_bind(&incr, err, &e, vars);
+	if(err->_type != PBG_ERR_NONE) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	/* Evaluate once, update the variable, and evaluate again. */
+	pbg_incr_evaluate(&incr, err);
+	for(i = 0; i < pbg_numvars(&e); i++)
+		if(strcmp(pbg_var_name(&e, i, NULL), var) == 0)
+			pbg_incr_set(&incr, i, pbg_init_number(&update, value));
+	before = incr._numevals;
+	output = pbg_incr_evaluate(&incr, err);
+	/* The result must agree with a full evaluation. */
+	reference = pbg_evaluate_vars(&e, &verr, vars);
+	pbg_incr_free(&incr);
+	pbg_free(&e);
+	if(output != reference || incr._numevals - before != evals)
+		return PBG_TEST_FAIL;
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+#ifdef PBG_PROFILE
+int test_profile(pbg_error* err, char* str, int field, long evals, 
+		long numtrue, long numfalse, long numerror, char* span)
+{
+	pbg_expr e;
+	pbg_node_stats* stats;
+	int pass;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	pbg_evaluate(&e, err, dict);
+	err->_type = PBG_ERR_NONE;
+	stats = e._stats + (field-1);
+	pass = stats->_evals == evals && stats->_true == numtrue && 
+			stats->_false == numfalse && stats->_error == numerror &&
+			stats->_len == strlen(span) && 
+			strncmp(e._source + stats->_start, span, stats->_len) == 0;
+	pbg_expr_stats_reset(&e);
+	pass = pass && stats->_evals == 0 && stats->_nsec == 0;
+	pbg_free(&e);
+	return pass ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+#endif
+
+#ifdef PBG_THREADS
+int test_parallel(pbg_error* err, char* str, long numrecords, int numthreads, 
+		long expect)
+{
+	long resolved;
+	return test_parallel_r(err, str, NULL, numrecords, numthreads, expect, 
+			&resolved);
+}
+
+int test_select(pbg_error* err, char* str, long numrecords, long expect, 
+		long resolved)
+{
+	long count;
+	if(test_parallel_r(err, str, NULL, numrecords, 1, expect, &count) != 
+			PBG_TEST_PASS)
+		return PBG_TEST_FAIL;
+	return (count == resolved) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_filter(pbg_error* err, char* str, char* filter, long numrecords, 
+		int numthreads, long expect, long resolved)
+{
+	long count;
+	if(test_parallel_r(err, str, filter, numrecords, numthreads, expect, 
+			&count) != PBG_TEST_PASS)
+		return PBG_TEST_FAIL;
+	return (resolved == -1 || count == resolved) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_parallel_r(pbg_error* err, char* str, char* filter, long numrecords,
+		int numthreads, long expect, long* resolved)
+{
+	pbg_expr e;
+	pbg_batch batch;
+	pbg_error single;
+	pbg_field* vars;
+	test_parallel_ctx par;
+	long numtrue, i;
+	int pass, bit;
+	par._numbers = malloc(2*numthreads * sizeof(pbg_lt_number));
+	par._resolved = calloc(numthreads, sizeof(long));
+	par._results = malloc(numrecords + 1);
+	par._emitted = calloc(numrecords + 1, 1);
+	par._ruleset = NULL;
+	batch._numrecords = numrecords;
+	batch._resolve = resolve_record;
+	batch._ctx = &par;
+	batch._errors = calloc(numrecords/8 + 1, 1);
+	batch._filter = NULL;
+	batch._emit = NULL;
+	/* Evaluate the filter first, into a bitset of its own. */
+	if(filter != NULL) {
+		pbg_parse(&e, err, filter);
+		if(err->_type != PBG_ERR_NONE)
+			return PBG_TEST_FAIL;
+		par._expr = &e;
+		batch._matches = calloc(numrecords/8 + 1, 1);
+		pbg_evaluate_parallel(&e, err, &batch, numthreads);
+		pbg_free(&e);
+		batch._filter = batch._matches;
+		for(i = 0; i < numthreads; i++)
+			par._resolved[i] = 0;
+	}
+	batch._matches = calloc(numrecords/8 + 1, 1);
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	par._expr = &e;
+	batch._emit = emit_record;
+	numtrue = pbg_evaluate_parallel(&e, err, &batch, numthreads);
+	*resolved = 0;
+	for(i = 0; i < numthreads; i++)
+		*resolved += par._resolved[i];
+	/* Every record of the filter is emitted once, the bitsets agree with the
+	 * results, and so does evaluating each record on its own. Others are not
+	 * emitted and are in neither bitset. */
+	vars = malloc((pbg_numvars(&e)+1) * sizeof(pbg_field));
+	pass = 1;
+	for(i = 0; i < numrecords; i++) {
+		par._record = i;
+		bit = 1 << (i%8);
+		if(batch._filter != NULL && !(batch._filter[i/8] & bit)) {
+			pass = pass && par._emitted[i] == 0 && 
+					!(batch._matches[i/8] & bit) && !(batch._errors[i/8] & bit);
+			continue;
+		}
+		pass = pass && par._emitted[i] == 1 && 
+				!(batch._matches[i/8] & bit) == (par._results[i] != PBG_TRUE) &&
+				!(batch._errors[i/8] & bit) == (par._results[i] != PBG_ERROR) &&
+				par._results[i] == pbg_evaluate_lazy(&e, &single, vars, resolve_single, &par);
+	}
+	free(vars);
+	free(par._numbers);
+	free(par._resolved);
+	free(par._results);
+	free(par._emitted);
+	free(batch._matches);
+	free(batch._errors);
+	free(batch._filter);
+	pbg_free(&e);
+	if(err->_type != PBG_ERR_NONE)
+		return (pass && expect == -1) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (pass && expect == numtrue) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_ruleset_parallel(pbg_error* err, char* strs, char* filter, 
+		long numrecords, int numthreads, long expect, int fails)
+{
+	pbg_ruleset rs;
+	pbg_expr e, rules[8];
+	pbg_batch batch;
+	pbg_error single;
+	pbg_field vars[16];
+	test_parallel_ctx par;
+	char buf[256], *str, *end;
+	long nummatched, i;
+	int j, numrules, match, pass, failed, bit;
+	
+	/* Parse each rule of the ';' separated list, as for test_ruleset. */
+	strcpy(buf, strs);
+	for(str = buf, numrules = 0; str != NULL && numrules < 8; numrules++) {
+		if((end = strchr(str, ';')) != NULL)
+			*end++ = '\0';
+		pbg_parse(rules + numrules, err, str);
+		if(err->_type != PBG_ERR_NONE) {
+			for(j = 0; j < numrules; j++) pbg_free(rules + j);
+			return PBG_TEST_FAIL;
+		}
+		str = end;
+	}
+	pbg_ruleset_init(&rs, err, rules, NULL, numrules);
+	if(err->_type != PBG_ERR_NONE || pbg_ruleset_numvars(&rs) > 16) {
+		for(j = 0; j < numrules; j++) pbg_free(rules + j);
+		return PBG_TEST_FAIL;
+	}
+	
+	par._numbers = malloc(2*numthreads * sizeof(pbg_lt_number));
+	par._resolved = calloc(numthreads, sizeof(long));
+	par._results = malloc(numrecords + 1);
+	par._emitted = calloc(numrecords + 1, 1);
+	par._ruleset = NULL;
+	batch._numrecords = numrecords;
+	batch._resolve = resolve_record;
+	batch._ctx = &par;
+	batch._errors = calloc(numrecords/8 + 1, 1);
+	batch._filter = NULL;
+	batch._emit = NULL;
+	/* Evaluate the filter first, into a bitset of its own. */
+	pass = 1;
+	if(filter != NULL) {
+		pbg_parse(&e, err, filter);
+		pass = (err->_type == PBG_ERR_NONE);
+		par._expr = &e;
+		batch._matches = calloc(numrecords/8 + 1, 1);
+		if(pass)
+			pbg_evaluate_parallel(&e, err, &batch, numthreads);
+		pbg_free(&e);
+		batch._filter = batch._matches;
+	}
+	batch._matches = calloc(numrecords/8 + 1, 1);
+	par._ruleset = &rs;
+	batch._emit = emit_record;
+	nummatched = pass ? pbg_ruleset_parallel(&rs, err, &batch, numthreads) : 0;
+	
+	/* Every record of the filter is emitted once with the rule matched by
+	 * pbg_ruleset_evaluate, and is set in the bitset of errors only if no 
+	 * rule matched and some failed. Others are not emitted and are in 
+	 * neither bitset. */
+	failed = 0;
+	for(i = 0; pass && i < numrecords; i++) {
+		bit = 1 << (i%8);
+		if(batch._filter != NULL && !(batch._filter[i/8] & bit)) {
+			pass = par._emitted[i] == 0 && 
+					!(batch._matches[i/8] & bit) && !(batch._errors[i/8] & bit);
+			continue;
+		}
+		for(j = 0; j < pbg_ruleset_numvars(&rs); j++)
+			vars[j] = resolve_record(&par, 0, i, j);
+		match = pbg_ruleset_evaluate(&rs, &single, vars, NULL);
+		failed = failed || single._type != PBG_ERR_NONE;
+		pass = par._emitted[i] == 1 && par._results[i] == match &&
+				!(batch._matches[i/8] & bit) == (match < 0) &&
+				!(batch._errors[i/8] & bit) == 
+				(match >= 0 || single._type == PBG_ERR_NONE);
+	}
+	pass = pass && (err->_type != PBG_ERR_NONE) == failed;
+	free(par._numbers);
+	free(par._resolved);
+	free(par._results);
+	free(par._emitted);
+	free(batch._matches);
+	free(batch._errors);
+	free(batch._filter);
+	pbg_ruleset_free(&rs);
+	for(j = 0; j < numrules; j++)
+		pbg_free(rules + j);
+	return (pass && failed == fails && nummatched == expect) ? 
+			PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+#endif
+
+int test_canonical(pbg_error* err, char* str1, char* str2, int same)
+{
+	pbg_expr e1, e2;
+	unsigned char h1[PBG_HASH_SIZE], h2[PBG_HASH_SIZE];
+	int output, equal, pass;
+	pbg_parse(&e1, err, str1);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	pbg_parse(&e2, err, str2);
+	if(err->_type != PBG_ERR_NONE) {
+		pbg_free(&e1);
+		return PBG_TEST_FAIL;
+	}
+	output = pbg_evaluate(&e1, err, dict);
+	if(err->_type != PBG_ERR_NONE)
+		output = PBG_ERROR;
+	pbg_canonicalize(&e1, err);
+	pass = (err->_type == PBG_ERR_NONE);
+	pbg_canonicalize(&e2, err);
+	pass = pass && (err->_type == PBG_ERR_NONE);
+	/* Canonicalizing must not change results, errors aside. */
+	if(pass && output != PBG_ERROR) {
+		pass = (pbg_evaluate(&e1, err, dict) == output);
+		pbg_error_free(err);
+	}
+	pbg_hash(&e1, err, h1);
+	pbg_hash(&e2, err, h2);
+	equal = pbg_equal(&e1, &e2, err);
+	pbg_free(&e1);
+	pbg_free(&e2);
+	if(!pass || equal == PBG_ERROR)
+		return PBG_TEST_FAIL;
+	if(same)
+		pass = (equal == PBG_TRUE && memcmp(h1, h2, PBG_HASH_SIZE) == 0);
+	else
+		pass = (equal == PBG_FALSE && memcmp(h1, h2, PBG_HASH_SIZE) != 0);
+	return pass ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_zone(pbg_error* err, char* str, char* block, int expect)
+{
+	pbg_expr e, values[4][8];
+	pbg_field fields[4][8], vars[4];
+	pbg_zone zones[4];
+	char buf[256], *names[4], *tok;
+	int numvalues[4], numcols, numrec, col, i, r, result, anytrue, alltrue;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE || e._numvars > 4)
+		return PBG_TEST_FAIL;
+	
+	/* Split the block into columns, and parse each value. */
+	strcpy(buf, block);
+	numcols = 0;
+	for(tok = strtok(buf, " ;"); tok != NULL; tok = strtok(NULL, " ;")) {
+		if(tok[0] == '[') {
+			names[numcols] = tok;
+			numvalues[numcols++] = 0;
+			continue;
+		}
+		i = numvalues[numcols-1]++;
+		fields[numcols-1][i] = pbg_make_null();
+		if(strcmp(tok, "NULL") != 0) {
+			pbg_parse(&values[numcols-1][i], err, tok);
+			fields[numcols-1][i] = values[numcols-1][i]._constants[0];
+		}
+	}
+	numrec = numvalues[0];
+	
+	/* Gather the statistics of each variable. */
+	for(i = 0; i < e._numvars; i++) {
+		zones[i]._min = zones[i]._max = pbg_make_null();
+		zones[i]._nulls = zones[i]._count = numrec;
+		for(col = 0; col < numcols; col++)
+			if(strncmp(names[col]+1, e._variables[i]._data, e._variables[i]._int) == 0 &&
+					names[col][e._variables[i]._int+1] == ']')
+				break;
+		for(r = 0; col < numcols && r < numrec; r++) {
+			if(fields[col][r]._type == PBG_NULL)
+				continue;
+			if(zones[i]._nulls-- == numrec)
+				zones[i]._min = zones[i]._max = fields[col][r];
+			if(zone_less(fields[col] + r, &zones[i]._min))
+				zones[i]._min = fields[col][r];
+			if(zone_less(&zones[i]._max, fields[col] + r))
+				zones[i]._max = fields[col][r];
+			/* Values of mixed types leave the bounds unknown. */
+			if(fields[col][r]._type != zones[i]._min._type && 
+					!zone_less(fields[col] + r, &zones[i]._min) &&
+					!zone_less(&zones[i]._min, fields[col] + r))
+				zones[i]._min = zones[i]._max = pbg_make_null();
+		}
+	}
+	result = pbg_evaluate_zone(&e, err, zones);
+	
+	/* The answer must agree with every record. */
+	anytrue = 0, alltrue = 1;
+	for(r = 0; r < numrec; r++) {
+		for(i = 0; i < e._numvars; i++) {
+			vars[i] = pbg_make_null();
+			for(col = 0; col < numcols; col++)
+				if(strncmp(names[col]+1, e._variables[i]._data, e._variables[i]._int) == 0 &&
+						names[col][e._variables[i]._int+1] == ']')
+					vars[i] = fields[col][r];
+		}
+		if(pbg_evaluate_vars(&e, err, vars) == PBG_TRUE && err->_type == PBG_ERR_NONE)
+			anytrue = 1;
+		else
+			alltrue = 0;
+		pbg_error_free(err);
+	}
+	for(col = 0; col < numcols; col++)
+		for(r = 0; r < numvalues[col]; r++)
+			if(fields[col][r]._type != PBG_NULL)
+				pbg_free(&values[col][r]);
+	pbg_free(&e);
+	if((result == PBG_NEVER && anytrue) || (result == PBG_ALWAYS && !alltrue))
+		return PBG_TEST_FAIL;
+	return (result == expect) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+/* Orders two values of a block, for test_zone. FALSE precedes TRUE. */
+int zone_less(pbg_field* a, pbg_field* b)
+{
+	pbg_lt_date* da, *db;
+	int n;
+	if(a->_type != b->_type || a->_type == PBG_LT_TRUE || 
+			a->_type == PBG_LT_FALSE)
+		return a->_type == PBG_LT_FALSE && b->_type == PBG_LT_TRUE;
+	if(a->_type == PBG_LT_NUMBER)
+		return ((pbg_lt_number*) a->_data)->_val < ((pbg_lt_number*) b->_data)->_val;
+	if(a->_type == PBG_LT_DATE) {
+		da = a->_data, db = b->_data;
+		return da->_YYYY * 10000 + da->_MM * 100 + da->_DD < 
+				db->_YYYY * 10000 + db->_MM * 100 + db->_DD;
+	}
+	n = memcmp(a->_data, b->_data, (a->_int < b->_int) ? a->_int : b->_int);
+	return n < 0 || (n == 0 && a->_int < b->_int);
+}
+
+int test_partial(pbg_error* err, char* str, int specialize, char* residual,
+		int expect)
+{
+	pbg_expr e, r, want;
+	pbg_field vars[8], rvars[8];
+	pbg_lt_number numbers[8], rnumbers[8];
+	pbg_error_type partial, ea, eb;
+	int result, round, a, b, ok;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	if(specialize)
+		pbg_specialize(&e, err, schema);
+	if(err->_type != PBG_ERR_NONE) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	result = pbg_partial_evaluate(&e, err, partial_dict, &r);
+	if(result == PBG_ERROR) {
+		pbg_free(&e);
+		ok = (residual == NULL && err->_type != PBG_ERR_NONE);
+		return (ok && expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	}
+	partial = err->_type;
+	ok = (result == expect && residual != NULL);
+	
+	/* The residual must be as expected... */
+	if(ok) {
+		pbg_parse(&want, err, residual);
+		ok = (err->_type == PBG_ERR_NONE);
+		if(ok) {
+			ok = (pbg_equal(&r, &want, err) == PBG_TRUE);
+			pbg_free(&want);
+		}
+	}
+	
+	/* ...and agree with the expression however the unknowns are bound. */
+	for(round = 0; ok && round < 6; round++) {
+		partial_vars(&e, vars, numbers, round);
+		partial_vars(&r, rvars, rnumbers, round);
+		a = pbg_evaluate_vars(&e, err, vars);
+		ea = err->_type;
+		pbg_error_free(err);
+		b = pbg_evaluate_vars(&r, err, rvars);
+		eb = (err->_type != PBG_ERR_NONE) ? err->_type : partial;
+		pbg_error_free(err);
+		ok = (a == b && ea == eb);
+	}
+	pbg_free(&e);
+	pbg_free(&r);
+	return ok ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+/* Leaves [x], [y], [z], and [s] unknown, for test_partial. */
+pbg_field partial_dict(char* key, int n)
+{
+	if(strchr("xyzs", key[0]) != NULL)
+		return pbg_make_unbound();
+	return dict(key, n);
+}
+
+/* Binds the variables of an expression for test_partial: those known to 
+ * partial_dict as dict does, and the unknown ones to NULL, 3, 7, TRUE, 'm', 
+ * or 'x' depending on the round. */
+void partial_vars(pbg_expr* e, pbg_field* vars, pbg_lt_number* numbers, 
+		int round)
+{
+	char* name;
+	int i;
+	for(i = 0; i < pbg_numvars(e) && i < 8; i++) {
+		name = pbg_var_name(e, i, NULL);
+		if(name[0] == 'a' || name[0] == 'b')
+			vars[i] = pbg_init_number(numbers+i, 5.0);
+		else if(name[0] == 'c')
+			vars[i] = pbg_init_number(numbers+i, 6.0);
+		else if(strchr("xyzs", name[0]) == NULL || round == 0)
+			vars[i] = pbg_make_null();
+		else if(round == 1 || round == 2)
+			vars[i] = pbg_init_number(numbers+i, (round == 1) ? 3.0 : 7.0);
+		else if(round == 3)
+			vars[i] = pbg_make_bool(1);
+		else
+			vars[i] = pbg_init_string((round == 4) ? "m" : "x", 1);
+	}
+}
+
+int test_bdd(pbg_error* err, char* str, int maxnodes, int numnodes)
+{
+	pbg_expr e;
+	pbg_bdd bdd;
+	pbg_error treeerr;
+	pbg_field vars[5];
+	pbg_lt_number numbers[5];
+	int i, n, v, ok, tree, result;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	if(e._numvars > 5) {
+		pbg_free(&e);
+		return PBG_TEST_FAIL;
+	}
+	pbg_bdd_compile(&bdd, err, &e, maxnodes);
+	ok = (err->_type == PBG_ERR_NONE && bdd._numnodes == numnodes && 
+			(bdd._nodes == NULL) == (numnodes == 0));
+	
+	/* Count through every binding of the variables, in base 5. */
+	for(n = 1, i = 0; i < e._numvars; i++)
+		n *= 5;
+	while(ok && n-- > 0) {
+		for(i = 0, v = n; i < e._numvars; i++, v /= 5) {
+			if(v % 5 == 0) vars[i] = pbg_make_null();
+			else if(v % 5 < 3) vars[i] = pbg_make_bool(v % 5 == 1);
+			else vars[i] = pbg_init_number(numbers+i, (v % 5 == 3) ? 3.0 : 7.0);
+		}
+		tree = pbg_evaluate_vars(&e, &treeerr, vars);
+		result = pbg_bdd_evaluate(&bdd, err, vars);
+		if(treeerr._type != PBG_ERR_NONE)
+			ok = (err->_type == treeerr._type && err->_line == treeerr._line);
+		else
+			ok = (err->_type == PBG_ERR_NONE && result == tree);
+		pbg_error_free(&treeerr);
+		pbg_error_free(err);
+	}
+	pbg_bdd_free(&bdd);
+	pbg_free(&e);
+	return ok ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_match(pbg_error* err, char* str, char* subject, int compiled, 
+		int expect)
+{
+	return test_match_r(err, str, subject, compiled, expect, 1);
+}
+
+int test_match_r(pbg_error* err, char* str, char* subject, int compiled, 
+		int expect, int compile)
+{
+	pbg_expr e;
+	pbg_error plainerr;
+	pbg_field vars[8];
+	pbg_lt_number numbers[8];
+	char* name;
+	int converted[8];
+	int i, n, output, plain, pass;
+	pbg_parse(&e, err, str);
+	if(err->_type != PBG_ERR_NONE)
+		return PBG_TEST_FAIL;
+	/* Bind [s] to the subject, [a]=5, and [t]=TRUE. Everything else is NULL. */
+	for(i = 0; i < pbg_numvars(&e) && i < 8; i++) {
+		name = pbg_var_name(&e, i, NULL);
+		if(strcmp(name, "s") == 0 && subject != NULL)
+			vars[i] = pbg_init_string(subject, strlen(subject));
+		else if(strcmp(name, "a") == 0)
+			vars[i] = pbg_init_number(numbers+i, 5.0);
+		else if(strcmp(name, "t") == 0)
+			vars[i] = pbg_make_bool(1);
+		else
+			vars[i] = pbg_make_null();
+	}
+	output = pbg_evaluate_vars(&e, err, vars);
+	
+	/* Evaluate again with the patterns tested in turn. */
+	for(i = n = 0; i < e._numconst && n < 8; i++)
+		if(e._constants[i]._type >= PBG_AC_PFX && 
+				e._constants[i]._type <= PBG_AC_CONT) {
+			e._constants[i]._type += PBG_OP_PFX - PBG_AC_PFX;
+			converted[n++] = i;
+		}
+	plain = pbg_evaluate_vars(&e, &plainerr, vars);
+	for(i = 0; i < n; i++)
+		e._constants[converted[i]]._type += PBG_AC_PFX - PBG_OP_PFX;
+	pass = (n == compiled && plain == output && plainerr._type == err->_type);
+	pbg_error_free(&plainerr);
+	if(pass && compile)
+		pass = test_compile(&e, str, vars, NULL, output, err->_type) == 
+				PBG_TEST_PASS;
+	pbg_free(&e);
+	if(!pass)
+		return PBG_TEST_FAIL;
+	if(err->_type != PBG_ERR_NONE)
+		return (expect == PBG_ERROR) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	return (expect == output) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_match_random(pbg_error* err, char* op, int rounds)
+{
+	char str[128], subject[16], patterns[8][4];
+	int i, j, n, len, numpatterns, expect;
+	srand(42);
+	for(i = 0; i < rounds; i++) {
+		/* Short patterns and subjects over two letters overlap often. */
+		numpatterns = 4 + rand() % 5;
+		sprintf(str, "(%s [s]", op);
+		for(j = expect = 0; j < numpatterns; j++) {
+			len = rand() % 4;
+			for(n = 0; n < len; n++)
+				patterns[j][n] = 'a' + rand() % 2;
+			patterns[j][len] = '\0';
+			sprintf(str + strlen(str), " '%s'", patterns[j]);
+		}
+		strcat(str, ")");
+		len = rand() % 12;
+		for(n = 0; n < len; n++)
+			subject[n] = 'a' + rand() % 2;
+		subject[len] = '\0';
+		for(j = 0; j < numpatterns; j++) {
+			n = strlen(patterns[j]);
+			if((op[0] == '^' && strncmp(subject, patterns[j], n) == 0) ||
+					(op[0] == '$' && n <= len && 
+					strcmp(subject + len-n, patterns[j]) == 0) ||
+					(op[0] == '*' && strstr(subject, patterns[j]) != NULL))
+				expect = PBG_TRUE;
+		}
+		if(test_match_r(err, str, subject, 1, expect, 0) != PBG_TEST_PASS)
+			return PBG_TEST_FAIL;
+	}
+	return PBG_TEST_PASS;
+}
+
+int test_match_many(pbg_error* err, int numpatterns, char* subject, 
+		int expect)
+{
+	char* str;
+	int i, n, result;
+	str = malloc(16 * (numpatterns+1));
+	if(str == NULL)
+		return PBG_TEST_FAIL;
+	n = sprintf(str, "(*= [s]");
+	for(i = 0; i < numpatterns; i++)
+		n += sprintf(str + n, " ',%d,'", i);
+	strcpy(str + n, ")");
+	result = test_match_r(err, str, subject, 1, expect, 0);
+	free(str);
+	return result;
+}
+
+int test_number(char* str, int valid)
+{
+	char* copy;
+	double value, expect;
+	int n, result;
+	/* Read from an unterminated copy, so reading past it is caught. */
+	n = strlen(str);
+	copy = malloc(n+1);
+	if(copy == NULL)
+		return PBG_TEST_FAIL;
+	memcpy(copy, str, n);
+	value = -1.0;
+	result = pbg_read_number(copy, n, &value);
+	free(copy);
+	if(result != valid || result != pbg_read_number(str, n, NULL))
+		return PBG_TEST_FAIL;
+	if(!valid)
+		return (value == -1.0) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+	expect = strtod(str, NULL);
+	return (memcmp(&value, &expect, sizeof(double)) == 0) ? 
+			PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
+int test_number_random(int rounds)
+{
+	char str[64];
+	int i, n, len;
+	srand(44);
+	for(i = 0; i < rounds; i++) {
+		/* Significands of up to 20 digits, with a point or an exponent. */
+		n = sprintf(str, "%s%d", (rand() % 2) ? "-" : "", 1 + rand() % 9);
+		for(len = rand() % 20; len > 0; len--)
+			str[n++] = '0' + rand() % 10;
+		if(rand() % 2) {
+			str[n++] = '.';
+			for(len = 1 + rand() % 8; len > 0; len--)
+				str[n++] = '0' + rand() % 10;
+		}
+		str[n] = '\0';
+		if(rand() % 2)
+			sprintf(str+n, "e%d", rand() % 80 - 40);
+		if(test_number(str, 1) != PBG_TEST_PASS)
+			return PBG_TEST_FAIL;
+	}
+	return PBG_TEST_PASS;
+}
+
+int test_bits(char op, char* a, char* b, char* expect)
+{
+	unsigned char x[32], y[32], z[32];
+	long i, n, count;
+	n = strlen(expect);
+	memset(x, 0, sizeof(x));
+	memset(y, 0, sizeof(y));
+	memset(z, 0xFF, sizeof(z));
+	for(i = 0; i < n; i++) {
+		x[i/8] |= (a[i] == '1') << (i%8);
+		y[i/8] |= (b[i] == '1') << (i%8);
+	}
+	if(op == '&') pbg_bits_and(z, x, y, n);
+	else if(op == '|') pbg_bits_or(z, x, y, n);
+	else pbg_bits_andnot(z, x, y, n);
+	count = 0;
+	for(i = 0; i < n; i++) {
+		if(((z[i/8] >> (i%8)) & 1) != (expect[i] == '1'))
+			return PBG_TEST_FAIL;
+		count += (expect[i] == '1');
+	}
+	/* The result may also be an operand. */
+	if(op == '&') pbg_bits_and(x, x, y, n);
+	else if(op == '|') pbg_bits_or(x, x, y, n);
+	else pbg_bits_andnot(x, x, y, n);
+	for(i = 0; i < n; i++)
+		if(((x[i/8] >> (i%8)) & 1) != (expect[i] == '1'))
+			return PBG_TEST_FAIL;
+	return (pbg_bits_count(z, n) == count) ? PBG_TEST_PASS : PBG_TEST_FAIL;
+}
+
 void pbg_err_print(pbg_error* err)
 {
 	if(err->_type != PBG_ERR_NONE) {
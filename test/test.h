@@ -14,7 +14,7 @@
 void pbg_err_print(pbg_error* err);
 
 #define check(test) do { int _res = (test); if(_res != PBG_TEST_PASS) { _numfail++; printf("-failed: %s:%d\n", __FILE__, __LINE__); pbg_err_print(&err); } err._type=PBG_ERR_NONE; pbg_error_free(&err); } while(0)
-#define init_test() pbg_error err; int _numfail; err._type = PBG_ERR_NONE; err._line = 0; err._file = NULL; err._int = 0; err._data = NULL; _numfail = 0;
+#define init_test() pbg_error err; int _numfail; err._type = PBG_ERR_NONE; err._line = 0; err._file = NULL; err._msg = NULL; err._str = NULL; err._i = 0; err._int = 0; _numfail = 0;
 #define end_test() if(err._type != PBG_ERR_NONE) pbg_error_free(&err); return _numfail
 #define summ_test(name,tester) do { int _numfail = (tester); if(_numfail != 0) printf("%s\tfailed %d tests!\n", (name), _numfail); else printf("%s\tpassed!\n", (name)); } while(0)
 
@@ -40,4 +40,554 @@ int test_evaluate(pbg_error* err, char* str,
 		pbg_field (*dict)(char*,int), int expect);
 
 
+/**
+ * Tests pbg_numvars.
+ * @param err     Container to store parse errors to, if any.
+ * @param str     String expression to parse.
+ * @param expect  Expected number of distinct variables.
+ * @return PBG_TEST_PASS if pbg_numvars matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_numvars(pbg_error* err, char* str, int expect);
+
+/**
+ * Tests pbg_evaluate_vars with borrowed fields binding [a]=5, [b]=5, [c]=6,
+ * [s]='hi', [d]=2018-10-12, and [t]=TRUE.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param expect  Expected result of evaluation.
+ * @return PBG_TEST_PASS if evaluation matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_evaluate_vars(pbg_error* err, char* str, int expect);
+
+/**
+ * Tests pbg_evaluate_lazy with a resolver which resolves every variable to 5.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param expect  Expected result of evaluation.
+ * @param calls   Expected number of variables resolved.
+ * @return PBG_TEST_PASS if evaluation matches expect and calls,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_evaluate_lazy(pbg_error* err, char* str, int expect, int calls);
+
+/**
+ * Tests a resumable evaluation, supplying each variable as it is asked for
+ * with the values of test_evaluate_vars. The result must be that of 
+ * pbg_evaluate_vars.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param str         String expression to parse.
+ * @param specialize  Whether to specialize the expression with schema first.
+ * @param asks        First letters of the names of the variables expected to
+ *                    be asked for, in order.
+ * @param expect      Expected result of evaluation.
+ * @return PBG_TEST_PASS if the evaluation asks for asks and matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_eval(pbg_error* err, char* str, int specialize, char* asks, 
+		int expect);
+
+/**
+ * Tests many resumable evaluations of the same expression interleaved on one
+ * thread, each of which must give the result of pbg_evaluate_vars.
+ * @param err       Container to store parse & evaluation errors to, if any.
+ * @param str       String expression to parse.
+ * @param numevals  Number of evaluations, at most 100.
+ * @return PBG_TEST_PASS if every evaluation gives the expected result,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_eval_many(pbg_error* err, char* str, int numevals);
+
+/**
+ * Tests pbg_evaluate_multiget on a batch of records resolved by multiget, 
+ * checking the result of each record against pbg_evaluate_vars.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param str         String expression to parse.
+ * @param numrecords  Number of records, at most 64.
+ * @param numtrue     Expected number of TRUE records.
+ * @param numerrors   Expected number of records which fail.
+ * @param calls       Expected number of calls to multiget.
+ * @return PBG_TEST_PASS if the batch evaluates as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_multiget(pbg_error* err, char* str, long numrecords, long numtrue, 
+		long numerrors, int calls);
+
+/**
+ * Tests pbg_ruleset_evaluate on rules bound as for test_evaluate_vars, 
+ * checking the match against evaluating every rule with pbg_evaluate_vars.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param strs        String expressions to parse, separated by ';'; at most 8.
+ * @param priorities  Priorities of the rules, or NULL.
+ * @param specialize  Whether to specialize the rules with schema first.
+ * @param expect      Expected rule to match, or -1.
+ * @param skipped     Expected number of rules skipped.
+ * @param fails       Whether a rule is expected to fail.
+ * @return PBG_TEST_PASS if the rule set evaluates as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_ruleset(pbg_error* err, char* strs, int* priorities, int specialize,
+		int expect, int skipped, int fails);
+
+/**
+ * Tests a rule set of rules keyed on a single variable [k], and a last rule
+ * matching anything, for which only one rule is ever evaluated.
+ * @param err       Container to store parse & evaluation errors to, if any.
+ * @param numrules  Number of rules.
+ * @param value     Value of [k].
+ * @return PBG_TEST_PASS if the rule set evaluates as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_ruleset_many(pbg_error* err, int numrules, int value);
+
+/**
+ * Tests pbg_evaluate_budget on an expression bound as for test_evaluate_vars,
+ * checking that evaluations within their budget, and within pbg_cost(e), 
+ * give the result of pbg_evaluate_vars.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param visits  Most fields to begin, or -1.
+ * @param nsec    Most nanoseconds to evaluate for, or 0.
+ * @param expect  Expected result of evaluation.
+ * @param spent   Whether the budget is expected to run out.
+ * @return PBG_TEST_PASS if evaluation matches expect and spent,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_budget(pbg_error* err, char* str, long visits, long nsec, 
+		int expect, int spent);
+
+/**
+ * Tests pbg_evaluate_budget and pbg_cost on depth nested NOTs of [t]=TRUE.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param depth   Number of NOTs.
+ * @param visits  Most fields to begin, or -1.
+ * @param nsec    Most nanoseconds to evaluate for, or 0.
+ * @param spent   Whether the budget is expected to run out.
+ * @return PBG_TEST_PASS if evaluation matches spent,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_budget_deep(pbg_error* err, int depth, long visits, long nsec, 
+		int spent);
+
+/**
+ * Tests pbg_cost.
+ * @param err   Container to store parse errors to, if any.
+ * @param str   String expression to parse.
+ * @param cost  Expected cost.
+ * @return PBG_TEST_PASS if the cost matches, PBG_TEST_FAIL if not.
+ */
+int test_cost(pbg_error* err, char* str, long cost);
+
+/**
+ * Tests pbg_csv_evaluate. The delimiter is ';' if the header contains one,
+ * and ',' otherwise.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param header  CSV header naming the columns.
+ * @param record  CSV record to evaluate.
+ * @param str     String expression to parse.
+ * @param expect  Expected result of evaluation.
+ * @return PBG_TEST_PASS if evaluation matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_csv(pbg_error* err, char* header, char* record, char* str, int expect);
+
+/**
+ * Tests pbg_arrow_evaluate against the batch described by suite_arrow.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param offset  Offset of the batch into its columns.
+ * @param expect  Expected result of each row of the batch: 'T' for TRUE, 'F'
+ *                for FALSE, and '.' for rows which fail to evaluate. NULL if 
+ *                binding the expression is expected to fail.
+ * @return PBG_TEST_PASS if the result matches expect, including its count of
+ *         TRUE rows, PBG_TEST_FAIL if not.
+ */
+int test_arrow(pbg_error* err, char* str, int offset, char* expect);
+
+/**
+ * Tests the streaming parser by feeding it the expression in chunks, then
+ * evaluating the result with the test dictionary.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param chunk   Size of the chunks to feed.
+ * @param expect  Expected result of evaluation.
+ * @return PBG_TEST_PASS if evaluation matches expect and the tree matches 
+ *         that of pbg_parse, PBG_TEST_FAIL if not.
+ */
+int test_parser(pbg_error* err, char* str, int chunk, int expect);
+
+/**
+ * Tests parsing and evaluating a deeply nested expression, made of depth
+ * copies of open, then leaf, then depth copies of close. The expression is
+ * parsed by both pbg_parse_n and the streaming parser, then evaluated with 
+ * the test dictionary.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param open    Text opening each level.
+ * @param leaf    Text at the deepest level.
+ * @param close   Text closing each level.
+ * @param depth   Number of levels.
+ * @param expect  Expected result of evaluation.
+ * @return PBG_TEST_PASS if both evaluations match expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_deep(pbg_error* err, char* open, char* leaf, char* close, int depth, 
+		int expect);
+
+/**
+ * Tests an expression referencing many distinct variables, each twice. Every
+ * variable must be stored once, in order of first appearance.
+ * @param err      Container to store parse & evaluation errors to, if any.
+ * @param numvars  Number of distinct variables.
+ * @return PBG_TEST_PASS if the variables are deduplicated and evaluation 
+ *         yields TRUE, PBG_TEST_FAIL if not.
+ */
+int test_wide(pbg_error* err, int numvars);
+
+/**
+ * Tests pbg_error_format on the error raised by parsing, then evaluating with 
+ * the test dictionary, the given expression. The text is also formatted into
+ * buffers of every size up to its length, which must yield its prefixes.
+ * @param err     Container to store parse & evaluation errors to.
+ * @param str     String expression to parse.
+ * @param suffix  Expected end of the formatted text.
+ * @return PBG_TEST_PASS if an error occurs and is formatted as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_error(pbg_error* err, char* str, char* suffix);
+
+/**
+ * Tests pbg_specialize with the test schema, then evaluates the specialized
+ * expression both lazily, with every variable 5, and with the test 
+ * dictionary. Unless an error is expected, the latter must match evaluating
+ * the expression as parsed.
+ * @param err      Container to store parse & evaluation errors to, if any.
+ * @param str      String expression to parse.
+ * @param changed  Expected number of operators lowered or folded, or -1 if 
+ *                 specializing must fail.
+ * @param expect   Expected result of evaluation with the test dictionary.
+ * @param lazy     Expected result of lazy evaluation.
+ * @return PBG_TEST_PASS if specializing and evaluating match expectations,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_specialize(pbg_error* err, char* str, int changed, int expect, 
+		int lazy);
+
+/**
+ * Tests that comparisons of variables to constants are fused when parsed, 
+ * then evaluates the expression as test_evaluate_vars does.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param fused   Expected number of fused comparisons.
+ * @param expect  Expected result of evaluation.
+ * @return PBG_TEST_PASS if as many comparisons are fused as expected and 
+ *         evaluation matches expect, PBG_TEST_FAIL if not.
+ */
+int test_fuse(pbg_error* err, char* str, int fused, int expect);
+
+/**
+ * Tests pbg_compile on an expression evaluated by another test, which checks
+ * that measuring and writing the source agree. Built with PBG_CORPUS, the
+ * source is also printed for test/compiled.c; built with PBG_COMPILED, the
+ * compiled expression is evaluated and must agree with the interpreter.
+ * @param e       Expression to compile.
+ * @param str     String expression e was parsed from.
+ * @param vars    Variables e was evaluated with, or NULL.
+ * @param dict    Dictionary e was evaluated with, if vars is NULL.
+ * @param output  Result of the interpreter.
+ * @param type    Type of the error of the interpreter.
+ * @return PBG_TEST_PASS if compiling matches expectations,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_compile(pbg_expr* e, char* str, pbg_field* vars, 
+		pbg_field (*dict)(char*, int), int output, pbg_error_type type);
+
+/**
+ * Tests pbg_incr_evaluate. Every variable is bound to 5 and evaluated once,
+ * then the given variable is updated and the expression evaluated again.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param str     String expression to parse.
+ * @param var     Name of the variable to update.
+ * @param value   New value of the variable.
+ * @param expect  Expected result of the second evaluation.
+ * @param evals   Expected number of operators evaluated the second time.
+ * @return PBG_TEST_PASS if evaluation matches expect, evals, and a full
+ *         evaluation, PBG_TEST_FAIL if not.
+ */
+int test_incr(pbg_error* err, char* str, char* var, double value, 
+		int expect, long evals);
+
+#ifdef PBG_PROFILE
+/**
+ * Tests the statistics gathered by pbg_evaluate for a single field.
+ * @param err       Container to store parse & evaluation errors to, if any.
+ * @param str       String expression to parse.
+ * @param field     Index of the constant field to check, starting at 1.
+ * @param evals     Expected number of evaluations of the field.
+ * @param numtrue   Expected number of TRUE results.
+ * @param numfalse  Expected number of FALSE results.
+ * @param numerror  Expected number of ERROR results.
+ * @param span      Expected source text of the field.
+ * @return PBG_TEST_PASS if the statistics match,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_profile(pbg_error* err, char* str, int field, long evals, 
+		long numtrue, long numfalse, long numerror, char* span);
+#endif
+
+#ifdef PBG_THREADS
+/* Records of the tests of pbg_evaluate_parallel. */
+typedef struct {
+	pbg_expr*       _expr;     /* Expression being evaluated. */
+	pbg_ruleset*    _ruleset;  /* Rule set being matched, or NULL. */
+	pbg_lt_number*  _numbers;  /* Storage for numbers, two per thread. */
+	long*           _resolved; /* Number of variables resolved per thread. */
+	long            _record;   /* Record resolved by resolve_single. */
+	char*           _results;  /* Result of each record. */
+	char*           _emitted;  /* Number of times each record was emitted. */
+} test_parallel_ctx;
+
+/**
+ * Tests pbg_evaluate_parallel over records numbered 0 to numrecords-1, where
+ * record i binds [n]=i and [m]=i%3. Also checks that every record is emitted
+ * exactly once and that the bitsets of matches and errors agree with the
+ * results and with evaluating each record on its own.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param str         String expression to parse.
+ * @param numrecords  Number of records to evaluate.
+ * @param numthreads  Number of threads to evaluate with.
+ * @param expect      Expected number of TRUE records, or -1 for an error.
+ * @return PBG_TEST_PASS if evaluation matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_parallel(pbg_error* err, char* str, long numrecords, int numthreads, 
+		long expect);
+
+/**
+ * Tests pbg_evaluate_parallel on a single thread as test_parallel does, also
+ * checking how many variables were resolved.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param str         String expression to parse.
+ * @param numrecords  Number of records to evaluate.
+ * @param expect      Expected number of TRUE records, or -1 for an error.
+ * @param resolved    Expected number of variables resolved.
+ * @return PBG_TEST_PASS if evaluation matches expect and resolved,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_select(pbg_error* err, char* str, long numrecords, long expect, 
+		long resolved);
+
+/**
+ * Tests pbg_evaluate_parallel as test_parallel does, only evaluating the
+ * records for which a filter expression is TRUE. Also checks that no other
+ * record is emitted or set in the bitsets, and how many variables were 
+ * resolved.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param str         String expression to parse.
+ * @param filter      String expression of the records to evaluate.
+ * @param numrecords  Number of records to evaluate.
+ * @param numthreads  Number of threads to evaluate with.
+ * @param expect      Expected number of TRUE records, or -1 for an error.
+ * @param resolved    Expected number of variables resolved by str, or -1 to
+ *                    skip the check.
+ * @return PBG_TEST_PASS if evaluation matches expect and resolved,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_filter(pbg_error* err, char* str, char* filter, long numrecords, 
+		int numthreads, long expect, long resolved);
+
+/**
+ * Tests pbg_ruleset_parallel over the records of test_parallel, checking that
+ * every record is emitted once with the rule matched by pbg_ruleset_evaluate
+ * and that the bitsets of matches and errors agree with it.
+ * @param err         Container to store parse & evaluation errors to, if any.
+ * @param strs        Rules to parse, separated by ';'.
+ * @param filter      String expression of the records to match, or NULL to
+ *                    match all of them.
+ * @param numrecords  Number of records to match.
+ * @param numthreads  Number of threads to evaluate with.
+ * @param expect      Expected number of records which match a rule.
+ * @param fails       Whether some rule is expected to fail.
+ * @return PBG_TEST_PASS if matching agrees with expect and fails,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_ruleset_parallel(pbg_error* err, char* strs, char* filter, 
+		long numrecords, int numthreads, long expect, int fails);
+
+/**
+ * Helper function for test_parallel, test_select, and test_filter, which 
+ * also gives the number of variables resolved.
+ */
+int test_parallel_r(pbg_error* err, char* str, char* filter, long numrecords,
+		int numthreads, long expect, long* resolved);
+
+/* Reader of the tests of pbg_reload_publish, see reload_reader. */
+typedef struct {
+	pbg_reload*    _reload;  /* Rule set read. */
+	int            _reader;  /* Number of the reader. */
+	volatile int*  _done;    /* Set once the last version is published. */
+	long           _reads;   /* Number of snapshots evaluated. */
+	int            _failed;  /* Number of snapshots evaluated wrongly. */
+} test_reload_ctx;
+
+/**
+ * Tests a versioned rule set on a single thread, checking which versions 
+ * readers see and how many replaced versions are left as readers come and
+ * go.
+ * @param err  Container to store parse & evaluation errors to, if any.
+ * @return PBG_TEST_PASS if versions are freed as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_reload_hold(pbg_error* err);
+
+/**
+ * Tests a versioned rule set with readers evaluating it on their own threads
+ * while versions are published, see reload_publish and reload_reader. Each 
+ * snapshot must evaluate as its version does, and readers must never see an
+ * older version than they saw before.
+ * @param err          Container to store parse & evaluation errors to, if any.
+ * @param numreaders   Number of reader threads, at most 8.
+ * @param numversions  Number of versions to publish.
+ * @return PBG_TEST_PASS if every snapshot evaluates as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_reload(pbg_error* err, int numreaders, long numversions);
+#endif
+
+/**
+ * Tests pbg_canonicalize, pbg_hash, and pbg_equal on two expressions. Also 
+ * checks that canonicalizing the first does not change its result with dict.
+ * @param err   Container to store parse errors to, if any.
+ * @param str1  First string expression.
+ * @param str2  Second string expression.
+ * @param same  Whether the canonical expressions are expected to be equal.
+ * @return PBG_TEST_PASS if hashing and equality match same,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_canonical(pbg_error* err, char* str1, char* str2, int same);
+
+/**
+ * Tests pbg_evaluate_zone on a block of records, written as columns such as
+ * "[a] 1 NULL; [s] 'x' 'y'". The statistics of each variable are gathered 
+ * from its column, and every record is evaluated to check that the answer
+ * holds for the block.
+ * @param err     Container to store parse errors to, if any.
+ * @param str     String expression to test.
+ * @param block   Columns of values of the records of the block.
+ * @param expect  Expected answer: PBG_NEVER, PBG_ALWAYS, or PBG_MAYBE.
+ * @return PBG_TEST_PASS if the answer holds and is expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_zone(pbg_error* err, char* str, char* block, int expect);
+
+/**
+ * Tests pbg_partial_evaluate with the variables [x], [y], [z], and [s] 
+ * unknown and the rest given by dict. Both the expression and the residual 
+ * are then evaluated with the unknown variables bound to values of each type,
+ * and must agree on both their result and their error. An error stored by
+ * partial evaluation stands for one the residual no longer sets.
+ * @param err         Container to store parse errors to, if any.
+ * @param str         String expression to test.
+ * @param specialize  Whether to specialize the expression with schema first.
+ * @param residual    Expected residual, compared with pbg_equal, or NULL if 
+ *                    the expression must fail.
+ * @param expect      Expected result of partial evaluation.
+ * @return PBG_TEST_PASS if the result and residual are expected and agree,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_partial(pbg_error* err, char* str, int specialize, char* residual,
+		int expect);
+
+/**
+ * Tests pbg_bdd_compile and pbg_bdd_evaluate. The diagram must agree with 
+ * pbg_evaluate_vars, errors included, with every variable bound to each of 
+ * NULL, TRUE, FALSE, 3, and 7.
+ * @param err       Container to store parse errors to, if any.
+ * @param str       String expression to test.
+ * @param maxnodes  Most nodes the diagram may have.
+ * @param numnodes  Expected number of nodes, sinks included, or 0 if the 
+ *                  expression must be evaluated as a tree.
+ * @return PBG_TEST_PASS if the diagram is as expected and agrees,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_bdd(pbg_error* err, char* str, int maxnodes, int numnodes);
+
+/**
+ * Tests a string operator with [s] bound to the subject, [a]=5, and [t]=TRUE.
+ * The expression must agree with itself evaluated with the patterns tested in
+ * turn instead of by automata.
+ * @param err       Container to store parse & evaluation errors to, if any.
+ * @param str       String expression to test.
+ * @param subject   Value of [s], or NULL.
+ * @param compiled  Expected number of operators given an automaton.
+ * @param expect    Expected result of evaluation.
+ * @return PBG_TEST_PASS if the operators are compiled as expected, and the 
+ *         results agree and match expect, PBG_TEST_FAIL if not.
+ */
+int test_match(pbg_error* err, char* str, char* subject, int compiled, 
+		int expect);
+
+/**
+ * Helper function for test_match, test_match_random, and test_match_many, 
+ * which also tells whether to check the expression with test_compile.
+ */
+int test_match_r(pbg_error* err, char* str, char* subject, int compiled, 
+		int expect, int compile);
+
+/**
+ * Tests automata against patterns checked by the standard library, over
+ * random patterns and subjects of two letters.
+ * @param err     Container to store parse & evaluation errors to, if any.
+ * @param op      String operator to test: "^=", "$=", or "*=".
+ * @param rounds  Number of expressions to test.
+ * @return PBG_TEST_PASS if every result is as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_match_random(pbg_error* err, char* op, int rounds);
+
+/**
+ * Tests an automaton of many patterns, ",0,", ",1,", and so on, which must
+ * occur in the subject.
+ * @param err          Container to store parse & evaluation errors to.
+ * @param numpatterns  Number of patterns.
+ * @param subject      Value of [s].
+ * @param expect       Expected result of evaluation.
+ * @return PBG_TEST_PASS if the result matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_match_many(pbg_error* err, int numpatterns, char* subject, 
+		int expect);
+
+/**
+ * Tests pbg_read_number on an unterminated copy of the string, and checks 
+ * that its value is the one strtod gives, to the bit.
+ * @param str    NUMBER to read, terminated so strtod can read it too.
+ * @param valid  Whether str is a NUMBER.
+ * @return PBG_TEST_PASS if str is read as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_number(char* str, int valid);
+
+/**
+ * Tests pbg_read_number as test_number does on random NUMBERs, which are
+ * converted exactly or left to strtod.
+ * @param rounds  Number of NUMBERs to read.
+ * @return PBG_TEST_PASS if every NUMBER is read as expected,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_number_random(int rounds);
+
+/**
+ * Tests pbg_bits_and, pbg_bits_or, or pbg_bits_andnot on bitsets written as
+ * strings of '0' and '1', and pbg_bits_count on the result. Also checks that
+ * the result may be stored in the first operand.
+ * @param op      '&' for AND, '|' for OR, or '-' for ANDNOT.
+ * @param a       First operand.
+ * @param b       Second operand.
+ * @param expect  Expected result.
+ * @return PBG_TEST_PASS if the result matches expect,
+ *         PBG_TEST_FAIL if not.
+ */
+int test_bits(char op, char* a, char* b, char* expect);
+
 #endif /* __PBG_TEST_H__ */
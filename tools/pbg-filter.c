@@ -0,0 +1,977 @@
+#define _POSIX_C_SOURCE 200112L  /* pthreads, mmap */
+
+#include "../pbg.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*********************************************************
+ *                                                       *
+ * pbg-filter: filters newline-delimited JSON or CSV     *
+ * records with a pbg expression, using a pool of worker *
+ * threads                                               *
+ *                                                       *
+ *********************************************************/
+
+#define FILTER_USAGE \
+	"usage: pbg-filter [-j threads] [-c] [-d delim] EXPR [FILE]\n" \
+	"Writes each line of FILE (or stdin) holding a JSON object for which EXPR\n" \
+	"is TRUE. Top-level keys of the object are bound to the variables of EXPR:\n" \
+	"numbers are NUMBERs, true/false are BOOLs, strings of the form YYYY-MM-DD\n" \
+	"are DATEs, other strings are STRINGs, and null, nested values, and missing\n" \
+	"keys are NULL. Lines are written in their original order.\n"
+
+#define FILTER_OPTIONS \
+	"  -j threads  number of worker threads (default: one per CPU)\n" \
+	"  -c          read CSV records instead, whose first line names the\n" \
+	"              columns bound to the variables of EXPR; see pbg_csv_bind\n" \
+	"  -d delim    CSV field delimiter (default: ',')\n"
+
+/* Number of input bytes handed to a worker at once. */
+#define FILTER_CHUNK (1 << 20)
+
+/* Number of chunks in flight per worker thread. */
+#define FILTER_SLOTS_PER_THREAD 4
+
+/* Chunk states. */
+#define FILTER_FREE   0
+#define FILTER_FILLED 1
+#define FILTER_DONE   2
+
+/* Result of lines which are not JSON objects, distinct from PBG_ERROR. */
+#define FILTER_MALFORMED -2
+
+
+/*****************************
+ *                           *
+ * LOCAL STRUCTURE DIRECTORY *
+ *                           *
+ *****************************/
+
+/* A run of consecutive matching lines. */
+typedef struct {
+	char*   _start;  /* First byte of the run. */
+	size_t  _len;    /* Length of the run, including newlines. */
+} filter_run;
+
+/* A chunk of whole lines, and the lines of it which matched. */
+typedef struct {
+	char*        _buf;      /* First line of the chunk. */
+	size_t       _len;      /* Length of the chunk. */
+	char*        _own;      /* Buffer owned by the chunk when streaming. */
+	size_t       _owncap;   /* Capacity of _own. */
+	filter_run*  _runs;     /* Runs of matching lines. */
+	int          _numruns;  /* Number of runs. */
+	int          _caprun;   /* Capacity of _runs. */
+	long         _malformed; /* Number of lines which are not JSON objects. */
+	long         _errors;   /* Number of lines which could not be evaluated. */
+	int          _state;    /* FILTER_FREE, FILTER_FILLED, or FILTER_DONE. */
+} filter_chunk;
+
+/* State shared by the reader, the writer, and the workers. */
+typedef struct {
+	pbg_expr*        _expr;       /* Expression to filter with. */
+	char*            _header;     /* CSV header, or NULL for JSON. */
+	int              _headerlen;  /* Length of the CSV header. */
+	char             _delim;      /* CSV field delimiter. */
+	filter_chunk*    _chunks;     /* Ring of chunks. */
+	int              _numchunks;  /* Size of the ring. */
+	long             _filled;     /* Number of chunks filled by the reader. */
+	long             _taken;      /* Number of chunks taken by workers. */
+	int              _eof;        /* Set once no more chunks will be filled. */
+	pthread_mutex_t  _lock;
+	pthread_cond_t   _work;       /* Signalled when a chunk is filled. */
+	pthread_cond_t   _done;       /* Signalled when a chunk is done. */
+} filter_state;
+
+/* State private to each worker thread. */
+typedef struct {
+	pbg_expr*       _expr;     /* Expression to filter with. */
+	pbg_csv         _csv;      /* CSV binding, if reading CSV. */
+	int             _iscsv;    /* Set if reading CSV. */
+	pbg_field*      _vars;     /* Fields bound to the expression variables. */
+	pbg_lt_number*  _numbers;  /* Storage for NUMBER fields. */
+	pbg_lt_date*    _dates;    /* Storage for DATE fields. */
+	char*           _scratch;  /* Storage for unescaped keys and STRINGs. */
+	size_t          _scrcap;   /* Capacity of _scratch. */
+	size_t          _scrused;  /* Bytes of _scratch used by STRING fields. */
+} filter_worker;
+
+
+/****************************
+ *                          *
+ * LOCAL FUNCTION DIRECTORY *
+ *                          *
+ ****************************/
+
+/* READING & WRITING */
+int filter_usage(void);
+int filter_fill_mapped(filter_chunk* chunk, char** pos, char* end);
+int filter_fill_stream(filter_chunk* chunk, int fd, char** carry,
+		size_t* carrylen, size_t* carrycap);
+int filter_write(filter_chunk* chunk, FILE* out);
+int filter_run_all(filter_state* st, int numthreads, int fd, char* map,
+		size_t mapsz);
+
+/* WORKERS */
+void* filter_worker_main(void* arg);
+int filter_worker_init(filter_worker* w, filter_state* st);
+void filter_worker_free(filter_worker* w);
+void filter_chunk_process(filter_worker* w, filter_chunk* chunk);
+int filter_chunk_addrun(filter_chunk* chunk, char* start, size_t len);
+int filter_line(filter_worker* w, char* p, char* end);
+int filter_line_csv(filter_worker* w, char* p, char* end);
+char* filter_read_header(int fd, char** map, size_t* mapsz, int* len);
+
+/* JSON SCANNING */
+char* json_skip_ws(char* p, char* end);
+char* json_scan_string(char* p, char* end, int* escaped);
+char* json_skip_value(char* p, char* end);
+char* json_scan_scalar(char* p, char* end);
+size_t json_unescape(char* dst, char* src, size_t n);
+unsigned long json_hex4(char* s);
+int json_bind(filter_worker* w, int var, char* p, char* end);
+int json_isdate(char* str, size_t n);
+
+
+/********
+ *      *
+ * MAIN *
+ *      *
+ ********/
+
+int main(int argc, char** argv)
+{
+	filter_state st;
+	pbg_error err;
+	pbg_expr e;
+	struct stat sb;
+	char* expr, *path, *map, *start, *header;
+	size_t mapsz;
+	int i, fd, numthreads, status, csv, headerlen;
+	char delim;
+
+	/* Parse command line arguments. */
+	numthreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	expr = path = NULL;
+	csv = 0;
+	delim = ',';
+	for(i = 1; i < argc; i++) {
+		if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+			numthreads = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-c") == 0)
+			csv = 1;
+		else if(strcmp(argv[i], "-d") == 0 && i+1 < argc && argv[i+1][0] != '\0')
+			delim = argv[++i][0], csv = 1;
+		else if(strcmp(argv[i], "-h") == 0 ||
+				(argv[i][0] == '-' && argv[i][1] != '\0')) {
+			return filter_usage();
+		}else if(expr == NULL)
+			expr = argv[i];
+		else if(path == NULL)
+			path = argv[i];
+		else {
+			return filter_usage();
+		}
+	}
+	if(expr == NULL) {
+		return filter_usage();
+	}
+	if(numthreads < 1) numthreads = 1;
+
+	/* Compile the expression. */
+	pbg_parse(&e, &err, expr);
+	if(pbg_iserror(&err)) {
+		pbg_error_print(&err);
+		pbg_error_free(&err);
+		return 2;
+	}
+
+	/* Open the input. Regular files are mapped in place. */
+	fd = (path == NULL) ? 0 : open(path, O_RDONLY);
+	if(fd < 0) {
+		perror(path);
+		pbg_free(&e);
+		return 2;
+	}
+	map = NULL;
+	sb.st_size = 0;
+	if(fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0 &&
+			lseek(fd, 0, SEEK_CUR) == 0) {
+		map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(map == MAP_FAILED)
+			map = NULL;
+		else
+			posix_madvise(map, sb.st_size, POSIX_MADV_SEQUENTIAL);
+	}
+
+	/* CSV headers are echoed and bound by each worker. */
+	start = map;
+	mapsz = (map == NULL) ? 0 : (size_t) sb.st_size;
+	header = NULL;
+	headerlen = 0;
+	if(csv) {
+		header = filter_read_header(fd, &start, &mapsz, &headerlen);
+		if(header == NULL) {
+			fputs("pbg-filter: failed to read CSV header\n", stderr);
+			if(map != NULL) munmap(map, sb.st_size);
+			if(fd != 0) close(fd);
+			pbg_free(&e);
+			return 2;
+		}
+		fwrite(header, 1, headerlen, stdout);
+		fputc('\n', stdout);
+		/* Line terminators are not part of the header. */
+		if(headerlen != 0 && header[headerlen-1] == '\r') headerlen--;
+	}
+
+	/* Filter! */
+	st._expr = &e;
+	st._header = header;
+	st._headerlen = headerlen;
+	st._delim = delim;
+	status = filter_run_all(&st, numthreads, fd, start, mapsz);
+
+	/* Clean up. */
+	if(map == NULL) free(header);
+	if(map != NULL) munmap(map, sb.st_size);
+	if(fd != 0) close(fd);
+	pbg_free(&e);
+	return status;
+}
+
+
+/*********************
+ *                   *
+ * READING & WRITING *
+ *                   *
+ *********************/
+
+/**
+ * Prints the usage of the program.
+ * @return the exit status for a usage error.
+ */
+int filter_usage(void)
+{
+	fputs(FILTER_USAGE, stderr);
+	fputs(FILTER_OPTIONS, stderr);
+	return 2;
+}
+
+/**
+ * Runs the reader and writer on this thread and the workers on numthreads
+ * other threads until the input is exhausted.
+ * @param st          Filter state with _expr set.
+ * @param numthreads  Number of worker threads.
+ * @param fd          Input file descriptor, used if map is NULL.
+ * @param map         Input mapped in memory, or NULL to stream from fd.
+ * @param mapsz       Size of the mapping.
+ * @return the exit status of the program.
+ */
+int filter_run_all(filter_state* st, int numthreads, int fd, char* map,
+		size_t mapsz)
+{
+	pthread_t* threads;
+	filter_chunk* chunk;
+	char* pos, *end, *carry;
+	size_t carrylen, carrycap;
+	long written, malformed, errors;
+	int i, numthreads_ok, more, status;
+
+	status = 0;
+	malformed = errors = written = 0;
+	more = 1;
+	pos = map, end = map + mapsz;
+	carry = NULL, carrylen = carrycap = 0;
+
+	st->_numchunks = FILTER_SLOTS_PER_THREAD * numthreads;
+	st->_chunks = calloc(st->_numchunks, sizeof(filter_chunk));
+	threads = malloc(numthreads * sizeof(pthread_t));
+	if(st->_chunks == NULL || threads == NULL) {
+		free(st->_chunks); free(threads);
+		fputs("pbg-filter: out of memory\n", stderr);
+		return 2;
+	}
+	st->_filled = st->_taken = 0;
+	st->_eof = 0;
+	pthread_mutex_init(&st->_lock, NULL);
+	pthread_cond_init(&st->_work, NULL);
+	pthread_cond_init(&st->_done, NULL);
+
+	/* Start the workers. */
+	for(numthreads_ok = 0; numthreads_ok < numthreads; numthreads_ok++)
+		if(pthread_create(threads+numthreads_ok, NULL, filter_worker_main, st))
+			break;
+	if(numthreads_ok == 0) {
+		fputs("pbg-filter: failed to start worker threads\n", stderr);
+		status = more = 0;
+	}
+
+	while(more || written != st->_filled) {
+		/* Fill a free chunk, if any, and hand it to the workers. */
+		if(more && st->_filled - written < st->_numchunks) {
+			chunk = st->_chunks + st->_filled % st->_numchunks;
+			more = (map != NULL) ? filter_fill_mapped(chunk, &pos, end) :
+					filter_fill_stream(chunk, fd, &carry, &carrylen, &carrycap);
+			if(more < 0) {
+				fputs("pbg-filter: failed to read input\n", stderr);
+				status = 2, more = 0;
+			}else if(chunk->_len != 0) {
+				pthread_mutex_lock(&st->_lock);
+				chunk->_state = FILTER_FILLED;
+				st->_filled++;
+				pthread_cond_signal(&st->_work);
+				pthread_mutex_unlock(&st->_lock);
+			}
+			continue;
+		}
+		/* Otherwise, write out the oldest chunk once it is done. */
+		chunk = st->_chunks + written % st->_numchunks;
+		pthread_mutex_lock(&st->_lock);
+		while(chunk->_state != FILTER_DONE)
+			pthread_cond_wait(&st->_done, &st->_lock);
+		pthread_mutex_unlock(&st->_lock);
+		if(status == 0 && filter_write(chunk, stdout) != 0) {
+			perror("pbg-filter");
+			status = 2;
+		}
+		malformed += chunk->_malformed;
+		errors += chunk->_errors;
+		chunk->_state = FILTER_FREE;
+		written++;
+	}
+
+	/* Stop the workers. */
+	pthread_mutex_lock(&st->_lock);
+	st->_eof = 1;
+	pthread_cond_broadcast(&st->_work);
+	pthread_mutex_unlock(&st->_lock);
+	for(i = 0; i < numthreads_ok; i++)
+		pthread_join(threads[i], NULL);
+	if(fflush(stdout) != 0 && status == 0) {
+		perror("pbg-filter");
+		status = 2;
+	}
+	if(malformed != 0)
+		fprintf(stderr, "pbg-filter: %ld lines were malformed\n", malformed);
+	if(errors != 0)
+		fprintf(stderr, "pbg-filter: %ld lines could not be evaluated\n", 
+				errors);
+
+	/* Clean up. */
+	for(i = 0; i < st->_numchunks; i++) {
+		free(st->_chunks[i]._own);
+		free(st->_chunks[i]._runs);
+	}
+	pthread_mutex_destroy(&st->_lock);
+	pthread_cond_destroy(&st->_work);
+	pthread_cond_destroy(&st->_done);
+	free(st->_chunks);
+	free(threads);
+	free(carry);
+	return status;
+}
+
+/**
+ * Reads the first line of the input as a CSV header.
+ * @param fd     Input file descriptor, read from if map is NULL.
+ * @param map    Input mapped in memory, or NULL. Advanced past the header.
+ * @param mapsz  Size of the mapping. Reduced by the size of the header.
+ * @param len    Set to the length of the header, excluding its newline.
+ * @return the header, which is allocated if read from fd, or NULL if an 
+ *         error occurred.
+ */
+char* filter_read_header(int fd, char** map, size_t* mapsz, int* len)
+{
+	char* header, *nl;
+	size_t cap;
+	if(*map != NULL) {
+		header = *map;
+		nl = memchr(header, '\n', *mapsz);
+		*len = (nl == NULL) ? (int) *mapsz : nl - header;
+		*map += (nl == NULL) ? *mapsz : (size_t)(nl+1 - header);
+		*mapsz -= *map - header;
+		return header;
+	}
+	/* Read a byte at a time so as not to read past the header. */
+	cap = 256;
+	header = malloc(cap);
+	*len = 0;
+	while(header != NULL) {
+		if(read(fd, header + *len, 1) != 1 || header[*len] == '\n')
+			return header;
+		if((size_t) ++*len == cap) {
+			nl = realloc(header, cap *= 2);
+			if(nl == NULL) free(header);
+			header = nl;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Points the chunk at the next FILTER_CHUNK or so bytes of mapped input,
+ * extended to the end of the line.
+ * @param chunk  Chunk to fill.
+ * @param pos    Start of the remaining input. Advanced past the chunk.
+ * @param end    End of the input.
+ * @return 1 if there is more input, 0 otherwise.
+ */
+int filter_fill_mapped(filter_chunk* chunk, char** pos, char* end)
+{
+	char* stop, *nl;
+	stop = (end - *pos > FILTER_CHUNK) ? *pos + FILTER_CHUNK : end;
+	if(stop != end) {
+		nl = memchr(stop, '\n', end - stop);
+		stop = (nl == NULL) ? end : nl+1;
+	}
+	chunk->_buf = *pos;
+	chunk->_len = stop - *pos;
+	*pos = stop;
+	return *pos != end;
+}
+
+/**
+ * Reads the next FILTER_CHUNK or so bytes of streamed input into the chunk's
+ * own buffer. The chunk always ends at the end of a line; the partial line
+ * following it is kept in the carry buffer for the next chunk.
+ * @param chunk     Chunk to fill.
+ * @param fd        Input file descriptor.
+ * @param carry     Partial line left over from the previous chunk.
+ * @param carrylen  Length of the partial line.
+ * @param carrycap  Capacity of the carry buffer.
+ * @return 1 if there is more input, 0 at the end of the input, and -1 if an
+ *         error occurred.
+ */
+int filter_fill_stream(filter_chunk* chunk, int fd, char** carry,
+		size_t* carrylen, size_t* carrycap)
+{
+	char* buf, *nl;
+	size_t len, tail;
+	ssize_t got;
+	int eof;
+
+	/* Ensure the buffer can hold the carry plus a full chunk. */
+	if(chunk->_owncap < *carrylen + FILTER_CHUNK) {
+		buf = realloc(chunk->_own, *carrylen + FILTER_CHUNK);
+		if(buf == NULL) return -1;
+		chunk->_own = buf;
+		chunk->_owncap = *carrylen + FILTER_CHUNK;
+	}
+	buf = chunk->_own;
+	if(*carrylen != 0) memcpy(buf, *carry, *carrylen);
+	len = *carrylen;
+
+	/* Read until the buffer is full and holds a newline, or until EOF. */
+	eof = 0;
+	for(;;) {
+		if(len == chunk->_owncap) {
+			if(memchr(buf + *carrylen, '\n', len - *carrylen) != NULL) break;
+			/* A line longer than the buffer. Grow it. */
+			buf = realloc(chunk->_own, 2*chunk->_owncap);
+			if(buf == NULL) return -1;
+			chunk->_own = buf;
+			chunk->_owncap *= 2;
+		}
+		got = read(fd, buf + len, chunk->_owncap - len);
+		if(got < 0) return -1;
+		if(got == 0) { eof = 1; break; }
+		len += got;
+	}
+
+	/* Keep the trailing partial line for the next chunk. */
+	tail = 0;
+	if(!eof) {
+		for(nl = buf + len - 1; *nl != '\n'; nl--) tail++;
+		if(*carrycap < tail) {
+			nl = realloc(*carry, tail);
+			if(nl == NULL) return -1;
+			*carry = nl;
+			*carrycap = tail;
+		}
+		memcpy(*carry, buf + len - tail, tail);
+	}
+	*carrylen = tail;
+	chunk->_buf = buf;
+	chunk->_len = len - tail;
+	return !eof;
+}
+
+/**
+ * Writes the matching lines of the chunk.
+ * @param chunk  Chunk to write.
+ * @param out    Output stream.
+ * @return 0 if successful, -1 otherwise.
+ */
+int filter_write(filter_chunk* chunk, FILE* out)
+{
+	int i;
+	for(i = 0; i < chunk->_numruns; i++)
+		if(fwrite(chunk->_runs[i]._start, 1, chunk->_runs[i]._len, out) !=
+				chunk->_runs[i]._len)
+			return -1;
+	return 0;
+}
+
+
+/***********
+ *         *
+ * WORKERS *
+ *         *
+ ***********/
+
+/**
+ * Entry point of each worker thread. Processes filled chunks until the filter
+ * state signals there are no more.
+ * @param arg  Shared filter_state.
+ * @return NULL.
+ */
+void* filter_worker_main(void* arg)
+{
+	filter_state* st;
+	filter_chunk* chunk;
+	filter_worker w;
+	int ok;
+	st = (filter_state*) arg;
+	ok = filter_worker_init(&w, st);
+	for(;;) {
+		pthread_mutex_lock(&st->_lock);
+		while(st->_taken == st->_filled && !st->_eof)
+			pthread_cond_wait(&st->_work, &st->_lock);
+		if(st->_taken == st->_filled) {
+			pthread_mutex_unlock(&st->_lock);
+			break;
+		}
+		chunk = st->_chunks + st->_taken++ % st->_numchunks;
+		pthread_mutex_unlock(&st->_lock);
+
+		chunk->_numruns = 0;
+		chunk->_malformed = chunk->_errors = 0;
+		if(ok)
+			filter_chunk_process(&w, chunk);
+		else
+			chunk->_errors = 1;
+
+		pthread_mutex_lock(&st->_lock);
+		chunk->_state = FILTER_DONE;
+		pthread_cond_broadcast(&st->_done);
+		pthread_mutex_unlock(&st->_lock);
+	}
+	filter_worker_free(&w);
+	return NULL;
+}
+
+/**
+ * Allocates the per-thread storage used to bind variables.
+ * @param w   Worker to initialize.
+ * @param st  Shared filter state.
+ * @return 1 if successful, 0 otherwise.
+ */
+int filter_worker_init(filter_worker* w, filter_state* st)
+{
+	pbg_error err;
+	pbg_expr* e;
+	int numvars;
+	e = st->_expr;
+	numvars = pbg_numvars(e);
+	w->_expr = e;
+	w->_iscsv = (st->_header != NULL);
+	if(w->_iscsv) {
+		pbg_csv_bind(&w->_csv, &err, e, st->_header, st->_headerlen,
+				st->_delim);
+		if(pbg_iserror(&err)) {
+			pbg_error_free(&err);
+			w->_iscsv = 0;
+			return 0;
+		}
+	}
+	w->_vars = malloc((numvars+1) * sizeof(pbg_field));
+	w->_numbers = malloc((numvars+1) * sizeof(pbg_lt_number));
+	w->_dates = malloc((numvars+1) * sizeof(pbg_lt_date));
+	w->_scratch = NULL;
+	w->_scrcap = w->_scrused = 0;
+	return w->_vars != NULL && w->_numbers != NULL && w->_dates != NULL;
+}
+
+/**
+ * Frees the per-thread storage of the worker.
+ * @param w  Worker to clean up.
+ */
+void filter_worker_free(filter_worker* w)
+{
+	free(w->_vars);
+	free(w->_numbers);
+	free(w->_dates);
+	free(w->_scratch);
+	if(w->_iscsv) pbg_csv_free(&w->_csv);
+}
+
+/**
+ * Evaluates every line of the chunk, recording runs of matching lines.
+ * @param w      Worker evaluating the chunk.
+ * @param chunk  Chunk to process.
+ */
+void filter_chunk_process(filter_worker* w, filter_chunk* chunk)
+{
+	char* p, *end, *nl, *next;
+	int result;
+	p = chunk->_buf;
+	end = p + chunk->_len;
+	while(p < end) {
+		nl = memchr(p, '\n', end - p);
+		next = (nl == NULL) ? end : nl+1;
+		result = w->_iscsv ? filter_line_csv(w, p, (nl == NULL) ? end : nl) :
+				filter_line(w, p, (nl == NULL) ? end : nl);
+		if(result == PBG_TRUE) {
+			if(!filter_chunk_addrun(chunk, p, next - p))
+				chunk->_errors++;
+		}else if(result == FILTER_MALFORMED)
+			chunk->_malformed++;
+		else if(result == PBG_ERROR)
+			chunk->_errors++;
+		p = next;
+	}
+}
+
+/**
+ * Adds a matching line to the chunk, extending the last run if the line
+ * immediately follows it.
+ * @param chunk  Chunk the line belongs to.
+ * @param start  Start of the line.
+ * @param len    Length of the line, including its newline.
+ * @return 1 if successful, 0 if an allocation failed.
+ */
+int filter_chunk_addrun(filter_chunk* chunk, char* start, size_t len)
+{
+	filter_run* runs, *last;
+	if(chunk->_numruns != 0) {
+		last = chunk->_runs + chunk->_numruns-1;
+		if(last->_start + last->_len == start) {
+			last->_len += len;
+			return 1;
+		}
+	}
+	if(chunk->_numruns == chunk->_caprun) {
+		runs = realloc(chunk->_runs,
+				(chunk->_caprun ? 2*chunk->_caprun : 64) * sizeof(filter_run));
+		if(runs == NULL) return 0;
+		chunk->_runs = runs;
+		chunk->_caprun = chunk->_caprun ? 2*chunk->_caprun : 64;
+	}
+	chunk->_runs[chunk->_numruns]._start = start;
+	chunk->_runs[chunk->_numruns]._len = len;
+	chunk->_numruns++;
+	return 1;
+}
+
+/**
+ * Binds the top-level keys of the JSON object on the line to the variables of
+ * the expression and evaluates it.
+ * @param w    Worker evaluating the line.
+ * @param p    Start of the line.
+ * @param end  End of the line, excluding the newline.
+ * @return PBG_TRUE or PBG_FALSE, PBG_ERROR if the evaluation failed, 
+ *         FILTER_MALFORMED if the line is not a JSON object, and PBG_FALSE 
+ *         for blank lines.
+ */
+int filter_line(filter_worker* w, char* p, char* end)
+{
+	pbg_error err;
+	char* key, *value, *name;
+	size_t keylen;
+	int i, numvars, namelen, escaped, result;
+	char* scratch;
+
+	p = json_skip_ws(p, end);
+	if(p == end) return PBG_FALSE;
+	if(*p != '{') return FILTER_MALFORMED;
+
+	/* Unescaped strings never outgrow the line. The first half of the scratch
+	 * buffer holds the current key, the second half holds STRING fields. */
+	if(w->_scrcap < 2*(size_t)(end - p)) {
+		scratch = realloc(w->_scratch, 2*(end - p));
+		if(scratch == NULL) return PBG_ERROR;
+		w->_scratch = scratch;
+		w->_scrcap = 2*(end - p);
+	}
+	scratch = w->_scratch;
+	w->_scrused = w->_scrcap/2;
+
+	/* Every variable is NULL unless the object defines it. */
+	numvars = pbg_numvars(w->_expr);
+	for(i = 0; i < numvars; i++)
+		w->_vars[i] = pbg_make_null();
+
+	p = json_skip_ws(p+1, end);
+	if(p != end && *p == '}') p = end;  /* Empty object. */
+	while(p != end) {
+		/* Scan the key. */
+		if(*p != '"') return FILTER_MALFORMED;
+		key = p+1;
+		p = json_scan_string(p, end, &escaped);
+		if(p == NULL) return FILTER_MALFORMED;
+		keylen = p-1 - key;
+		if(escaped) {
+			keylen = json_unescape(scratch, key, keylen);
+			key = scratch;
+		}
+		p = json_skip_ws(p, end);
+		if(p == end || *p != ':') return FILTER_MALFORMED;
+		value = json_skip_ws(p+1, end);
+		p = json_skip_value(value, end);
+		if(p == NULL) return FILTER_MALFORMED;
+
+		/* Bind the value if the key names a variable. */
+		for(i = 0; i < numvars; i++) {
+			name = pbg_var_name(w->_expr, i, &namelen);
+			if((size_t) namelen == keylen && memcmp(name, key, keylen) == 0) {
+				if(!json_bind(w, i, value, p)) return FILTER_MALFORMED;
+				break;
+			}
+		}
+
+		/* Move on to the next key. */
+		p = json_skip_ws(p, end);
+		if(p == end) return FILTER_MALFORMED;
+		if(*p == '}') break;
+		if(*p != ',') return FILTER_MALFORMED;
+		p = json_skip_ws(p+1, end);
+	}
+
+	result = pbg_evaluate_vars(w->_expr, &err, w->_vars);
+	pbg_error_free(&err);
+	return result;
+}
+
+
+/**
+ * Evaluates the CSV record on the line.
+ * @param w    Worker evaluating the line.
+ * @param p    Start of the line.
+ * @param end  End of the line, excluding the newline.
+ * @return PBG_TRUE or PBG_FALSE, PBG_ERROR if the evaluation failed, and 
+ *         PBG_FALSE for empty lines.
+ */
+int filter_line_csv(filter_worker* w, char* p, char* end)
+{
+	pbg_error err;
+	int result;
+	if(end != p && end[-1] == '\r') end--;
+	if(end == p) return PBG_FALSE;
+	result = pbg_csv_evaluate(&w->_csv, &err, p, end - p);
+	pbg_error_free(&err);
+	return result;
+}
+
+
+/*****************
+ *               *
+ * JSON SCANNING *
+ *               *
+ *****************/
+
+/**
+ * Skips JSON whitespace.
+ * @return the first non-whitespace character, or end.
+ */
+char* json_skip_ws(char* p, char* end)
+{
+	while(p != end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+		p++;
+	return p;
+}
+
+/**
+ * Scans the JSON string starting at the opening quote p.
+ * @param escaped  Set to 1 if the string contains escape sequences.
+ * @return the character following the closing quote, or NULL if unclosed.
+ */
+char* json_scan_string(char* p, char* end, int* escaped)
+{
+	*escaped = 0;
+	for(p++; p != end; p++) {
+		if(*p == '"') return p+1;
+		if(*p == '\\') {
+			*escaped = 1;
+			if(++p == end) return NULL;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Scans a scalar that isn't a string (a number, true, false, or null).
+ * @return the character following the scalar.
+ */
+char* json_scan_scalar(char* p, char* end)
+{
+	while(p != end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' &&
+			*p != '\t' && *p != '\r' && *p != '\n')
+		p++;
+	return p;
+}
+
+/**
+ * Skips the JSON value starting at p, including nested objects and arrays.
+ * @return the character following the value, or NULL if malformed.
+ */
+char* json_skip_value(char* p, char* end)
+{
+	int depth, escaped;
+	if(p == end) return NULL;
+	if(*p == '"') return json_scan_string(p, end, &escaped);
+	if(*p != '{' && *p != '[')
+		return (json_scan_scalar(p, end) == p) ? NULL : json_scan_scalar(p, end);
+	depth = 0;
+	while(p != end) {
+		if(*p == '"') {
+			p = json_scan_string(p, end, &escaped);
+			if(p == NULL) return NULL;
+			continue;
+		}
+		if(*p == '{' || *p == '[') depth++;
+		if(*p == '}' || *p == ']')
+			if(--depth == 0) return p+1;
+		p++;
+	}
+	return NULL;
+}
+
+/**
+ * Unescapes the contents of a JSON string, encoding \u escapes as UTF-8.
+ * The result is never longer than the source.
+ * @param dst  Destination buffer.
+ * @param src  Contents of the string, without quotes.
+ * @param n    Length of src.
+ * @return the length of the unescaped string.
+ */
+size_t json_unescape(char* dst, char* src, size_t n)
+{
+	size_t i, j;
+	unsigned long cp, lo;
+	for(i = j = 0; i < n; i++) {
+		if(src[i] != '\\' || i+1 == n) { dst[j++] = src[i]; continue; }
+		switch(src[++i]) {
+			case 'b': dst[j++] = '\b'; break;
+			case 'f': dst[j++] = '\f'; break;
+			case 'n': dst[j++] = '\n'; break;
+			case 'r': dst[j++] = '\r'; break;
+			case 't': dst[j++] = '\t'; break;
+			case 'u':
+				if(i+4 >= n) break;
+				cp = json_hex4(src+i+1);
+				i += 4;
+				/* Combine surrogate pairs. */
+				if(cp >= 0xD800 && cp < 0xDC00 && i+6 < n &&
+						src[i+1] == '\\' && src[i+2] == 'u') {
+					lo = json_hex4(src+i+3);
+					if(lo >= 0xDC00 && lo < 0xE000) {
+						cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+						i += 6;
+					}
+				}
+				if(cp < 0x80) dst[j++] = (char) cp;
+				else if(cp < 0x800) {
+					dst[j++] = (char)(0xC0 | (cp >> 6));
+					dst[j++] = (char)(0x80 | (cp & 0x3F));
+				}else if(cp < 0x10000) {
+					dst[j++] = (char)(0xE0 | (cp >> 12));
+					dst[j++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+					dst[j++] = (char)(0x80 | (cp & 0x3F));
+				}else{
+					dst[j++] = (char)(0xF0 | (cp >> 18));
+					dst[j++] = (char)(0x80 | ((cp >> 12) & 0x3F));
+					dst[j++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+					dst[j++] = (char)(0x80 | (cp & 0x3F));
+				}
+				break;
+			default: dst[j++] = src[i]; break;  /* \" \\ \/ */
+		}
+	}
+	return j;
+}
+
+/**
+ * Decodes the four hexadecimal digits of a \\u escape.
+ * @return the code unit, with invalid digits read as 0.
+ */
+unsigned long json_hex4(char* s)
+{
+	unsigned long cp;
+	int k;
+	cp = 0;
+	for(k = 0; k < 4; k++) {
+		cp <<= 4;
+		if(s[k] >= '0' && s[k] <= '9') cp |= s[k] - '0';
+		else if(s[k] >= 'a' && s[k] <= 'f') cp |= s[k] - 'a' + 10;
+		else if(s[k] >= 'A' && s[k] <= 'F') cp |= s[k] - 'A' + 10;
+	}
+	return cp;
+}
+
+/**
+ * Checks if the string has the form YYYY-MM-DD of a pbg DATE.
+ */
+int json_isdate(char* s, size_t n)
+{
+	return n == 10 &&
+		s[0] >= '0' && s[0] <= '9' && s[1] >= '0' && s[1] <= '9' &&
+		s[2] >= '0' && s[2] <= '9' && s[3] >= '0' && s[3] <= '9' &&
+		s[4] == '-' && s[5] >= '0' && s[5] <= '9' && s[6] >= '0' &&
+		s[6] <= '9' && s[7] == '-' && s[8] >= '0' && s[8] <= '9' &&
+		s[9] >= '0' && s[9] <= '9';
+}
+
+/**
+ * Binds the JSON value to the given variable of the worker's expression.
+ * @param w    Worker evaluating the line.
+ * @param var  Index of the variable.
+ * @param p    Start of the value.
+ * @param end  End of the value.
+ * @return 1 if successful, 0 if the value is malformed.
+ */
+int json_bind(filter_worker* w, int var, char* p, char* end)
+{
+	char* dst;
+	size_t n;
+	int escaped;
+	double value;
+	n = end - p;
+	if(*p == '"') {
+		json_scan_string(p, end, &escaped);
+		p++, n -= 2;
+		/* Escaped strings are unescaped into the scratch buffer. */
+		if(escaped) {
+			dst = w->_scratch + w->_scrused;
+			n = json_unescape(dst, p, n);
+			w->_scrused += n;
+			p = dst;
+		}
+		if(json_isdate(p, n))
+			w->_vars[var] = pbg_init_date(w->_dates+var,
+					(p[0]-'0')*1000 + (p[1]-'0')*100 + (p[2]-'0')*10 + (p[3]-'0'),
+					(p[5]-'0')*10 + (p[6]-'0'), (p[8]-'0')*10 + (p[9]-'0'));
+		else if(n <= INT_MAX)
+			w->_vars[var] = pbg_init_string(p, (int) n);
+		else
+			w->_vars[var] = pbg_make_null();
+	}else if(n == 4 && memcmp(p, "true", 4) == 0)
+		w->_vars[var] = pbg_make_bool(1);
+	else if(n == 5 && memcmp(p, "false", 5) == 0)
+		w->_vars[var] = pbg_make_bool(0);
+	else if(n == 4 && memcmp(p, "null", 4) == 0)
+		w->_vars[var] = pbg_make_null();
+	else if(*p == '{' || *p == '[')
+		w->_vars[var] = pbg_make_null();
+	else if(pbg_read_number(p, n, &value))
+		w->_vars[var] = pbg_init_number(w->_numbers+var, value);
+	else
+		return 0;
+	return 1;
+}
@@ -0,0 +1,89 @@
+#include "../pbg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************************************************
+ *                                                       *
+ * pbgc: compiles a pbg expression to C89 source, see    *
+ * pbg_compile                                           *
+ *                                                       *
+ *********************************************************/
+
+#define PBGC_USAGE \
+	"usage: pbgc NAME EXPR\n" \
+	"Writes C source defining NAME and NAME_dict, which evaluate EXPR as\n" \
+	"pbg_evaluate_vars and pbg_evaluate do. The source includes pbg.h and\n" \
+	"does not need pbg.c to be linked.\n"
+
+
+/****************************
+ *                          *
+ * LOCAL FUNCTION DIRECTORY *
+ *                          *
+ ****************************/
+
+int pbgc_usage(void);
+int pbgc_isname(char* name);
+
+
+/********
+ *      *
+ * MAIN *
+ *      *
+ ********/
+
+int main(int argc, char** argv)
+{
+	pbg_error err;
+	pbg_expr e;
+	char* buf;
+	size_t len;
+
+	if(argc != 3 || !pbgc_isname(argv[1]))
+		return pbgc_usage();
+
+	/* Parse the expression. */
+	pbg_parse(&e, &err, argv[2]);
+	if(pbg_iserror(&err)) {
+		pbg_error_print(&err);
+		pbg_error_free(&err);
+		return 2;
+	}
+
+	/* Measure the source, then write it. */
+	len = pbg_compile(&e, argv[1], NULL, 0);
+	buf = (len == 0) ? NULL : malloc(len+1);
+	if(buf == NULL) {
+		fputs("pbgc: out of memory\n", stderr);
+		pbg_free(&e);
+		return 2;
+	}
+	pbg_compile(&e, argv[1], buf, len+1);
+	fwrite(buf, 1, len, stdout);
+	free(buf);
+	pbg_free(&e);
+	return 0;
+}
+
+int pbgc_usage(void)
+{
+	fputs(PBGC_USAGE, stderr);
+	return 2;
+}
+
+/**
+ * Checks that a name is a C identifier, so the source compiles.
+ * @param name  Name of the generated function.
+ * @return 1 if name is an identifier, 0 otherwise.
+ */
+int pbgc_isname(char* name)
+{
+	int i;
+	for(i = 0; name[i] != '\0'; i++)
+		if(!(name[i] == '_' || (name[i] >= 'a' && name[i] <= 'z') ||
+				(name[i] >= 'A' && name[i] <= 'Z') ||
+				(i > 0 && name[i] >= '0' && name[i] <= '9')))
+			return 0;
+	return i > 0;
+}